@@ -62,9 +62,11 @@ DisplayBackend *g_displayBackend = nullptr;
 
 // SettingsStore module
 #include "src/SettingsStore/SettingsStore.h"
+#include "src/SettingsSchema/SettingsSchema.h"
 
 // PriceData module (Fase 4.2.1: voor DataSource enum)
 #include "src/PriceData/PriceData.h"
+#include "src/PriceData/PriceSampler.h"
 
 // TrendDetector module (Fase 5.1: voor TrendState enum en trend detection)
 #include "src/TrendDetector/TrendDetector.h"
@@ -76,9 +78,24 @@ DisplayBackend *g_displayBackend = nullptr;
 #include "src/AlertEngine/AlertEngine.h"
 #include "src/RegimeEngine/RegimeEngine.h"
 
+// AnalyticsSnapshot module: één afgeleide-waarden-snapshot per prijs-tick (lock-free lezers)
+#include "src/AnalyticsSnapshot/AnalyticsSnapshot.h"
+
+// MqttTelemetry module: compacte binaire values-frames (MQTT_TELEMETRY_BINARY)
+#include "src/MqttTelemetry/MqttTelemetry.h"
+
+// MqttQueue module: uitgaande MQTT-queue met prioriteitslanes (PSRAM-backed)
+#include "src/MqttQueue/MqttQueue.h"
+
+// MqttDiscovery module: incrementele Home Assistant discovery (tabel + content hashing)
+#include "src/MqttDiscovery/MqttDiscovery.h"
+
 // Memory module (M1: heap telemetry voor geheugenfragmentatie audit)
 #include "src/Memory/HeapMon.h"
 
+// Trace module: hot-path tracepoints (cycle-count spans, GET /metrics)
+#include "src/Trace/Trace.h"
+
 // Forward declaration needed for Arduino auto-prototypes.
 // (Arduino preprocessor may generate function prototypes before the struct body below.)
 struct NtfyPendingItem;
@@ -91,6 +108,9 @@ struct NtfyPendingItem;
 
 // UIController module (Fase 8: UI Module refactoring)
 #include "src/UIController/UIController.h"
+#include "src/ChartHistory/ChartHistory.h"
+#include "src/UiCommand/UiCommand.h"
+#include "src/TaskTopology/TaskTopology.h"
 #include "src/PriceFormat/QuotePriceFormat.h"
 
 // ArduinoJson support (optioneel - als library niet beschikbaar is, gebruik handmatige parsing)
@@ -165,7 +185,7 @@ struct NtfyPendingItem;
 #endif
 
 // --- API Configuration ---
-#define BITVAVO_API_BASE "https://api.bitvavo.com/v2"  // Bitvavo API base URL
+#define BITVAVO_API_BASE CRYPTO_ALERT_FEED_API_BASE  // Bitvavo API base URL (platform_config.h)
 #define BITVAVO_SYMBOL_DEFAULT "BTC-EUR"  // Default Bitvavo symbol (format: BASE-QUOTE met streepje)
 // T1: Verhoogde connect/read timeouts voor betere stabiliteit
 #define HTTP_CONNECT_TIMEOUT_MS 2000  // Connect timeout (2000ms - geoptimaliseerd)
@@ -181,6 +201,12 @@ struct NtfyPendingItem;
 #define UPDATE_API_INTERVAL 4000   // API poll in ms (afgestemd op typische HTTPS-duur; connect/read timeouts ongewijzigd)
 // 1 Hz sampler voor korte horizons (secondPrices / fiveMinutePrices); los van API-poll
 #define PRICE_SAMPLE_INTERVAL_MS 1000
+// Wake-periode webTask / inline web-slices in priceRepeatTask
+#ifndef WEB_TASK_WAKE_MS
+#define WEB_TASK_WAKE_MS 200
+#endif
+// Task-CPU/sampler-diagnose naar MQTT (<prefix>/diag/tasks, <prefix>/diag/sampler)
+#define TASK_STATS_MQTT_INTERVAL_MS 60000UL
 #define UPDATE_WEB_INTERVAL 5000  // Web interface update in ms (elke 5 seconden)
 #define RECONNECT_INTERVAL 60000  // WiFi reconnect interval (60 seconden tussen reconnect pogingen)
 #define MQTT_RECONNECT_INTERVAL 5000  // MQTT reconnect interval (5 seconden)
@@ -298,6 +324,16 @@ struct NtfyPendingItem;
 #define MQTT_PASS_DEFAULT "mqtt_password"  // Standaard MQTT wachtwoord (pas aan)
 #define MQTT_VALUES_PUBLISH_INTERVAL_MS 30000UL
 #define MQTT_IP_PUBLISH_INTERVAL_MS 600000UL
+// Compacte binaire telemetrie (zie src/MqttTelemetry/MqttTelemetry.h voor frame-layout):
+// 1 = één <prefix>/values/frame per interval (delta t.o.v. vorig frame) i.p.v. losse tekst-topics per waarde.
+// Let op: HA-discovery sensoren op values/* krijgen dan geen updates meer (alleen voor eigen consumers).
+#ifndef MQTT_TELEMETRY_BINARY
+#define MQTT_TELEMETRY_BINARY 0
+#endif
+// Elke N delta-frames een volledig keyframe (resync voor nieuwe subscribers / gemiste frames)
+#ifndef MQTT_TELEMETRY_KEYFRAME_INTERVAL
+#define MQTT_TELEMETRY_KEYFRAME_INTERVAL 20
+#endif
 
 // --- Language Configuration ---
 #ifndef DEFAULT_LANGUAGE
@@ -382,7 +418,6 @@ float anchorMax = 0.0f;  // Hoogste prijs sinds anchor
 float anchorMin = 0.0f;  // Laagste prijs sinds anchor
 unsigned long anchorTime = 0;
 bool anchorActive = false;
-static bool anchorNotificationPending = false;  // Flag voor pending anchor set notificatie (alleen UI)
 float anchorTakeProfit = ANCHOR_TAKE_PROFIT_DEFAULT;  // Take profit threshold (%)
 float anchorMaxLoss = ANCHOR_MAX_LOSS_DEFAULT;        // Max loss threshold (%)
 uint8_t anchorStrategy = 0;  // 0 = handmatig, 1 = conservatief (TP +1.8%, SL -1.2%), 2 = actief (TP +1.2%, SL -0.9%)
@@ -473,9 +508,6 @@ float trendThreshold = TREND_THRESHOLD_DEFAULT;  // Trend threshold (%)
 // Fase 5.3.17: Globale variabelen voor backward compatibility - modules zijn source of truth
 // Deze variabelen worden gesynchroniseerd met VolatilityTracker module na elke update
 // TODO: In toekomstige fase kunnen deze verwijderd worden zodra alle code volledig gemigreerd is
-float abs1mReturns[VOLATILITY_LOOKBACK_MINUTES];  // Array voor absolute 1m returns
-uint8_t volatilityIndex = 0;  // Index voor circulaire buffer
-bool volatilityArrayFilled = false;  // Flag om aan te geven of array gevuld is
 VolatilityState volatilityState = VOLATILITY_MEDIUM;  // Current volatility state (backward compatibility)
 float volatilityLowThreshold = VOLATILITY_LOW_THRESHOLD_DEFAULT;  // Low threshold (%)
 float volatilityHighThreshold = VOLATILITY_HIGH_THRESHOLD_DEFAULT;  // High threshold (%)
@@ -545,10 +577,6 @@ uint8_t autoVolatilityWindowMinutes = AUTO_VOLATILITY_WINDOW_MINUTES_DEFAULT;
 float autoVolatilityBaseline1mStdPct = AUTO_VOLATILITY_BASELINE_1M_STD_PCT_DEFAULT;
 float autoVolatilityMinMultiplier = AUTO_VOLATILITY_MIN_MULTIPLIER_DEFAULT;
 float autoVolatilityMaxMultiplier = AUTO_VOLATILITY_MAX_MULTIPLIER_DEFAULT;
-// Fase 5.2: static verwijderd zodat VolatilityTracker module deze variabelen kan gebruiken
-float volatility1mReturns[MAX_VOLATILITY_WINDOW_SIZE];  // Sliding window voor 1m returns
-uint8_t volatility1mIndex = 0;  // Index voor circulaire buffer
-bool volatility1mArrayFilled = false;  // Flag om aan te geven of array gevuld is
 // Fase 5.2: static verwijderd zodat VolatilityTracker module deze variabele kan gebruiken
 float currentVolFactor = 1.0f;  // Huidige volatility factor
 static unsigned long lastVolatilityLog = 0;  // Timestamp van laatste volatility log (voor debug)
@@ -659,9 +687,21 @@ static unsigned long wsLiveSinceMs = 0;
 static bool wsLiveNtfyTestSent = true;
 static const unsigned long WS_LIVE_NTFY_HEALTH_PING_DELAY_MS = 15000UL;
 
-static const char* WS_HOST = "ws.bitvavo.com";
-static const uint16_t WS_PORT = 443;
-static const char* WS_PATH = "/v2/";
+static const char* WS_HOST = CRYPTO_ALERT_FEED_WS_HOST;
+static const uint16_t WS_PORT = CRYPTO_ALERT_FEED_WS_PORT;
+static const char* WS_PATH = CRYPTO_ALERT_FEED_WS_PATH;
+
+#if WS_ENABLED && WS_LIB_AVAILABLE
+// (Re)connect naar de feed; plain ws:// alleen voor LAN-replay (CRYPTO_ALERT_FEED_WS_TLS 0)
+static void wsBeginFeed(WebSocketsClient *client)
+{
+#if CRYPTO_ALERT_FEED_WS_TLS
+    client->beginSSL(WS_HOST, WS_PORT, WS_PATH);
+#else
+    client->begin(WS_HOST, WS_PORT, WS_PATH);
+#endif
+}
+#endif
 
 // NTFY exclusive network mode (alleen apiTask wisselt modus; loop() respecteert vlag)
 enum NetExclusiveNtfyMode : uint8_t {
@@ -907,14 +947,12 @@ WarmStartStats warmStartStats = {0, 0, 0, 0, false, false, false, false, WS_MODE
 // Fase 9.1.4: static verwijderd zodat WebServerModule deze variabele kan gebruiken
 uint8_t language = DEFAULT_LANGUAGE;  // 0 = Nederlands, 1 = English
 uint8_t displayRotation = 0;  // Display rotatie: 0 = normaal, 2 = 180 graden gedraaid
-volatile bool pendingDisplayRotationApply = false;
-volatile uint8_t pendingDisplayRotationValue = 0;
 volatile bool pendingMqttReconnect = false;
 volatile bool pendingIpPublish = false;
 char pendingIpBuffer[16] = "";
 
 // Forward declarations (moet vroeg in het bestand staan)
-static bool enqueueMqttMessage(const char* topic, const char* payload, bool retained);
+static bool enqueueMqttMessage(MqttTopicClass cls, const char* topic, const char* payload, bool retained);
 void publishMqttAnchorEvent(float anchor_price, const char* event_type);
 void apiTask(void *parameter);
 void uiTask(void *parameter);
@@ -979,6 +1017,7 @@ static const unsigned long CANDLE_REST_CONNECT_BACKOFF_MS = 30000UL;
 char bitvavoSymbol[16] = BITVAVO_SYMBOL_DEFAULT;  // Bitvavo symbool (max 15 karakters, bijv. BTC-EUR, ETH-EUR)
 char chartColorMode[8] = "auto";    // "auto" | "manual" — alleen grafieklijn/punten (WebUI)
 char chartColorManual[16] = "orange"; // orange|purple|yellow|red|cyan|blue|green|white
+uint8_t chartHorizon = CHART_HORIZON_LIVE;  // Grafiek: 0 = live, 1 = 1u, 2 = 24u, 3 = 7d (WebUI)
 
 // Alert thresholds in struct voor betere organisatie
 // Fase 6.1: AlertEngine module gebruikt deze struct (extern declaration in AlertEngine.cpp)
@@ -1168,16 +1207,11 @@ static unsigned long s_netdiag2LastWanTcpOkMs = 0;
 static unsigned long s_bootNetApiGateUntilMs = 0; // 0 = geen actieve gate
 
 // MQTT Message Queue - voorkomt message loss bij disconnect
-#define MQTT_QUEUE_SIZE 8  // Max aantal berichten in queue
-struct MqttMessage {
-    char topic[128];
-    char payload[128];
-    bool retained;
-    bool valid;
-};
-
-static MqttMessage mqttQueue[MQTT_QUEUE_SIZE];
-static uint8_t mqttQueueHead = 0;
+// Lanes/capaciteit in src/MqttQueue (runtime: groot in PSRAM, compact in DRAM).
+// Drain alleen vanuit loop() (zelfde context als mqttClient.loop()), in tijdslices:
+#define MQTT_QUEUE_DRAIN_BUDGET_MS 15   // Max ms per drain-slice (loop() blijft responsief)
+#define MQTT_QUEUE_DRAIN_MAX_MSGS 8     // Max berichten per drain-slice
+#define MQTT_QUEUE_STATS_LOG_INTERVAL_MS 300000UL  // [MQTT Queue] stats-log (alleen bij drops)
 
 // Anchor setting queue - voorkomt crashes door web server thread
 // Thread-safe: geschreven vanuit web server/MQTT, gelezen vanuit uiTask
@@ -1210,10 +1244,6 @@ bool queueAnchorSetting(float value, bool useCurrentPrice) {
     
     return true;
 }
-static uint8_t mqttQueueTail = 0;
-static uint8_t mqttQueueCount = 0;
-static bool mqttDiscoveryPublished = false;
-static unsigned long mqttLastDiscoveryMs = 0;
 static unsigned long mqttLastSettingsPublishMs = 0;
 
 // WiFi reconnect controle
@@ -1468,7 +1498,9 @@ int fetchBitvavoCandles(const char* symbol, const char* interval, uint16_t limit
         if ((millis() - lastWatchdogFeed) >= WATCHDOG_FEED_INTERVAL) {
             yield();
             delay(0);
-            lv_timer_handler();  // Update spinner animatie tijdens warm-start
+            if (uiMayTouchLvgl()) {
+                lv_timer_handler();  // Update spinner animatie tijdens warm-start (niet vanuit apiTask)
+            }
             lastWatchdogFeed = millis();
         }
         
@@ -2428,6 +2460,7 @@ static WarmStartMode performWarmStart()
                 minuteIndex = (uint8_t)seedCount;
                 minuteArrayFilled = (seedCount == MINUTES_FOR_30MIN_CALC);
                 firstMinuteAverage = (seedCount > 0) ? minuteAverages[0] : 0.0f;
+                chartHistoryBarClosed(CHART_SRC_MINUTE);
             } else {
                 for (int m = 0; m < MINUTES_FOR_30MIN_CALC; m++) {
                     minuteAverages[m] = 0.0f;
@@ -3024,6 +3057,7 @@ static bool ntfyHttpsPostNtfyAlertBody(
 
 static bool sendNtfyNotification(const char *title, const char *message, const char *colorTag = nullptr)
 {
+    TRACE_SPAN(TRACE_NTFY_SEND);
     unsigned long nowMs = millis();
     // Reset diagnose-vlag per send-actie (anders kan een eerdere 429 blijven hangen).
     ntfyLastSendAttemptWas429 = false;
@@ -3132,9 +3166,6 @@ static void maybeInitWebSocketAfterWarmStart()
             return;
         }
     }
-    const char* wsHost = "ws.bitvavo.com";
-    const uint16_t wsPort = 443;
-    const char* wsPath = "/v2/";
     wsClientPtr->onEvent([](WStype_t type, uint8_t* payload, size_t length) {
         switch (type) {
             case WStype_CONNECTED:
@@ -3189,10 +3220,11 @@ static void maybeInitWebSocketAfterWarmStart()
         }
     });
     wsClientPtr->setReconnectInterval(5000);
-    Serial.printf("[WS] Connecting to wss://%s%s\n", wsHost, wsPath);
+    Serial.printf("[WS] Connecting to %s://%s:%u%s\n", CRYPTO_ALERT_FEED_WS_TLS ? "wss" : "ws", WS_HOST,
+                  (unsigned)WS_PORT, WS_PATH);
     // Regie: beginSSL kan intern een (her)connect start triggeren.
     netMutexLock("[WS] beginSSL");
-    wsClientPtr->beginSSL(wsHost, wsPort, wsPath);
+    wsBeginFeed(wsClientPtr);
     netMutexUnlock("[WS] beginSSL");
     wsConnecting = true;
     wsConnectStartMs = millis();
@@ -3204,6 +3236,7 @@ static void maybeInitWebSocketAfterWarmStart()
 
 static void processWsTextMessage(const char* wsBuf, size_t length)
 {
+    TRACE_SPAN(TRACE_WS_MESSAGE);
     if (wsBuf == nullptr || length == 0) {
         return;
     }
@@ -3453,6 +3486,7 @@ static void processWsTextMessage(const char* wsBuf, size_t length)
             if (wsSecondAggCurrent.valid) {
                 wsSecondAggLastClosed = wsSecondAggCurrent;
                 wsSecondAggLastClosed.valid = true;
+                priceSamplerRecordWsClose(wsSecondAggLastClosed.secondBucket, wsSecondAggLastClosed.secondClose);
             }
             wsSecondAggCurrent.valid = true;
             wsSecondAggCurrent.secondBucket = currentSecondBucket;
@@ -3597,8 +3631,7 @@ void safeStrncpy(char *dest, const char *src, size_t destSize)
 // Deferred actions from other tasks (thread-safe flags)
 void requestDisplayRotation(uint8_t rotation)
 {
-    pendingDisplayRotationValue = rotation;
-    pendingDisplayRotationApply = true;
+    uiCommandPost(UI_CMD_ROTATE, rotation);
 }
 
 void requestMqttReconnect()
@@ -3606,18 +3639,15 @@ void requestMqttReconnect()
     pendingMqttReconnect = true;
 }
 
-static void applyPendingDisplayRotation()
+// Alleen in uiTask: rotatie via UI_CMD_ROTATE
+static void applyDisplayRotation(uint8_t rotation)
 {
-    if (!pendingDisplayRotationApply) {
-        return;
-    }
-    pendingDisplayRotationApply = false;
     if (g_displayBackend == nullptr) {
         return;
     }
     // Wis scherm voor/na rotatie om residu te voorkomen
     g_displayBackend->fillScreen(0 /* RGB565_BLACK */);
-    g_displayBackend->setRotation(pendingDisplayRotationValue);
+    g_displayBackend->setRotation(rotation);
     g_displayBackend->fillScreen(0 /* RGB565_BLACK */);
 }
 
@@ -4481,7 +4511,7 @@ static void bootWsSelfHealIfStalled(void)
     wsConnecting = false;
     netMutexLock("[SELFHEAL][WSBOOT] beginSSL");
     wsClientPtr->setReconnectInterval(5000);
-    wsClientPtr->beginSSL(WS_HOST, WS_PORT, WS_PATH);
+    wsBeginFeed(wsClientPtr);
     netMutexUnlock("[SELFHEAL][WSBOOT] beginSSL");
     wsConnecting = true;
     wsConnectStartMs = now;
@@ -4555,7 +4585,7 @@ static void restartWebSocketAfterNtfyExclusive(void)
     }
     netMutexLock("[NTFY][EXCL] ws restart beginSSL");
     wsClientPtr->setReconnectInterval(5000);
-    wsClientPtr->beginSSL(WS_HOST, WS_PORT, WS_PATH);
+    wsBeginFeed(wsClientPtr);
     netMutexUnlock("[NTFY][EXCL] ws restart beginSSL");
     wsConnecting = true;
 #endif
@@ -5092,7 +5122,7 @@ static void ntfyDeferredStartupTestIfPending(void)
 // - checkAnchorAlerts() → AnchorSystem
 
 void publishMqttAnchorEvent(float anchor_price, const char* event_type) {
-    if (!mqttConnected) return;
+    // Ook zonder verbinding: event-lane bewaart het bericht tot na reconnect
     
     // Haal lokale tijd op
     struct tm timeinfo;
@@ -5120,13 +5150,8 @@ void publishMqttAnchorEvent(float anchor_price, const char* event_type) {
     getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
     snprintf(topic, sizeof(topic), "%s/anchor/event", mqttPrefix);
     
-    // Try direct publish, queue if failed
-    if (mqttConnected && mqttClient.publish(topic, payload, false)) {
-        Serial_printf(F("[MQTT] Anchor event gepubliceerd: %s (prijs: %s, event: %s)\n"),
-                     timeStr, priceStr, event_type);
-    } else {
-        // Queue message if not connected or publish failed
-        enqueueMqttMessage(topic, payload, false);
+    // Altijd via de event-lane: deze functie draait in apiTask, PubSubClient alleen vanuit loop()
+    if (enqueueMqttMessage(MQTT_CLASS_EVENT, topic, payload, false)) {
         Serial_printf(F("[MQTT] Anchor event in queue: %s (prijs: %s, event: %s)\n"),
                      timeStr, priceStr, event_type);
     }
@@ -5288,12 +5313,9 @@ void getDeviceIdFromTopic(const char* topic, char* buffer, size_t bufferSize) {
 // Settings Management Functions
 // ============================================================================
 
-static void loadSettings()
+// Kopieer settings-struct naar de globale variabelen (backward compatibility)
+static void applySettingsToGlobals(const CryptoMonitorSettings& settings)
 {
-    // Load settings using SettingsStore module
-    CryptoMonitorSettings settings = settingsStore.load();
-    
-    // Copy settings to global variables (backward compatibility)
     safeStrncpy(ntfyTopic, settings.ntfyTopic, sizeof(ntfyTopic));
     safeStrncpy(bitvavoSymbol, settings.bitvavoSymbol, sizeof(bitvavoSymbol));
     // Update symbols array with the loaded bitvavo symbol
@@ -5302,6 +5324,7 @@ static void loadSettings()
     displayRotation = settings.displayRotation;
     safeStrncpy(chartColorMode, settings.chartColorMode, sizeof(chartColorMode));
     safeStrncpy(chartColorManual, settings.chartColorManual, sizeof(chartColorManual));
+    chartHorizon = (settings.chartHorizon < CHART_HORIZON_COUNT) ? settings.chartHorizon : (uint8_t)CHART_HORIZON_LIVE;
 
     // Copy alert thresholds
     alertThresholds = settings.alertThresholds;
@@ -5400,19 +5423,81 @@ static void loadSettings()
     regimeEnergiekAllowStandalone1mBurst = settings.regimeEnergiekAllowStandalone1mBurst;
     regimeEnergiekStandalone1mFactor = settings.regimeEnergiekStandalone1mFactor;
     regimeEnergiekMinDirectionStrength = settings.regimeEnergiekMinDirectionStrength;
+    // Regime-tabel wordt bij de volgende tick uit deze waarden gecompileerd (niet per tick gelezen)
+    regimeEngineConfigChanged();
+}
+
+// Schema-velden → globale variabelen (zelfde namen als in CryptoMonitorSettings). Struct-globals
+// dekken al hun velden; een MQTT /set schrijft zo alleen het ene gewijzigde veld.
+struct SettingGlobalBinding {
+    uint16_t offset;   // offsetof in CryptoMonitorSettings
+    void* global;
+    uint16_t size;
+};
+#define SETTING_GLOBAL(name) {(uint16_t)offsetof(CryptoMonitorSettings, name), &name, (uint16_t)sizeof(name)}
+static const SettingGlobalBinding kSettingGlobals[] = {
+    SETTING_GLOBAL(alertThresholds),
+    SETTING_GLOBAL(alert2HThresholds),
+    SETTING_GLOBAL(notificationCooldowns),
+    SETTING_GLOBAL(anchorTakeProfit),
+    SETTING_GLOBAL(anchorMaxLoss),
+    SETTING_GLOBAL(trendThreshold),
+    SETTING_GLOBAL(volatilityLowThreshold),
+    SETTING_GLOBAL(volatilityHighThreshold),
+    SETTING_GLOBAL(trendAdaptiveAnchorsEnabled),
+    SETTING_GLOBAL(uptrendMaxLossMultiplier),
+    SETTING_GLOBAL(uptrendTakeProfitMultiplier),
+    SETTING_GLOBAL(downtrendMaxLossMultiplier),
+    SETTING_GLOBAL(downtrendTakeProfitMultiplier),
+    SETTING_GLOBAL(smartConfluenceEnabled),
+    SETTING_GLOBAL(nightModeEnabled),
+    SETTING_GLOBAL(nightModeStartHour),
+    SETTING_GLOBAL(nightModeEndHour),
+    SETTING_GLOBAL(nightSpike5mThreshold),
+    SETTING_GLOBAL(nightMove5mAlertThreshold),
+    SETTING_GLOBAL(nightMove30mThreshold),
+    SETTING_GLOBAL(nightCooldown5mSec),
+    SETTING_GLOBAL(nightAutoVolMinMultiplier),
+    SETTING_GLOBAL(nightAutoVolMaxMultiplier),
+    SETTING_GLOBAL(autoVolatilityEnabled),
+    SETTING_GLOBAL(autoVolatilityWindowMinutes),
+    SETTING_GLOBAL(autoVolatilityBaseline1mStdPct),
+    SETTING_GLOBAL(autoVolatilityMinMultiplier),
+    SETTING_GLOBAL(autoVolatilityMaxMultiplier),
+    SETTING_GLOBAL(warmStartEnabled),
+    SETTING_GLOBAL(warmStart1mExtraCandles),
+    SETTING_GLOBAL(warmStart5mCandles),
+    SETTING_GLOBAL(warmStart30mCandles),
+    SETTING_GLOBAL(warmStart2hCandles),
+};
+#undef SETTING_GLOBAL
+
+// Adres van de globale variabele voor een schema-veld, of nullptr als er geen binding is
+static uint8_t* settingGlobalPtr(const SettingDesc& desc)
+{
+    const size_t size = settingsSchemaFieldSize(desc);
+    for (const SettingGlobalBinding& b : kSettingGlobals) {
+        if (desc.offset >= b.offset && desc.offset + size <= (size_t)b.offset + b.size) {
+            return static_cast<uint8_t*>(b.global) + (desc.offset - b.offset);
+        }
+    }
+    return nullptr;
+}
+
+static void loadSettings()
+{
+    // Load settings using SettingsStore module
+    CryptoMonitorSettings settings = settingsStore.load();
+    applySettingsToGlobals(settings);
     
     Serial_printf(F("[Settings] Loaded: topic=%s, symbol=%s, 1min trend=%.2f/%.2f%%/min, 30min trend=%.2f/%.2f%%/uur, cooldown=%lu/%lu ms\n"),
                   ntfyTopic, bitvavoSymbol, threshold1MinUp, threshold1MinDown, threshold30MinUp, threshold30MinDown,
                   notificationCooldown1MinMs, notificationCooldown30MinMs);
 }
 
-// Save settings to Preferences using SettingsStore
-// Fase 9.1.4: static verwijderd zodat WebServerModule deze functie kan aanroepen
-void saveSettings()
+// Vul settings-struct vanuit de globale variabelen
+static void collectSettingsFromGlobals(CryptoMonitorSettings& settings)
 {
-    // Create settings struct from global variables
-    CryptoMonitorSettings settings;
-    
     // Copy basic settings
     safeStrncpy(settings.ntfyTopic, ntfyTopic, sizeof(settings.ntfyTopic));
     safeStrncpy(settings.bitvavoSymbol, bitvavoSymbol, sizeof(settings.bitvavoSymbol));
@@ -5420,6 +5505,7 @@ void saveSettings()
     settings.displayRotation = displayRotation;
     safeStrncpy(settings.chartColorMode, chartColorMode, sizeof(settings.chartColorMode));
     safeStrncpy(settings.chartColorManual, chartColorManual, sizeof(settings.chartColorManual));
+    settings.chartHorizon = chartHorizon;
 
     // Copy alert thresholds
     settings.alertThresholds = alertThresholds;
@@ -5518,27 +5604,25 @@ void saveSettings()
     settings.regimeEnergiekAllowStandalone1mBurst = regimeEnergiekAllowStandalone1mBurst;
     settings.regimeEnergiekStandalone1mFactor = regimeEnergiekStandalone1mFactor;
     settings.regimeEnergiekMinDirectionStrength = regimeEnergiekMinDirectionStrength;
+}
+
+// Save settings to Preferences using SettingsStore
+// Fase 9.1.4: static verwijderd zodat WebServerModule deze functie kan aanroepen
+void saveSettings()
+{
+    // Create settings struct from global variables
+    CryptoMonitorSettings settings;
+    collectSettingsFromGlobals(settings);
     
     // Save using SettingsStore
     settingsStore.save(settings);
+    regimeEngineConfigChanged();
+    // Nieuwe settings-versie: gecachte settings-pagina (/) is verouderd (ook bij MQTT/knop-wijzigingen)
+    webServerModule.invalidatePageCache();
     Serial_println("[Settings] Saved");
 }
 
 // Handler functies voor verschillende setting types
-static bool handleMqttFloatSetting(const char* value, float* target, float minVal, float maxVal, const char* stateTopic, const char* prefix) {
-    float val;
-    if (safeAtof(value, val) && val >= minVal && val <= maxVal) {
-        *target = val;
-        if (stateTopic != nullptr) {
-            char topicBuffer[192];
-            snprintf(topicBuffer, sizeof(topicBuffer), "%s%s", prefix, stateTopic);
-            mqttClient.publish(topicBuffer, value, true);
-        }
-        return true;
-    }
-    return false;
-}
-
 // Helper: Convert seconds to milliseconds with overflow check
 // Returns true on success, false on overflow or invalid input
 // Fase 9.1.4: static verwijderd zodat WebServerModule deze functie kan aanroepen
@@ -5569,27 +5653,6 @@ bool safeSecondsToMs(int seconds, uint32_t& resultMs)
     return true;
 }
 
-static bool handleMqttIntSetting(const char* value, uint32_t* targetMs, int minVal, int maxVal, const char* stateTopic, const char* prefix) {
-    int seconds = atoi(value);
-    if (seconds >= minVal && seconds <= maxVal) {
-        uint32_t resultMs;
-        if (!safeSecondsToMs(seconds, resultMs)) {
-            Serial_printf(F("[MQTT] Overflow check failed for cooldown: %d seconds\n"), seconds);
-            return false;
-        }
-        *targetMs = resultMs;
-        if (stateTopic != nullptr) {
-            char topicBuffer[192];
-            char valueBuffer[32];
-            snprintf(topicBuffer, sizeof(topicBuffer), "%s%s", prefix, stateTopic);
-            snprintf(valueBuffer, sizeof(valueBuffer), "%lu", *targetMs / 1000);
-            mqttClient.publish(topicBuffer, valueBuffer, true);
-        }
-        return true;
-    }
-    return false;
-}
-
 static bool handleMqttStringSetting(const char* value, size_t valueLen, char* target, size_t targetSize, bool uppercase, const char* stateTopic, const char* prefix) {
     if (valueLen > 0 && valueLen < targetSize) {
         if (uppercase) {
@@ -5632,7 +5695,7 @@ static bool handleMqttStringSetting(const char* value, size_t valueLen, char* ta
 }
 
 // MQTT callback: verwerk instellingen van Home Assistant
-// Geoptimaliseerd: gebruik lookup table i.p.v. geneste if-else chain
+// Scalar settings via SettingsSchema (hash-lookup); strings/neveneffecten als speciale gevallen
 void mqttCallback(char* topic, byte* payload, unsigned int length) {
     // Geoptimaliseerd: gebruik char arrays i.p.v. String om geheugenfragmentatie te voorkomen
     char topicBuffer[96];  // Verkleind van 128 naar 96 bytes (bespaart 32 bytes DRAM)
@@ -5659,395 +5722,166 @@ void mqttCallback(char* topic, byte* payload, unsigned int length) {
     }
     
     Serial_printf(F("[MQTT] Message: %s => %s\n"), topicBuffer, msgBuffer);
+
+    // Home Assistant herstart: retained discovery kan weg zijn → hashes vergeten en opnieuw publiceren
+    if (strcmp(topicBuffer, "homeassistant/status") == 0) {
+        if (strcmp(msgBuffer, "online") == 0) {
+            mqttDiscoveryInvalidate();
+            publishMqttDiscovery();
+        }
+        return;
+    }
     
     // Helper: maak MQTT topic prefix (gebaseerd op NTFY topic voor unieke identificatie)
     getMqttTopicPrefix(prefixBuffer, sizeof(prefixBuffer));
     
+    // Verwacht <prefix>/config/<key>/set; key wordt in-place uit topicBuffer gehaald
+    const size_t prefixLen = strlen(prefixBuffer);
+    static const char kConfigPart[] = "/config/";
+    static const char kSetPart[] = "/set";
+    const size_t configLen = sizeof(kConfigPart) - 1;
+    const size_t setLen = sizeof(kSetPart) - 1;
+    if (topicLen <= prefixLen + configLen + setLen ||
+        strncmp(topicBuffer, prefixBuffer, prefixLen) != 0 ||
+        strncmp(topicBuffer + prefixLen, kConfigPart, configLen) != 0 ||
+        strcmp(topicBuffer + topicLen - setLen, kSetPart) != 0) {
+        return;
+    }
+    const char* key = topicBuffer + prefixLen + configLen;
+    const size_t keyLen = topicLen - prefixLen - configLen - setLen;
+    topicBuffer[topicLen - setLen] = '\0';  // topicBuffer = <prefix>/config/<key> (state topic)
+    
     bool settingChanged = false;
     char topicBufferFull[192]; // Voor volledige topic strings
     char valueBuffer[32]; // Voor numerieke waarden
     
-    // Lookup table voor MQTT settings - gebruik loop i.p.v. geneste if-else
-    // Dit maakt de code veel leesbaarder en makkelijker uitbreidbaar
-    struct MqttSetting {
-        const char* suffix;
-        bool isFloat;
-        float minVal;
-        float maxVal;
-        void* targetVar;
-        const char* stateSuffix;
-    };
-    
-    static const MqttSetting floatSettings[] = {
-        {"/config/spike1m/set", true, 0.01f, 10.0f, &alertThresholds.spike1m, "/config/spike1m"},
-        {"/config/spike5m/set", true, 0.01f, 10.0f, &alertThresholds.spike5m, "/config/spike5m"},
-        {"/config/move30m/set", true, 0.01f, 20.0f, &alertThresholds.move30m, "/config/move30m"},
-        {"/config/move5m/set", true, 0.01f, 10.0f, &alertThresholds.move5m, "/config/move5m"},
-        {"/config/move5mAlert/set", true, 0.01f, 10.0f, &alertThresholds.move5mAlert, "/config/move5mAlert"},
-        {"/config/nightSpike5m/set", true, 0.01f, 10.0f, &nightSpike5mThreshold, "/config/nightSpike5m"},
-        {"/config/nightMove5m/set", true, 0.01f, 10.0f, &nightMove5mAlertThreshold, "/config/nightMove5m"},
-        {"/config/nightMove30m/set", true, 0.01f, 20.0f, &nightMove30mThreshold, "/config/nightMove30m"},
-        {"/config/anchorTakeProfit/set", true, 0.1f, 100.0f, &anchorTakeProfit, "/config/anchorTakeProfit"},
-        {"/config/anchorMaxLoss/set", true, -100.0f, -0.1f, &anchorMaxLoss, "/config/anchorMaxLoss"},
-        {"/config/trendThreshold/set", true, 0.1f, 10.0f, &trendThreshold, "/config/trendThreshold"},
-        {"/config/volatilityLowThreshold/set", true, 0.01f, 1.0f, &volatilityLowThreshold, "/config/volatilityLowThreshold"},
-        {"/config/volatilityHighThreshold/set", true, 0.01f, 1.0f, &volatilityHighThreshold, "/config/volatilityHighThreshold"},
-        // 2-hour alert thresholds
-        {"/config/2hBreakMargin/set", true, 0.01f, 5.0f, &alert2HThresholds.breakMarginPct, "/config/2hBreakMargin"},
-        {"/config/2hBreakReset/set", true, 0.01f, 5.0f, &alert2HThresholds.breakResetMarginPct, "/config/2hBreakReset"},
-        {"/config/2hMeanMinDist/set", true, 0.01f, 10.0f, &alert2HThresholds.meanMinDistancePct, "/config/2hMeanMinDist"},
-        {"/config/2hMeanTouch/set", true, 0.01f, 2.0f, &alert2HThresholds.meanTouchBandPct, "/config/2hMeanTouch"},
-        {"/config/2hCompressTh/set", true, 0.01f, 5.0f, &alert2HThresholds.compressThresholdPct, "/config/2hCompressTh"},
-        {"/config/2hCompressReset/set", true, 0.01f, 10.0f, &alert2HThresholds.compressResetPct, "/config/2hCompressReset"},
-        {"/config/2hAnchorMargin/set", true, 0.01f, 5.0f, &alert2HThresholds.anchorOutsideMarginPct, "/config/2hAnchorMargin"},
-        // FASE X.4: Trend hysteresis en throttling instellingen
-        {"/config/2hTrendHyst/set", true, 0.1f, 1.0f, &alert2HThresholds.trendHysteresisFactor, "/config/2hTrendHyst"},
-        // Trend-adaptive anchor multipliers
-        {"/config/upMLMult/set", true, 0.5f, 2.0f, &uptrendMaxLossMultiplier, "/config/upMLMult"},
-        {"/config/upTPMult/set", true, 0.5f, 2.0f, &uptrendTakeProfitMultiplier, "/config/upTPMult"},
-        {"/config/downMLMult/set", true, 0.5f, 2.0f, &downtrendMaxLossMultiplier, "/config/downMLMult"},
-        {"/config/downTPMult/set", true, 0.5f, 2.0f, &downtrendTakeProfitMultiplier, "/config/downTPMult"},
-        // Auto-Volatility settings
-        {"/config/autoVolBase/set", true, 0.01f, 1.0f, &autoVolatilityBaseline1mStdPct, "/config/autoVolBase"},
-        {"/config/autoVolMin/set", true, 0.1f, 1.0f, &autoVolatilityMinMultiplier, "/config/autoVolMin"},
-        {"/config/autoVolMax/set", true, 1.0f, 3.0f, &autoVolatilityMaxMultiplier, "/config/autoVolMax"},
-        {"/config/nightAvMin/set", true, 0.1f, 3.0f, &nightAutoVolMinMultiplier, "/config/nightAvMin"},
-        {"/config/nightAvMax/set", true, 0.1f, 5.0f, &nightAutoVolMaxMultiplier, "/config/nightAvMax"}
-    };
-    
-    static const struct {
-        const char* suffix;
-        uint32_t* targetMs;
-        const char* stateSuffix;
-    } cooldownSettings[] = {
-        {"/config/cooldown1min/set", &notificationCooldowns.cooldown1MinMs, "/config/cooldown1min"},
-        {"/config/cooldown30min/set", &notificationCooldowns.cooldown30MinMs, "/config/cooldown30min"},
-        {"/config/cooldown5min/set", &notificationCooldowns.cooldown5MinMs, "/config/cooldown5min"},
-        // 2-hour alert cooldowns
-        {"/config/2hBreakCD/set", &alert2HThresholds.breakCooldownMs, "/config/2hBreakCD"},
-        {"/config/2hMeanCD/set", &alert2HThresholds.meanCooldownMs, "/config/2hMeanCD"},
-        {"/config/2hCompressCD/set", &alert2HThresholds.compressCooldownMs, "/config/2hCompressCD"},
-        {"/config/2hAnchorCD/set", &alert2HThresholds.anchorCooldownMs, "/config/2hAnchorCD"},
-        // FASE X.4: Throttling tijden
-        {"/config/2hThrottleTC/set", &alert2HThresholds.throttlingTrendChangeMs, "/config/2hThrottleTC"},
-        {"/config/2hThrottleTM/set", &alert2HThresholds.throttlingTrendToMeanMs, "/config/2hThrottleTM"},
-        {"/config/2hThrottleMT/set", &alert2HThresholds.throttlingMeanTouchMs, "/config/2hThrottleMT"},
-        {"/config/2hThrottleComp/set", &alert2HThresholds.throttlingCompressMs, "/config/2hThrottleComp"}
-    };
-    
-    // Integer settings (uint8_t) - voor warm-start en auto-volatility window
-    static const struct {
-        const char* suffix;
-        uint8_t* targetVar;
-        int minVal;
-        int maxVal;
-        const char* stateSuffix;
-    } intSettings[] = {
-        {"/config/autoVolWin/set", &autoVolatilityWindowMinutes, 10, 120, "/config/autoVolWin"},
-        {"/config/ws1mExtra/set", &warmStart1mExtraCandles, 0, 100, "/config/ws1mExtra"},
-        {"/config/ws5m/set", &warmStart5mCandles, 2, 200, "/config/ws5m"},
-        {"/config/ws30m/set", &warmStart30mCandles, 2, 200, "/config/ws30m"},
-        {"/config/ws2h/set", &warmStart2hCandles, 2, 200, "/config/ws2h"},
-        {"/config/nightStartHour/set", &nightModeStartHour, 0, 23, "/config/nightStartHour"},
-        {"/config/nightEndHour/set", &nightModeEndHour, 0, 23, "/config/nightEndHour"}
-    };
-    
-    // Boolean settings (switch entities)
-    static const struct {
-        const char* suffix;
-        bool* targetVar;
-        const char* stateSuffix;
-    } boolSettings[] = {
-        {"/config/trendAdapt/set", &trendAdaptiveAnchorsEnabled, "/config/trendAdapt"},
-        {"/config/smartConf/set", &smartConfluenceEnabled, "/config/smartConf"},
-        {"/config/nightMode/set", &nightModeEnabled, "/config/nightMode"},
-        {"/config/autoVol/set", &autoVolatilityEnabled, "/config/autoVol"},
-        {"/config/warmStart/set", &warmStartEnabled, "/config/warmStart"}
-    };
-    
-    // Process float settings
-    bool handled = false;
-    for (size_t i = 0; i < sizeof(floatSettings) / sizeof(floatSettings[0]); i++) {
-        snprintf(topicBufferFull, sizeof(topicBufferFull), "%s%s", prefixBuffer, floatSettings[i].suffix);
-        if (strcmp(topicBuffer, topicBufferFull) == 0) {
-            float val;
-            bool valid = false;
-            
-            // Special check voor volatilityHighThreshold (moet > volatilityLowThreshold)
-            if (strstr(floatSettings[i].suffix, "volatilityHighThreshold") != nullptr) {
-                valid = safeAtof(msgBuffer, val) && val >= floatSettings[i].minVal && 
-                        val <= floatSettings[i].maxVal && val > volatilityLowThreshold;
-            } else {
-                valid = safeAtof(msgBuffer, val) && val >= floatSettings[i].minVal && val <= floatSettings[i].maxVal;
-            }
-            
-            if (valid) {
-                *((float*)floatSettings[i].targetVar) = val;
-                snprintf(topicBufferFull, sizeof(topicBufferFull), "%s%s", prefixBuffer, floatSettings[i].stateSuffix);
-                mqttClient.publish(topicBufferFull, msgBuffer, true);
-                settingChanged = true;
-                handled = true;
-            } else {
-                Serial_printf(F("[MQTT] Invalid value for %s: %s\n"), floatSettings[i].suffix, msgBuffer);
-            }
-            break;
-        }
-    }
-    
-    // Process cooldown settings (int -> ms conversion)
-    // Note: 2h cooldowns en throttling zijn in seconden (niet minuten zoals in web interface)
-    if (!handled) {
-        for (size_t i = 0; i < sizeof(cooldownSettings) / sizeof(cooldownSettings[0]); i++) {
-            snprintf(topicBufferFull, sizeof(topicBufferFull), "%s%s", prefixBuffer, cooldownSettings[i].suffix);
-            if (strcmp(topicBuffer, topicBufferFull) == 0) {
-                                int seconds = atoi(msgBuffer);
-                // 2h cooldowns en throttling kunnen groter zijn (tot 10 uur = 36000 seconden)
-                int maxSeconds = (strstr(cooldownSettings[i].suffix, "2h") != nullptr) ? 36000 : 3600;
-                if (seconds >= 1 && seconds <= maxSeconds) {
-                                    uint32_t resultMs;
-                                    if (!safeSecondsToMs(seconds, resultMs)) {
-                                        Serial_printf(F("[MQTT] Overflow check failed for cooldown: %d seconds\n"), seconds);
-                                        break;
-                                    }
-                                    *cooldownSettings[i].targetMs = resultMs;
-                    snprintf(topicBufferFull, sizeof(topicBufferFull), "%s%s", prefixBuffer, cooldownSettings[i].stateSuffix);
-                    snprintf(valueBuffer, sizeof(valueBuffer), "%lu", *cooldownSettings[i].targetMs / 1000);
-                    mqttClient.publish(topicBufferFull, valueBuffer, true);
-                    settingChanged = true;
-                    handled = true;
-                } else {
-                    Serial_printf(F("[MQTT] Invalid cooldown value (range: 1-%d seconds): %s\n"), maxSeconds, msgBuffer);
-                }
-                break;
-            }
+    // Schema-settings: één hash-lookup i.p.v. strcmp per bekende setting
+    const SettingDesc* desc = settingsSchemaFind(key, keyLen);
+    if (desc != nullptr) {
+        // Alleen het gewijzigde veld: parse in een staging-struct, kopieer dat ene veld naar zijn global
+        uint8_t* global = settingGlobalPtr(*desc);
+        const size_t fieldSize = settingsSchemaFieldSize(*desc);
+        CryptoMonitorSettings staged;
+        uint8_t* field = reinterpret_cast<uint8_t*>(&staged) + desc->offset;
+        if (global != nullptr) {
+            memcpy(field, global, fieldSize);
+            staged.volatilityLowThreshold = volatilityLowThreshold;  // Voor SETTING_F_GT_VOL_LOW
+        }
+        if (global != nullptr && settingsSchemaApply(*desc, msgBuffer, staged)) {
+            memcpy(global, field, fieldSize);  // saveSettings() hieronder meldt de regime-engine
+            settingsSchemaFormat(*desc, staged, valueBuffer, sizeof(valueBuffer));
+            mqttClient.publish(topicBuffer, valueBuffer, true);
+            settingChanged = true;
+        } else {
+            Serial_printf(F("[MQTT] Invalid value for %s (range: %.2f-%.2f): %s\n"),
+                          desc->key, desc->minVal, desc->maxVal, msgBuffer);
         }
     }
-    
-    // FASE X.5: Secondary global cooldown en coalescing settings (in seconden, niet milliseconden)
-    // Deze worden apart verwerkt omdat ze al in seconden zijn opgeslagen
-    if (!handled) {
-        snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/2hSecGlobalCD/set", prefixBuffer);
-        if (strcmp(topicBuffer, topicBufferFull) == 0) {
-            int seconds = atoi(msgBuffer);
-            if (seconds >= 60 && seconds <= 86400) {  // 1 min tot 24 uur
-                alert2HThresholds.twoHSecondaryGlobalCooldownSec = seconds;
-                snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/2hSecGlobalCD", prefixBuffer);
-                snprintf(valueBuffer, sizeof(valueBuffer), "%lu", alert2HThresholds.twoHSecondaryGlobalCooldownSec);
-                mqttClient.publish(topicBufferFull, valueBuffer, true);
-                settingChanged = true;
-                handled = true;
-            } else {
-                Serial_printf(F("[MQTT] Invalid 2hSecGlobalCD value (range: 60-86400 seconds): %s\n"), msgBuffer);
-            }
+    // Special cases (niet in schema vanwege neveneffecten of string-waarden)
+    else if (strcmp(key, "bitvavoSymbol") == 0) {
+        // bitvavoSymbol - speciale logica (uppercase + symbolsArray update)
+        if (handleMqttStringSetting(msgBuffer, msgLen, bitvavoSymbol, sizeof(bitvavoSymbol), true, "/config/bitvavoSymbol", prefixBuffer)) {
+            safeStrncpy(symbol0, bitvavoSymbol, sizeof(symbol0));
+            settingChanged = true;
+        }
+    } else if (strcmp(key, "ntfyTopic") == 0) {
+        // ntfyTopic - speciale logica (trim)
+        if (handleMqttStringSetting(msgBuffer, msgLen, ntfyTopic, sizeof(ntfyTopic), false, "/config/ntfyTopic", prefixBuffer)) {
+            settingChanged = true;
+        }
+    } else if (strcmp(key, "language") == 0) {
+        uint8_t newLanguage = atoi(msgBuffer);
+        if (newLanguage == 0 || newLanguage == 1) {
+            language = newLanguage;
+            snprintf(valueBuffer, sizeof(valueBuffer), "%u", language);
+            mqttClient.publish(topicBuffer, valueBuffer, true);
+            settingChanged = true;
+        }
+    } else if (strcmp(key, "displayRotation") == 0) {
+        // displayRotation - speciale logica (deferred apply)
+        uint8_t newRotation = atoi(msgBuffer);
+        if (newRotation == 0 || newRotation == 2) {
+            displayRotation = newRotation;
+            requestDisplayRotation(newRotation);
+            snprintf(valueBuffer, sizeof(valueBuffer), "%u", displayRotation);
+            mqttClient.publish(topicBuffer, valueBuffer, true);
+            settingChanged = true;
         }
+    } else if (strcmp(key, "anchorValue") == 0) {
+        // anchorValue/set - speciale logica (queue voor asynchrone verwerking)
+        float val = 0.0f;
+        bool useCurrentPrice = false;
+        bool valid = false;
         
-        snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/2hSecCoalesce/set", prefixBuffer);
-        if (strcmp(topicBuffer, topicBufferFull) == 0) {
-            int seconds = atoi(msgBuffer);
-            if (seconds >= 10 && seconds <= 600) {  // 10 sec tot 10 min
-                alert2HThresholds.twoHSecondaryCoalesceWindowSec = seconds;
-                snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/2hSecCoalesce", prefixBuffer);
-                snprintf(valueBuffer, sizeof(valueBuffer), "%lu", alert2HThresholds.twoHSecondaryCoalesceWindowSec);
-                mqttClient.publish(topicBufferFull, valueBuffer, true);
-                settingChanged = true;
-                handled = true;
-            } else {
-                Serial_printf(F("[MQTT] Invalid 2hSecCoalesce value (range: 10-600 seconds): %s\n"), msgBuffer);
+        // Lege waarde of "current" = gebruik huidige prijs
+        if (strlen(msgBuffer) == 0 || strcmp(msgBuffer, "current") == 0 || 
+            strcmp(msgBuffer, "CURRENT") == 0 || strcmp(msgBuffer, "0") == 0) {
+            useCurrentPrice = true;
+            valid = queueAnchorSetting(0.0f, true);
+            if (valid) {
+                Serial_println("[MQTT] Anchor setting queued: gebruik huidige prijs");
             }
-        }
-    }
-    
-    // Nacht: 5m cooldown in seconden (aparte setting)
-    if (!handled) {
-        snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/nightCd5m/set", prefixBuffer);
-        if (strcmp(topicBuffer, topicBufferFull) == 0) {
-            int seconds = atoi(msgBuffer);
-            if (seconds >= 60 && seconds <= 7200) {
-                nightCooldown5mSec = static_cast<uint16_t>(seconds);
-                snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/nightCd5m", prefixBuffer);
-                snprintf(valueBuffer, sizeof(valueBuffer), "%u", nightCooldown5mSec);
-                mqttClient.publish(topicBufferFull, valueBuffer, true);
-                settingChanged = true;
-                handled = true;
-            } else {
-                Serial_printf(F("[MQTT] Invalid nightCd5m value (range: 60-7200 seconds): %s\n"), msgBuffer);
+        } else if (safeAtof(msgBuffer, val) && val > 0.0f && isValidPrice(val)) {
+            // Valide waarde - zet in queue voor asynchrone verwerking
+            useCurrentPrice = false;
+            valid = queueAnchorSetting(val, false);
+            if (valid) {
+                Serial_printf(F("[MQTT] Anchor setting queued: %.2f\n"), val);
             }
+        } else {
+            Serial_printf(F("[MQTT] WARN: Ongeldige anchor waarde opgegeven: %s\n"), msgBuffer);
         }
-    }
-    
-    // Process integer settings (uint8_t)
-    if (!handled) {
-        for (size_t i = 0; i < sizeof(intSettings) / sizeof(intSettings[0]); i++) {
-            snprintf(topicBufferFull, sizeof(topicBufferFull), "%s%s", prefixBuffer, intSettings[i].suffix);
-            if (strcmp(topicBuffer, topicBufferFull) == 0) {
-                int val = atoi(msgBuffer);
-                if (val >= intSettings[i].minVal && val <= intSettings[i].maxVal) {
-                    *intSettings[i].targetVar = static_cast<uint8_t>(val);
-                    snprintf(topicBufferFull, sizeof(topicBufferFull), "%s%s", prefixBuffer, intSettings[i].stateSuffix);
-                    snprintf(valueBuffer, sizeof(valueBuffer), "%u", *intSettings[i].targetVar);
-                    mqttClient.publish(topicBufferFull, valueBuffer, true);
-                    settingChanged = true;
-                    handled = true;
+        
+        // Publiceer bevestiging terug
+        if (valid) {
+            if (useCurrentPrice) {
+                // Publiceer huidige prijs als state (default waarde)
+                extern float prices[];
+                if (safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "mqttCallback anchorValue")) {
+                    float currentPrice = prices[0];
+                    safeMutexGive(dataMutex, "mqttCallback anchorValue");
+                    snprintf(valueBuffer, sizeof(valueBuffer), "%.2f", currentPrice);
+                    mqttClient.publish(topicBuffer, valueBuffer, true);
                 } else {
-                    Serial_printf(F("[MQTT] Invalid value for %s (range: %d-%d): %s\n"), 
-                                 intSettings[i].suffix, intSettings[i].minVal, intSettings[i].maxVal, msgBuffer);
-                }
-                break;
-            }
-        }
-    }
-    
-    // Process boolean settings (switch entities)
-    if (!handled) {
-        for (size_t i = 0; i < sizeof(boolSettings) / sizeof(boolSettings[0]); i++) {
-            snprintf(topicBufferFull, sizeof(topicBufferFull), "%s%s", prefixBuffer, boolSettings[i].suffix);
-            if (strcmp(topicBuffer, topicBufferFull) == 0) {
-                // Home Assistant switch: "ON" = true, "OFF" = false
-                bool newValue = (strcmp(msgBuffer, "ON") == 0 || strcmp(msgBuffer, "on") == 0 || 
-                                strcmp(msgBuffer, "1") == 0 || strcmp(msgBuffer, "true") == 0);
-                *boolSettings[i].targetVar = newValue;
-                snprintf(topicBufferFull, sizeof(topicBufferFull), "%s%s", prefixBuffer, boolSettings[i].stateSuffix);
-                mqttClient.publish(topicBufferFull, newValue ? "ON" : "OFF", true);
-                settingChanged = true;
-                handled = true;
-                break;
-            }
-        }
-    }
-    
-    // Special cases (niet in lookup table vanwege complexe logica)
-    if (!handled) {
-        // bitvavoSymbol - speciale logica (uppercase + symbolsArray update)
-        snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/bitvavoSymbol/set", prefixBuffer);
-        if (strcmp(topicBuffer, topicBufferFull) == 0) {
-            if (handleMqttStringSetting(msgBuffer, msgLen, bitvavoSymbol, sizeof(bitvavoSymbol), true, "/config/bitvavoSymbol", prefixBuffer)) {
-                safeStrncpy(symbol0, bitvavoSymbol, sizeof(symbol0));
-                settingChanged = true;
-            }
-        } else {
-            // ntfyTopic - speciale logica (trim)
-            snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/ntfyTopic/set", prefixBuffer);
-            if (strcmp(topicBuffer, topicBufferFull) == 0) {
-                if (handleMqttStringSetting(msgBuffer, msgLen, ntfyTopic, sizeof(ntfyTopic), false, "/config/ntfyTopic", prefixBuffer)) {
-                    settingChanged = true;
+                    // Fallback: gebruik 0 als placeholder (wordt later geupdate)
+                    mqttClient.publish(topicBuffer, "0.00", true);
                 }
             } else {
-                // language - speciale logica (saveSettings call)
-                snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/language/set", prefixBuffer);
-                if (strcmp(topicBuffer, topicBufferFull) == 0) {
-                    uint8_t newLanguage = atoi(msgBuffer);
-                    if (newLanguage == 0 || newLanguage == 1) {
-                        language = newLanguage;
-                        saveSettings(); // Save language to Preferences
-                        snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/language", prefixBuffer);
-                        snprintf(valueBuffer, sizeof(valueBuffer), "%u", language);
-                        mqttClient.publish(topicBufferFull, valueBuffer, true);
-                        settingChanged = true;
-                    }
-                } else {
-                    // displayRotation - speciale logica (saveSettings call + deferred apply)
-                    snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/displayRotation/set", prefixBuffer);
-                    if (strcmp(topicBuffer, topicBufferFull) == 0) {
-                        uint8_t newRotation = atoi(msgBuffer);
-                        if (newRotation == 0 || newRotation == 2) {
-                            displayRotation = newRotation;
-                            requestDisplayRotation(newRotation);
-                            saveSettings(); // Save displayRotation to Preferences
-                            snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/displayRotation", prefixBuffer);
-                            snprintf(valueBuffer, sizeof(valueBuffer), "%u", displayRotation);
-                            mqttClient.publish(topicBufferFull, valueBuffer, true);
-                            settingChanged = true;
-                        }
-                        handled = true;
-                } else {
-                    // anchorValue/set - speciale logica (queue voor asynchrone verwerking)
-                    snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/anchorValue/set", prefixBuffer);
-                    if (strcmp(topicBuffer, topicBufferFull) == 0) {
-                        // Verwerk anchor waarde via MQTT
-                        float val = 0.0f;
-                        bool useCurrentPrice = false;
-                        bool valid = false;
-                        
-                        // Lege waarde of "current" = gebruik huidige prijs
-                        if (strlen(msgBuffer) == 0 || strcmp(msgBuffer, "current") == 0 || 
-                            strcmp(msgBuffer, "CURRENT") == 0 || strcmp(msgBuffer, "0") == 0) {
-                            useCurrentPrice = true;
-                            valid = queueAnchorSetting(0.0f, true);
-                            if (valid) {
-                                Serial_println("[MQTT] Anchor setting queued: gebruik huidige prijs");
-                            }
-                        } else if (safeAtof(msgBuffer, val) && val > 0.0f && isValidPrice(val)) {
-                            // Valide waarde - zet in queue voor asynchrone verwerking
-                            useCurrentPrice = false;
-                            valid = queueAnchorSetting(val, false);
-                            if (valid) {
-                                Serial_printf(F("[MQTT] Anchor setting queued: %.2f\n"), val);
-                            }
-                        } else {
-                            Serial_printf(F("[MQTT] WARN: Ongeldige anchor waarde opgegeven: %s\n"), msgBuffer);
-                        }
-                        
-                        // Publiceer bevestiging terug
-                        snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/anchorValue", prefixBuffer);
-                        if (valid) {
-                            if (useCurrentPrice) {
-                                    // Publiceer huidige prijs als state (default waarde)
-                                    extern float prices[];
-                                    if (safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "mqttCallback anchorValue")) {
-                                        float currentPrice = prices[0];
-                                        safeMutexGive(dataMutex, "mqttCallback anchorValue");
-                                        snprintf(valueBuffer, sizeof(valueBuffer), "%.2f", currentPrice);
-                                        mqttClient.publish(topicBufferFull, valueBuffer, true);
-                                    } else {
-                                        // Fallback: gebruik 0 als placeholder (wordt later geupdate)
-                                        mqttClient.publish(topicBufferFull, "0.00", true);
-                                    }
-                            } else {
-                                snprintf(valueBuffer, sizeof(valueBuffer), "%.2f", val);
-                                    mqttClient.publish(topicBufferFull, valueBuffer, true);
-                            }
-                        } else {
-                            mqttClient.publish(topicBufferFull, "ERROR: Invalid value", false);
-                        }
-                        handled = true;
-                                } else {
-                            // anchorStrategy/set - speciale logica (pas TP/SL aan)
-                            snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/anchorStrategy/set", prefixBuffer);
-                            if (strcmp(topicBuffer, topicBufferFull) == 0) {
-                                uint8_t newStrategy = atoi(msgBuffer);
-                                if (newStrategy >= 0 && newStrategy <= 2) {
-                                    anchorStrategy = newStrategy;
-                                    // Pas TP/SL automatisch aan op basis van strategie
-                                    if (anchorStrategy == 1) {
-                                        // Conservatief: TP +1.8%, SL -1.2%
-                                        anchorTakeProfit = 1.8f;
-                                        anchorMaxLoss = -1.2f;
-                                    } else if (anchorStrategy == 2) {
-                                        // Actief: TP +1.2%, SL -0.9%
-                                        anchorTakeProfit = 1.2f;
-                                        anchorMaxLoss = -0.9f;
-                                    }
-                                    // anchorStrategy == 0 (handmatig): behoud huidige waarden
-                                    saveSettings(); // Save anchorStrategy en TP/SL to Preferences
-                                    snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/anchorStrategy", prefixBuffer);
-                                    snprintf(valueBuffer, sizeof(valueBuffer), "%u", anchorStrategy);
-                                    mqttClient.publish(topicBufferFull, valueBuffer, true);
-                                    // Publiceer ook TP/SL updates
-                                    snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/anchorTP", prefixBuffer);
-                                    snprintf(valueBuffer, sizeof(valueBuffer), "%.2f", anchorTakeProfit);
-                                    mqttClient.publish(topicBufferFull, valueBuffer, true);
-                                    snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/anchorML", prefixBuffer);
-                                    snprintf(valueBuffer, sizeof(valueBuffer), "%.2f", anchorMaxLoss);
-                                    mqttClient.publish(topicBufferFull, valueBuffer, true);
-                                    settingChanged = true;
-                                }
-                                handled = true;
-                            }
-                        }
-                    }
-                }
+                snprintf(valueBuffer, sizeof(valueBuffer), "%.2f", val);
+                mqttClient.publish(topicBuffer, valueBuffer, true);
             }
+        } else {
+            mqttClient.publish(topicBuffer, "ERROR: Invalid value", false);
+        }
+    } else if (strcmp(key, "anchorStrategy") == 0) {
+        // anchorStrategy/set - speciale logica (pas TP/SL aan)
+        uint8_t newStrategy = atoi(msgBuffer);
+        if (newStrategy <= 2) {
+            anchorStrategy = newStrategy;
+            // Pas TP/SL automatisch aan op basis van strategie
+            if (anchorStrategy == 1) {
+                // Conservatief: TP +1.8%, SL -1.2%
+                anchorTakeProfit = 1.8f;
+                anchorMaxLoss = -1.2f;
+            } else if (anchorStrategy == 2) {
+                // Actief: TP +1.2%, SL -0.9%
+                anchorTakeProfit = 1.2f;
+                anchorMaxLoss = -0.9f;
+            }
+            // anchorStrategy == 0 (handmatig): behoud huidige waarden
+            snprintf(valueBuffer, sizeof(valueBuffer), "%u", anchorStrategy);
+            mqttClient.publish(topicBuffer, valueBuffer, true);
+            // Publiceer ook TP/SL updates
+            snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/anchorTP", prefixBuffer);
+            snprintf(valueBuffer, sizeof(valueBuffer), "%.2f", anchorTakeProfit);
+            mqttClient.publish(topicBufferFull, valueBuffer, true);
+            snprintf(topicBufferFull, sizeof(topicBufferFull), "%s/config/anchorML", prefixBuffer);
+            snprintf(valueBuffer, sizeof(valueBuffer), "%.2f", anchorMaxLoss);
+            mqttClient.publish(topicBufferFull, valueBuffer, true);
+            settingChanged = true;
         }
+    } else {
+        Serial_printf(F("[MQTT] Onbekende setting: %s\n"), key);
     }
     
     if (settingChanged) {
@@ -6059,89 +5893,56 @@ void mqttCallback(char* topic, byte* payload, unsigned int length) {
 // Publiceer huidige instellingen naar MQTT
 // Geoptimaliseerd: gebruik char arrays i.p.v. String om geheugenfragmentatie te voorkomen
 // MQTT Message Queue functions
-static bool enqueueMqttMessage(const char* topic, const char* payload, bool retained) {
-    if (mqttQueueCount >= MQTT_QUEUE_SIZE) {
-        // Queue is vol: probeer eerst queue te legen voordat we bericht verliezen
-        // Dit voorkomt message loss bij tijdelijke queue overflow
-        if (mqttConnected) {
-            processMqttQueue();  // Probeer queue te legen
-        }
-        
-        // Check opnieuw na processing
-        if (mqttQueueCount >= MQTT_QUEUE_SIZE) {
-            // Queue nog steeds vol, log warning (maar niet te vaak)
-            static unsigned long lastQueueFullWarning = 0;
-            unsigned long now = millis();
-            if (now - lastQueueFullWarning > 5000) {  // Max 1 warning per 5 seconden
-        Serial_printf("[MQTT Queue] Queue vol, bericht verloren: %s\n", topic);
-                lastQueueFullWarning = now;
-            }
-            return false; // Queue nog steeds vol
-        }
-        // Queue heeft nu ruimte, val door naar normale enqueue
-    }
-    
-    MqttMessage* msg = &mqttQueue[mqttQueueTail];
-    strncpy(msg->topic, topic, sizeof(msg->topic) - 1);
-    msg->topic[sizeof(msg->topic) - 1] = '\0';
-    strncpy(msg->payload, payload, sizeof(msg->payload) - 1);
-    msg->payload[sizeof(msg->payload) - 1] = '\0';
-    msg->retained = retained;
-    msg->valid = true;
-    
-    mqttQueueTail = (mqttQueueTail + 1) % MQTT_QUEUE_SIZE;
-    mqttQueueCount++;
-    
-    return true;
+// Enqueue blokkeert nooit op netwerk-I/O: geen synchrone drain meer vanuit de aanroepende task
+static bool enqueueMqttMessage(MqttTopicClass cls, const char* topic, const char* payload, bool retained) {
+    return mqttQueueEnqueue(cls, topic, payload, retained);
+}
+
+static bool mqttQueuePublishCb(const char* topic, const uint8_t* payload, size_t len, bool retained) {
+    TRACE_SPAN(TRACE_MQTT_PUBLISH);
+    return mqttConnected && mqttClient.publish(topic, payload, (unsigned int)len, retained);
 }
 
+// Tijdslice-drain: events eerst, daarna values/settings (zie MqttQueue.h)
 static void processMqttQueue() {
-    if (!mqttConnected || mqttQueueCount == 0) {
+    if (!mqttConnected) {
         return;
     }
-    
-    // Process max 5 messages per call om queue sneller leeg te maken (was 3)
-    uint8_t processed = 0;
-    while (mqttQueueCount > 0 && processed < 5) {
-        MqttMessage* msg = &mqttQueue[mqttQueueHead];
-        if (!msg->valid) {
-            mqttQueueHead = (mqttQueueHead + 1) % MQTT_QUEUE_SIZE;
-            mqttQueueCount--;
-            continue;
-        }
-        
-        bool success = mqttClient.publish(msg->topic, msg->payload, msg->retained);
-        if (success) {
-            msg->valid = false;
-            mqttQueueHead = (mqttQueueHead + 1) % MQTT_QUEUE_SIZE;
-            mqttQueueCount--;
-            processed++;
-        } else {
-            // Publish failed, stop processing (will retry next time)
-            break;
-        }
-    }
+    mqttQueueDrain(mqttQueuePublishCb, MQTT_QUEUE_DRAIN_BUDGET_MS, MQTT_QUEUE_DRAIN_MAX_MSGS);
 }
 
-// Helper functies voor MQTT publishing - reduceert code duplicatie
-// Gebruikt queue om message loss te voorkomen
-static void publishMqttFloat(const char* topicSuffix, float value) {
-    char topicBuffer[96];  // Verkleind van 128 naar 96 bytes (bespaart 32 bytes DRAM)
-    char buffer[32];
-    char mqttPrefix[64];
-    getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
-    dtostrf(value, 0, 2, buffer);
-    snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/%s", mqttPrefix, topicSuffix);
-    
-    if (mqttConnected && mqttClient.publish(topicBuffer, buffer, true)) {
-        // Direct publish succeeded
+// Periodieke stats per topic-klasse; alleen loggen als er iets gedropt is sinds vorige log
+static void logMqttQueueStatsIfDue() {
+    static unsigned long lastLogMs = 0;
+    static uint32_t lastDroppedTotal = 0;
+    const unsigned long nowMs = millis();
+    if (nowMs - lastLogMs < MQTT_QUEUE_STATS_LOG_INTERVAL_MS) {
         return;
     }
-    
-    // Queue message if not connected or publish failed
-    enqueueMqttMessage(topicBuffer, buffer, true);
+    lastLogMs = nowMs;
+    uint32_t droppedTotal = 0;
+    MqttQueueClassStats st[MQTT_CLASS_COUNT];
+    for (uint8_t c = 0; c < MQTT_CLASS_COUNT; c++) {
+        mqttQueueGetStats((MqttTopicClass)c, st[c]);
+        droppedTotal += st[c].dropped;
+    }
+    if (droppedTotal == lastDroppedTotal) {
+        return;
+    }
+    lastDroppedTotal = droppedTotal;
+    for (uint8_t c = 0; c < MQTT_CLASS_COUNT; c++) {
+        Serial_printf(F("[MQTT Queue] %s: depth=%u/%u hwm=%u enq=%lu pub=%lu drop=%lu coal=%lu lat_avg=%lums lat_max=%lums\n"),
+                      mqttQueueClassName((MqttTopicClass)c),
+                      (unsigned)st[c].depth, (unsigned)st[c].capacity, (unsigned)st[c].highWater,
+                      (unsigned long)st[c].enqueued, (unsigned long)st[c].published,
+                      (unsigned long)st[c].dropped, (unsigned long)st[c].coalesced,
+                      (unsigned long)(st[c].published ? (st[c].latencySumMs / st[c].published) : 0),
+                      (unsigned long)st[c].latencyMaxMs);
+    }
 }
 
+// Helper functies voor MQTT publishing - reduceert code duplicatie
+// Gebruikt queue om message loss te voorkomen
 static void publishMqttUint(const char* topicSuffix, unsigned long value) {
     char topicBuffer[96];  // Verkleind van 128 naar 96 bytes (bespaart 32 bytes DRAM)
     char buffer[32];
@@ -6150,13 +5951,8 @@ static void publishMqttUint(const char* topicSuffix, unsigned long value) {
     snprintf(buffer, sizeof(buffer), "%lu", value);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/%s", mqttPrefix, topicSuffix);
     
-    if (mqttConnected && mqttClient.publish(topicBuffer, buffer, true)) {
-        // Direct publish succeeded
-        return;
-    }
-    
-    // Queue message if not connected or publish failed
-    enqueueMqttMessage(topicBuffer, buffer, true);
+    // Settings lopen altijd via de settings-lane: reconnect-republish wordt in slices gedraind
+    enqueueMqttMessage(MQTT_CLASS_SETTINGS, topicBuffer, buffer, true);
 }
 
 static void publishMqttString(const char* topicSuffix, const char* value) {
@@ -6165,112 +5961,23 @@ static void publishMqttString(const char* topicSuffix, const char* value) {
     getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/%s", mqttPrefix, topicSuffix);
     
-    if (mqttConnected && mqttClient.publish(topicBuffer, value, true)) {
-        // Direct publish succeeded
-        return;
-    }
-    
-    // Queue message if not connected or publish failed
-    enqueueMqttMessage(topicBuffer, value, true);
+    // Settings lopen altijd via de settings-lane: reconnect-republish wordt in slices gedraind
+    enqueueMqttMessage(MQTT_CLASS_SETTINGS, topicBuffer, value, true);
 }
 
+// Settings-republish in slices (zelfde idee als discovery): de ronde is een index over schema +
+// speciale topics; serviceMqttSettings() zet alleen zoveel topics klaar als de settings-lane vrij heeft.
+// Zo overleeft een volledige republish ook de compacte DRAM-lane zonder dat retained state verloren gaat.
+static const uint16_t MQTT_SETTINGS_ROUND_IDLE = 0xFFFF;
+static const uint16_t MQTT_SETTINGS_SPECIAL_COUNT = 6;
+static uint16_t s_mqttSettingsNext = MQTT_SETTINGS_ROUND_IDLE;
+
 void publishMqttSettings() {
     // Queue messages even if not connected - they will be sent when connection is restored
-    
-    // Float settings
-    publishMqttFloat("spike1m", spike1mThreshold);
-    publishMqttFloat("spike5m", spike5mThreshold);
-    publishMqttFloat("move30m", move30mThreshold);
-    publishMqttFloat("move5m", move5mThreshold);
-    publishMqttFloat("move5mAlert", move5mAlertThreshold);
-    publishMqttFloat("anchorTakeProfit", anchorTakeProfit);
-    publishMqttFloat("anchorMaxLoss", anchorMaxLoss);
-    publishMqttUint("anchorStrategy", anchorStrategy);
-    publishMqttFloat("trendThreshold", trendThreshold);
-    publishMqttFloat("volatilityLowThreshold", volatilityLowThreshold);
-    publishMqttFloat("volatilityHighThreshold", volatilityHighThreshold);
-    
-    // 2-hour alert thresholds
-    publishMqttFloat("2hBreakMargin", alert2HThresholds.breakMarginPct);
-    publishMqttFloat("2hBreakReset", alert2HThresholds.breakResetMarginPct);
-    publishMqttFloat("2hMeanMinDist", alert2HThresholds.meanMinDistancePct);
-    publishMqttFloat("2hMeanTouch", alert2HThresholds.meanTouchBandPct);
-    publishMqttFloat("2hCompressTh", alert2HThresholds.compressThresholdPct);
-    publishMqttFloat("2hCompressReset", alert2HThresholds.compressResetPct);
-    publishMqttFloat("2hAnchorMargin", alert2HThresholds.anchorOutsideMarginPct);
-    publishMqttFloat("2hTrendHyst", alert2HThresholds.trendHysteresisFactor);
-    
-    // Trend-adaptive anchor multipliers
-    publishMqttFloat("upMLMult", uptrendMaxLossMultiplier);
-    publishMqttFloat("upTPMult", uptrendTakeProfitMultiplier);
-    publishMqttFloat("downMLMult", downtrendMaxLossMultiplier);
-    publishMqttFloat("downTPMult", downtrendTakeProfitMultiplier);
-    
-    // Auto-Volatility settings
-    publishMqttFloat("autoVolBase", autoVolatilityBaseline1mStdPct);
-    publishMqttFloat("autoVolMin", autoVolatilityMinMultiplier);
-    publishMqttFloat("autoVolMax", autoVolatilityMaxMultiplier);
-    
-    // Unsigned int settings (cooldowns in seconds)
-    publishMqttUint("cooldown1min", notificationCooldown1MinMs / 1000);
-    publishMqttUint("cooldown30min", notificationCooldown30MinMs / 1000);
-    publishMqttUint("cooldown5min", notificationCooldown5MinMs / 1000);
-    publishMqttUint("language", language);
-    publishMqttUint("displayRotation", displayRotation);
-    publishMqttUint("nightStartHour", nightModeStartHour);
-    publishMqttUint("nightEndHour", nightModeEndHour);
-    publishMqttFloat("nightSpike5m", nightSpike5mThreshold);
-    publishMqttFloat("nightMove5m", nightMove5mAlertThreshold);
-    publishMqttFloat("nightMove30m", nightMove30mThreshold);
-    publishMqttUint("nightCd5m", nightCooldown5mSec);
-    publishMqttFloat("nightAvMin", nightAutoVolMinMultiplier);
-    publishMqttFloat("nightAvMax", nightAutoVolMaxMultiplier);
-    
-    // 2-hour alert cooldowns (in seconds)
-    publishMqttUint("2hBreakCD", alert2HThresholds.breakCooldownMs / 1000);
-    publishMqttUint("2hMeanCD", alert2HThresholds.meanCooldownMs / 1000);
-    publishMqttUint("2hCompressCD", alert2HThresholds.compressCooldownMs / 1000);
-    publishMqttUint("2hAnchorCD", alert2HThresholds.anchorCooldownMs / 1000);
-    publishMqttUint("2hThrottleTC", alert2HThresholds.throttlingTrendChangeMs / 1000);
-    publishMqttUint("2hThrottleTM", alert2HThresholds.throttlingTrendToMeanMs / 1000);
-    publishMqttUint("2hThrottleMT", alert2HThresholds.throttlingMeanTouchMs / 1000);
-    publishMqttUint("2hThrottleComp", alert2HThresholds.throttlingCompressMs / 1000);
-    // FASE X.5: Secondary global cooldown en coalescing (in seconden)
-    publishMqttUint("2hSecGlobalCD", alert2HThresholds.twoHSecondaryGlobalCooldownSec);
-    publishMqttUint("2hSecCoalesce", alert2HThresholds.twoHSecondaryCoalesceWindowSec);
-    
-    // Integer settings (uint8_t)
-    publishMqttUint("autoVolWin", autoVolatilityWindowMinutes);
-    publishMqttUint("ws1mExtra", warmStart1mExtraCandles);
-    publishMqttUint("ws5m", warmStart5mCandles);
-    publishMqttUint("ws30m", warmStart30mCandles);
-    publishMqttUint("ws2h", warmStart2hCandles);
-    
-    // Boolean settings (switch entities)
-    char mqttPrefix[64];
-    getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
-    char topicBuffer[128];
-    char valueBuffer[8];
-    snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/trendAdapt", mqttPrefix);
-    snprintf(valueBuffer, sizeof(valueBuffer), "%s", trendAdaptiveAnchorsEnabled ? "ON" : "OFF");
-    enqueueMqttMessage(topicBuffer, valueBuffer, true);
-    snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/smartConf", mqttPrefix);
-    snprintf(valueBuffer, sizeof(valueBuffer), "%s", smartConfluenceEnabled ? "ON" : "OFF");
-    enqueueMqttMessage(topicBuffer, valueBuffer, true);
-    snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightMode", mqttPrefix);
-    snprintf(valueBuffer, sizeof(valueBuffer), "%s", nightModeEnabled ? "ON" : "OFF");
-    enqueueMqttMessage(topicBuffer, valueBuffer, true);
-    snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/autoVol", mqttPrefix);
-    snprintf(valueBuffer, sizeof(valueBuffer), "%s", autoVolatilityEnabled ? "ON" : "OFF");
-    enqueueMqttMessage(topicBuffer, valueBuffer, true);
-    snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/warmStart", mqttPrefix);
-    snprintf(valueBuffer, sizeof(valueBuffer), "%s", warmStartEnabled ? "ON" : "OFF");
-    enqueueMqttMessage(topicBuffer, valueBuffer, true);
-    
-    // String settings
-    publishMqttString("bitvavoSymbol", bitvavoSymbol);
-    publishMqttString("ntfyTopic", ntfyTopic);
-    
+    s_mqttSettingsNext = 0;
+}
+
+static void publishMqttAnchorValueSetting() {
     // Anchor value - publish current price as default (or current anchor if set)
     char mqttPrefixAnchor[64];
     getMqttTopicPrefix(mqttPrefixAnchor, sizeof(mqttPrefixAnchor));
@@ -6301,7 +6008,60 @@ void publishMqttSettings() {
     
     if (anchorValueToPublish > 0.0f) {
         formatQuotePriceEur(valueBufferAnchor, sizeof(valueBufferAnchor), anchorValueToPublish);
-        enqueueMqttMessage(topicBufferAnchor, valueBufferAnchor, true);
+        enqueueMqttMessage(MQTT_CLASS_SETTINGS, topicBufferAnchor, valueBufferAnchor, true);
+    }
+}
+
+// Speciale settings (niet in schema), index 0..MQTT_SETTINGS_SPECIAL_COUNT-1
+static void publishMqttSpecialSetting(uint16_t idx) {
+    switch (idx) {
+        case 0: publishMqttUint("anchorStrategy", anchorStrategy); break;
+        case 1: publishMqttUint("language", language); break;
+        case 2: publishMqttUint("displayRotation", displayRotation); break;
+        case 3: publishMqttString("bitvavoSymbol", bitvavoSymbol); break;
+        case 4: publishMqttString("ntfyTopic", ntfyTopic); break;
+        default: publishMqttAnchorValueSetting(); break;
+    }
+}
+
+// Vult de settings-lane tot hij vol is en hervat de volgende slice bij de volgende index
+static void serviceMqttSettings() {
+    if (s_mqttSettingsNext == MQTT_SETTINGS_ROUND_IDLE) {
+        return;
+    }
+    MqttQueueClassStats st;
+    mqttQueueGetStats(MQTT_CLASS_SETTINGS, st);
+    if (st.capacity == 0) {
+        s_mqttSettingsNext = MQTT_SETTINGS_ROUND_IDLE;  // Lane niet gealloceerd: ronde heeft geen zin
+        return;
+    }
+    uint16_t room = (st.depth < st.capacity) ? (uint16_t)(st.capacity - st.depth) : 0;
+    if (room == 0) {
+        return;
+    }
+
+    char mqttPrefix[64];
+    getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
+    char topicBuffer[128];
+    char valueBuffer[32];
+    // Alle schema-settings (zelfde formattering als de state na een /set)
+    CryptoMonitorSettings settings;
+    collectSettingsFromGlobals(settings);
+    const uint16_t total = (uint16_t)(kSettingsSchemaCount + MQTT_SETTINGS_SPECIAL_COUNT);
+    while (room > 0 && s_mqttSettingsNext < total) {
+        const uint16_t i = s_mqttSettingsNext++;
+        if (i < kSettingsSchemaCount) {
+            const SettingDesc& desc = kSettingsSchema[i];
+            snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/%s", mqttPrefix, desc.key);
+            settingsSchemaFormat(desc, settings, valueBuffer, sizeof(valueBuffer));
+            enqueueMqttMessage(MQTT_CLASS_SETTINGS, topicBuffer, valueBuffer, true);
+        } else {
+            publishMqttSpecialSetting((uint16_t)(i - kSettingsSchemaCount));
+        }
+        room--;
+    }
+    if (s_mqttSettingsNext >= total) {
+        s_mqttSettingsNext = MQTT_SETTINGS_ROUND_IDLE;
     }
 }
 
@@ -6324,7 +6084,8 @@ static void formatTrendLabel(char* buffer, size_t bufferSize, const char* prefix
     snprintf(buffer, bufferSize, "%s%s", prefix, suffix);
 }
 
-void publishMqttValues(float price, float ret_1m, float ret_5m, float ret_30m) {
+// Waarden komen uit de AnalyticsSnapshot van deze tick (zelfde getallen als /status en UI)
+void publishMqttValues(const AnalyticsSnapshot& snap) {
     if (!mqttConnected) return;
     
     static unsigned long lastValuesPublishMs = 0;
@@ -6339,52 +6100,90 @@ void publishMqttValues(float price, float ret_1m, float ret_5m, float ret_30m) {
     char mqttPrefix[64];
     getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
 
-    dtostrf(price, 0, 2, buffer);
+#if MQTT_TELEMETRY_BINARY
+    // Eén packed frame i.p.v. ~11 losse publishes; onveranderde velden worden niet verstuurd
+    MqttTelemetryValues tv;
+    tv.price = snap.price;
+    tv.ret1m = snap.ret1m;
+    tv.ret5m = snap.ret5m;
+    tv.ret30m = snap.ret30m;
+    tv.ret2h = snap.ret2h;
+    tv.ret1d = snap.ret1d;
+    tv.ret7d = snap.ret7d;
+    tv.trend2h = (uint8_t)snap.trend;
+    tv.trend1d = (uint8_t)snap.trendMedium;
+    tv.trend7d = (uint8_t)snap.trendLong;
+    tv.volatility = (uint8_t)snap.volatility;
+    tv.regime = (uint8_t)snap.regime.committedRegime;
+    // Een delta is alleen bruikbaar na zijn voorganger: is er sinds de vorige ronde iets uit de
+    // values-lane verdrongen/gedropt, dan begint dit frame opnieuw met een keyframe
+    static uint32_t s_valuesDroppedSeen = 0;
+    MqttQueueClassStats vs;
+    mqttQueueGetStats(MQTT_CLASS_VALUES, vs);
+    if (vs.dropped != s_valuesDroppedSeen) {
+        s_valuesDroppedSeen = vs.dropped;
+        mqttTelemetryForceKeyframe();
+    }
+    uint8_t frame[MQTT_TELEMETRY_FRAME_MAX_LEN];
+    size_t frameLen = mqttTelemetryBuildFrame(tv, frame, sizeof(frame), MQTT_TELEMETRY_KEYFRAME_INTERVAL);
+    if (frameLen > 0) {
+        snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/frame", mqttPrefix);
+        // Via de values-lane (loop() publiceert); basis pas verschuiven als het frame in de queue staat
+        if (mqttQueueEnqueueBinary(MQTT_CLASS_VALUES, topicBuffer, frame, frameLen, false)) {
+            mqttTelemetryCommitFrame();
+        } else {
+            mqttTelemetryForceKeyframe();
+        }
+    }
+#else
+    // Via de values-lane (loop() publiceert); per topic samengevoegd als de vorige ronde nog wacht
+    dtostrf(snap.price, 0, 2, buffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/price", mqttPrefix);
-    mqttClient.publish(topicBuffer, buffer, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, buffer, false);
     
-    dtostrf(ret_1m, 0, 2, buffer);
+    dtostrf(snap.ret1m, 0, 2, buffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/return_1m", mqttPrefix);
-    mqttClient.publish(topicBuffer, buffer, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, buffer, false);
     
-    dtostrf(ret_5m, 0, 2, buffer);
+    dtostrf(snap.ret5m, 0, 2, buffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/return_5m", mqttPrefix);
-    mqttClient.publish(topicBuffer, buffer, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, buffer, false);
     
-    dtostrf(ret_30m, 0, 2, buffer);
+    dtostrf(snap.ret30m, 0, 2, buffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/return_30m", mqttPrefix);
-    mqttClient.publish(topicBuffer, buffer, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, buffer, false);
 
-    dtostrf(ret_2h, 0, 2, buffer);
+    dtostrf(snap.ret2h, 0, 2, buffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/return_2h", mqttPrefix);
-    mqttClient.publish(topicBuffer, buffer, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, buffer, false);
 
-    dtostrf(ret_1d, 0, 2, buffer);
+    dtostrf(snap.ret1d, 0, 2, buffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/return_1d", mqttPrefix);
-    mqttClient.publish(topicBuffer, buffer, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, buffer, false);
 
-    dtostrf(ret_7d, 0, 2, buffer);
+    dtostrf(snap.ret7d, 0, 2, buffer);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/return_7d", mqttPrefix);
-    mqttClient.publish(topicBuffer, buffer, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, buffer, false);
 
     char trend2h[8];
     char trend1d[8];
     char trend7d[8];
-    formatTrendLabel(trend2h, sizeof(trend2h), "2h", trendDetector.getTrendState());
-    formatTrendLabel(trend1d, sizeof(trend1d), "1d", trendDetector.getMediumTrendState());
-    formatTrendLabel(trend7d, sizeof(trend7d), "7d", trendDetector.getLongTermTrendState());
+    formatTrendLabel(trend2h, sizeof(trend2h), "2h", snap.trend);
+    formatTrendLabel(trend1d, sizeof(trend1d), "1d", snap.trendMedium);
+    formatTrendLabel(trend7d, sizeof(trend7d), "7d", snap.trendLong);
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/trend_2h", mqttPrefix);
-    mqttClient.publish(topicBuffer, trend2h, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, trend2h, false);
     
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/trend_1d", mqttPrefix);
-    mqttClient.publish(topicBuffer, trend1d, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, trend1d, false);
     
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/trend_7d", mqttPrefix);
-    mqttClient.publish(topicBuffer, trend7d, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, trend7d, false);
     
     snprintf(buffer, sizeof(buffer), "%lu", millis());
     snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/timestamp", mqttPrefix);
-    mqttClient.publish(topicBuffer, buffer, false);
+    enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, buffer, false);
+#endif // MQTT_TELEMETRY_BINARY
     
     // Publiceer IP-adres (alleen als WiFi verbonden is)
     if (WiFi.status() == WL_CONNECTED) {
@@ -6396,458 +6195,66 @@ void publishMqttValues(float price, float ret_1m, float ret_5m, float ret_30m) {
             lastIpPublishMs == 0 ||
             (nowMs - lastIpPublishMs) >= MQTT_IP_PUBLISH_INTERVAL_MS) {
             snprintf(topicBuffer, sizeof(topicBuffer), "%s/values/ip_address", mqttPrefix);
-            mqttClient.publish(topicBuffer, ipBuffer, false);
+            // Via de values-lane: deze functie draait in apiTask, PubSubClient alleen vanuit loop()
+            enqueueMqttMessage(MQTT_CLASS_VALUES, topicBuffer, ipBuffer, false);
             strncpy(lastIp, ipBuffer, sizeof(lastIp) - 1);
             lastIp[sizeof(lastIp) - 1] = '\0';
             lastIpPublishMs = nowMs;
         }
     }
-}
 
-// Publiceer MQTT Discovery berichten voor Home Assistant
-// Geoptimaliseerd: gebruik char arrays i.p.v. String om geheugenfragmentatie te voorkomen
-static void jsonEscapeString(const char* input, char* output, size_t outputSize) {
-    if (output == nullptr || outputSize == 0) return;
-    output[0] = '\0';
-    if (input == nullptr) return;
-
-    size_t out = 0;
-    for (size_t i = 0; input[i] != '\0' && out + 1 < outputSize; ++i) {
-        char c = input[i];
-        if (c == '"' || c == '\\') {
-            if (out + 2 >= outputSize) break;
-            output[out++] = '\\';
-            output[out++] = c;
-        } else {
-            output[out++] = c;
+    // Task-CPU en sampler-deadlines/backfill/jitter (zelfde fragmenten als /status), via de diag-lane
+    // (MQTT_QUEUE_DIAG_PAYLOAD_LEN); twee topics i.v.m. de slotgrootte
+    static unsigned long lastTaskStatsPublishMs = 0;
+    if (lastTaskStatsPublishMs == 0 || (nowMs - lastTaskStatsPublishMs) >= TASK_STATS_MQTT_INTERVAL_MS) {
+        char diagBuf[MQTT_QUEUE_DIAG_PAYLOAD_LEN];
+        diagBuf[0] = '{';
+        size_t n = taskTopologyFormatJson(diagBuf + 1, sizeof(diagBuf) - 2);
+        if (n > 0) {
+            diagBuf[n + 1] = '}';
+            diagBuf[n + 2] = '\0';
+            snprintf(topicBuffer, sizeof(topicBuffer), "%s/diag/tasks", mqttPrefix);
+            enqueueMqttMessage(MQTT_CLASS_DIAG, topicBuffer, diagBuf, false);
+        }
+        n = priceSamplerFormatJson(diagBuf + 1, sizeof(diagBuf) - 2);
+        if (n > 0) {
+            diagBuf[n + 1] = '}';
+            diagBuf[n + 2] = '\0';
+            snprintf(topicBuffer, sizeof(topicBuffer), "%s/diag/sampler", mqttPrefix);
+            enqueueMqttMessage(MQTT_CLASS_DIAG, topicBuffer, diagBuf, false);
         }
+        lastTaskStatsPublishMs = nowMs;
     }
-    output[out] = '\0';
 }
 
+// Publiceer MQTT Discovery berichten voor Home Assistant
+// Incrementeel: entiteiten staan als tabel in src/MqttDiscovery; hier alleen een ronde starten.
+// loop() verwerkt daarna één entiteit per slice (serviceMqttDiscovery) en slaat ongewijzigde over.
 void publishMqttDiscovery() {
-    if (!mqttConnected) return;
-    
-    // Generate device ID and device JSON string (char arrays)
     char deviceId[64];
     getMqttDeviceId(deviceId, sizeof(deviceId));
-    
-    // Haal MQTT prefix op (gebaseerd op NTFY topic voor unieke identificatie)
     char mqttPrefix[64];
     getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
-    
-    char escapedDeviceName[96];
-    char escapedDeviceModel[96];
-    jsonEscapeString(DEVICE_NAME, escapedDeviceName, sizeof(escapedDeviceName));
-    jsonEscapeString(DEVICE_MODEL, escapedDeviceModel, sizeof(escapedDeviceModel));
+    mqttDiscoveryStart(deviceId, mqttPrefix, DEVICE_NAME, DEVICE_MODEL);
+}
+
+static bool mqttDiscoveryPublishCb(const char* topic, const char* payload, bool retained) {
+    return mqttConnected && mqttClient.publish(topic, payload, retained);
+}
+
+// Eén discovery-entiteit per loop()-slice; wacht tot de event-lane leeg is (alerts eerst)
+static void serviceMqttDiscovery() {
+    if (!mqttConnected || !mqttDiscoveryActive()) {
+        return;
+    }
+    MqttQueueClassStats evt;
+    mqttQueueGetStats(MQTT_CLASS_EVENT, evt);
+    if (evt.depth > 0) {
+        return;
+    }
+    mqttDiscoveryStep(mqttDiscoveryPublishCb);
+}
 
-    char deviceJson[256];
-    snprintf(deviceJson, sizeof(deviceJson), 
-        "\"device\":{\"identifiers\":[\"%s\"],\"name\":\"%s\",\"manufacturer\":\"JanP\",\"model\":\"%s\"}",
-        deviceId, escapedDeviceName, escapedDeviceModel);
-    
-    // Buffers voor topic en payload
-    char topicBuffer[128];
-    char payloadBuffer[400];  // Verkleind van 512 naar 400 bytes (bespaart 112 bytes DRAM)
-    
-    // Discovery berichten met char arrays (geen String concatenatie)
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_spike1m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"1m Spike Threshold\",\"unique_id\":\"%s_spike1m\",\"state_topic\":\"%s/config/spike1m\",\"command_topic\":\"%s/config/spike1m/set\",\"min\":0.01,\"max\":5.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_spike5m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"5m Spike Filter\",\"unique_id\":\"%s_spike5m\",\"state_topic\":\"%s/config/spike5m\",\"command_topic\":\"%s/config/spike5m/set\",\"min\":0.01,\"max\":10.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:filter\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_move30m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"30m Move Threshold\",\"unique_id\":\"%s_move30m\",\"state_topic\":\"%s/config/move30m\",\"command_topic\":\"%s/config/move30m/set\",\"min\":0.5,\"max\":20.0,\"step\":0.1,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:trending-up\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_move5m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"5m Move Filter\",\"unique_id\":\"%s_move5m\",\"state_topic\":\"%s/config/move5m\",\"command_topic\":\"%s/config/move5m/set\",\"min\":0.1,\"max\":10.0,\"step\":0.1,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:filter-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_move5mAlert/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"5m Move Alert Threshold\",\"unique_id\":\"%s_move5mAlert\",\"state_topic\":\"%s/config/move5mAlert\",\"command_topic\":\"%s/config/move5mAlert/set\",\"min\":0.1,\"max\":10.0,\"step\":0.1,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:alert\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_cooldown1min/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"1m Cooldown\",\"unique_id\":\"%s_cooldown1min\",\"state_topic\":\"%s/config/cooldown1min\",\"command_topic\":\"%s/config/cooldown1min/set\",\"min\":10,\"max\":3600,\"step\":10,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_cooldown30min/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"30m Cooldown\",\"unique_id\":\"%s_cooldown30min\",\"state_topic\":\"%s/config/cooldown30min\",\"command_topic\":\"%s/config/cooldown30min/set\",\"min\":10,\"max\":3600,\"step\":10,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer-outline\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_cooldown5min/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"5m Cooldown\",\"unique_id\":\"%s_cooldown5min\",\"state_topic\":\"%s/config/cooldown5min\",\"command_topic\":\"%s/config/cooldown5min/set\",\"min\":10,\"max\":3600,\"step\":10,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer-sand\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/text/%s_bitvavoSymbol/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Bitvavo Market\",\"unique_id\":\"%s_bitvavoSymbol\",\"state_topic\":\"%s/config/bitvavoSymbol\",\"command_topic\":\"%s/config/bitvavoSymbol/set\",\"icon\":\"mdi:currency-btc\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/text/%s_ntfyTopic/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"NTFY Topic\",\"unique_id\":\"%s_ntfyTopic\",\"state_topic\":\"%s/config/ntfyTopic\",\"command_topic\":\"%s/config/ntfyTopic/set\",\"icon\":\"mdi:bell-ring\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_price/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Crypto Price\",\"unique_id\":\"%s_price\",\"state_topic\":\"%s/values/price\",\"unit_of_measurement\":\"EUR\",\"icon\":\"mdi:currency-btc\",\"device_class\":\"monetary\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_return_1m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"1m Return\",\"unique_id\":\"%s_return_1m\",\"state_topic\":\"%s/values/return_1m\",\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-line-variant\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_return_5m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"5m Return\",\"unique_id\":\"%s_return_5m\",\"state_topic\":\"%s/values/return_5m\",\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_return_30m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"30m Return\",\"unique_id\":\"%s_return_30m\",\"state_topic\":\"%s/values/return_30m\",\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:trending-up\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_return_2h/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Return\",\"unique_id\":\"%s_return_2h\",\"state_topic\":\"%s/values/return_2h\",\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:trending-up\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_return_1d/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"1d Return\",\"unique_id\":\"%s_return_1d\",\"state_topic\":\"%s/values/return_1d\",\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:calendar-today\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_return_7d/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"7d Return\",\"unique_id\":\"%s_return_7d\",\"state_topic\":\"%s/values/return_7d\",\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:calendar-week\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_trend_2h/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Trend 2h\",\"unique_id\":\"%s_trend_2h\",\"state_topic\":\"%s/values/trend_2h\",\"icon\":\"mdi:chart-line\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_trend_1d/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Trend 1d\",\"unique_id\":\"%s_trend_1d\",\"state_topic\":\"%s/values/trend_1d\",\"icon\":\"mdi:chart-line\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_trend_7d/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Trend 7d\",\"unique_id\":\"%s_trend_7d\",\"state_topic\":\"%s/values/trend_7d\",\"icon\":\"mdi:chart-line\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Anchor take profit
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_anchorTakeProfit/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Anchor Take Profit\",\"unique_id\":\"%s_anchorTakeProfit\",\"state_topic\":\"%s/config/anchorTakeProfit\",\"command_topic\":\"%s/config/anchorTakeProfit/set\",\"min\":0.1,\"max\":100.0,\"step\":0.1,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:cash-plus\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Anchor max loss
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_anchorMaxLoss/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Anchor Max Loss\",\"unique_id\":\"%s_anchorMaxLoss\",\"state_topic\":\"%s/config/anchorMaxLoss\",\"command_topic\":\"%s/config/anchorMaxLoss/set\",\"min\":-100.0,\"max\":-0.1,\"step\":0.1,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:cash-minus\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Anchor strategy (select entity)
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/select/%s_anchorStrategy/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"TP/SL Strategie\",\"unique_id\":\"%s_anchorStrategy\",\"state_topic\":\"%s/config/anchorStrategy\",\"command_topic\":\"%s/config/anchorStrategy/set\",\"options\":[\"0\",\"1\",\"2\"],\"icon\":\"mdi:strategy\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Anchor value (number entity for setting anchor price) - renamed to "Reset Anchor Price"
-    // Default value will be set to current price when publishing state
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_anchorValue/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Reset Anchor Price\",\"unique_id\":\"%s_anchorValue\",\"state_topic\":\"%s/config/anchorValue\",\"command_topic\":\"%s/config/anchorValue/set\",\"min\":0.01,\"max\":1000000.0,\"step\":0.01,\"unit_of_measurement\":\"EUR\",\"icon\":\"mdi:anchor\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Anchor event sensor
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_anchor_event/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Anchor Event\",\"unique_id\":\"%s_anchor_event\",\"state_topic\":\"%s/anchor/event\",\"json_attributes_topic\":\"%s/anchor/event\",\"value_template\":\"{{ value_json.event }}\",\"icon\":\"mdi:anchor\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Trend threshold
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_trendThreshold/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Trend Threshold\",\"unique_id\":\"%s_trendThreshold\",\"state_topic\":\"%s/config/trendThreshold\",\"command_topic\":\"%s/config/trendThreshold/set\",\"min\":0.1,\"max\":10.0,\"step\":0.1,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-line\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Volatility low threshold
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_volatilityLowThreshold/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Volatility Low Threshold\",\"unique_id\":\"%s_volatilityLowThreshold\",\"state_topic\":\"%s/config/volatilityLowThreshold\",\"command_topic\":\"%s/config/volatilityLowThreshold/set\",\"min\":0.01,\"max\":1.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Volatility high threshold
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_volatilityHighThreshold/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Volatility High Threshold\",\"unique_id\":\"%s_volatilityHighThreshold\",\"state_topic\":\"%s/config/volatilityHighThreshold\",\"command_topic\":\"%s/config/volatilityHighThreshold/set\",\"min\":0.01,\"max\":1.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant-shimmer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Display Rotation discovery
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_displayRotation/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Display Rotation\",\"unique_id\":\"%s_displayRotation\",\"state_topic\":\"%s/config/displayRotation\",\"command_topic\":\"%s/config/displayRotation/set\",\"min\":0,\"max\":2,\"step\":2,\"icon\":\"mdi:rotate-3d-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // IP Address sensor
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/sensor/%s_ip_address/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"IP Address\",\"unique_id\":\"%s_ip_address\",\"state_topic\":\"%s/values/ip_address\",\"icon\":\"mdi:ip-network\",%s}", deviceId, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Language select
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/select/%s_language/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Language\",\"unique_id\":\"%s_language\",\"state_topic\":\"%s/config/language\",\"command_topic\":\"%s/config/language/set\",\"options\":[\"0\",\"1\"],\"icon\":\"mdi:translate\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Display Rotation discovery
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_displayRotation/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Display Rotation\",\"unique_id\":\"%s_displayRotation\",\"state_topic\":\"%s/config/displayRotation\",\"command_topic\":\"%s/config/displayRotation/set\",\"min\":0,\"max\":2,\"step\":2,\"icon\":\"mdi:rotate-3d-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // 2-hour Alert Thresholds
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hBreakMargin/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Breakout Margin\",\"unique_id\":\"%s_2hBreakMargin\",\"state_topic\":\"%s/config/2hBreakMargin\",\"command_topic\":\"%s/config/2hBreakMargin/set\",\"min\":0.01,\"max\":5.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hBreakReset/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Breakout Reset\",\"unique_id\":\"%s_2hBreakReset\",\"state_topic\":\"%s/config/2hBreakReset\",\"command_topic\":\"%s/config/2hBreakReset/set\",\"min\":0.01,\"max\":5.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hBreakCD/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Breakout Cooldown\",\"unique_id\":\"%s_2hBreakCD\",\"state_topic\":\"%s/config/2hBreakCD\",\"command_topic\":\"%s/config/2hBreakCD/set\",\"min\":1,\"max\":18000,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hMeanMinDist/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Mean Min Distance\",\"unique_id\":\"%s_2hMeanMinDist\",\"state_topic\":\"%s/config/2hMeanMinDist\",\"command_topic\":\"%s/config/2hMeanMinDist/set\",\"min\":0.01,\"max\":10.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hMeanTouch/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Mean Touch Band\",\"unique_id\":\"%s_2hMeanTouch\",\"state_topic\":\"%s/config/2hMeanTouch\",\"command_topic\":\"%s/config/2hMeanTouch/set\",\"min\":0.01,\"max\":2.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hMeanCD/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Mean Cooldown\",\"unique_id\":\"%s_2hMeanCD\",\"state_topic\":\"%s/config/2hMeanCD\",\"command_topic\":\"%s/config/2hMeanCD/set\",\"min\":1,\"max\":10800,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hCompressTh/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Compress Threshold\",\"unique_id\":\"%s_2hCompressTh\",\"state_topic\":\"%s/config/2hCompressTh\",\"command_topic\":\"%s/config/2hCompressTh/set\",\"min\":0.01,\"max\":5.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hCompressReset/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Compress Reset\",\"unique_id\":\"%s_2hCompressReset\",\"state_topic\":\"%s/config/2hCompressReset\",\"command_topic\":\"%s/config/2hCompressReset/set\",\"min\":0.01,\"max\":10.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hCompressCD/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Compress Cooldown\",\"unique_id\":\"%s_2hCompressCD\",\"state_topic\":\"%s/config/2hCompressCD\",\"command_topic\":\"%s/config/2hCompressCD/set\",\"min\":1,\"max\":18000,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hAnchorMargin/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Anchor Margin\",\"unique_id\":\"%s_2hAnchorMargin\",\"state_topic\":\"%s/config/2hAnchorMargin\",\"command_topic\":\"%s/config/2hAnchorMargin/set\",\"min\":0.01,\"max\":5.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:anchor\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hAnchorCD/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Anchor Cooldown\",\"unique_id\":\"%s_2hAnchorCD\",\"state_topic\":\"%s/config/2hAnchorCD\",\"command_topic\":\"%s/config/2hAnchorCD/set\",\"min\":1,\"max\":18000,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Trend Hysteresis and Throttling
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hTrendHyst/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Trend Hysteresis\",\"unique_id\":\"%s_2hTrendHyst\",\"state_topic\":\"%s/config/2hTrendHyst\",\"command_topic\":\"%s/config/2hTrendHyst/set\",\"min\":0.1,\"max\":1.0,\"step\":0.01,\"icon\":\"mdi:chart-line\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hThrottleTC/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Throttle Trend Change\",\"unique_id\":\"%s_2hThrottleTC\",\"state_topic\":\"%s/config/2hThrottleTC\",\"command_topic\":\"%s/config/2hThrottleTC/set\",\"min\":1,\"max\":36000,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hThrottleTM/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Throttle Trend→Mean\",\"unique_id\":\"%s_2hThrottleTM\",\"state_topic\":\"%s/config/2hThrottleTM\",\"command_topic\":\"%s/config/2hThrottleTM/set\",\"min\":1,\"max\":18000,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hThrottleMT/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Throttle Mean Touch\",\"unique_id\":\"%s_2hThrottleMT\",\"state_topic\":\"%s/config/2hThrottleMT\",\"command_topic\":\"%s/config/2hThrottleMT/set\",\"min\":1,\"max\":18000,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hThrottleComp/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Throttle Compress\",\"unique_id\":\"%s_2hThrottleComp\",\"state_topic\":\"%s/config/2hThrottleComp\",\"command_topic\":\"%s/config/2hThrottleComp/set\",\"min\":1,\"max\":36000,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // FASE X.5: Secondary global cooldown en coalescing discovery
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hSecGlobalCD/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Secondary Global Cooldown\",\"unique_id\":\"%s_2hSecGlobalCD\",\"state_topic\":\"%s/config/2hSecGlobalCD\",\"command_topic\":\"%s/config/2hSecGlobalCD/set\",\"min\":60,\"max\":86400,\"step\":60,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer-outline\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_2hSecCoalesce/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"2h Secondary Coalesce Window\",\"unique_id\":\"%s_2hSecCoalesce\",\"state_topic\":\"%s/config/2hSecCoalesce\",\"command_topic\":\"%s/config/2hSecCoalesce/set\",\"min\":10,\"max\":600,\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer-sand\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Smart Logic & Filters
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/switch/%s_trendAdapt/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Trend-Adaptive Anchors\",\"unique_id\":\"%s_trendAdapt\",\"state_topic\":\"%s/config/trendAdapt\",\"command_topic\":\"%s/config/trendAdapt/set\",\"icon\":\"mdi:chart-line-variant\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_upMLMult/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"UP Trend Max Loss Mult\",\"unique_id\":\"%s_upMLMult\",\"state_topic\":\"%s/config/upMLMult\",\"command_topic\":\"%s/config/upMLMult/set\",\"min\":0.5,\"max\":2.0,\"step\":0.01,\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_upTPMult/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"UP Trend Take Profit Mult\",\"unique_id\":\"%s_upTPMult\",\"state_topic\":\"%s/config/upTPMult\",\"command_topic\":\"%s/config/upTPMult/set\",\"min\":0.5,\"max\":2.0,\"step\":0.01,\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_downMLMult/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"DOWN Trend Max Loss Mult\",\"unique_id\":\"%s_downMLMult\",\"state_topic\":\"%s/config/downMLMult\",\"command_topic\":\"%s/config/downMLMult/set\",\"min\":0.5,\"max\":2.0,\"step\":0.01,\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_downTPMult/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"DOWN Trend Take Profit Mult\",\"unique_id\":\"%s_downTPMult\",\"state_topic\":\"%s/config/downTPMult\",\"command_topic\":\"%s/config/downTPMult/set\",\"min\":0.5,\"max\":2.0,\"step\":0.01,\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/switch/%s_smartConf/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Smart Confluence Mode\",\"unique_id\":\"%s_smartConf\",\"state_topic\":\"%s/config/smartConf\",\"command_topic\":\"%s/config/smartConf/set\",\"icon\":\"mdi:chart-timeline-variant\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/switch/%s_nightMode/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night Mode\",\"unique_id\":\"%s_nightMode\",\"state_topic\":\"%s/config/nightMode\",\"command_topic\":\"%s/config/nightMode/set\",\"icon\":\"mdi:weather-night\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/switch/%s_autoVol/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Auto-Volatility Mode\",\"unique_id\":\"%s_autoVol\",\"state_topic\":\"%s/config/autoVol\",\"command_topic\":\"%s/config/autoVol/set\",\"icon\":\"mdi:chart-timeline-variant-shimmer\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_autoVolWin/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Auto-Volatility Window\",\"unique_id\":\"%s_autoVolWin\",\"state_topic\":\"%s/config/autoVolWin\",\"command_topic\":\"%s/config/autoVolWin/set\",\"min\":10,\"max\":120,\"step\":1,\"unit_of_measurement\":\"min\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_autoVolBase/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Auto-Volatility Baseline\",\"unique_id\":\"%s_autoVolBase\",\"state_topic\":\"%s/config/autoVolBase\",\"command_topic\":\"%s/config/autoVolBase/set\",\"min\":0.01,\"max\":1.0,\"step\":0.0001,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_autoVolMin/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Auto-Volatility Min Mult\",\"unique_id\":\"%s_autoVolMin\",\"state_topic\":\"%s/config/autoVolMin\",\"command_topic\":\"%s/config/autoVolMin/set\",\"min\":0.1,\"max\":1.0,\"step\":0.01,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_autoVolMax/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Auto-Volatility Max Mult\",\"unique_id\":\"%s_autoVolMax\",\"state_topic\":\"%s/config/autoVolMax\",\"command_topic\":\"%s/config/autoVolMax/set\",\"min\":1.0,\"max\":3.0,\"step\":0.01,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    // Warm-Start
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/switch/%s_warmStart/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Warm-Start Enabled\",\"unique_id\":\"%s_warmStart\",\"state_topic\":\"%s/config/warmStart\",\"command_topic\":\"%s/config/warmStart/set\",\"icon\":\"mdi:fire\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_ws1mExtra/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Warm-Start 1m Extra\",\"unique_id\":\"%s_ws1mExtra\",\"state_topic\":\"%s/config/ws1mExtra\",\"command_topic\":\"%s/config/ws1mExtra/set\",\"min\":0,\"max\":100,\"step\":1,\"icon\":\"mdi:fire\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_ws5m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Warm-Start 5m Candles\",\"unique_id\":\"%s_ws5m\",\"state_topic\":\"%s/config/ws5m\",\"command_topic\":\"%s/config/ws5m/set\",\"min\":2,\"max\":200,\"step\":1,\"icon\":\"mdi:fire\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_ws30m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Warm-Start 30m Candles\",\"unique_id\":\"%s_ws30m\",\"state_topic\":\"%s/config/ws30m\",\"command_topic\":\"%s/config/ws30m/set\",\"min\":2,\"max\":200,\"step\":1,\"icon\":\"mdi:fire\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_ws2h/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Warm-Start 2h Candles\",\"unique_id\":\"%s_ws2h\",\"state_topic\":\"%s/config/ws2h\",\"command_topic\":\"%s/config/ws2h/set\",\"min\":2,\"max\":200,\"step\":1,\"icon\":\"mdi:fire\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_nightStartHour/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night Start Hour\",\"unique_id\":\"%s_nightStartHour\",\"state_topic\":\"%s/config/nightStartHour\",\"command_topic\":\"%s/config/nightStartHour/set\",\"min\":0,\"max\":23,\"step\":1,\"unit_of_measurement\":\"h\",\"icon\":\"mdi:clock-start\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_nightEndHour/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night End Hour\",\"unique_id\":\"%s_nightEndHour\",\"state_topic\":\"%s/config/nightEndHour\",\"command_topic\":\"%s/config/nightEndHour/set\",\"min\":0,\"max\":23,\"step\":1,\"unit_of_measurement\":\"h\",\"icon\":\"mdi:clock-end\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_nightSpike5m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night 5m Spike Filter\",\"unique_id\":\"%s_nightSpike5m\",\"state_topic\":\"%s/config/nightSpike5m\",\"command_topic\":\"%s/config/nightSpike5m/set\",\"min\":0.01,\"max\":10.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:filter\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_nightMove5m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night 5m Move Threshold\",\"unique_id\":\"%s_nightMove5m\",\"state_topic\":\"%s/config/nightMove5m\",\"command_topic\":\"%s/config/nightMove5m/set\",\"min\":0.01,\"max\":10.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:trending-up\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_nightMove30m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night 30m Move Threshold\",\"unique_id\":\"%s_nightMove30m\",\"state_topic\":\"%s/config/nightMove30m\",\"command_topic\":\"%s/config/nightMove30m/set\",\"min\":0.01,\"max\":20.0,\"step\":0.01,\"unit_of_measurement\":\"%%\",\"icon\":\"mdi:trending-up\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_nightCd5m/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night 5m Cooldown\",\"unique_id\":\"%s_nightCd5m\",\"state_topic\":\"%s/config/nightCd5m\",\"command_topic\":\"%s/config/nightCd5m/set\",\"min\":60,\"max\":7200,\"step\":10,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_nightAvMin/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night Auto-Vol Min\",\"unique_id\":\"%s_nightAvMin\",\"state_topic\":\"%s/config/nightAvMin\",\"command_topic\":\"%s/config/nightAvMin/set\",\"min\":0.1,\"max\":3.0,\"step\":0.01,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    snprintf(topicBuffer, sizeof(topicBuffer), "homeassistant/number/%s_nightAvMax/config", deviceId);
-    snprintf(payloadBuffer, sizeof(payloadBuffer), "{\"name\":\"Night Auto-Vol Max\",\"unique_id\":\"%s_nightAvMax\",\"state_topic\":\"%s/config/nightAvMax\",\"command_topic\":\"%s/config/nightAvMax/set\",\"min\":0.1,\"max\":5.0,\"step\":0.01,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\",%s}", deviceId, mqttPrefix, mqttPrefix, deviceJson);
-    mqttClient.publish(topicBuffer, payloadBuffer, true);
-    delay(50);
-    
-    Serial_println("[MQTT] Discovery messages published");
-}
-
-// MQTT connect functie (niet-blokkerend)
 void connectMQTT() {
     if (mqttConnected) return;
     Serial.println(F("[MQTTSRC] entered connectMQTT body"));
@@ -6906,6 +6313,8 @@ void connectMQTT() {
     // Geef MQTT meer ademruimte bij lange API-calls
     mqttClient.setKeepAlive(60);
     mqttClient.setSocketTimeout(10);
+    // Discovery-payloads (incl. device-blok) passen niet in de standaard 256-byte client buffer
+    mqttClient.setBufferSize(768);
     
     // Geoptimaliseerd: gebruik char array i.p.v. String
     // Gebruik dynamische MQTT prefix (gebaseerd op NTFY topic voor unieke identificatie)
@@ -6925,137 +6334,21 @@ void connectMQTT() {
         Serial_println("[MQTT] Connected!");
         mqttConnected = true;
         mqttReconnectAttemptCount = 0; // Reset counter bij succesvolle verbinding
+#if MQTT_TELEMETRY_BINARY
+        mqttTelemetryForceKeyframe(); // Eerste frame na (re)connect altijd volledig
+#endif
         
         // Geoptimaliseerd: gebruik char arrays i.p.v. String voor subscribe topics
         // Gebruik dynamische MQTT prefix (gebaseerd op NTFY topic voor unieke identificatie)
         char mqttPrefix[64];
         getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
         char topicBuffer[128];
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/spike1m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/spike5m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/move30m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/move5m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightSpike5m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightMove5m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightMove30m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/cooldown1min/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/cooldown30min/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/bitvavoSymbol/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/ntfyTopic/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        // button/reset subscribe verwijderd - gebruik nu anchorValue number entity
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/anchorTakeProfit/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/anchorMaxLoss/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/anchorValue/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/anchorStrategy/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/language/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/displayRotation/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        
-        // Subscribe to 2h alert threshold settings
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hBreakMargin/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hBreakReset/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hBreakCD/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hMeanMinDist/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hMeanTouch/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hMeanCD/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hCompressTh/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hCompressReset/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hCompressCD/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hAnchorMargin/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hAnchorCD/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hTrendHyst/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hThrottleTC/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hThrottleTM/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hThrottleMT/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/2hThrottleComp/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        
-        // Subscribe to smart logic & filters
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/trendAdapt/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/upMLMult/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/upTPMult/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/downMLMult/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/downTPMult/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/smartConf/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightMode/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/autoVol/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/autoVolWin/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/autoVolBase/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/autoVolMin/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/autoVolMax/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightAvMin/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightAvMax/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        
-        // Subscribe to warm-start settings
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/warmStart/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/ws1mExtra/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/ws5m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/ws30m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/ws2h/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightStartHour/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightEndHour/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/nightCd5m/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        
-        // Subscribe to cooldown5min (was missing)
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/cooldown5min/set", mqttPrefix);
-        mqttClient.subscribe(topicBuffer);
-        
-        // Subscribe to move5mAlert (was missing)
-        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/move5mAlert/set", mqttPrefix);
+        // Eén wildcard-subscribe voor alle config-commando's; mqttCallback dispatcht via SettingsSchema
+        snprintf(topicBuffer, sizeof(topicBuffer), "%s/config/+/set", mqttPrefix);
         mqttClient.subscribe(topicBuffer);
+
+        // Home Assistant birth message: bij "online" discovery opnieuw volledig publiceren
+        mqttClient.subscribe("homeassistant/status");
         
         unsigned long nowMs = millis();
         // Settings: rate-limit om queue druk te voorkomen (1x per 10 min)
@@ -7065,16 +6358,11 @@ void connectMQTT() {
         } else {
             Serial_println("[MQTT] Settings publish skipped (rate-limited)");
         }
-        // Discovery is zwaar: publiceer 1x per boot of max 1x per 6 uur
-        if (!mqttDiscoveryPublished || (nowMs - mqttLastDiscoveryMs) >= 21600000UL) {
-            publishMqttDiscovery();
-            mqttDiscoveryPublished = true;
-            mqttLastDiscoveryMs = nowMs;
-        } else {
-            Serial_println("[MQTT] Discovery skipped (recently published)");
-        }
+        // Discovery: ronde starten bij elke connect; alleen gewijzigde entiteiten (hash) gaan naar de broker
+        publishMqttDiscovery();
         
         // Process queued messages after reconnection
+        serviceMqttSettings();
         processMqttQueue();
         
     } else {
@@ -8466,6 +7754,60 @@ TwoHMetrics computeTwoHMetrics()
     return metrics;
 }
 
+// Vul en publiceer de AnalyticsSnapshot uit de actuele globale state (aanroeper houdt dataMutex)
+// ret1m/ret5m/twoH/livePct* zijn in fetchPrice al berekend en worden hier alleen overgenomen.
+static AnalyticsSnapshot publishAnalyticsSnapshotLocked(float ret1m, float ret5m, const TwoHMetrics& twoH,
+                                                        uint8_t livePct30, uint8_t livePct120)
+{
+    AnalyticsSnapshot snap;
+    snap.tickMs = lastApiMs;
+    snap.price = isValidPrice(prices[0]) ? prices[0] : 0.0f;
+    snap.ret1m = ret1m;
+    snap.ret5m = ret5m;
+    snap.ret30m = ret_30m;
+    snap.ret2h = ret_2h;
+    snap.ret4h = ret_4h;
+    snap.ret1d = ret_1d;
+    snap.ret7d = ret_7d;
+    snap.hasRet30m = hasRet30m;
+    snap.hasRet2h = hasRet2h;
+    snap.hasRet4h = hasRet4h;
+    snap.hasRet1d = hasRet1d;
+    snap.hasRet7d = hasRet7d;
+    snap.livePct5m = livePct5m;
+    snap.livePct30m = livePct30;
+    snap.livePct2h = livePct120;
+    snap.trend = trendDetector.getTrendState();
+    snap.trendMedium = trendDetector.getMediumTrendState();
+    snap.trendLong = trendDetector.getLongTermTrendState();
+    snap.volatility = volatilityTracker.getVolatilityState();
+    snap.volume = lastVolumeRange1m;
+    snap.twoH = twoH;
+    snap.regime = regimeEngineGetSnapshot();
+    snap.anchorActive = anchorActive;
+    if (anchorActive && isValidPrice(anchorPrice)) {
+        snap.anchorPrice = anchorPrice;
+        if (snap.price > 0.0f && anchorPrice > 0.0f) {
+            snap.anchorDeltaPct = ((snap.price - anchorPrice) / anchorPrice) * 100.0f;
+        }
+    }
+    analyticsSnapshotPublish(snap);
+
+    // Render-task krijgt de waarden van deze tick mee (geen dataMutex/globals lezen in uiTask)
+    if (snap.price > 0.0f) {
+        const UiPriceCardCmd card = {snap.price, (uint32_t)snap.tickMs};
+        uiCommandPostPriceCard(card);
+    }
+    const UiMarketStateCmd state = {(uint8_t)snap.trend, (uint8_t)snap.trendMedium, (uint8_t)snap.trendLong,
+                                    (uint8_t)snap.volatility, (uint8_t)snap.regime.committedRegime};
+    static UiMarketStateCmd s_lastPostedState = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    if (memcmp(&state, &s_lastPostedState, sizeof(state)) != 0) {
+        s_lastPostedState = state;
+        uiCommandPostMarketState(state);
+    }
+    return snap;
+}
+
 // Add price to second array (called every second)
 // Geoptimaliseerd: bounds checking toegevoegd voor robuustheid
 // Korte buffers: priceData.addPriceToSecondArray() alleen vanuit priceRepeatTask (1 Hz sampler)
@@ -8525,6 +7867,7 @@ static void updateHourlyAverage()
     if (hourIndex == 0) {
         hourArrayFilled = true;
     }
+    chartHistoryBarClosed(CHART_SRC_HOUR);
 }
 
 // Periodieke sanity check voor live minutenbuffer (voor 1m/5m/30m/2h)
@@ -8631,6 +7974,7 @@ static void updateMinuteAverage()
     minuteIndex = (minuteIndex + 1) % MINUTES_FOR_30MIN_CALC;
     if (minuteIndex == 0)
         minuteArrayFilled = true;
+    chartHistoryBarClosed(CHART_SRC_MINUTE);
     
     
     // Update hourly aggregate buffer
@@ -8813,7 +8157,9 @@ static void bootNetWaitApiGateIfNeeded(const char *reason) {
     Serial.printf(F("[BootNet] API delayed start (%s, wait ~%lu ms)\n"), reason ? reason : "?",
                   (unsigned long)(s_bootNetApiGateUntilMs - now));
     while (millis() < s_bootNetApiGateUntilMs) {
-        lv_timer_handler();
+        if (uiMayTouchLvgl()) {
+            lv_timer_handler();
+        }
         delay(10);
     }
     Serial.println(F("[BootNet] API start now"));
@@ -8822,6 +8168,7 @@ static void bootNetWaitApiGateIfNeeded(const char *reason) {
 
 void fetchPrice()
 {
+    TRACE_SPAN(TRACE_FETCH_PRICE);
     // Controleer eerst of WiFi verbonden is
     if (WiFi.status() != WL_CONNECTED) {
         #if !DEBUG_BUTTON_ONLY
@@ -9200,15 +8547,16 @@ void fetchPrice()
             
             // Kopieer waarden voor gebruik BUITEN mutex
             float fetchedLocal = fetched;
-            float ret1mLocal = ret_1m;
-            float ret5mLocal = ret_5m;
-            float ret30mLocal = ret_30m;
             float manualAnchorLocal = anchorActive ? anchorPrice : 0.0f;
 
             // Fase A regime-engine: na return-berekening, vóór alertEngine (geen wijziging aan alertlogica)
             TwoHMetrics regimeTwoH = computeTwoHMetrics();
             regimeEngineTick(millis(), ret_1m, ret_5m, ret_30m, ret_2h,
                              regimeTwoH.rangePct, regimeTwoH.valid);
+
+            // Eén snapshot per tick: web/UI/MQTT/alerts lezen deze i.p.v. zelf te herberekenen
+            const AnalyticsSnapshot tickSnap = publishAnalyticsSnapshotLocked(ret_1m, ret_5m, regimeTwoH,
+                                                                              livePct30, livePct120);
             
             // Phase 1: Auto-anchor uitgeschakeld (alleen manual anchor)
             safeMutexGive(dataMutex, "fetchPrice");  // MUTEX EERST VRIJGEVEN!
@@ -9216,7 +8564,7 @@ void fetchPrice()
             
             // Check thresholds and send notifications if needed (met ret_5m voor extra filtering)
             // Fase 6.1.11: Gebruik AlertEngine module i.p.v. globale functie
-            alertEngine.checkAndNotify(ret1mLocal, ret5mLocal, ret30mLocal);
+            alertEngine.checkAndNotify(tickSnap.ret1m, tickSnap.ret5m, tickSnap.ret30m);
             
             // Check anchor take profit / max loss alerts
             // Fase 6.2.7: Gebruik AnchorSystem module i.p.v. globale functie
@@ -9224,10 +8572,10 @@ void fetchPrice()
             
             // Check 2-hour notifications (breakout, breakdown, compression, mean reversion, anchor context)
             // Wordt aangeroepen na elke price update
-            AlertEngine::check2HNotifications(fetchedLocal, manualAnchorLocal);
+            AlertEngine::check2HNotifications(fetchedLocal, manualAnchorLocal, tickSnap.twoH);
             
             // Publiceer waarden naar MQTT
-            publishMqttValues(fetchedLocal, ret1mLocal, ret5mLocal, ret30mLocal);
+            publishMqttValues(tickSnap);
             if (postOkTrace) {
                 Serial.println(F("[POSTOK] leaving fetchPrice success path"));
                 s_postOkDiagSeq++;
@@ -9485,7 +8833,7 @@ void checkButton() {
         
         // Phase 1: Anchor set in apiTask context (queue; geen HTTPS in button/UI task)
         if (queueAnchorSetting(0.0f, true)) {
-            uiController.updateUI();
+            uiCommandPost(UI_CMD_REFRESH);
         } else {
             Serial_println("[Button] WARN: Kon anchor niet in queue zetten");
         }
@@ -9666,7 +9014,7 @@ static void setupSerialAndDevice()
     trendDetector.begin();  // begin() synchroniseert state met globale variabelen
     
     // Fase 5.2: Initialize VolatilityTracker (volatiliteit tracking module)
-    volatilityTracker.begin();  // begin() synchroniseert state met globale variabelen
+    volatilityTracker.begin();  // begin() reset de streaming schatters en neemt volatilityState over
     
     // Fase 6.1: Initialize AlertEngine (alert detection module)
     alertEngine.begin();
@@ -10230,90 +9578,45 @@ static void startFreeRTOSTasks()
     }
 #endif
     
-    // Core 1: API calls (elke seconde)
-    xTaskCreatePinnedToCore(
-        apiTask,           // Task function
-        "API_Task",        // Task name
-        apiTaskStack,      // Stack size (platform-specifiek)
-        NULL,              // Parameters
-        1,                 // Priority
-        &s_apiTaskHandle,  // Task handle (o.a. ntfy wake na enqueue)
-        1                  // Core 1
-    );
-
-    // Core 1: Periodieke prijs herhaling (elke 2 seconden) - onafhankelijk van API calls
-    // Stack size moet groot genoeg zijn voor mutex calls en Serial.printf
-    xTaskCreatePinnedToCore(
-        priceRepeatTask,   // Task function
-        "PriceRepeat",     // Task name
-        priceRepeatTaskStack, // Stack size
-        NULL,              // Parameters
-        1,                 // Priority (zelfde als API task)
-        NULL,              // Task handle
-        1                  // Core 1
-    );
-
-    // Core 2: UI updates (elke seconde)
-    xTaskCreatePinnedToCore(
-        uiTask,            // Task function
-        "UI_Task",         // Task name
-        uiTaskStack,       // Stack size (platform-specifiek)
-        NULL,              // Parameters
-        1,                 // Priority
-        NULL,              // Task handle
-        0                  // Core 0 (Arduino loop core)
-    );
-
-    // Web task, Dummy_Task, inline web in PriceRepeat, of geen web.
-#if WEBTASK_PRESENT_BUT_INERT_TEST
-    {
-        const BaseType_t webTaskCore =
+    // Task-topologie als tabel: stack uit het profiel hierboven, core/prioriteit/periode per task.
+    // Web-variant (task, inline in PriceRepeat, Dummy_Task of uit) volgt de compile-time toggles.
+    const BaseType_t webTaskCore =
 #if WEBTASK_FORCE_CORE1_FOR_DIAG
-            (BaseType_t)1
+        (BaseType_t)1;
 #else
-            (BaseType_t)0
-#endif
-            ;
-        xTaskCreatePinnedToCore(
-            webTask, "Web_Task", webTaskStack, NULL, 1, NULL, webTaskCore);
-    }
-    // webTask draait in INERT-modus (direct suspend); zie [WEBTASKCFG] present_but_inert_test.
+        (BaseType_t)0;
+#endif
+    (void)webTaskCore;
+    const TaskSpec taskTable[] = {
+        // naam          functie          stack                 prio core         periode (ms)              handle
+        {"API_Task",    apiTask,         apiTaskStack,         1,   1,           UPDATE_API_INTERVAL,      &s_apiTaskHandle},
+        {"PriceRepeat", priceRepeatTask, priceRepeatTaskStack, 1,   1,           PRICE_SAMPLE_INTERVAL_MS, nullptr},
+        {"UI_Task",     uiTask,          uiTaskStack,          1,   0,           UPDATE_UI_INTERVAL,       nullptr},
+#if WEBTASK_PRESENT_BUT_INERT_TEST
+        // webTask draait in INERT-modus (direct suspend); zie [WEBTASKCFG] present_but_inert_test.
+        {"Web_Task",    webTask,         webTaskStack,         1,   webTaskCore, 0,                        nullptr},
 #elif INLINE_DUMMY_IN_PRICEREPEAT_DIAG && !WEB_RUNTIME_INLINE_IN_PRICE_TASK
-    // Geen extra xTaskCreate voor Web/Dummy; zie [INLINECFG] en priceRepeatTask.
+        // Geen extra task voor Web/Dummy; zie [INLINECFG] en priceRepeatTask.
 #elif WEB_RUNTIME_INLINE_IN_PRICE_TASK
-    // Geen webTask: serviceWebServerInlineSlice() in priceRepeatTask — zie [WEBRUNTIMECFG].
+        // Geen webTask: serviceWebServerInlineSlice() in priceRepeatTask — zie [WEBRUNTIMECFG].
 #elif EXTRA_DUMMY_TASK_DIAG
-    logDummyTaskMem("dummy pre-create");
-    xTaskCreatePinnedToCore(
-        dummyDiagTask,     // Task function
-        "Dummy_Task",      // Task name
-        webTaskStack,      // zelfde als Web_Task
-        NULL,              // Parameters
-        1,                 // Priority (zelfde als webTask)
-        NULL,              // Task handle
-        1                  // Core 1 (zoals skeleton webTask op Core 1)
-    );
-    logDummyTaskMem("dummy post-create");
+        // Zelfde stack/prioriteit als Web_Task, op Core 1 (zoals skeleton webTask)
+        {"Dummy_Task",  dummyDiagTask,   webTaskStack,         1,   1,           0,                        nullptr},
 #elif !BOOT_DIAG_DISABLE_WEB_TASK
-    {
-        const BaseType_t webTaskCore =
-#if WEBTASK_FORCE_CORE1_FOR_DIAG
-            (BaseType_t)1
-#else
-            (BaseType_t)0
-#endif
-            ;
-        xTaskCreatePinnedToCore(
-            webTask,           // Task function
-            "Web_Task",        // Task name
-            webTaskStack,      // Stack size (platform-specifiek)
-            NULL,              // Parameters
-            1,                 // Priority
-            NULL,              // Task handle
-            webTaskCore
-        );
+        {"Web_Task",    webTask,         webTaskStack,         1,   webTaskCore, WEB_TASK_WAKE_MS,         nullptr},
+#endif
+    };
+
+#if EXTRA_DUMMY_TASK_DIAG && !WEBTASK_PRESENT_BUT_INERT_TEST && !INLINE_DUMMY_IN_PRICEREPEAT_DIAG && !WEB_RUNTIME_INLINE_IN_PRICE_TASK
+    logDummyTaskMem("dummy pre-create");
+#endif
+    if (!taskTopologyStart(stackProfile, taskTable, sizeof(taskTable) / sizeof(taskTable[0]))) {
+        Serial.println(F("[FreeRTOS] WARN: niet alle tasks aangemaakt (zie [TaskTopo])"));
     }
-#else
+#if EXTRA_DUMMY_TASK_DIAG && !WEBTASK_PRESENT_BUT_INERT_TEST && !INLINE_DUMMY_IN_PRICEREPEAT_DIAG && !WEB_RUNTIME_INLINE_IN_PRICE_TASK
+    logDummyTaskMem("dummy post-create");
+#elif BOOT_DIAG_DISABLE_WEB_TASK && !WEBTASK_PRESENT_BUT_INERT_TEST && !INLINE_DUMMY_IN_PRICEREPEAT_DIAG \
+    && !WEB_RUNTIME_INLINE_IN_PRICE_TASK && !EXTRA_DUMMY_TASK_DIAG
     Serial.println(F("[BOOT_DIAG] Web_Task not started (BOOT_DIAG_DISABLE_WEB_TASK)"));
 #endif
 
@@ -10363,6 +9666,9 @@ void setup()
     // Ringbuffers en gerelateerde heap-arrays voor alle platforms (vroeg in setup, vóór verdere init)
     allocateDynamicArrays();
     logBootStage("after arrays");
+
+    // MQTT queue lanes: groot in PSRAM als beschikbaar, anders compact DRAM-profiel
+    mqttQueueBegin(hasPSRAM());
     
     // Allocate Bitvavo streaming buffer on heap (fallback naar static)
     if (bitvavoStreamBuffer == bitvavoStreamBufferFallback) {
@@ -10456,6 +9762,13 @@ void setup()
                        ret_2h, ret_30m, hasRet2h, hasRet30m,
                        req1mCandles, req5mCandles, req30mCandles, req2hCandles);
     }
+    // Eerste snapshot met warm-start returns (UI/web tonen die al vóór de eerste live tick)
+    if (safeMutexTake(dataMutex, pdMS_TO_TICKS(500), "setup analytics snapshot")) {
+        publishAnalyticsSnapshotLocked(calculateReturn1MinuteReadOnly(), calculateReturn5Minutes(),
+                                       computeTwoHMetrics(),
+                                       calcLivePctMinuteAverages(30), calcLivePctMinuteAverages(120));
+        safeMutexGive(dataMutex, "setup analytics snapshot");
+    }
     logBootStage("after warmstart");
     
     // Diagnostiek: startup-NTFY-test na warmstart (no-op tenzij CRYPTO_ALERT_NTFY_DIAGNOSTICS_RUNTIME + STARTUP_TEST).
@@ -10908,6 +10221,7 @@ void apiTask(void *parameter)
             logHeap("API_TASK_LOOP");
             lastHeapLog = t0;
         }
+        taskTopologyTick(t0);
         
         // Controleer WiFi status voordat we een request doet
         if (WiFi.status() == WL_CONNECTED) {
@@ -11075,10 +10389,7 @@ void apiTask(void *parameter)
     }
 }
 
-// --- Web handleClient timing (gedeeld door webTask en priceRepeat inline-runtime) — lokaal, zie WEB_TASK_WAKE_MS ---
-#ifndef WEB_TASK_WAKE_MS
-#define WEB_TASK_WAKE_MS 200
-#endif
+// --- Web handleClient timing (gedeeld door webTask en priceRepeat inline-runtime); WEB_TASK_WAKE_MS staat bij Timing Configuration ---
 #ifndef WEB_HANDLE_IDLE_MS
 #define WEB_HANDLE_IDLE_MS 1000
 #endif
@@ -11134,11 +10445,42 @@ static void serviceWebServerInlineSlice(void)
 #endif
 #endif  // !WEBTRACE_HANDLECLIENT_NOOP_INLINE_TEST
     }
+    webServerModule.pollLivePush();
 }
 #endif  // WEB_RUNTIME_INLINE_IN_PRICE_TASK
 
+static void priceSamplerSink(uint32_t slot, float price, DataSource src)
+{
+    priceData.addPriceToSecondArray(price, src);
+    volatilityTracker.feedSecondPrice(slot, price);
+}
+
+// Eén sampler-run: actuele prijs + aanvulling van gemiste slots (PriceSampler)
+static void priceRepeatSampleSlot()
+{
+    const bool sampled = dataMutex != nullptr && safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "priceRepeatTask");
+    if (sampled) {
+        float p = latestKnownPrice;
+        const uint32_t nowMs = (uint32_t)millis();
+        const uint32_t nowBucket = nowMs / 1000UL;
+        if (wsSecondAggLastClosed.valid) {
+            const uint32_t ageBuckets = (nowBucket >= wsSecondAggLastClosed.secondBucket)
+                ? (nowBucket - wsSecondAggLastClosed.secondBucket)
+                : (UINT32_MAX - wsSecondAggLastClosed.secondBucket + nowBucket + 1U);
+            if (ageBuckets <= 1U && wsSecondAggLastClosed.secondClose > 0.0f) {
+                p = wsSecondAggLastClosed.secondClose;
+            }
+        }
+        priceSamplerRun(nowMs, p, priceSamplerSink);
+        safeMutexGive(dataMutex, "priceRepeatTask");
+    } else {
+        priceSamplerRecordLockSkip();
+    }
+}
+
 // FreeRTOS Task: 1 Hz sampler — enige schrijver naar secondPrices/fiveMinutePrices (addPriceToSecondArray)
 // Bron: primair laatst afgesloten WS-seconde-close, fallback latestKnownPrice; API-poll blijft UPDATE_API_INTERVAL
+// Wekt op slotgrens + PRICE_SAMPLER_PHASE_MS (deadline) i.p.v. een vaste delay na het werk
 void priceRepeatTask(void *parameter)
 {
 #if STACK_DIAG_TASK_STACK_HWM
@@ -11176,7 +10518,6 @@ void priceRepeatTask(void *parameter)
 #if WEB_RUNTIME_INLINE_IN_PRICE_TASK && !PRICE_REPEAT_CLASSIC_LOOP_TEST && !WEBTASK_PRESENT_BUT_INERT_TEST
     TickType_t lastWakeTime = xTaskGetTickCount();
     const TickType_t kPriceWakeTicks = pdMS_TO_TICKS(WEB_TASK_WAKE_MS);
-    unsigned long lastSampleAtMs = 0;
     for (;;) {
 #if WEB_RUNTIME_INLINE_SKIP_SERVICE_SLICE_TEST
         {
@@ -11190,28 +10531,9 @@ void priceRepeatTask(void *parameter)
         serviceWebServerInlineSlice();
 #endif
 
-        const unsigned long tNow = millis();
-        if (lastSampleAtMs == 0UL) {
-            lastSampleAtMs = tNow;
-        }
-        if ((tNow - lastSampleAtMs) >= (unsigned long)PRICE_SAMPLE_INTERVAL_MS) {
-            lastSampleAtMs = tNow;
-            if (dataMutex != nullptr && safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "priceRepeatTask")) {
-                float p = latestKnownPrice;
-                const uint32_t nowBucket = (uint32_t)(millis() / 1000UL);
-                if (wsSecondAggLastClosed.valid) {
-                    const uint32_t ageBuckets = (nowBucket >= wsSecondAggLastClosed.secondBucket)
-                        ? (nowBucket - wsSecondAggLastClosed.secondBucket)
-                        : (UINT32_MAX - wsSecondAggLastClosed.secondBucket + nowBucket + 1U);
-                    if (ageBuckets <= 1U && wsSecondAggLastClosed.secondClose > 0.0f) {
-                        p = wsSecondAggLastClosed.secondClose;
-                    }
-                }
-                if (p > 0.0f) {
-                    priceData.addPriceToSecondArray(p);
-                }
-                safeMutexGive(dataMutex, "priceRepeatTask");
-            }
+        // Slot-gestuurd: bij een trage web-slice worden overgeslagen seconden bij de volgende run aangevuld
+        if (priceSamplerSlotDue((uint32_t)millis())) {
+            priceRepeatSampleSlot();
         }
 
 #if STACK_DIAG_TASK_STACK_HWM
@@ -11242,24 +10564,9 @@ void priceRepeatTask(void *parameter)
             }
         }
 #endif
-        if (dataMutex != nullptr && safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "priceRepeatTask")) {
-            float p = latestKnownPrice;
-            const uint32_t nowBucket = (uint32_t)(millis() / 1000UL);
-            if (wsSecondAggLastClosed.valid) {
-                const uint32_t ageBuckets = (nowBucket >= wsSecondAggLastClosed.secondBucket)
-                    ? (nowBucket - wsSecondAggLastClosed.secondBucket)
-                    : (UINT32_MAX - wsSecondAggLastClosed.secondBucket + nowBucket + 1U);
-                if (ageBuckets <= 1U && wsSecondAggLastClosed.secondClose > 0.0f) {
-                    p = wsSecondAggLastClosed.secondClose;
-                }
-            }
-            if (p > 0.0f) {
-                priceData.addPriceToSecondArray(p);
-            }
-            safeMutexGive(dataMutex, "priceRepeatTask");
-        }
+        priceRepeatSampleSlot();
 
-        vTaskDelay(pdMS_TO_TICKS(PRICE_SAMPLE_INTERVAL_MS));
+        vTaskDelay(pdMS_TO_TICKS(priceSamplerMsUntilNextSlot((uint32_t)millis())));
     }
 #else
     // WEB_RUNTIME_INLINE_IN_PRICE_TASK && PRICE_REPEAT_CLASSIC_LOOP_TEST: zelfde body als legacy loop hierboven.
@@ -11275,24 +10582,9 @@ void priceRepeatTask(void *parameter)
             }
         }
 #endif
-        if (dataMutex != nullptr && safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "priceRepeatTask")) {
-            float p = latestKnownPrice;
-            const uint32_t nowBucket = (uint32_t)(millis() / 1000UL);
-            if (wsSecondAggLastClosed.valid) {
-                const uint32_t ageBuckets = (nowBucket >= wsSecondAggLastClosed.secondBucket)
-                    ? (nowBucket - wsSecondAggLastClosed.secondBucket)
-                    : (UINT32_MAX - wsSecondAggLastClosed.secondBucket + nowBucket + 1U);
-                if (ageBuckets <= 1U && wsSecondAggLastClosed.secondClose > 0.0f) {
-                    p = wsSecondAggLastClosed.secondClose;
-                }
-            }
-            if (p > 0.0f) {
-                priceData.addPriceToSecondArray(p);
-            }
-            safeMutexGive(dataMutex, "priceRepeatTask");
-        }
+        priceRepeatSampleSlot();
 
-        vTaskDelay(pdMS_TO_TICKS(PRICE_SAMPLE_INTERVAL_MS));
+        vTaskDelay(pdMS_TO_TICKS(priceSamplerMsUntilNextSlot((uint32_t)millis())));
     }
 #endif  // WEB_RUNTIME_INLINE / PRICE_REPEAT_CLASSIC_LOOP_TEST branches
 }
@@ -11309,6 +10601,8 @@ void uiTask(void *parameter)
 #endif
     
     Serial.println("[UI Task] Gestart op Core 0");
+    // Vanaf hier raakt alleen deze task LVGL en het display aan; andere tasks posten UiCommands
+    uiCommandSetRenderTask();
 #if STACK_DIAG_TASK_STACK_HWM
     Serial.printf("[STACK][UI] HWM=%u bytes (task start)\n", stackDiagHwmBytes());
 #endif
@@ -11339,8 +10633,27 @@ void uiTask(void *parameter)
         }
 #endif
         
-        // Apply deferred display rotation on UI core
-        applyPendingDisplayRotation();
+        // UI-commando's van andere tasks (gecoalesced: per type alleen de laatste)
+        uint32_t uiCmdArgs[UI_CMD_COUNT];
+        const uint32_t uiCmds = uiCommandTakeAll(uiCmdArgs);
+        if (uiCmds & (1u << UI_CMD_ROTATE)) {
+            applyDisplayRotation((uint8_t)uiCmdArgs[UI_CMD_ROTATE]);
+        }
+        if (uiCmds & (1u << UI_CMD_PRICE_CARD)) {
+            UiPriceCardCmd card;
+            uiCommandReadPriceCard(card);
+            uiController.applyPriceCard(card);
+        }
+        if (uiCmds & (1u << UI_CMD_MARKET_STATE)) {
+            UiMarketStateCmd state;
+            uiCommandReadMarketState(state);
+            uiController.applyMarketState(state);
+        }
+        // Gepost REFRESH blijft staan tot updateUI() echt gedraaid heeft (writer kan de mutex houden)
+        static bool s_uiRefreshPending = false;
+        if (uiCmds & (1u << UI_CMD_REFRESH)) {
+            s_uiRefreshPending = true;
+        }
         
 #if BOOT_DIAG_MINIMAL_UI_LOAD
         {
@@ -11360,9 +10673,10 @@ void uiTask(void *parameter)
                 if (dataMutex != nullptr) {
                     xSemaphoreGive(dataMutex);
                 }
-                if (nowMs - s_diagLastUpdateUiMs >= kDiagUpdateUiMs) {
+                if (s_uiRefreshPending || nowMs - s_diagLastUpdateUiMs >= kDiagUpdateUiMs) {
                     s_diagLastUpdateUiMs = nowMs;
                     uiController.updateUI();
+                    s_uiRefreshPending = false;
                 }
             }
         }
@@ -11381,12 +10695,15 @@ void uiTask(void *parameter)
         
         // UI mag niet lang in een mutex zitten (LVGL kan blocken).
         // We checken alleen kort of er geen writer actief is, en updaten daarna zonder lock.
+        // Ook een geposte REFRESH wacht op een vrije mutex (updateUI leest nog globals); lukt het
+        // niet, dan blijft hij pending voor de volgende ronde
         if (dataMutex == nullptr || xSemaphoreTake(dataMutex, 0) == pdTRUE) {
             if (dataMutex != nullptr) {
                 xSemaphoreGive(dataMutex);
             }
             // Fase 8.8.1: Gebruik module versie (parallel - oude functie blijft bestaan)
             uiController.updateUI();
+            s_uiRefreshPending = false;
         }
 #endif
         
@@ -11596,6 +10913,8 @@ void webTask(void *parameter)
 #endif
             }
 #endif
+            // Live push (SSE): eigen cadans (WEB_TASK_WAKE_MS), los van de idle/burst handleClient-throttle
+            webServerModule.pollLivePush();
 #if STACK_DIAG_TASK_STACK_HWM
             if (!s_loggedHwmAfterFirstHandle) {
                 s_loggedHwmAfterFirstHandle = true;
@@ -11670,9 +10989,12 @@ void loop()
                 lastMqttReconnectAttempt = millis(); // voorkom immediate reconnect storm
                 // mqttReconnectAttemptCount wordt NIET gereset, zodat exponential backoff blijft werken
             } else {
-                // Process queued messages when connected
+                // Process queued messages when connected (tijdslice, zie MQTT_QUEUE_DRAIN_BUDGET_MS)
                 processMqttQueue();
+                serviceMqttSettings();
+                serviceMqttDiscovery();
             }
+            logMqttQueueStatsIfDue();
         } else if (WiFi.status() == WL_CONNECTED) {
             unsigned long now = millis();
             // Probeer MQTT reconnect als WiFi verbonden is (met exponential backoff); init-delay zit in connectMQTT().
@@ -11838,7 +11160,9 @@ void loop()
             bool reconnected = false;
             while (WiFi.status() != WL_CONNECTED && (millis() - reconnectStart) < 10000) {
                 delay(100);
-                lv_timer_handler(); // Geef LVGL tijd om te renderen tijdens reconnect
+                if (uiMayTouchLvgl()) {
+                    lv_timer_handler(); // Geef LVGL tijd om te renderen tijdens reconnect
+                }
             }
             
             if (WiFi.status() == WL_CONNECTED) {
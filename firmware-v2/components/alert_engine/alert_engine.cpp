@@ -14,6 +14,7 @@
 #include "config_store/config_store.hpp"
 #include "domain_metrics/domain_metrics.hpp"
 #include "diagnostics/diagnostics.hpp"
+#include "diagnostics/trace.hpp"
 #include "market_data/market_data.hpp"
 #include "service_outbound/service_outbound.hpp"
 #include "esp_log.h"
@@ -369,6 +370,7 @@ esp_err_t init()
 
 void tick()
 {
+    DIAG_TRACE_SPAN(AlertTick);
     const int64_t now_ms = static_cast<int64_t>(esp_timer_get_time() / 1000LL);
     bool fired_conf_this_tick = false;
     bool fired_1m_this_tick = false;
@@ -455,7 +457,7 @@ void tick()
         if (!s_m010f_logged_vol_unready_info) {
             s_m010f_logged_vol_unready_info = true;
             ESP_LOGI(TAG,
-                     "M-010f: vol metric nog niet klaar (min. paren in venster) — eff. drempels = "
+                     "M-010f: vol metric nog niet klaar (min. 1s-returns) — eff. drempels = "
                      "basis (normal ‰) tot vol beschikbaar is");
         }
     }
@@ -468,6 +470,8 @@ void tick()
     s_regime_obs.vol_metric_ready = volm.ready;
     s_regime_obs.vol_mean_abs_step_bps = volm.ready ? volm.mean_abs_step_bps : 0.0;
     s_regime_obs.vol_pairs_used = volm.pairs_used;
+    const VolSurfaceSnapshot &vs = domain_metrics::vol_surface();
+    std::memcpy(s_regime_obs.vol_surface, vs.h, sizeof(s_regime_obs.vol_surface));
     s_regime_obs.vol_unavailable_fallback = !volm.ready;
     std::strncpy(s_regime_obs.regime, regime_label(regime), sizeof(s_regime_obs.regime) - 1);
     s_regime_obs.regime[sizeof(s_regime_obs.regime) - 1] = '\0';
@@ -3,6 +3,7 @@
 #include <cstdint>
 
 #include "esp_err.h"
+#include "VolSurface.h"
 
 namespace alert_engine {
 
@@ -73,9 +74,12 @@ struct AlertEngineRuntimeStatsSnapshot {
 /** Laatst bekende regime/vol/drempels (bijgewerkt aan het begin van elke `tick()`). Veldnamen stabiel voor JSON. */
 struct RegimeObservabilitySnapshot {
     bool vol_metric_ready{false};
-    /** `domain_metrics::compute_vol_mean_abs_step_bps` — gemiddelde |Δ| in bps (~1s-stappen). */
+    /** `domain_metrics::compute_vol_mean_abs_step_bps` — verwachte |Δ| per seconde in bps (uit vol-surface). */
     double vol_mean_abs_step_bps{0.0};
+    /** Meegetelde 1s-returns in de 1s-horizon. */
     uint32_t vol_pairs_used{0};
+    /** Vol-surface per horizon (1s/1m/5m/1h); `volPerMinPct` is onderling vergelijkbaar. */
+    VolHorizonStats vol_surface[VOL_HORIZON_COUNT]{};
     /** Geen vol-metric (warmup): regime gedropt naar normal, schaal 1000‰. */
     bool vol_unavailable_fallback{false};
     /** `"calm"` | `"normal"` | `"hot"` */
@@ -69,121 +69,78 @@ static void html_escape_text(const char *src, char *dst, size_t dst_sz)
     dst[j] = '\0';
 }
 
-static void add_one_timeframe_to_root(cJSON *root,
-                                      const char *key_json,
-                                      Entry *ring,
-                                      uint32_t *seq_ptr,
-                                      bool is_5m)
+/** Kopie onder de mutex; bij timeout een lege lijst (`count` 0). */
+static void write_one_timeframe(json_stream::Writer &w,
+                                const char *key_json,
+                                const Entry *ring,
+                                const uint32_t *seq_ptr,
+                                bool is_5m)
 {
     Entry copy[k_ring]{};
-    uint32_t seq_copy = 0;
-    if (!root || !s_mu) {
+    size_t nvalid = 0;
+    if (!s_mu) {
         return;
     }
-    if (xSemaphoreTake(s_mu, pdMS_TO_TICKS(100)) != pdTRUE) {
-        cJSON *wrap = cJSON_CreateObject();
-        cJSON *arr = cJSON_CreateArray();
-        if (wrap && arr) {
-            cJSON_AddItemToObject(wrap, "items", arr);
-            cJSON_AddNumberToObject(wrap, "count", 0);
-            cJSON_AddItemToObject(root, key_json, wrap);
-        } else {
-            cJSON_Delete(wrap);
-            cJSON_Delete(arr);
+    if (xSemaphoreTake(s_mu, pdMS_TO_TICKS(100)) == pdTRUE) {
+        const uint32_t seq_copy = *seq_ptr;
+        nvalid = (seq_copy < static_cast<uint32_t>(k_ring)) ? static_cast<size_t>(seq_copy) : k_ring;
+        for (size_t i = 0; i < nvalid; ++i) {
+            const size_t idx = (seq_copy > 0 ? (seq_copy - 1u - i) : 0u) % k_ring;
+            copy[i] = ring[idx];
         }
-        return;
-    }
-    seq_copy = *seq_ptr;
-    const size_t nvalid =
-        (seq_copy < static_cast<uint32_t>(k_ring)) ? static_cast<size_t>(seq_copy) : k_ring;
-    for (size_t i = 0; i < nvalid; ++i) {
-        const size_t idx = (seq_copy > 0 ? (seq_copy - 1u - i) : 0u) % k_ring;
-        copy[i] = ring[idx];
+        xSemaphoreGive(s_mu);
     }
-    xSemaphoreGive(s_mu);
 
-    cJSON *wrap = cJSON_CreateObject();
-    cJSON *arr = cJSON_CreateArray();
-    if (!wrap || !arr) {
-        cJSON_Delete(wrap);
-        cJSON_Delete(arr);
-        return;
-    }
+    w.begin_object(key_json);
+    w.begin_array("items");
     for (size_t i = 0; i < nvalid; ++i) {
         const Entry &e = copy[i];
-        cJSON *o = cJSON_CreateObject();
-        if (!o) {
-            continue;
-        }
-        cJSON_AddStringToObject(o, "symbol", e.symbol[0] ? e.symbol : "?");
-        cJSON_AddBoolToObject(o, "up", e.up);
-        cJSON_AddNumberToObject(o, "price_eur", e.price_eur);
-        if (is_5m) {
-            cJSON_AddNumberToObject(o, "pct_5m", e.pct_1m);
-        } else {
-            cJSON_AddNumberToObject(o, "pct_1m", e.pct_1m);
-        }
-        cJSON_AddNumberToObject(o, "ts_ms", static_cast<double>(e.ts_ms));
-        cJSON_AddItemToArray(arr, o);
-    }
-    cJSON_AddItemToObject(wrap, "items", arr);
-    cJSON_AddNumberToObject(wrap, "count", static_cast<double>(nvalid));
-    cJSON_AddItemToObject(root, key_json, wrap);
+        w.begin_object();
+        w.str("symbol", e.symbol[0] ? e.symbol : "?");
+        w.boolean("up", e.up);
+        w.number("price_eur", e.price_eur);
+        w.number(is_5m ? "pct_5m" : "pct_1m", e.pct_1m);
+        w.int64("ts_ms", e.ts_ms);
+        w.end_object();
+    }
+    w.end_array();
+    w.number("count", static_cast<double>(nvalid));
+    w.end_object();
 }
 
-static void add_conf_to_root(cJSON *root)
+static void write_conf(json_stream::Writer &w)
 {
     EntryConf copy[k_ring]{};
-    uint32_t seq_copy = 0;
-    if (!root || !s_mu) {
+    size_t nvalid = 0;
+    if (!s_mu) {
         return;
     }
-    if (xSemaphoreTake(s_mu, pdMS_TO_TICKS(100)) != pdTRUE) {
-        cJSON *wrap = cJSON_CreateObject();
-        cJSON *arr = cJSON_CreateArray();
-        if (wrap && arr) {
-            cJSON_AddItemToObject(wrap, "items", arr);
-            cJSON_AddNumberToObject(wrap, "count", 0);
-            cJSON_AddItemToObject(root, "alerts_conf_1m5m", wrap);
-        } else {
-            cJSON_Delete(wrap);
-            cJSON_Delete(arr);
+    if (xSemaphoreTake(s_mu, pdMS_TO_TICKS(100)) == pdTRUE) {
+        const uint32_t seq_copy = s_seq_conf;
+        nvalid = (seq_copy < static_cast<uint32_t>(k_ring)) ? static_cast<size_t>(seq_copy) : k_ring;
+        for (size_t i = 0; i < nvalid; ++i) {
+            const size_t idx = (seq_copy > 0 ? (seq_copy - 1u - i) : 0u) % k_ring;
+            copy[i] = s_ring_conf[idx];
         }
-        return;
-    }
-    seq_copy = s_seq_conf;
-    const size_t nvalid =
-        (seq_copy < static_cast<uint32_t>(k_ring)) ? static_cast<size_t>(seq_copy) : k_ring;
-    for (size_t i = 0; i < nvalid; ++i) {
-        const size_t idx = (seq_copy > 0 ? (seq_copy - 1u - i) : 0u) % k_ring;
-        copy[i] = s_ring_conf[idx];
+        xSemaphoreGive(s_mu);
     }
-    xSemaphoreGive(s_mu);
 
-    cJSON *wrap = cJSON_CreateObject();
-    cJSON *arr = cJSON_CreateArray();
-    if (!wrap || !arr) {
-        cJSON_Delete(wrap);
-        cJSON_Delete(arr);
-        return;
-    }
+    w.begin_object("alerts_conf_1m5m");
+    w.begin_array("items");
     for (size_t i = 0; i < nvalid; ++i) {
         const EntryConf &e = copy[i];
-        cJSON *o = cJSON_CreateObject();
-        if (!o) {
-            continue;
-        }
-        cJSON_AddStringToObject(o, "symbol", e.symbol[0] ? e.symbol : "?");
-        cJSON_AddBoolToObject(o, "up", e.up);
-        cJSON_AddNumberToObject(o, "price_eur", e.price_eur);
-        cJSON_AddNumberToObject(o, "pct_1m", e.pct_1m);
-        cJSON_AddNumberToObject(o, "pct_5m", e.pct_5m);
-        cJSON_AddNumberToObject(o, "ts_ms", static_cast<double>(e.ts_ms));
-        cJSON_AddItemToArray(arr, o);
-    }
-    cJSON_AddItemToObject(wrap, "items", arr);
-    cJSON_AddNumberToObject(wrap, "count", static_cast<double>(nvalid));
-    cJSON_AddItemToObject(root, "alerts_conf_1m5m", wrap);
+        w.begin_object();
+        w.str("symbol", e.symbol[0] ? e.symbol : "?");
+        w.boolean("up", e.up);
+        w.number("price_eur", e.price_eur);
+        w.number("pct_1m", e.pct_1m);
+        w.number("pct_5m", e.pct_5m);
+        w.int64("ts_ms", e.ts_ms);
+        w.end_object();
+    }
+    w.end_array();
+    w.number("count", static_cast<double>(nvalid));
+    w.end_object();
 }
 
 } // namespace (anonymous)
@@ -275,14 +232,11 @@ void record_conf_1m5m_alert(const char *symbol,
     ESP_LOGD(TAG, "M-010d: recorded conf sym=%s 1m=%.4f 5m=%.4f", e.symbol, pct_1m, pct_5m);
 }
 
-void add_alerts_to_cjson(cJSON *root)
+void write_alerts_json(json_stream::Writer &w)
 {
-    if (!root) {
-        return;
-    }
-    add_one_timeframe_to_root(root, "alerts_1m", s_ring, &s_seq, false);
-    add_one_timeframe_to_root(root, "alerts_5m", s_ring5, &s_seq5, true);
-    add_conf_to_root(root);
+    write_one_timeframe(w, "alerts_1m", s_ring, &s_seq, false);
+    write_one_timeframe(w, "alerts_5m", s_ring5, &s_seq5, true);
+    write_conf(w);
 }
 
 int append_alerts_html_section(char *out, size_t cap)
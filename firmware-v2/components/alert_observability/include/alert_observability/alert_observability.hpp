@@ -1,7 +1,7 @@
 #pragma once
 
-#include "cJSON.h"
 #include "esp_err.h"
+#include "json_stream/json_stream.hpp"
 
 #include <cstddef>
 #include <cstdint>
@@ -27,8 +27,8 @@ void record_conf_1m5m_alert(const char *symbol,
                             double pct_5m,
                             int64_t ts_ms);
 
-/** Voegt `alerts_1m`, `alerts_5m`, `alerts_conf_1m5m` toe (nieuwste eerst). */
-void add_alerts_to_cjson(cJSON *root);
+/** Schrijft `alerts_1m`, `alerts_5m`, `alerts_conf_1m5m` in het open object van `w` (nieuwste eerst). */
+void write_alerts_json(json_stream::Writer &w);
 
 /**
  * Schrijft compacte HTML voor 1m-alerts (h2 + lijst of lege staat).
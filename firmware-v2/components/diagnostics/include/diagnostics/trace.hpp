@@ -0,0 +1,98 @@
+#pragma once
+
+/**
+ * Hot-path tracepoints (CPU cycle counter) — vaste span-ID's, statische tabel, geen heap.
+ *
+ * Per span: count/som/min/max sinds boot + log-lineair histogram (4 sub-buckets per octaaf, µs)
+ * voor p50/p99. Histogramtellers halveren bij verzadiging (recente samples wegen zwaarder).
+ * Start-cycles en core staan in het Scope-object op de stack van de aanroepende taak; wisselt
+ * de taak tijdens de span van core, dan wordt het sample verworpen (`migrated`).
+ *
+ * Gebruik: `DIAG_TRACE_SPAN(RestFetch);` bovenaan de functie. Met CONFIG_DIAG_TRACE_ENABLE=n
+ * compileert de macro naar niets. Uitlezen: GET /metrics (webui, Prometheus-tekst).
+ */
+#include "sdkconfig.h"
+#include <cstddef>
+#include <cstdint>
+
+#if CONFIG_DIAG_TRACE_ENABLE
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#endif
+
+namespace diagnostics::trace {
+
+enum class SpanId : uint8_t {
+    RestFetch = 0, ///< exchange_bitvavo::rest::fetch_ticker_price (incl. TLS/HTTP)
+    WsMessage,     ///< Bitvavo WS DATA-event (parse + snapshot-update)
+    AlertTick,     ///< alert_engine::tick
+    UiRefresh,     ///< ui::refresh_from_snapshot (incl. LVGL-lock)
+    NtfySend,      ///< ntfy_client HTTPS POST
+    MqttPublish,   ///< mqtt_bridge publish (enqueue in esp-mqtt)
+    Count
+};
+
+constexpr size_t kSpanCount = static_cast<size_t>(SpanId::Count);
+constexpr unsigned kHistSubBits = 2;
+constexpr unsigned kHistBuckets = 96;          ///< 1 µs .. ~33 s
+constexpr int64_t kCycleWrapGuardUs = 10000000; ///< Langere spans: esp_timer i.p.v. cycle counter
+
+struct SpanStats {
+    uint32_t count;
+    uint32_t migrated;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint64_t sum_cycles;
+    uint32_t p50_us; ///< Bovengrens histogram-bucket (afgekapt op max_us)
+    uint32_t p99_us;
+    char task[16];   ///< Taak die de span het laatst registreerde
+};
+
+#if CONFIG_DIAG_TRACE_ENABLE
+
+void record(SpanId id, uint32_t start_cycles, int64_t start_us, int start_core);
+
+class Scope {
+public:
+    explicit Scope(SpanId id)
+        : id_(id), core_(esp_cpu_get_core_id()), start_us_(esp_timer_get_time()),
+          start_cycles_(static_cast<uint32_t>(esp_cpu_get_cycle_count()))
+    {
+    }
+    ~Scope() { record(id_, start_cycles_, start_us_, core_); }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+private:
+    SpanId id_;
+    int core_;
+    int64_t start_us_;
+    uint32_t start_cycles_;
+};
+
+#define DIAG_TRACE_CONCAT_INNER(a, b) a##b
+#define DIAG_TRACE_CONCAT(a, b) DIAG_TRACE_CONCAT_INNER(a, b)
+#define DIAG_TRACE_SPAN(id) \
+    ::diagnostics::trace::Scope DIAG_TRACE_CONCAT(diag_trace_span_, __LINE__)(::diagnostics::trace::SpanId::id)
+
+#else
+
+#define DIAG_TRACE_SPAN(id) \
+    do {                    \
+    } while (0)
+
+#endif // CONFIG_DIAG_TRACE_ENABLE
+
+const char *span_name(SpanId id);
+
+/** false als tracing uit staat (out = nullen). */
+bool get_stats(SpanId id, SpanStats *out);
+
+/** Tekst-sink (bijv. httpd_resp_sendstr_chunk); chunk is nul-getermineerd. */
+using MetricsSink = void (*)(const char *chunk, void *ctx);
+
+/** Alle spans + heap/uptime in Prometheus-tekstformaat, één of enkele regels per sink-call. */
+void write_metrics(MetricsSink sink, void *ctx);
+
+} // namespace diagnostics::trace
@@ -0,0 +1,240 @@
+#include "diagnostics/trace.hpp"
+#include "esp_heap_caps.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace diagnostics::trace {
+
+namespace {
+
+constexpr const char *k_span_names[kSpanCount] = {
+    "rest_fetch",
+    "ws_message",
+    "alert_tick",
+    "ui_refresh",
+    "ntfy_send",
+    "mqtt_publish",
+};
+
+#if CONFIG_DIAG_TRACE_ENABLE
+
+struct Slot {
+    uint32_t count;
+    uint32_t migrated;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint64_t sum_cycles;
+    uint16_t hist[kHistBuckets];
+    char task[16];
+};
+
+static Slot s_slots[kSpanCount];
+static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+
+/** Waarden < 4 exact, daarna 4 sub-buckets per macht van 2. */
+static unsigned bucket_for_us(uint32_t us)
+{
+    constexpr uint32_t sub = 1u << kHistSubBits;
+    if (us < sub) {
+        return us;
+    }
+    const uint32_t msb = 31u - static_cast<uint32_t>(__builtin_clz(us));
+    const uint32_t shift = msb - kHistSubBits;
+    const uint32_t idx = (msb - kHistSubBits + 1u) * sub + ((us >> shift) & (sub - 1u));
+    return idx < kHistBuckets ? idx : kHistBuckets - 1;
+}
+
+static uint32_t bucket_upper_us(unsigned idx)
+{
+    constexpr uint32_t sub = 1u << kHistSubBits;
+    if (idx < sub) {
+        return idx;
+    }
+    const uint32_t shift = idx / sub - 1u;
+    const uint32_t lower = (sub + idx % sub) << shift;
+    return lower + (1u << shift) - 1u;
+}
+
+static uint32_t percentile_us(const uint16_t *hist, uint32_t total, uint32_t permille)
+{
+    if (total == 0) {
+        return 0;
+    }
+    const uint32_t target = (total * permille + 999u) / 1000u;
+    uint32_t acc = 0;
+    for (unsigned i = 0; i < kHistBuckets; ++i) {
+        acc += hist[i];
+        if (acc >= target) {
+            return bucket_upper_us(i);
+        }
+    }
+    return bucket_upper_us(kHistBuckets - 1);
+}
+
+#endif // CONFIG_DIAG_TRACE_ENABLE
+
+} // namespace
+
+#if CONFIG_DIAG_TRACE_ENABLE
+
+void record(SpanId id, uint32_t start_cycles, int64_t start_us, int start_core)
+{
+    const uint32_t end_cycles = static_cast<uint32_t>(esp_cpu_get_cycle_count());
+    const size_t i = static_cast<size_t>(id);
+    if (i >= kSpanCount) {
+        return;
+    }
+    Slot &slot = s_slots[i];
+    if (esp_cpu_get_core_id() != start_core) {
+        portENTER_CRITICAL(&s_mux);
+        slot.migrated++;
+        portEXIT_CRITICAL(&s_mux);
+        return;
+    }
+
+    const int64_t elapsed_us = esp_timer_get_time() - start_us;
+    uint32_t cycles = 0;
+    uint32_t us;
+    if (elapsed_us >= kCycleWrapGuardUs) {
+        us = elapsed_us > static_cast<int64_t>(UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(elapsed_us);
+    } else {
+        cycles = end_cycles - start_cycles;
+        const uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+        us = cycles / (ticks_per_us ? ticks_per_us : 1u);
+    }
+    const unsigned bucket = bucket_for_us(us);
+    const char *task_name = pcTaskGetName(nullptr);
+
+    portENTER_CRITICAL(&s_mux);
+    if (slot.count == 0 || us < slot.min_us) {
+        slot.min_us = us;
+    }
+    if (us > slot.max_us) {
+        slot.max_us = us;
+    }
+    slot.count++;
+    slot.sum_us += us;
+    slot.sum_cycles += cycles;
+    if (slot.hist[bucket] == UINT16_MAX) {
+        for (unsigned b = 0; b < kHistBuckets; ++b) {
+            slot.hist[b] >>= 1;
+        }
+    }
+    slot.hist[bucket]++;
+    if (task_name && strncmp(slot.task, task_name, sizeof(slot.task) - 1) != 0) {
+        strncpy(slot.task, task_name, sizeof(slot.task) - 1);
+        slot.task[sizeof(slot.task) - 1] = '\0';
+    }
+    portEXIT_CRITICAL(&s_mux);
+}
+
+#endif // CONFIG_DIAG_TRACE_ENABLE
+
+const char *span_name(SpanId id)
+{
+    const size_t i = static_cast<size_t>(id);
+    return i < kSpanCount ? k_span_names[i] : "?";
+}
+
+bool get_stats(SpanId id, SpanStats *out)
+{
+    if (!out) {
+        return false;
+    }
+    memset(out, 0, sizeof(*out));
+#if CONFIG_DIAG_TRACE_ENABLE
+    const size_t i = static_cast<size_t>(id);
+    if (i >= kSpanCount) {
+        return false;
+    }
+    uint16_t hist[kHistBuckets];
+    portENTER_CRITICAL(&s_mux);
+    const Slot &slot = s_slots[i];
+    out->count = slot.count;
+    out->migrated = slot.migrated;
+    out->min_us = slot.min_us;
+    out->max_us = slot.max_us;
+    out->sum_us = slot.sum_us;
+    out->sum_cycles = slot.sum_cycles;
+    memcpy(out->task, slot.task, sizeof(out->task));
+    memcpy(hist, slot.hist, sizeof(hist));
+    portEXIT_CRITICAL(&s_mux);
+
+    uint32_t total = 0;
+    for (unsigned b = 0; b < kHistBuckets; ++b) {
+        total += hist[b];
+    }
+    out->p50_us = percentile_us(hist, total, 500);
+    out->p99_us = percentile_us(hist, total, 990);
+    if (out->p50_us > out->max_us) {
+        out->p50_us = out->max_us;
+    }
+    if (out->p99_us > out->max_us) {
+        out->p99_us = out->max_us;
+    }
+    return true;
+#else
+    (void)id;
+    return false;
+#endif
+}
+
+void write_metrics(MetricsSink sink, void *ctx)
+{
+    if (!sink) {
+        return;
+    }
+    char line[192];
+    sink("# HELP crypto_span_duration_us Hot-path span duur in microseconden\n"
+         "# TYPE crypto_span_duration_us summary\n",
+         ctx);
+    for (size_t i = 0; i < kSpanCount; ++i) {
+        SpanStats st{};
+        if (!get_stats(static_cast<SpanId>(i), &st)) {
+            continue;
+        }
+        const char *name = k_span_names[i];
+        const char *task = st.task[0] ? st.task : "-";
+        snprintf(line, sizeof(line),
+                 "crypto_span_duration_us{span=\"%s\",task=\"%s\",quantile=\"0.5\"} %" PRIu32 "\n"
+                 "crypto_span_duration_us{span=\"%s\",task=\"%s\",quantile=\"0.99\"} %" PRIu32 "\n",
+                 name, task, st.p50_us, name, task, st.p99_us);
+        sink(line, ctx);
+        snprintf(line, sizeof(line),
+                 "crypto_span_duration_us_sum{span=\"%s\",task=\"%s\"} %" PRIu64 "\n"
+                 "crypto_span_duration_us_count{span=\"%s\",task=\"%s\"} %" PRIu32 "\n",
+                 name, task, st.sum_us, name, task, st.count);
+        sink(line, ctx);
+        snprintf(line, sizeof(line),
+                 "crypto_span_min_us{span=\"%s\"} %" PRIu32 "\n"
+                 "crypto_span_max_us{span=\"%s\"} %" PRIu32 "\n"
+                 "crypto_span_mean_us{span=\"%s\"} %" PRIu32 "\n",
+                 name, st.min_us, name, st.max_us, name,
+                 st.count ? static_cast<uint32_t>(st.sum_us / st.count) : 0u);
+        sink(line, ctx);
+        snprintf(line, sizeof(line),
+                 "crypto_span_cycles_total{span=\"%s\"} %" PRIu64 "\n"
+                 "crypto_span_migrated_total{span=\"%s\"} %" PRIu32 "\n",
+                 name, st.sum_cycles, name, st.migrated);
+        sink(line, ctx);
+    }
+
+    snprintf(line, sizeof(line),
+             "crypto_heap_free_bytes %u\n"
+             "crypto_heap_largest_block_bytes %u\n"
+             "crypto_heap_min_free_bytes %u\n"
+             "crypto_uptime_seconds %" PRId64 "\n",
+             static_cast<unsigned>(heap_caps_get_free_size(MALLOC_CAP_8BIT)),
+             static_cast<unsigned>(heap_caps_get_largest_free_block(MALLOC_CAP_8BIT)),
+             static_cast<unsigned>(heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT)),
+             static_cast<int64_t>(esp_timer_get_time() / 1000000));
+    sink(line, ctx);
+}
+
+} // namespace diagnostics::trace
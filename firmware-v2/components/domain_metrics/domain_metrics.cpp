@@ -2,15 +2,25 @@
  * M-010a: rolling samples (prijs + tijd) — sober; cadence volgt caller (typ. app_core-lus).
  * M-010b: canonicalisatie naar 1 representatieve secondewaarde (TWAP-achtig gemiddelde).
  * M-010c: 5m-metric op dezelfde ring (cap > 5 min canonieke seconden).
- * M-010f: gemiddelde | stap | tussen opeenvolgende canonieke secondes (bps) als vol-proxy.
+ * M-010f: realised vol per horizon (1s/1m/5m/1h) via de gedeelde VolSurface-kern uit v1
+ *         (src/VolSurface): O(1) per canonieke seconde, geen vensterloop meer.
+ * M-010g: seconde-indeling op exchange-tijd i.p.v. pollmoment. Offset (exchange − lokaal) via een
+ *         max-filter op trade-paren (alleen Bitvavo; voeden alleen de klok, niet de prijs) en op ticks met
+ *         exchange-ts van elke provider. De offset hoort bij één provider: bij wissel/failover opnieuw.
+ *         Ticks met exchange-ts gaan via die offset naar de lokale tijdas, anders telt de lokale
+ *         ontvangsttijd. Een watermark houdt recente secondes open zodat laat binnenkomende ticks nog in
+ *         hun eigen seconde landen.
  */
 #include "domain_metrics/domain_metrics.hpp"
 #include "diagnostics/diagnostics.hpp"
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "sdkconfig.h"
+#include "VolSurface.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 
 #ifndef CONFIG_ALERT_REGIME_VOL_WINDOW_SEC
@@ -19,11 +29,8 @@
 #ifndef CONFIG_ALERT_REGIME_VOL_MIN_PAIRS
 #define CONFIG_ALERT_REGIME_VOL_MIN_PAIRS 30
 #endif
-#ifndef CONFIG_ALERT_REGIME_VOL_PAIR_MIN_MS
-#define CONFIG_ALERT_REGIME_VOL_PAIR_MIN_MS 800
-#endif
-#ifndef CONFIG_ALERT_REGIME_VOL_PAIR_MAX_MS
-#define CONFIG_ALERT_REGIME_VOL_PAIR_MAX_MS 2200
+#ifndef CONFIG_DM_CANONICAL_WATERMARK_MS
+#define CONFIG_DM_CANONICAL_WATERMARK_MS 0
 #endif
 
 namespace domain_metrics {
@@ -35,6 +42,14 @@ static const char TAG[] = DIAG_TAG_METRICS;
 /** ≥5m canonieke seconden + marge (1m- en 5m-metrics delen dezelfde ring). */
 static constexpr size_t k_ring_cap = 400;
 
+/** M-010g: seconde S is definitief zodra de lokale klok (S+1)·1000 + watermark passeert. */
+static constexpr int64_t k_watermark_ms = CONFIG_DM_CANONICAL_WATERMARK_MS;
+/** Genoeg open secondes voor het maximale watermark (5000 ms → ~7 tegelijk). */
+static constexpr size_t k_open_buckets = 8;
+/** Offset-max-filter over twee blokken van 30 s: volgt klokdrift zonder oude maxima vast te houden. */
+static constexpr int64_t k_offset_block_ms = 30000;
+static constexpr uint32_t k_offset_min_samples = 3;
+
 struct Sample {
     int64_t ts_ms{0};
     double price_eur{0.0};
@@ -49,14 +64,33 @@ struct SecondBucket {
     double last_price{0.0};
 };
 
+struct ClockOffset {
+    int64_t cur_max{INT64_MIN};
+    int64_t prev_max{INT64_MIN};
+    int64_t block_start_local_ms{0};
+    /** Dedup per bron: hetzelfde paar komt elke feed()-ronde terug. */
+    int64_t last_trade_local_ms{0};
+    int64_t last_tick_local_ms{0};
+    uint32_t samples{0};
+    /** Provider (+ failover-teller) waarvoor de offset geldt. */
+    char provider[sizeof(market_data::MarketSnapshot::feed_provider)]{};
+    uint32_t failovers{0};
+};
+
 static Sample s_ring[k_ring_cap]{};
 static size_t s_head{0};
 static size_t s_count{0};
-static SecondBucket s_bucket{};
-/** Laatste bekende EUR-prijs; voor carry-forward als een wandklok-seconde geen nieuwe WS-ts kreeg. */
+static SecondBucket s_open[k_open_buckets]{};
+/** Laatst afgesloten canonieke seconde; -1 = nog geen. */
+static int64_t s_last_final_sec{-1};
+/** Laatste canonieke EUR-prijs; voor carry-forward als een seconde geen tick kreeg. */
 static double s_carry_price_eur{0.0};
-/** Dedup: zelfde `last_tick.ts_ms` niet opnieuw in dezelfde seconde tellen (voorkomt 10×/s spam bij 100 ms-loop). */
+/** Dedup: zelfde `last_tick.ts_ms` niet opnieuw tellen (voorkomt 10×/s spam bij 100 ms-loop). */
 static int64_t s_last_merged_tick_ts_ms{-1};
+static ClockOffset s_offset{};
+static CanonicalClockStats s_clock_stats{};
+/** M-010f: vol-surface over dezelfde canonieke secondes als de ring (carry-seconden inbegrepen). */
+static VolSurfaceEngine s_vol{};
 
 static void ring_push(const Sample &s)
 {
@@ -79,6 +113,14 @@ static void ring_prune_before(int64_t now_ms, int64_t horizon_ms)
     }
 }
 
+/** Canonieke seconde opslaan: ring (1m/5m-moves) + vol-surface. */
+static void store_second(const Sample &s)
+{
+    ring_prune_before(s.ts_ms, 360000); // M-010c: ≥5m historie + marge (parallel aan 1m-metric)
+    ring_push(s);
+    s_vol.feed(static_cast<uint32_t>(s.ts_ms / 1000LL), static_cast<float>(s.price_eur));
+}
+
 static bool ring_latest(Sample *out)
 {
     if (s_count == 0 || !out) {
@@ -89,7 +131,7 @@ static bool ring_latest(Sample *out)
     return true;
 }
 
-/** Vul ontbrekende wandklok-seconden (carry-prijs) als de hoofdloop een seconde oversloeg. */
+/** Vul canonieke seconden zonder tick met de carry-prijs. */
 static void push_carry_seconds(int64_t from_sec_inclusive, int64_t to_sec_exclusive)
 {
     if (s_carry_price_eur <= 0.0 || from_sec_inclusive >= to_sec_exclusive) {
@@ -99,44 +141,159 @@ static void push_carry_seconds(int64_t from_sec_inclusive, int64_t to_sec_exclus
         Sample s{};
         s.ts_ms = sec * 1000LL + 999LL;
         s.price_eur = s_carry_price_eur;
-        ring_prune_before(s.ts_ms, 360000);
-        ring_push(s);
+        store_second(s);
+        ++s_clock_stats.carry_seconds;
     }
 }
 
-static void bucket_reset()
+static void finalize_bucket(SecondBucket &b)
 {
-    s_bucket = {};
-}
-
-static void finalize_bucket()
-{
-    if (!s_bucket.active) {
+    if (!b.active || b.tick_count == 0) {
+        b = {};
         return;
     }
-    double canonical_price = 0.0;
-    if (s_bucket.tick_count > 0) {
-        canonical_price =
-            s_bucket.sum_price / static_cast<double>(s_bucket.tick_count);
-    } else if (s_carry_price_eur > 0.0) {
-        /* Geen nieuw WS-bericht in deze wandklok-seconde — prijs gelijk houden voor 1×/s ring. */
-        canonical_price = s_carry_price_eur;
-    } else {
-        return;
+    if (s_last_final_sec >= 0) {
+        push_carry_seconds(s_last_final_sec + 1, b.sec_epoch);
     }
+    const double canonical_price = b.sum_price / static_cast<double>(b.tick_count);
     Sample s{};
-    s.ts_ms = (s_bucket.sec_epoch * 1000LL) + 999LL;
+    s.ts_ms = (b.sec_epoch * 1000LL) + 999LL;
     s.price_eur = canonical_price;
-    ring_prune_before(s.ts_ms, 360000); // M-010c: ≥5m historie + marge (parallel aan 1m-metric)
-    ring_push(s);
+    store_second(s);
+    s_last_final_sec = b.sec_epoch;
+    s_carry_price_eur = b.last_price;
     ESP_LOGI(TAG,
              "M-010b: sec=%lld ticks=%u canonical=%.4f open=%.4f close=%.4f",
-             (long long)s_bucket.sec_epoch,
-             static_cast<unsigned>(s_bucket.tick_count),
+             (long long)b.sec_epoch,
+             static_cast<unsigned>(b.tick_count),
              canonical_price,
-             s_bucket.first_price,
-             s_bucket.last_price);
-    bucket_reset();
+             b.first_price,
+             b.last_price);
+    b = {};
+}
+
+static SecondBucket *oldest_open()
+{
+    SecondBucket *best = nullptr;
+    for (SecondBucket &b : s_open) {
+        if (b.active && (best == nullptr || b.sec_epoch < best->sec_epoch)) {
+            best = &b;
+        }
+    }
+    return best;
+}
+
+/** Sluit open secondes t/m `upto_sec` (oplopend); lege secondes daartussen/erna krijgen carry. */
+static void close_through(int64_t upto_sec)
+{
+    for (SecondBucket *b = oldest_open(); b != nullptr && b->sec_epoch <= upto_sec; b = oldest_open()) {
+        finalize_bucket(*b);
+    }
+    if (s_last_final_sec >= 0 && s_last_final_sec < upto_sec) {
+        push_carry_seconds(s_last_final_sec + 1, upto_sec + 1);
+        s_last_final_sec = upto_sec;
+    }
+}
+
+static void offset_observe(int64_t exchange_ms, int64_t local_ms, int64_t &last_local_ms)
+{
+    if (exchange_ms <= 0 || local_ms <= 0 || local_ms == last_local_ms) {
+        return;
+    }
+    last_local_ms = local_ms;
+    if (s_offset.block_start_local_ms == 0) {
+        s_offset.block_start_local_ms = local_ms;
+    } else if (local_ms - s_offset.block_start_local_ms >= k_offset_block_ms) {
+        s_offset.prev_max = s_offset.cur_max;
+        s_offset.cur_max = INT64_MIN;
+        s_offset.block_start_local_ms = local_ms;
+    }
+    /* exchange − lokale ontvangst = echte offset − netwerklatentie; maximum ≈ offset − kleinste latentie. */
+    s_offset.cur_max = std::max(s_offset.cur_max, exchange_ms - local_ms);
+    ++s_offset.samples;
+    s_clock_stats.offset_samples = s_offset.samples;
+    if (s_offset.samples < k_offset_min_samples) {
+        return;
+    }
+    const int64_t off = std::max(s_offset.cur_max, s_offset.prev_max);
+    if (!s_clock_stats.offset_valid) {
+        ESP_LOGI(TAG, "M-010g: klok-offset actief (exchange-lokaal=%lld ms)", (long long)off);
+    }
+    s_clock_stats.offset_valid = true;
+    s_clock_stats.offset_ms = off;
+}
+
+/** Andere provider of failover → andere exchange-klok en latentie: offset opnieuw schatten. */
+static void offset_track_provider(const market_data::MarketSnapshot &snap)
+{
+    if (std::strncmp(s_offset.provider, snap.feed_provider, sizeof(s_offset.provider)) == 0 &&
+        s_offset.failovers == snap.feed_failover_count) {
+        return;
+    }
+    const bool had_provider = s_offset.provider[0] != '\0';
+    s_offset = {};
+    std::strncpy(s_offset.provider, snap.feed_provider, sizeof(s_offset.provider) - 1);
+    s_offset.failovers = snap.feed_failover_count;
+    s_clock_stats.offset_valid = false;
+    s_clock_stats.offset_ms = 0;
+    s_clock_stats.offset_samples = 0;
+    if (had_provider) {
+        ++s_clock_stats.offset_resets;
+        ESP_LOGI(TAG,
+                 "M-010g: klok-offset reset (provider=%s, failovers=%u)",
+                 s_offset.provider,
+                 static_cast<unsigned>(s_offset.failovers));
+    }
+}
+
+/** Tick-tijd op de lokale tijdas: exchange-ts − offset, anders WS-ontvangsttijd, anders pollmoment. */
+static int64_t tick_canonical_ms(const market_data::MarketSnapshot &snap, int64_t wall_ms)
+{
+    if (snap.last_tick.ts_exchange_ms > 0 && s_clock_stats.offset_valid) {
+        ++s_clock_stats.ticks_exchange_time;
+        /* Nooit later dan het moment waarop we de tick zagen (offset-drift). */
+        return std::min(snap.last_tick.ts_exchange_ms - s_clock_stats.offset_ms, wall_ms);
+    }
+    ++s_clock_stats.ticks_local_time;
+    if (snap.last_tick_source == market_data::TickSource::Ws && snap.last_tick.ts_ms > 0) {
+        return std::min(snap.last_tick.ts_ms, wall_ms);
+    }
+    return wall_ms;
+}
+
+static void merge_tick(int64_t sec, double price)
+{
+    SecondBucket *newest = nullptr;
+    SecondBucket *free_slot = nullptr;
+    for (SecondBucket &b : s_open) {
+        if (b.active && b.sec_epoch == sec) {
+            b.sum_price += price;
+            ++b.tick_count;
+            b.last_price = price;
+            return;
+        }
+        if (b.active && (newest == nullptr || b.sec_epoch > newest->sec_epoch)) {
+            newest = &b;
+        }
+        if (!b.active && free_slot == nullptr) {
+            free_slot = &b;
+        }
+    }
+    if (newest != nullptr && sec < newest->sec_epoch) {
+        ++s_clock_stats.reordered_ticks;
+    }
+    if (free_slot == nullptr) {
+        /* Meer open secondes dan voorzien (klokverspringing): oudste vervroegd afsluiten. */
+        SecondBucket *old = oldest_open();
+        close_through(old->sec_epoch);
+        free_slot = old;
+    }
+    free_slot->active = true;
+    free_slot->sec_epoch = sec;
+    free_slot->sum_price = price;
+    free_slot->tick_count = 1;
+    free_slot->first_price = price;
+    free_slot->last_price = price;
 }
 
 } // namespace
@@ -147,60 +304,55 @@ esp_err_t init()
     s_count = 0;
     s_carry_price_eur = 0.0;
     s_last_merged_tick_ts_ms = -1;
-    bucket_reset();
+    s_last_final_sec = -1;
+    for (SecondBucket &b : s_open) {
+        b = {};
+    }
+    s_offset = {};
+    s_clock_stats = {};
+    s_clock_stats.watermark_ms = static_cast<uint32_t>(k_watermark_ms);
     std::memset(s_ring, 0, sizeof(s_ring));
+    /* 1s-horizon volgt de bestaande regime-Kconfig: span = venster, ready = minimaal aantal stappen. */
+    VolHorizonConfig h1s = VolSurfaceEngine::defaultConfig(VOL_H_1S);
+    h1s.spanBars = static_cast<uint16_t>(CONFIG_ALERT_REGIME_VOL_WINDOW_SEC);
+    h1s.minBars = static_cast<uint16_t>(CONFIG_ALERT_REGIME_VOL_MIN_PAIRS);
+    s_vol.reset();
+    s_vol.configure(VOL_H_1S, h1s);
     ESP_LOGI(TAG,
-             "M-010b/c: domain_metrics init (ring=%u, per-second canonical, 1m+5m)",
-             static_cast<unsigned>(k_ring_cap));
+             "M-010b/c/g: domain_metrics init (ring=%u, per-second canonical, watermark=%u ms, 1m+5m)",
+             static_cast<unsigned>(k_ring_cap),
+             static_cast<unsigned>(k_watermark_ms));
     return ESP_OK;
 }
 
 void feed(const market_data::MarketSnapshot &snap)
 {
-    if (!snap.valid || snap.last_tick.price_eur <= 0.0) {
-        return;
-    }
-    s_carry_price_eur = snap.last_tick.price_eur;
     const int64_t wall_ms = static_cast<int64_t>(esp_timer_get_time() / 1000LL);
-    const int64_t wsec = wall_ms / 1000LL;
-
-    if (!s_bucket.active) {
-        s_bucket.active = true;
-        s_bucket.sec_epoch = wsec;
-        s_last_merged_tick_ts_ms = snap.last_tick.ts_ms;
-        s_bucket.sum_price = snap.last_tick.price_eur;
-        s_bucket.tick_count = 1;
-        s_bucket.first_price = snap.last_tick.price_eur;
-        s_bucket.last_price = snap.last_tick.price_eur;
-        return;
-    }
+    offset_track_provider(snap);
+    offset_observe(snap.ws_last_trade_exchange_ms, snap.ws_last_trade_local_ms, s_offset.last_trade_local_ms);
+    offset_observe(snap.last_tick.ts_exchange_ms, snap.last_tick.ts_ms, s_offset.last_tick_local_ms);
 
-    if (wsec > s_bucket.sec_epoch) {
-        const int64_t closing_sec = s_bucket.sec_epoch;
-        finalize_bucket();
-        push_carry_seconds(closing_sec + 1, wsec);
-        s_bucket.active = true;
-        s_bucket.sec_epoch = wsec;
+    if (snap.valid && snap.last_tick.price_eur > 0.0 && snap.last_tick.ts_ms != s_last_merged_tick_ts_ms) {
         s_last_merged_tick_ts_ms = snap.last_tick.ts_ms;
-        s_bucket.sum_price = snap.last_tick.price_eur;
-        s_bucket.tick_count = 1;
-        s_bucket.first_price = snap.last_tick.price_eur;
-        s_bucket.last_price = snap.last_tick.price_eur;
-        return;
+        const int64_t sec = tick_canonical_ms(snap, wall_ms) / 1000LL;
+        if (s_last_final_sec >= 0 && sec <= s_last_final_sec) {
+            /* Achter het watermark: die seconde staat al in de ring. */
+            ++s_clock_stats.late_ticks_dropped;
+            ESP_LOGD(TAG,
+                     "M-010g: late tick sec=%lld (final=%lld) genegeerd",
+                     (long long)sec,
+                     (long long)s_last_final_sec);
+        } else {
+            merge_tick(sec, snap.last_tick.price_eur);
+        }
     }
 
-    if (wsec != s_bucket.sec_epoch) {
-        /* Tolerantie voor kleine klok- of volgorde-anomalieën: negeren. */
-        return;
-    }
+    close_through((wall_ms - k_watermark_ms) / 1000LL - 1);
+}
 
-    if (snap.last_tick.ts_ms == s_last_merged_tick_ts_ms) {
-        return;
-    }
-    s_last_merged_tick_ts_ms = snap.last_tick.ts_ms;
-    s_bucket.sum_price += snap.last_tick.price_eur;
-    ++s_bucket.tick_count;
-    s_bucket.last_price = snap.last_tick.price_eur;
+CanonicalClockStats canonical_clock_stats()
+{
+    return s_clock_stats;
 }
 
 Metric1mMovePct compute_1m_move_pct()
@@ -274,46 +426,28 @@ Metric5mMovePct compute_5m_move_pct()
 MetricVolMeanAbsStepBps compute_vol_mean_abs_step_bps()
 {
     MetricVolMeanAbsStepBps out{};
-    if (s_count < 2) {
-        return out;
-    }
-    Sample latest{};
-    if (!ring_latest(&latest)) {
+    const VolSurfaceSnapshot &vs = s_vol.snapshot();
+    const VolHorizonStats &h1s = vs.h[VOL_H_1S];
+    if (!h1s.ready) {
         return out;
     }
-    const int64_t window_ms = static_cast<int64_t>(CONFIG_ALERT_REGIME_VOL_WINDOW_SEC) * 1000LL;
-    const int64_t cutoff_ts = latest.ts_ms - window_ms;
-    const int64_t dt_min = static_cast<int64_t>(CONFIG_ALERT_REGIME_VOL_PAIR_MIN_MS);
-    const int64_t dt_max = static_cast<int64_t>(CONFIG_ALERT_REGIME_VOL_PAIR_MAX_MS);
-
-    double sum_bps = 0.0;
-    uint32_t n = 0;
-    for (size_t k = 1; k < s_count; ++k) {
-        const Sample &p0 = s_ring[(s_head + k - 1U) % k_ring_cap];
-        const Sample &p1 = s_ring[(s_head + k) % k_ring_cap];
-        if (p0.ts_ms < cutoff_ts || p1.ts_ms < cutoff_ts) {
-            continue;
-        }
-        if (p0.price_eur <= 0.0 || p1.price_eur <= 0.0) {
-            continue;
-        }
-        const int64_t dt = p1.ts_ms - p0.ts_ms;
-        if (dt < dt_min || dt > dt_max) {
-            continue;
-        }
-        const double step_bps =
-            std::fabs((p1.price_eur - p0.price_eur) / p0.price_eur) * 10000.0;
-        sum_bps += step_bps;
-        ++n;
-    }
-    const uint32_t need = static_cast<uint32_t>(CONFIG_ALERT_REGIME_VOL_MIN_PAIRS);
-    if (n < need) {
-        return out;
+    /* σ per seconde: 1s close-to-close, of de 1m-range (GK) teruggeschaald als die hoger ligt
+     * (TWAP-secondes dempen de stap). E|Δ| = σ·√(2/π) houdt de bestaande bps-grenzen geldig. */
+    double sigma_pct = static_cast<double>(h1s.volPct);
+    const VolHorizonStats &h1m = vs.h[VOL_H_1M];
+    if (h1m.ready) {
+        sigma_pct = std::max(sigma_pct, static_cast<double>(h1m.volPct) / std::sqrt(60.0));
     }
+    static constexpr double k_mean_abs_per_sigma = 0.7978845608; /* √(2/π) */
     out.ready = true;
-    out.pairs_used = n;
-    out.mean_abs_step_bps = sum_bps / static_cast<double>(n);
+    out.pairs_used = h1s.bars;
+    out.mean_abs_step_bps = sigma_pct * 100.0 * k_mean_abs_per_sigma;
     return out;
 }
 
+const VolSurfaceSnapshot &vol_surface()
+{
+    return s_vol.snapshot();
+}
+
 } // namespace domain_metrics
@@ -2,6 +2,7 @@
 
 #include "market_data/market_data.hpp"
 #include "esp_err.h"
+#include "VolSurface.h"
 
 namespace domain_metrics {
 
@@ -9,7 +10,8 @@ namespace domain_metrics {
  * M-010a: compacte prijs-historie (rolling) + afgeleide 1m-move metric.
  * M-010b: canonicalisatie naar 1 representatieve secondewaarde vóór opslag.
  * M-010c: zelfde bufferbasis + 5m %-move metric (parallel aan 1m, geen confluence).
- * M-010f: korte-horizon volatiliteit — gemiddelde |Δprijs| tussen opeenvolgende canonieke secondes (bps).
+ * M-010f: realised vol per horizon (1s/1m/5m/1h) op de canonieke secondes (gedeelde VolSurface-kern).
+ * M-010g: seconde-indeling op exchange-tijd (klok-offset + watermark), fallback lokale tijd.
  * Alleen invoer via `feed(market_data::snapshot)` — geen exchange-details.
  */
 esp_err_t init();
@@ -41,14 +43,39 @@ struct Metric5mMovePct {
 
 Metric5mMovePct compute_5m_move_pct();
 
-/** Gemiddelde absolute stap tussen opeenvolgende 1s-canonieke samples in het venster (realized vol-proxy). */
+/** Verwachte absolute 1s-stap afgeleid uit de vol-surface (realized vol-proxy voor het regime). */
 struct MetricVolMeanAbsStepBps {
     bool ready{false};
-    /** Gemiddelde van |Δp/p|×10⁴ over geldige opeenvolgende paren (~1s). */
+    /** σ per seconde × √(2/π) in bps (E|Δp/p|×10⁴); zelfde schaal als de oude venster-gemiddelde stap. */
     double mean_abs_step_bps{0.0};
     uint32_t pairs_used{0};
 };
 
 MetricVolMeanAbsStepBps compute_vol_mean_abs_step_bps();
 
+/** M-010g: observability van de canonieke secondeklok. */
+struct CanonicalClockStats {
+    /** Offset (exchange − lokaal, ms) geschat uit ≥3 trade-/tick-paren van de actieve provider. */
+    bool offset_valid{false};
+    int64_t offset_ms{0};
+    uint32_t offset_samples{0};
+    /** Offset weggegooid na providerwissel/failover. */
+    uint32_t offset_resets{0};
+    uint32_t watermark_ms{0};
+    /** Ticks ingedeeld via exchange-ts resp. lokale ontvangsttijd (fallback). */
+    uint32_t ticks_exchange_time{0};
+    uint32_t ticks_local_time{0};
+    /** Tick landde in een oudere, nog open seconde dan de nieuwste open seconde. */
+    uint32_t reordered_ticks{0};
+    /** Tick achter het watermark (seconde al vastgelegd) → genegeerd. */
+    uint32_t late_ticks_dropped{0};
+    /** Secondes zonder tick, gevuld met de carry-prijs. */
+    uint32_t carry_seconds{0};
+};
+
+CanonicalClockStats canonical_clock_stats();
+
+/** Volledige vol-surface (σ per horizon; `volPerMinPct` is vergelijkbaar tussen horizons). */
+const VolSurfaceSnapshot &vol_surface();
+
 } // namespace domain_metrics
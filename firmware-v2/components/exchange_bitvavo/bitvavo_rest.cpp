@@ -1,5 +1,6 @@
 /**
  * REST bootstrap: Bitvavo GET /v2/ticker/price (TLS, certificate bundle).
+ * MD-01: GET /v2/{market}/candles voor de candle-historie van de provider-interface.
  *
  * M-002b: één `esp_http_client`-handle in deze module (lazy init, file-static).
  * Per call: `set_url` + open → read → close; handle blijft bestaan voor hergebruik
@@ -9,10 +10,12 @@
  * onder `net_runtime::net_mutex` — zelfde synchronisatie als voorheen.
  */
 #include "diagnostics/diagnostics.hpp"
+#include "diagnostics/trace.hpp"
 #include "esp_crt_bundle.h"
 #include "esp_http_client.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "market_types/provider.hpp"
 #include "net_runtime/net_runtime.hpp"
 #include <cstdlib>
 #include <cstring>
@@ -21,6 +24,9 @@ namespace exchange_bitvavo::rest {
 
 namespace {
 
+/** Bovengrens per candle-request (heapbuffer ≈ 96 B per bar). */
+static constexpr size_t k_candles_max = 240;
+
 static bool parse_price_json(const char *buf, double *out)
 {
     const char *p = strstr(buf, "\"price\"");
@@ -77,19 +83,24 @@ static esp_err_t http_ensure(char *err_detail, size_t err_len)
     return ESP_OK;
 }
 
-} // namespace
-
-esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_detail, size_t err_len)
+static void set_err(char *err_detail, size_t err_len, const char *msg)
 {
-    if (!out_eur || !market || !market[0]) {
-        return ESP_ERR_INVALID_ARG;
+    if (err_detail && err_len) {
+        strncpy(err_detail, msg, err_len - 1);
+        err_detail[err_len - 1] = '\0';
     }
+}
+
+/**
+ * GET `url` → `buf` (NUL-getermineerd, afgekapt op `cap - 1`) onder `net_mutex`.
+ * Logt `REST TLS …` met `what` als label; zelfde foutafhandeling (client invalidate) als voorheen.
+ */
+static esp_err_t http_get_body(const char *url, const char *what, char *buf, size_t cap, int *len_out,
+                               char *err_detail, size_t err_len)
+{
     if (!net_runtime::net_mutex_take(pdMS_TO_TICKS(20000))) {
         ESP_LOGW(DIAG_TAG_BV_FEED, "M-002: net_mutex timeout — Bitvavo REST deferred (outbound/NTFY hold mutex?)");
-        if (err_detail && err_len) {
-            strncpy(err_detail, "net_mutex timeout", err_len - 1);
-            err_detail[err_len - 1] = '\0';
-        }
+        set_err(err_detail, err_len, "net_mutex timeout");
         return ESP_ERR_TIMEOUT;
     }
 
@@ -99,15 +110,9 @@ esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_deta
         return ens;
     }
 
-    char url[192];
-    snprintf(url, sizeof(url), "https://api.bitvavo.com/v2/ticker/price?market=%s", market);
-
     if (esp_http_client_set_url(s_http, url) != ESP_OK) {
-        ESP_LOGW(DIAG_TAG_BV_FEED, "REST set_url failed market=%s", market);
-        if (err_detail && err_len) {
-            strncpy(err_detail, "set_url", err_len - 1);
-            err_detail[err_len - 1] = '\0';
-        }
+        ESP_LOGW(DIAG_TAG_BV_FEED, "REST set_url failed %s", what);
+        set_err(err_detail, err_len, "set_url");
         http_invalidate();
         net_runtime::net_mutex_give();
         return ESP_FAIL;
@@ -115,11 +120,11 @@ esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_deta
     esp_http_client_set_method(s_http, HTTP_METHOD_GET);
 
     const int64_t t0_us = esp_timer_get_time();
-    ESP_LOGI(DIAG_TAG_BV_FEED, "REST TLS market=%s (client hergebruik)", market);
+    ESP_LOGI(DIAG_TAG_BV_FEED, "REST TLS %s (client hergebruik)", what);
 
     esp_err_t err = esp_http_client_open(s_http, 0);
     if (err != ESP_OK) {
-        ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end market=%s err=%s dt_ms=%lld", market, esp_err_to_name(err),
+        ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end %s err=%s dt_ms=%lld", what, esp_err_to_name(err),
                  (long long)((esp_timer_get_time() - t0_us) / 1000));
         if (err_detail && err_len) {
             snprintf(err_detail, err_len, "open %s", esp_err_to_name(err));
@@ -132,7 +137,7 @@ esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_deta
     (void)esp_http_client_fetch_headers(s_http);
     const int status = esp_http_client_get_status_code(s_http);
     if (status < 200 || status >= 300) {
-        ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end market=%s HTTP=%d dt_ms=%lld", market, status,
+        ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end %s HTTP=%d dt_ms=%lld", what, status,
                  (long long)((esp_timer_get_time() - t0_us) / 1000));
         if (err_detail && err_len) {
             snprintf(err_detail, err_len, "HTTP %d", status);
@@ -143,17 +148,13 @@ esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_deta
         return ESP_FAIL;
     }
 
-    char buf[512]{};
     int rtotal = 0;
     for (;;) {
-        const int r = esp_http_client_read(s_http, buf + rtotal, static_cast<int>(sizeof(buf) - 1 - rtotal));
+        const int r = esp_http_client_read(s_http, buf + rtotal, static_cast<int>(cap - 1 - rtotal));
         if (r < 0) {
-            ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end market=%s read_err dt_ms=%lld", market,
+            ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end %s read_err dt_ms=%lld", what,
                      (long long)((esp_timer_get_time() - t0_us) / 1000));
-            if (err_detail && err_len) {
-                strncpy(err_detail, "read err", err_len - 1);
-                err_detail[err_len - 1] = '\0';
-            }
+            set_err(err_detail, err_len, "read err");
             esp_http_client_close(s_http);
             http_invalidate();
             net_runtime::net_mutex_give();
@@ -163,7 +164,7 @@ esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_deta
             break;
         }
         rtotal += r;
-        if (rtotal >= static_cast<int>(sizeof(buf) - 1)) {
+        if (rtotal >= static_cast<int>(cap - 1)) {
             break;
         }
     }
@@ -171,24 +172,60 @@ esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_deta
     net_runtime::net_mutex_give();
 
     if (rtotal <= 0) {
-        ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end market=%s empty dt_ms=%lld", market,
+        ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end %s empty dt_ms=%lld", what,
                  (long long)((esp_timer_get_time() - t0_us) / 1000));
-        if (err_detail && err_len) {
-            strncpy(err_detail, "empty body", err_len - 1);
-            err_detail[err_len - 1] = '\0';
-        }
+        set_err(err_detail, err_len, "empty body");
         http_invalidate();
         return ESP_FAIL;
     }
     buf[rtotal] = '\0';
+    *len_out = rtotal;
+    ESP_LOGD(DIAG_TAG_BV_FEED, "REST TLS body %s len=%d dt_ms=%lld", what, rtotal,
+             (long long)((esp_timer_get_time() - t0_us) / 1000));
+    return ESP_OK;
+}
+
+/** Volgend getal (optioneel tussen quotes) vanaf `p`; `*next` wijst erna. */
+static bool next_number(const char *p, double *out, const char **next)
+{
+    while (*p == ' ' || *p == ',' || *p == '\"') {
+        ++p;
+    }
+    char *end = nullptr;
+    const double v = strtod(p, &end);
+    if (end == p) {
+        return false;
+    }
+    *out = v;
+    *next = end;
+    return true;
+}
+
+} // namespace
+
+esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_detail, size_t err_len)
+{
+    DIAG_TRACE_SPAN(RestFetch);
+    if (!out_eur || !market || !market[0]) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    char url[192];
+    snprintf(url, sizeof(url), "https://api.bitvavo.com/v2/ticker/price?market=%s", market);
+    char what[40];
+    snprintf(what, sizeof(what), "market=%s", market);
+
+    const int64_t t0_us = esp_timer_get_time();
+    char buf[512]{};
+    int len = 0;
+    const esp_err_t err = http_get_body(url, what, buf, sizeof(buf), &len, err_detail, err_len);
+    if (err != ESP_OK) {
+        return err;
+    }
 
     if (!parse_price_json(buf, out_eur)) {
         ESP_LOGW(DIAG_TAG_BV_FEED, "REST TLS end market=%s parse_fail dt_ms=%lld", market,
                  (long long)((esp_timer_get_time() - t0_us) / 1000));
-        if (err_detail && err_len) {
-            strncpy(err_detail, "parse price", err_len - 1);
-            err_detail[err_len - 1] = '\0';
-        }
+        set_err(err_detail, err_len, "parse price");
         return ESP_FAIL;
     }
 
@@ -198,4 +235,79 @@ esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_deta
     return ESP_OK;
 }
 
+esp_err_t fetch_candles(const char *market, const char *interval, market_types::CandleBar *out, size_t cap,
+                        size_t *n_out, char *err_detail, size_t err_len)
+{
+    DIAG_TRACE_SPAN(RestFetch);
+    if (!market || !market[0] || !interval || !interval[0] || !out || cap == 0 || !n_out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *n_out = 0;
+    if (cap > k_candles_max) {
+        cap = k_candles_max;
+    }
+    char url[192];
+    snprintf(url, sizeof(url), "https://api.bitvavo.com/v2/%s/candles?interval=%s&limit=%u", market, interval,
+             static_cast<unsigned>(cap));
+    char what[48];
+    snprintf(what, sizeof(what), "candles %s/%s", market, interval);
+
+    /* [[ts,"o","h","l","c","v"],…] ≈ 80 B per bar; heap i.p.v. taakstack. */
+    const size_t body_cap = cap * 96U + 16U;
+    char *buf = static_cast<char *>(malloc(body_cap));
+    if (!buf) {
+        set_err(err_detail, err_len, "no mem");
+        return ESP_ERR_NO_MEM;
+    }
+    int len = 0;
+    esp_err_t err = http_get_body(url, what, buf, body_cap, &len, err_detail, err_len);
+    if (err != ESP_OK) {
+        free(buf);
+        return err;
+    }
+
+    /* Bitvavo levert nieuwste eerst; omdraaien zodat `out[0]` de oudste bar is. */
+    size_t n = 0;
+    const char *p = strchr(buf, '[');
+    while (p && n < cap) {
+        p = strchr(p + 1, '[');
+        if (!p) {
+            break;
+        }
+        double v[6];
+        const char *q = p + 1;
+        bool ok = true;
+        for (double &f : v) {
+            if (!next_number(q, &f, &q)) {
+                ok = false;
+                break;
+            }
+        }
+        if (!ok) {
+            break;
+        }
+        market_types::CandleBar &b = out[n++];
+        b.open_ms = static_cast<int64_t>(v[0]);
+        b.open = v[1];
+        b.high = v[2];
+        b.low = v[3];
+        b.close = v[4];
+        b.volume = v[5];
+        p = q;
+    }
+    free(buf);
+    for (size_t i = 0; i < n / 2; ++i) {
+        const market_types::CandleBar t = out[i];
+        out[i] = out[n - 1 - i];
+        out[n - 1 - i] = t;
+    }
+    *n_out = n;
+    if (n == 0) {
+        set_err(err_detail, err_len, "parse candles");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(DIAG_TAG_BV_FEED, "REST candles %s/%s n=%u", market, interval, static_cast<unsigned>(n));
+    return ESP_OK;
+}
+
 } // namespace exchange_bitvavo::rest
@@ -3,6 +3,7 @@
  * Officiële prijs blijft ticker→`apply_price`; trades → bounded ring + observability.
  */
 #include "diagnostics/diagnostics.hpp"
+#include "diagnostics/trace.hpp"
 #include "esp_check.h"
 #include "esp_crt_bundle.h"
 #include "esp_log.h"
@@ -75,7 +76,7 @@ void sync_inbound_tick_stats()
     }
 }
 
-static void apply_price(double p, int64_t ts_ms)
+static void apply_price(double p, int64_t ts_ms, int64_t ts_exchange_ms)
 {
     sync_inbound_tick_stats();
     if (!s_metrics_mx || !s_snap_ptr) {
@@ -86,9 +87,10 @@ static void apply_price(double p, int64_t ts_ms)
     }
     ++s_stats_cur_sec_count;
     s_last_canonical_wall_sec = esp_timer_get_time() / 1000000ULL;
-    ESP_LOGD(TAG, "[WS_AGG] price=%.6f ts_ms=%lld", p, (long long)ts_ms);
+    ESP_LOGD(TAG, "[WS_AGG] price=%.6f ts_ms=%lld exch_ms=%lld", p, (long long)ts_ms, (long long)ts_exchange_ms);
     s_snap_ptr->last_tick.price_eur = p;
     s_snap_ptr->last_tick.ts_ms = ts_ms;
+    s_snap_ptr->last_tick.ts_exchange_ms = ts_exchange_ms;
     s_snap_ptr->valid = true;
     s_snap_ptr->last_tick_source = market_types::TickSource::Ws;
     s_snap_ptr->connection = market_types::ConnectionState::Connected;
@@ -96,9 +98,29 @@ static void apply_price(double p, int64_t ts_ms)
     xSemaphoreGive(s_metrics_mx);
 }
 
-static bool parse_ticker_text(const char *buf, size_t len, double *out)
+/** `"timestamp": 1700000000000` (of als string) → Unix ms; 0 als het veld ontbreekt of niet parseert. */
+static int64_t parse_timestamp_field(const char *tmp)
 {
-    if (!buf || len == 0 || !out) {
+    const char *tsp = strstr(tmp, "\"timestamp\"");
+    if (tsp == nullptr) {
+        return 0;
+    }
+    tsp = strchr(tsp + 11, ':');
+    if (tsp == nullptr) {
+        return 0;
+    }
+    ++tsp;
+    while (*tsp == ' ' || *tsp == '\"') {
+        ++tsp;
+    }
+    char *end_ts = nullptr;
+    const long long tv = strtoll(tsp, &end_ts, 10);
+    return end_ts != tsp ? static_cast<int64_t>(tv) : 0;
+}
+
+static bool parse_ticker_text(const char *buf, size_t len, double *out, int64_t *ts_exch_out)
+{
+    if (!buf || len == 0 || !out || !ts_exch_out) {
         return false;
     }
     char tmp[384];
@@ -132,6 +154,8 @@ static bool parse_ticker_text(const char *buf, size_t len, double *out)
         return false;
     }
     *out = v;
+    /* Bitvavo `ticker` levert (nog) geen timestamp; ticker24h-achtige payloads wel. */
+    *ts_exch_out = parse_timestamp_field(tmp);
     return true;
 }
 
@@ -147,22 +171,7 @@ static bool parse_trade_text(const char *buf, size_t len, double *price_out, int
     if (strstr(tmp, "\"event\":\"trade\"") == nullptr && strstr(tmp, "\"event\": \"trade\"") == nullptr) {
         return false;
     }
-    *ts_exch_out = 0;
-    const char *tsp = strstr(tmp, "\"timestamp\":");
-    if (tsp != nullptr) {
-        tsp = strchr(tsp + 12, ':');
-        if (tsp != nullptr) {
-            ++tsp;
-            while (*tsp == ' ' || *tsp == '\"') {
-                ++tsp;
-            }
-            char *end_ts = nullptr;
-            const long long tv = strtoll(tsp, &end_ts, 10);
-            if (end_ts != tsp) {
-                *ts_exch_out = static_cast<int64_t>(tv);
-            }
-        }
-    }
+    *ts_exch_out = parse_timestamp_field(tmp);
     const char *pp = strstr(tmp, "\"price\":");
     if (pp == nullptr) {
         pp = strstr(tmp, "\"price\" :");
@@ -241,6 +250,8 @@ static void on_event(void *handler_args, esp_event_base_t base, int32_t event_id
             s_snap_ptr->ws_trade_ring_capacity = static_cast<uint16_t>(k_trade_ring_cap);
             s_snap_ptr->ws_trade_ring_occupancy = 0;
             s_snap_ptr->ws_last_trade_local_ms = 0;
+            s_snap_ptr->ws_last_trade_exchange_ms = 0;
+            s_snap_ptr->ws_link_up = true;
             xSemaphoreGive(s_metrics_mx);
         }
         send_subscribe(s_client);
@@ -250,6 +261,7 @@ static void on_event(void *handler_args, esp_event_base_t base, int32_t event_id
         ESP_LOGW(DIAG_TAG_MARKET, "WS disconnected");
         if (s_metrics_mx && s_snap_ptr && xSemaphoreTake(s_metrics_mx, pdMS_TO_TICKS(50)) == pdTRUE) {
             s_snap_ptr->ws_reconnect_count++;
+            s_snap_ptr->ws_link_up = false;
             if (s_snap_ptr->connection == market_types::ConnectionState::Connected) {
                 s_snap_ptr->connection = market_types::ConnectionState::Connecting;
             }
@@ -257,6 +269,7 @@ static void on_event(void *handler_args, esp_event_base_t base, int32_t event_id
         }
         break;
     case WEBSOCKET_EVENT_DATA: {
+        DIAG_TRACE_SPAN(WsMessage);
         const int opcode = data->op_code;
         if (opcode == 1 && data->data_ptr != nullptr && data->data_len > 0) {
             sync_inbound_tick_stats();
@@ -283,6 +296,7 @@ static void on_event(void *handler_args, esp_event_base_t base, int32_t event_id
                         s_last_trade_wall_sec = esp_timer_get_time() / 1000000ULL;
                         s_snap_ptr->ws_trade_ring_occupancy = static_cast<uint16_t>(s_trade_count);
                         s_snap_ptr->ws_last_trade_local_ms = loc_ms;
+                        s_snap_ptr->ws_last_trade_exchange_ms = ts_exch;
                         s_snap_ptr->ws_trade_ring_capacity = static_cast<uint16_t>(k_trade_ring_cap);
                     }
                     xSemaphoreGive(s_metrics_mx);
@@ -291,9 +305,10 @@ static void on_event(void *handler_args, esp_event_base_t base, int32_t event_id
                          (long long)loc_ms, (long long)ts_exch);
             } else {
                 double p = 0;
-                if (parse_ticker_text(data->data_ptr, static_cast<size_t>(data->data_len), &p)) {
+                int64_t tick_exch = 0;
+                if (parse_ticker_text(data->data_ptr, static_cast<size_t>(data->data_len), &p, &tick_exch)) {
                     const int64_t ts = static_cast<int64_t>(esp_timer_get_time() / 1000);
-                    apply_price(p, ts);
+                    apply_price(p, ts, tick_exch);
                 }
             }
         }
@@ -339,6 +354,9 @@ esp_err_t start(market_types::MarketSnapshot *snap_sink, const char *market, Sem
     /* Iets langere pauze tussen reconnect-pogingen → minder TLS-handshakes bij wisselende WiFi */
     wcfg.reconnect_timeout_ms = 10000;
     wcfg.disable_auto_reconnect = false;
+    /* MD-01: half-open socket → DISCONNECTED binnen ~20 s; failover kijkt naar de verbinding, niet naar stilte */
+    wcfg.ping_interval_sec = 10;
+    wcfg.pingpong_timeout_sec = 20;
 
     s_client = esp_websocket_client_init(&wcfg);
     ESP_RETURN_ON_FALSE(s_client, ESP_ERR_NO_MEM, TAG, "ws init");
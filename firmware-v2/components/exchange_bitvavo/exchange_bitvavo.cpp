@@ -31,8 +31,11 @@ esp_err_t init(const char *market_symbol)
     if (!market_symbol || !market_symbol[0]) {
         return ESP_ERR_INVALID_ARG;
     }
-    s_mx = xSemaphoreCreateMutex();
-    ESP_RETURN_ON_FALSE(s_mx, ESP_ERR_NO_MEM, TAG, "mutex");
+    if (!s_mx) {
+        /* MD-01: bij failback opnieuw `init` — mutex blijft, geen lek. */
+        s_mx = xSemaphoreCreateMutex();
+        ESP_RETURN_ON_FALSE(s_mx, ESP_ERR_NO_MEM, TAG, "mutex");
+    }
 
     strncpy(s_symbol, market_symbol, sizeof(s_symbol) - 1);
     s_snap = {};
@@ -96,6 +99,7 @@ void tick()
                 if (er == ESP_OK) {
                     s_snap.last_tick.price_eur = p;
                     s_snap.last_tick.ts_ms = static_cast<int64_t>(now);
+                    s_snap.last_tick.ts_exchange_ms = 0;
                     s_snap.valid = true;
                     s_snap.last_tick_source = market_types::TickSource::Rest;
                     s_snap.rest_bootstrap_ok++;
@@ -138,4 +142,67 @@ market_types::MarketSnapshot snapshot()
     return o;
 }
 
+void stop()
+{
+    if (s_ws_started) {
+        ws::stop();
+        s_ws_started = false;
+    }
+    if (s_mx && xSemaphoreTake(s_mx, pdMS_TO_TICKS(100)) == pdTRUE) {
+        s_snap.connection = market_types::ConnectionState::Disconnected;
+        s_snap.ws_link_up = false;
+        xSemaphoreGive(s_mx);
+    }
+    ESP_LOGI(DIAG_TAG_MARKET, "exchange_bitvavo stop market=%s", s_symbol);
+}
+
+esp_err_t fetch_candles(const char *market_symbol, const char *interval, market_types::CandleBar *out, size_t cap,
+                        size_t *n_out)
+{
+    char err[48]{};
+    const esp_err_t e = rest::fetch_candles(market_symbol, interval, out, cap, n_out, err, sizeof(err));
+    if (e != ESP_OK) {
+        ESP_LOGW(TAG, "candles %s/%s: %s", market_symbol ? market_symbol : "?", interval ? interval : "?", err);
+    }
+    return e;
+}
+
+namespace {
+
+esp_err_t provider_start(void *, const char *market_symbol)
+{
+    return init(market_symbol);
+}
+
+void provider_stop(void *)
+{
+    stop();
+}
+
+void provider_tick(void *)
+{
+    tick();
+}
+
+market_types::MarketSnapshot provider_snapshot(void *)
+{
+    return snapshot();
+}
+
+esp_err_t provider_candles(void *, const char *market_symbol, const char *interval, market_types::CandleBar *out,
+                           size_t cap, size_t *n_out)
+{
+    return fetch_candles(market_symbol, interval, out, cap, n_out);
+}
+
+} // namespace
+
+const market_types::FeedProvider &provider()
+{
+    static const market_types::FeedProvider p{
+        "bitvavo", nullptr, provider_start, provider_stop, provider_tick, provider_snapshot, provider_candles,
+    };
+    return p;
+}
+
 } // namespace exchange_bitvavo
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esp_err.h"
+#include "market_types/provider.hpp"
 #include <cstddef>
 
 namespace exchange_bitvavo::rest {
@@ -8,4 +9,8 @@ namespace exchange_bitvavo::rest {
 /** GET /v2/ticker/price; interne `esp_http_client` wordt in `bitvavo_rest.cpp` hergebruikt (M-002b). */
 esp_err_t fetch_ticker_price(const char *market, double *out_eur, char *err_detail, size_t err_len);
 
+/** MD-01: GET /v2/{market}/candles (`interval` zoals Bitvavo: 1m, 5m, 1h, …); `out[0]` = oudste bar. */
+esp_err_t fetch_candles(const char *market, const char *interval, market_types::CandleBar *out, size_t cap,
+                        size_t *n_out, char *err_detail, size_t err_len);
+
 }
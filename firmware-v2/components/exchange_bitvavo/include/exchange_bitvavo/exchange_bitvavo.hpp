@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esp_err.h"
+#include "market_types/provider.hpp"
 #include "market_types/types.hpp"
 
 namespace exchange_bitvavo {
@@ -15,4 +16,14 @@ esp_err_t init(const char *market_symbol);
 void tick();
 market_types::MarketSnapshot snapshot();
 
+/** MD-01: WS sluiten + snapshot naar Disconnected (failover naar andere venue); `init` start opnieuw. */
+void stop();
+
+/** MD-01: candle-historie via REST (zie `rest::fetch_candles`). */
+esp_err_t fetch_candles(const char *market_symbol, const char *interval, market_types::CandleBar *out, size_t cap,
+                        size_t *n_out);
+
+/** MD-01: functietabel voor de `market_data`-registry (naam `"bitvavo"`). */
+const market_types::FeedProvider &provider();
+
 } // namespace exchange_bitvavo
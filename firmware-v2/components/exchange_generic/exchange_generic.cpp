@@ -0,0 +1,678 @@
+/**
+ * MD-01: generieke JSON-WS venue + loopback-stand-in (zie header).
+ * - WS: `esp_websocket_client`; TLS-bundle alleen bij `wss://`.
+ * - Parse: berichtfilter (substring) → `"<price_key>"` → prijs; `"<ts_key>"` → exchange-ms
+ *   (getal in ms of s, of ISO-8601-string). Zelfde snapshot-/gapvelden als Bitvavo (RWS-01).
+ * - REST: per call een `esp_http_client` onder `net_mutex` (bootstrap elke 45 s zolang WS niet live is).
+ */
+#include "exchange_generic/exchange_generic.hpp"
+#include "diagnostics/diagnostics.hpp"
+#include "esp_check.h"
+#include "esp_crt_bundle.h"
+#include "esp_http_client.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_websocket_client.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "net_runtime/net_runtime.hpp"
+#include "sdkconfig.h"
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef CONFIG_MD_GENERIC_NAME
+#define CONFIG_MD_GENERIC_NAME "coinbase"
+#endif
+#ifndef CONFIG_MD_GENERIC_WS_URI
+#define CONFIG_MD_GENERIC_WS_URI "wss://ws-feed.exchange.coinbase.com"
+#endif
+#ifndef CONFIG_MD_GENERIC_WS_SUBSCRIBE
+#define CONFIG_MD_GENERIC_WS_SUBSCRIBE "{\"type\":\"subscribe\",\"product_ids\":[\"%s\"],\"channels\":[\"ticker\"]}"
+#endif
+#ifndef CONFIG_MD_GENERIC_MSG_MATCH
+#define CONFIG_MD_GENERIC_MSG_MATCH "\"type\":\"ticker\""
+#endif
+#ifndef CONFIG_MD_GENERIC_PRICE_KEY
+#define CONFIG_MD_GENERIC_PRICE_KEY "price"
+#endif
+#ifndef CONFIG_MD_GENERIC_TS_KEY
+#define CONFIG_MD_GENERIC_TS_KEY "time"
+#endif
+#ifndef CONFIG_MD_GENERIC_MARKET
+#define CONFIG_MD_GENERIC_MARKET ""
+#endif
+#ifndef CONFIG_MD_GENERIC_REST_TICKER_URL
+#define CONFIG_MD_GENERIC_REST_TICKER_URL "https://api.exchange.coinbase.com/products/%s/ticker"
+#endif
+#ifndef CONFIG_MD_GENERIC_REST_CANDLES_URL
+#define CONFIG_MD_GENERIC_REST_CANDLES_URL "https://api.exchange.coinbase.com/products/%s/candles?granularity=%u"
+#endif
+#ifndef CONFIG_MD_LOOPBACK_WS_URI
+#define CONFIG_MD_LOOPBACK_WS_URI "ws://192.168.1.10:8765"
+#endif
+
+namespace exchange_generic {
+
+namespace {
+
+static const char TAG[] = "exchange_gen";
+
+/** Vaste instellingen per instantie; lege string = functie uit. */
+struct FeedConfig {
+    const char *name;
+    const char *stream_label;
+    const char *ws_uri;
+    const char *subscribe_fmt;
+    const char *msg_match;
+    const char *price_key;
+    const char *ts_key;
+    const char *market_override;
+    const char *rest_ticker_url_fmt;
+    const char *rest_candles_url_fmt;
+};
+
+struct Feed {
+    explicit Feed(const FeedConfig *c) : cfg(c) {}
+
+    const FeedConfig *cfg;
+    SemaphoreHandle_t mx{nullptr};
+    esp_websocket_client_handle_t client{nullptr};
+    market_types::MarketSnapshot snap{};
+    char market[24]{};
+    uint64_t next_rest_ms{0};
+    bool ws_started{false};
+    /** RWS-01-equivalent: tellers per wandklok-seconde + gaps. */
+    uint64_t stats_wall_sec{0};
+    uint32_t cur_canonical{0};
+    uint32_t cur_raw{0};
+    uint64_t last_raw_wall_sec{0};
+    uint64_t last_canonical_wall_sec{0};
+    bool gap_warn_latched{false};
+};
+
+static const FeedConfig k_generic_cfg{
+    CONFIG_MD_GENERIC_NAME,
+    "generic_ws_v1",
+    CONFIG_MD_GENERIC_WS_URI,
+    CONFIG_MD_GENERIC_WS_SUBSCRIBE,
+    CONFIG_MD_GENERIC_MSG_MATCH,
+    CONFIG_MD_GENERIC_PRICE_KEY,
+    CONFIG_MD_GENERIC_TS_KEY,
+    CONFIG_MD_GENERIC_MARKET,
+    CONFIG_MD_GENERIC_REST_TICKER_URL,
+    CONFIG_MD_GENERIC_REST_CANDLES_URL,
+};
+
+/** Formaat van `tools/ws_replay.py`: `{"event":"ticker","market":…,"price":"…","timestamp":ms}`. */
+static const FeedConfig k_loopback_cfg{
+    "loopback",
+    "loopback_ws_v1",
+    CONFIG_MD_LOOPBACK_WS_URI,
+    "{\"action\":\"subscribe\",\"market\":\"%s\"}",
+    "\"event\":\"ticker\"",
+    "price",
+    "timestamp",
+    "",
+    "",
+    "",
+};
+
+static Feed s_generic(&k_generic_cfg);
+static Feed s_loopback(&k_loopback_cfg);
+
+/** Waarde na `"key":` (spaties en openingsquote overgeslagen); nullptr als de sleutel ontbreekt. */
+static const char *find_value(const char *json, const char *key)
+{
+    if (!key || !key[0]) {
+        return nullptr;
+    }
+    char pat[40];
+    snprintf(pat, sizeof(pat), "\"%s\"", key);
+    const char *p = strstr(json, pat);
+    if (!p) {
+        return nullptr;
+    }
+    p = strchr(p + strlen(pat), ':');
+    if (!p) {
+        return nullptr;
+    }
+    ++p;
+    while (*p == ' ' || *p == '\"') {
+        ++p;
+    }
+    return p;
+}
+
+/** Dagen sinds 1970-01-01 (proleptisch Gregoriaans; Howard Hinnant days_from_civil). */
+static int64_t days_from_civil(int64_t y, unsigned m, unsigned d)
+{
+    y -= m <= 2 ? 1 : 0;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+/** `2024-01-31T12:34:56.789123Z` → Unix ms (alleen UTC/`Z`); 0 bij ander formaat. */
+static int64_t parse_iso8601_ms(const char *p)
+{
+    int y = 0;
+    unsigned mo = 0, d = 0, h = 0, mi = 0, s = 0;
+    int n = 0;
+    if (sscanf(p, "%4d-%2u-%2uT%2u:%2u:%2u%n", &y, &mo, &d, &h, &mi, &s, &n) != 6 || mo < 1 || mo > 12) {
+        return 0;
+    }
+    p += n;
+    unsigned ms = 0;
+    if (*p == '.') {
+        ++p;
+        unsigned scale = 100;
+        while (*p >= '0' && *p <= '9') {
+            ms += static_cast<unsigned>(*p - '0') * scale;
+            scale /= 10;
+            ++p;
+        }
+    }
+    const int64_t days = days_from_civil(y, mo, d);
+    return ((days * 24 + h) * 60 + mi) * 60000LL + static_cast<int64_t>(s) * 1000LL + ms;
+}
+
+/** Exchange-tijdstempel: getal (ms, of s bij < 1e11, fracties toegestaan) of ISO-8601. */
+static int64_t parse_ts_ms(const char *v)
+{
+    if (!v) {
+        return 0;
+    }
+    const int64_t iso = parse_iso8601_ms(v);
+    if (iso > 0) {
+        return iso;
+    }
+    char *end = nullptr;
+    const double x = strtod(v, &end);
+    if (end == v || x <= 0) {
+        return 0;
+    }
+    return x < 1e11 ? static_cast<int64_t>(x * 1000.0) : static_cast<int64_t>(x);
+}
+
+static void commit_second_stats(Feed &f)
+{
+    const uint64_t w = esp_timer_get_time() / 1000000ULL;
+    if (f.stats_wall_sec == 0ULL) {
+        f.stats_wall_sec = w;
+        return;
+    }
+    while (w > f.stats_wall_sec) {
+        f.snap.ws_inbound_ticks_last_sec = f.cur_canonical;
+        f.snap.ws_raw_msgs_last_sec = f.cur_raw;
+        f.cur_canonical = 0;
+        f.cur_raw = 0;
+        ++f.stats_wall_sec;
+    }
+}
+
+static void publish_gaps(Feed &f)
+{
+    const uint64_t now_s = esp_timer_get_time() / 1000000ULL;
+    uint32_t gap_can = 0;
+    if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(30)) != pdTRUE) {
+        return;
+    }
+    commit_second_stats(f);
+    if (f.last_raw_wall_sec > 0 && now_s >= f.last_raw_wall_sec) {
+        f.snap.ws_gap_sec_since_last_raw = static_cast<uint32_t>(now_s - f.last_raw_wall_sec);
+    }
+    if (f.last_canonical_wall_sec > 0 && now_s >= f.last_canonical_wall_sec) {
+        gap_can = static_cast<uint32_t>(now_s - f.last_canonical_wall_sec);
+    }
+    f.snap.ws_gap_sec_since_last_canonical = gap_can;
+    xSemaphoreGive(f.mx);
+
+    if (gap_can >= 12) {
+        if (!f.gap_warn_latched) {
+            f.gap_warn_latched = true;
+            ESP_LOGW(TAG, "[WS_GAP] %s: no canonical tick for >=12 s (gap=%" PRIu32 " s)", f.cfg->name, gap_can);
+        }
+    } else {
+        f.gap_warn_latched = false;
+    }
+}
+
+static void on_text(Feed &f, const char *data, size_t len)
+{
+    char tmp[640];
+    const size_t n = len < sizeof(tmp) - 1 ? len : sizeof(tmp) - 1;
+    memcpy(tmp, data, n);
+    tmp[n] = '\0';
+
+    const int64_t loc_ms = static_cast<int64_t>(esp_timer_get_time() / 1000);
+    double price = 0;
+    bool ok = f.cfg->msg_match[0] == '\0' || strstr(tmp, f.cfg->msg_match) != nullptr;
+    const char *pv = ok ? find_value(tmp, f.cfg->price_key) : nullptr;
+    if (pv) {
+        char *end = nullptr;
+        price = strtod(pv, &end);
+        ok = end != pv && price > 0.0;
+    } else {
+        ok = false;
+    }
+    const int64_t ts_exch = ok ? parse_ts_ms(find_value(tmp, f.cfg->ts_key)) : 0;
+
+    if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return;
+    }
+    commit_second_stats(f);
+    ++f.cur_raw;
+    f.last_raw_wall_sec = static_cast<uint64_t>(loc_ms / 1000);
+    if (ok) {
+        ++f.cur_canonical;
+        f.last_canonical_wall_sec = f.last_raw_wall_sec;
+        f.snap.last_tick.price_eur = price;
+        f.snap.last_tick.ts_ms = loc_ms;
+        f.snap.last_tick.ts_exchange_ms = ts_exch;
+        f.snap.valid = true;
+        f.snap.last_tick_source = market_types::TickSource::Ws;
+        f.snap.connection = market_types::ConnectionState::Connected;
+        f.snap.last_error = market_types::FeedErrorCode::None;
+    }
+    xSemaphoreGive(f.mx);
+    ESP_LOGD(TAG, "[WS_AGG] %s ok=%d price=%.6f exch_ms=%lld", f.cfg->name, ok ? 1 : 0, price, (long long)ts_exch);
+}
+
+static void send_subscribe(Feed &f)
+{
+    char payload[320];
+    const int n = snprintf(payload, sizeof(payload), f.cfg->subscribe_fmt, f.market, f.market);
+    if (n <= 0 || n >= static_cast<int>(sizeof(payload))) {
+        ESP_LOGW(TAG, "%s: subscribe buffer overflow", f.cfg->name);
+        return;
+    }
+    if (esp_websocket_client_send_text(f.client, payload, static_cast<size_t>(n), pdMS_TO_TICKS(4000)) < 0) {
+        ESP_LOGW(TAG, "%s: send_text subscribe failed", f.cfg->name);
+    } else {
+        ESP_LOGI(DIAG_TAG_MARKET, "WS subscribe %s %s", f.cfg->name, f.market);
+    }
+}
+
+static void on_event(void *handler_args, esp_event_base_t base, int32_t event_id, void *event_data)
+{
+    (void)base;
+    Feed &f = *static_cast<Feed *>(handler_args);
+    auto *data = static_cast<esp_websocket_event_data_t *>(event_data);
+
+    switch (event_id) {
+    case WEBSOCKET_EVENT_CONNECTED:
+        ESP_LOGI(DIAG_TAG_MARKET, "WS connected (%s)", f.cfg->name);
+        if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(50)) == pdTRUE) {
+            f.snap.ws_link_up = true;
+            xSemaphoreGive(f.mx);
+        }
+        send_subscribe(f);
+        break;
+    case WEBSOCKET_EVENT_DISCONNECTED:
+        ESP_LOGW(DIAG_TAG_MARKET, "WS disconnected (%s)", f.cfg->name);
+        if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(50)) == pdTRUE) {
+            f.snap.ws_reconnect_count++;
+            f.snap.ws_link_up = false;
+            if (f.snap.connection == market_types::ConnectionState::Connected) {
+                f.snap.connection = market_types::ConnectionState::Connecting;
+            }
+            xSemaphoreGive(f.mx);
+        }
+        break;
+    case WEBSOCKET_EVENT_DATA:
+        if (data->op_code == 1 && data->data_ptr != nullptr && data->data_len > 0) {
+            on_text(f, data->data_ptr, static_cast<size_t>(data->data_len));
+        }
+        break;
+    case WEBSOCKET_EVENT_ERROR:
+        ESP_LOGW(DIAG_TAG_MARKET, "WS error (%s)", f.cfg->name);
+        if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(50)) == pdTRUE) {
+            f.snap.last_error = market_types::FeedErrorCode::WsFailure;
+            strncpy(f.snap.last_error_detail, "ws error", sizeof(f.snap.last_error_detail) - 1);
+            xSemaphoreGive(f.mx);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static esp_err_t ws_start(Feed &f)
+{
+    esp_websocket_client_config_t wcfg{};
+    wcfg.uri = f.cfg->ws_uri;
+    if (strncmp(f.cfg->ws_uri, "wss://", 6) == 0) {
+        wcfg.crt_bundle_attach = esp_crt_bundle_attach;
+    }
+    wcfg.network_timeout_ms = 15000;
+    wcfg.reconnect_timeout_ms = 10000;
+    wcfg.disable_auto_reconnect = false;
+    /* MD-01: half-open socket → DISCONNECTED binnen ~20 s; failover kijkt naar de verbinding, niet naar stilte */
+    wcfg.ping_interval_sec = 10;
+    wcfg.pingpong_timeout_sec = 20;
+
+    f.client = esp_websocket_client_init(&wcfg);
+    ESP_RETURN_ON_FALSE(f.client, ESP_ERR_NO_MEM, TAG, "ws init");
+    ESP_RETURN_ON_ERROR(esp_websocket_register_events(f.client, WEBSOCKET_EVENT_ANY, on_event, &f), TAG,
+                        "ws events");
+    return esp_websocket_client_start(f.client);
+}
+
+/** GET `url` → `buf` onder `net_mutex`; eigen kortlevende client (tweede venue pollt zelden). */
+static esp_err_t http_get(const char *url, char *buf, size_t cap, char *err, size_t err_len)
+{
+    if (!net_runtime::net_mutex_take(pdMS_TO_TICKS(20000))) {
+        snprintf(err, err_len, "net_mutex timeout");
+        return ESP_ERR_TIMEOUT;
+    }
+    esp_http_client_config_t cfg{};
+    cfg.url = url;
+    cfg.method = HTTP_METHOD_GET;
+    cfg.timeout_ms = 15000;
+    cfg.user_agent = "CryptoAlertV2"; /* Coinbase weigert requests zonder User-Agent */
+    if (strncmp(url, "https://", 8) == 0) {
+        cfg.crt_bundle_attach = esp_crt_bundle_attach;
+    }
+    esp_http_client_handle_t h = esp_http_client_init(&cfg);
+    if (!h) {
+        net_runtime::net_mutex_give();
+        snprintf(err, err_len, "http init");
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t e = esp_http_client_open(h, 0);
+    int total = 0;
+    if (e == ESP_OK) {
+        (void)esp_http_client_fetch_headers(h);
+        const int status = esp_http_client_get_status_code(h);
+        if (status < 200 || status >= 300) {
+            snprintf(err, err_len, "HTTP %d", status);
+            e = ESP_FAIL;
+        }
+        while (e == ESP_OK && total < static_cast<int>(cap - 1)) {
+            const int r = esp_http_client_read(h, buf + total, static_cast<int>(cap - 1 - total));
+            if (r < 0) {
+                snprintf(err, err_len, "read err");
+                e = ESP_FAIL;
+            }
+            if (r <= 0) {
+                break;
+            }
+            total += r;
+        }
+        esp_http_client_close(h);
+    } else {
+        snprintf(err, err_len, "open %s", esp_err_to_name(e));
+    }
+    esp_http_client_cleanup(h);
+    net_runtime::net_mutex_give();
+    if (e == ESP_OK && total <= 0) {
+        snprintf(err, err_len, "empty body");
+        e = ESP_FAIL;
+    }
+    buf[e == ESP_OK ? total : 0] = '\0';
+    return e;
+}
+
+static void rest_bootstrap(Feed &f, uint64_t now_ms)
+{
+    char url[192];
+    snprintf(url, sizeof(url), f.cfg->rest_ticker_url_fmt, f.market);
+    char body[512];
+    char err[48]{};
+    esp_err_t e = http_get(url, body, sizeof(body), err, sizeof(err));
+    double p = 0;
+    if (e == ESP_OK) {
+        const char *pv = find_value(body, f.cfg->price_key);
+        char *end = nullptr;
+        p = pv ? strtod(pv, &end) : 0.0;
+        if (!pv || end == pv || p <= 0.0) {
+            snprintf(err, sizeof(err), "parse price");
+            e = ESP_FAIL;
+        }
+    }
+    if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return;
+    }
+    if (e == ESP_OK) {
+        f.snap.last_tick.price_eur = p;
+        f.snap.last_tick.ts_ms = static_cast<int64_t>(now_ms);
+        f.snap.last_tick.ts_exchange_ms = 0;
+        f.snap.valid = true;
+        f.snap.last_tick_source = market_types::TickSource::Rest;
+        f.snap.rest_bootstrap_ok++;
+        f.snap.last_error = market_types::FeedErrorCode::None;
+        f.snap.last_error_detail[0] = '\0';
+    } else {
+        f.snap.last_error = market_types::FeedErrorCode::RestFailure;
+        strncpy(f.snap.last_error_detail, err, sizeof(f.snap.last_error_detail) - 1);
+    }
+    xSemaphoreGive(f.mx);
+    ESP_LOGI(DIAG_TAG_MARKET, "REST %s %s: %s", f.cfg->name, f.market, e == ESP_OK ? "ok" : err);
+}
+
+esp_err_t feed_start(void *ctx, const char *market_symbol)
+{
+    Feed &f = *static_cast<Feed *>(ctx);
+    if (!market_symbol || !market_symbol[0]) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!f.mx) {
+        f.mx = xSemaphoreCreateMutex();
+        ESP_RETURN_ON_FALSE(f.mx, ESP_ERR_NO_MEM, TAG, "mutex");
+    }
+    const char *m = f.cfg->market_override[0] ? f.cfg->market_override : market_symbol;
+    f.market[0] = '\0';
+    strncat(f.market, m, sizeof(f.market) - 1);
+    f.snap = {};
+    strncpy(f.snap.market_label, market_symbol, sizeof(f.snap.market_label) - 1);
+    strncpy(f.snap.ws_official_price_stream, f.cfg->stream_label, sizeof(f.snap.ws_official_price_stream) - 1);
+    f.next_rest_ms = 0;
+    f.ws_started = false;
+    f.stats_wall_sec = 0;
+    f.cur_canonical = 0;
+    f.cur_raw = 0;
+    f.last_raw_wall_sec = 0;
+    f.last_canonical_wall_sec = 0;
+    f.gap_warn_latched = false;
+    ESP_LOGI(DIAG_TAG_MARKET, "%s init market=%s uri=%s", f.cfg->name, f.market, f.cfg->ws_uri);
+    return ESP_OK;
+}
+
+void feed_stop(void *ctx)
+{
+    Feed &f = *static_cast<Feed *>(ctx);
+    if (f.client) {
+        esp_websocket_client_stop(f.client);
+        esp_websocket_client_destroy(f.client);
+        f.client = nullptr;
+    }
+    f.ws_started = false;
+    if (f.mx && xSemaphoreTake(f.mx, pdMS_TO_TICKS(100)) == pdTRUE) {
+        f.snap.connection = market_types::ConnectionState::Disconnected;
+        f.snap.ws_link_up = false;
+        xSemaphoreGive(f.mx);
+    }
+    ESP_LOGI(DIAG_TAG_MARKET, "%s stop", f.cfg->name);
+}
+
+void feed_tick(void *ctx)
+{
+    Feed &f = *static_cast<Feed *>(ctx);
+    if (!f.mx) {
+        return;
+    }
+    const uint64_t now = esp_timer_get_time() / 1000ULL;
+    if (f.ws_started) {
+        publish_gaps(f);
+    }
+    if (!net_runtime::has_ip()) {
+        if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(50)) == pdTRUE) {
+            f.snap.connection = market_types::ConnectionState::Error;
+            f.snap.last_error = market_types::FeedErrorCode::NetworkDown;
+            strncpy(f.snap.last_error_detail, "geen IP (WiFi?)", sizeof(f.snap.last_error_detail) - 1);
+            xSemaphoreGive(f.mx);
+        }
+        return;
+    }
+
+    if (f.cfg->rest_ticker_url_fmt[0] && now >= f.next_rest_ms) {
+        bool ws_live = false;
+        if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(20)) == pdTRUE) {
+            ws_live = f.snap.last_tick_source == market_types::TickSource::Ws &&
+                      f.snap.connection == market_types::ConnectionState::Connected;
+            xSemaphoreGive(f.mx);
+        }
+        if (!ws_live) {
+            rest_bootstrap(f, now);
+        }
+        f.next_rest_ms = now + (ws_live ? 300000ULL : 45000ULL);
+    }
+
+    if (!f.ws_started) {
+        f.ws_started = true; /* één poging; esp_websocket_client reconnect intern */
+        if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(50)) == pdTRUE) {
+            f.snap.connection = market_types::ConnectionState::Connecting;
+            xSemaphoreGive(f.mx);
+        }
+        const esp_err_t e = ws_start(f);
+        if (e != ESP_OK) {
+            ESP_LOGW(TAG, "%s WS start: %s", f.cfg->name, esp_err_to_name(e));
+            if (xSemaphoreTake(f.mx, pdMS_TO_TICKS(50)) == pdTRUE) {
+                f.snap.last_error = market_types::FeedErrorCode::WsFailure;
+                strncpy(f.snap.last_error_detail, "ws start", sizeof(f.snap.last_error_detail) - 1);
+                xSemaphoreGive(f.mx);
+            }
+        }
+    }
+}
+
+market_types::MarketSnapshot feed_snapshot(void *ctx)
+{
+    Feed &f = *static_cast<Feed *>(ctx);
+    market_types::MarketSnapshot o{};
+    if (f.mx && xSemaphoreTake(f.mx, pdMS_TO_TICKS(200)) == pdTRUE) {
+        o = f.snap;
+        xSemaphoreGive(f.mx);
+    }
+    return o;
+}
+
+/** `1m`/`5m`/`1h`/`1d` → seconden; 0 bij onbekende eenheid. */
+static unsigned interval_seconds(const char *interval)
+{
+    char *end = nullptr;
+    const unsigned long n = strtoul(interval, &end, 10);
+    if (end == interval || n == 0) {
+        return 0;
+    }
+    switch (*end) {
+    case 'm':
+        return static_cast<unsigned>(n * 60UL);
+    case 'h':
+        return static_cast<unsigned>(n * 3600UL);
+    case 'd':
+        return static_cast<unsigned>(n * 86400UL);
+    default:
+        return 0;
+    }
+}
+
+/** Layout `[[t_s, low, high, open, close, volume], …]` (nieuwste eerst), zoals Coinbase Exchange. */
+esp_err_t feed_candles(void *ctx, const char *market_symbol, const char *interval, market_types::CandleBar *out,
+                       size_t cap, size_t *n_out)
+{
+    Feed &f = *static_cast<Feed *>(ctx);
+    if (!f.cfg->rest_candles_url_fmt[0]) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (!market_symbol || !interval || !out || cap == 0 || !n_out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *n_out = 0;
+    const unsigned gran = interval_seconds(interval);
+    if (gran == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const char *m = f.cfg->market_override[0] ? f.cfg->market_override : market_symbol;
+    char url[224];
+    snprintf(url, sizeof(url), f.cfg->rest_candles_url_fmt, m, gran);
+
+    const size_t body_cap = cap * 80U + 16U;
+    char *buf = static_cast<char *>(malloc(body_cap));
+    if (!buf) {
+        return ESP_ERR_NO_MEM;
+    }
+    char err[48]{};
+    esp_err_t e = http_get(url, buf, body_cap, err, sizeof(err));
+    size_t n = 0;
+    if (e == ESP_OK) {
+        const char *p = strchr(buf, '[');
+        while (p && n < cap && (p = strchr(p + 1, '[')) != nullptr) {
+            double v[6];
+            char *q = const_cast<char *>(p + 1);
+            bool ok = true;
+            for (double &x : v) {
+                while (*q == ' ' || *q == ',' || *q == '\"') {
+                    ++q;
+                }
+                char *end = nullptr;
+                x = strtod(q, &end);
+                if (end == q) {
+                    ok = false;
+                    break;
+                }
+                q = end;
+            }
+            if (!ok) {
+                break;
+            }
+            market_types::CandleBar &b = out[n++];
+            b.open_ms = static_cast<int64_t>(v[0]) * 1000LL;
+            b.low = v[1];
+            b.high = v[2];
+            b.open = v[3];
+            b.close = v[4];
+            b.volume = v[5];
+            p = q;
+        }
+    }
+    free(buf);
+    for (size_t i = 0; i < n / 2; ++i) {
+        const market_types::CandleBar t = out[i];
+        out[i] = out[n - 1 - i];
+        out[n - 1 - i] = t;
+    }
+    *n_out = n;
+    if (e == ESP_OK && n == 0) {
+        snprintf(err, sizeof(err), "parse candles");
+        e = ESP_FAIL;
+    }
+    if (e != ESP_OK) {
+        ESP_LOGW(TAG, "%s candles %s/%s: %s", f.cfg->name, m, interval, err);
+    }
+    return e;
+}
+
+} // namespace
+
+const market_types::FeedProvider &provider()
+{
+    static const market_types::FeedProvider p{
+        k_generic_cfg.name, &s_generic, feed_start, feed_stop, feed_tick, feed_snapshot, feed_candles,
+    };
+    return p;
+}
+
+const market_types::FeedProvider &loopback_provider()
+{
+    static const market_types::FeedProvider p{
+        k_loopback_cfg.name, &s_loopback, feed_start, feed_stop, feed_tick, feed_snapshot, nullptr,
+    };
+    return p;
+}
+
+} // namespace exchange_generic
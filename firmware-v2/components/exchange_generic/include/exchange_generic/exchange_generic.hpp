@@ -0,0 +1,20 @@
+#pragma once
+
+#include "market_types/provider.hpp"
+
+namespace exchange_generic {
+
+/**
+ * MD-01: tweede venue achter `market_data` — generieke JSON-over-WebSocket feed.
+ * Endpoint, subscribe-bericht, berichtfilter en JSON-sleutels komen uit menuconfig (default: Coinbase
+ * Exchange `ticker`, zelfde BASE-QUOTE-notatie als Bitvavo). Optioneel REST-bootstrap en candles.
+ *
+ * Twee instanties met dezelfde code:
+ * - `provider()` — naam uit `CONFIG_MD_GENERIC_NAME` (echte venue, TLS).
+ * - `loopback_provider()` — naam `"loopback"`; `CONFIG_MD_LOOPBACK_WS_URI` (bv. `ws://<pc>:8765`,
+ *   `tools/ws_replay.py` speelt een opgenomen tickbestand af). Testopstelling, geen REST.
+ */
+const market_types::FeedProvider &provider();
+const market_types::FeedProvider &loopback_provider();
+
+} // namespace exchange_generic
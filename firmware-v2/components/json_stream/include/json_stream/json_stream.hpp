@@ -0,0 +1,71 @@
+#pragma once
+
+/**
+ * Streaming JSON-writer zonder heap: serialiseert direct uit snapshot-structs naar een vaste
+ * buffer van de aanroeper en geeft volle buffers door aan een sink (bijv. httpd_resp_send_chunk).
+ * Geen cJSON-boom, geen nodes, geen print-buffer.
+ *
+ * Komma's worden per nesting-niveau bijgehouden (max. kMaxDepth). De eerste sink-fout is
+ * "sticky": verdere schrijfacties worden genegeerd en `finish()` geeft die fout terug.
+ * Getallen volgen de cJSON-notatie (geheel → zonder decimalen, anders %.15g/%.17g, NaN/inf → null),
+ * zodat bestaande clients dezelfde tekst zien.
+ */
+#include "esp_err.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace json_stream {
+
+/** Ontvangt `len` bytes (niet nul-getermineerd). */
+using Sink = esp_err_t (*)(const char *data, size_t len, void *ctx);
+
+constexpr unsigned kMaxDepth = 32;
+
+class Writer {
+public:
+    /** `buf` moet minstens 64 bytes zijn; blijft eigendom van de aanroeper. */
+    Writer(char *buf, size_t cap, Sink sink, void *ctx);
+    Writer(const Writer &) = delete;
+    Writer &operator=(const Writer &) = delete;
+
+    /** `key` = nullptr voor waarden in een array of de root. */
+    void begin_object(const char *key = nullptr);
+    void end_object();
+    void begin_array(const char *key = nullptr);
+    void end_array();
+
+    void str(const char *key, const char *value);
+    void boolean(const char *key, bool value);
+    void number(const char *key, double value);
+    void int64(const char *key, int64_t value);
+    void uint64(const char *key, uint64_t value);
+    void null(const char *key);
+
+    /** Rest van de buffer naar de sink; retourneert de eerste fout (of ESP_ERR_INVALID_STATE bij open scopes). */
+    esp_err_t finish();
+
+    esp_err_t error() const { return err_; }
+    size_t bytes_total() const { return total_; }
+
+private:
+    void value_prefix(const char *key);
+    void put(const char *s, size_t n);
+    void put_char(char c);
+    void put_escaped(const char *s);
+    void flush();
+    void open(char c, const char *key);
+    void close(char c);
+
+    char *buf_;
+    size_t cap_;
+    size_t len_{0};
+    size_t total_{0};
+    Sink sink_;
+    void *ctx_;
+    uint32_t has_item_{0}; ///< Bit per niveau: er staat al een waarde (komma nodig)
+    uint8_t depth_{0};
+    esp_err_t err_{ESP_OK};
+};
+
+} // namespace json_stream
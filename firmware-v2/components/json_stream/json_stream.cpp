@@ -0,0 +1,235 @@
+#include "json_stream/json_stream.hpp"
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace json_stream {
+
+Writer::Writer(char *buf, size_t cap, Sink sink, void *ctx)
+    : buf_(buf), cap_(cap), sink_(sink), ctx_(ctx)
+{
+    if (!buf_ || cap_ < 64 || !sink_) {
+        err_ = ESP_ERR_INVALID_ARG;
+    }
+}
+
+void Writer::flush()
+{
+    if (len_ == 0 || err_ != ESP_OK) {
+        len_ = 0;
+        return;
+    }
+    const esp_err_t e = sink_(buf_, len_, ctx_);
+    if (e != ESP_OK) {
+        err_ = e;
+    }
+    total_ += len_;
+    len_ = 0;
+}
+
+void Writer::put(const char *s, size_t n)
+{
+    while (n > 0 && err_ == ESP_OK) {
+        if (len_ == cap_) {
+            flush();
+            continue;
+        }
+        const size_t room = cap_ - len_;
+        const size_t k = n < room ? n : room;
+        memcpy(buf_ + len_, s, k);
+        len_ += k;
+        s += k;
+        n -= k;
+    }
+}
+
+void Writer::put_char(char c)
+{
+    if (len_ == cap_) {
+        flush();
+    }
+    if (err_ == ESP_OK) {
+        buf_[len_++] = c;
+    }
+}
+
+/** Zelfde escapes als cJSON; UTF-8 gaat ongewijzigd door. */
+void Writer::put_escaped(const char *s)
+{
+    put_char('"');
+    const char *run = s;
+    for (; *s; ++s) {
+        const unsigned char c = static_cast<unsigned char>(*s);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        put(run, static_cast<size_t>(s - run));
+        run = s + 1;
+        char esc[8];
+        switch (c) {
+        case '"':
+            put("\\\"", 2);
+            break;
+        case '\\':
+            put("\\\\", 2);
+            break;
+        case '\b':
+            put("\\b", 2);
+            break;
+        case '\f':
+            put("\\f", 2);
+            break;
+        case '\n':
+            put("\\n", 2);
+            break;
+        case '\r':
+            put("\\r", 2);
+            break;
+        case '\t':
+            put("\\t", 2);
+            break;
+        default:
+            snprintf(esc, sizeof(esc), "\\u%04x", static_cast<unsigned>(c));
+            put(esc, 6);
+            break;
+        }
+    }
+    put(run, static_cast<size_t>(s - run));
+    put_char('"');
+}
+
+void Writer::value_prefix(const char *key)
+{
+    if (depth_ > 0) {
+        const uint32_t bit = 1u << (depth_ - 1u);
+        if (has_item_ & bit) {
+            put_char(',');
+        }
+        has_item_ |= bit;
+    }
+    if (key) {
+        put_escaped(key);
+        put_char(':');
+    }
+}
+
+void Writer::open(char c, const char *key)
+{
+    if (depth_ >= kMaxDepth) {
+        err_ = ESP_ERR_INVALID_SIZE;
+        return;
+    }
+    value_prefix(key);
+    put_char(c);
+    ++depth_;
+    has_item_ &= ~(1u << (depth_ - 1u));
+}
+
+void Writer::close(char c)
+{
+    if (depth_ == 0) {
+        err_ = ESP_ERR_INVALID_STATE;
+        return;
+    }
+    --depth_;
+    put_char(c);
+}
+
+void Writer::begin_object(const char *key)
+{
+    open('{', key);
+}
+
+void Writer::end_object()
+{
+    close('}');
+}
+
+void Writer::begin_array(const char *key)
+{
+    open('[', key);
+}
+
+void Writer::end_array()
+{
+    close(']');
+}
+
+void Writer::str(const char *key, const char *value)
+{
+    value_prefix(key);
+    put_escaped(value ? value : "");
+}
+
+void Writer::boolean(const char *key, bool value)
+{
+    value_prefix(key);
+    if (value) {
+        put("true", 4);
+    } else {
+        put("false", 5);
+    }
+}
+
+void Writer::null(const char *key)
+{
+    value_prefix(key);
+    put("null", 4);
+}
+
+void Writer::number(const char *key, double value)
+{
+    value_prefix(key);
+    if (std::isnan(value) || std::isinf(value)) {
+        put("null", 4);
+        return;
+    }
+    char tmp[32];
+    int n;
+    // cJSON print_number: gehele waarden binnen int-bereik zonder decimalen
+    if (value >= INT32_MIN && value <= INT32_MAX && value == static_cast<double>(static_cast<int32_t>(value))) {
+        n = snprintf(tmp, sizeof(tmp), "%" PRId32, static_cast<int32_t>(value));
+    } else {
+        n = snprintf(tmp, sizeof(tmp), "%1.15g", value);
+        if (std::strtod(tmp, nullptr) != value) {
+            n = snprintf(tmp, sizeof(tmp), "%1.17g", value);
+        }
+    }
+    if (n > 0) {
+        put(tmp, static_cast<size_t>(n));
+    }
+}
+
+void Writer::int64(const char *key, int64_t value)
+{
+    value_prefix(key);
+    char tmp[24];
+    const int n = snprintf(tmp, sizeof(tmp), "%" PRId64, value);
+    if (n > 0) {
+        put(tmp, static_cast<size_t>(n));
+    }
+}
+
+void Writer::uint64(const char *key, uint64_t value)
+{
+    value_prefix(key);
+    char tmp[24];
+    const int n = snprintf(tmp, sizeof(tmp), "%" PRIu64, value);
+    if (n > 0) {
+        put(tmp, static_cast<size_t>(n));
+    }
+}
+
+esp_err_t Writer::finish()
+{
+    if (err_ == ESP_OK && depth_ != 0) {
+        err_ = ESP_ERR_INVALID_STATE;
+    }
+    flush();
+    return err_;
+}
+
+} // namespace json_stream
@@ -2,13 +2,15 @@
 
 #include "config_store/config_store.hpp"
 #include "market_data/types.hpp"
+#include "market_types/provider.hpp"
 #include "esp_err.h"
 
 namespace market_data {
 
 /**
  * Functionele grens naar UI: alleen snapshot/tick — geen Bitvavo- of TLS-details.
- * Backend: mock (menuconfig uit) of `exchange_bitvavo` achter deze API.
+ * Backend: provider-registry (MD-01). Ingebouwd per menuconfig: Bitvavo, generieke WS-venue,
+ * loopback-stand-in; mock alleen als geen netwerkprovider aan staat.
  *
  * M-002: enige bron van `MarketSnapshot` voor app_core; exchange_bitvavo niet direct vanuit UI.
  */
@@ -16,4 +18,28 @@ esp_err_t init(const config_store::RuntimeConfig &cfg);
 void tick();
 MarketSnapshot snapshot();
 
+using FeedProvider = market_types::FeedProvider;
+using CandleBar = market_types::CandleBar;
+
+/**
+ * MD-01: extra provider registreren (vóór of na `init`; max. 4). `p` moet de hele levensduur geldig blijven.
+ * Dubbele naam → ESP_ERR_INVALID_STATE.
+ */
+esp_err_t register_provider(const FeedProvider &p);
+
+/**
+ * MD-01: handmatig naar provider `name` wisselen (oude stoppen, nieuwe starten).
+ * ESP_ERR_NOT_FOUND als de naam niet geregistreerd is.
+ */
+esp_err_t select_provider(const char *name);
+
+/** Naam van de actieve provider; `""` vóór `init`. */
+const char *active_provider();
+
+/**
+ * MD-01: candle-historie via de actieve provider (`out[0]` = oudste bar).
+ * ESP_ERR_NOT_SUPPORTED als die venue geen candles levert.
+ */
+esp_err_t fetch_candles(const char *interval, CandleBar *out, size_t cap, size_t *n_out);
+
 } // namespace market_data
@@ -1,48 +1,234 @@
+/**
+ * MD-01: provider-registry + failover.
+ * - Eén actieve provider tegelijk (cold standby: andere venues hebben geen open TLS/WS).
+ * - Failover: actieve feed «stalt» als de WS-socket `CONFIG_MD_FAILOVER_GAP_SEC` aaneen dicht is
+ *   (`ws_link_up`; half-open sockets vallen via de WS-ping/pong-timeout weg), of als er
+ *   na de dwell-tijd nog geen live WS-tick is geweest. Stilte op een verbonden socket telt niet: een
+ *   illiquide markt tikt soms minutenlang niet. Dan stop → volgende geregistreerde provider
+ *   (round-robin). Minimale dwell per provider voorkomt flapperen; zonder IP geen failover
+ *   (dan stalt elke venue).
+ */
 #include "market_data/market_data.hpp"
 #include "diagnostics/diagnostics.hpp"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "net_runtime/net_runtime.hpp"
 
 #include "sdkconfig.h"
 
 #if CONFIG_MD_USE_EXCHANGE_BITVAVO
 #include "exchange_bitvavo/exchange_bitvavo.hpp"
-#else
-namespace market_data {
-esp_err_t mock_init();
-void mock_tick();
-MarketSnapshot mock_snapshot();
-} // namespace market_data
+#endif
+#if CONFIG_MD_USE_EXCHANGE_GENERIC || CONFIG_MD_USE_LOOPBACK_FEED
+#include "exchange_generic/exchange_generic.hpp"
+#endif
+
+#include <atomic>
+#include <cstring>
+
+#ifndef CONFIG_MD_PRIMARY_PROVIDER
+#define CONFIG_MD_PRIMARY_PROVIDER "bitvavo"
+#endif
+#ifndef CONFIG_MD_FAILOVER_GAP_SEC
+#define CONFIG_MD_FAILOVER_GAP_SEC 0
+#endif
+#ifndef CONFIG_MD_FAILOVER_MIN_DWELL_SEC
+#define CONFIG_MD_FAILOVER_MIN_DWELL_SEC 60
 #endif
 
 namespace market_data {
 
+const FeedProvider &mock_provider();
+
+namespace {
+
+static constexpr size_t k_max_providers = 4;
+static constexpr uint32_t k_failover_gap_sec = CONFIG_MD_FAILOVER_GAP_SEC;
+static constexpr uint64_t k_min_dwell_ms = static_cast<uint64_t>(CONFIG_MD_FAILOVER_MIN_DWELL_SEC) * 1000ULL;
+
+static const FeedProvider *s_providers[k_max_providers]{};
+static size_t s_provider_count{0};
+/** Index in `s_providers`; -1 = nog niet gestart. Atomic: webui leest `snapshot()` vanuit eigen taak. */
+static std::atomic<int> s_active{-1};
+static char s_symbol[24]{};
+static uint64_t s_active_since_ms{0};
+/** Begin van de huidige periode zonder WS-socket (`ws_link_up`); 0 = socket staat open. */
+static uint64_t s_link_down_since_ms{0};
+static uint32_t s_failover_count{0};
+
+static int find_provider(const char *name)
+{
+    for (size_t i = 0; i < s_provider_count; ++i) {
+        if (std::strcmp(s_providers[i]->name, name) == 0) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+static esp_err_t activate(int idx)
+{
+    const int old = s_active.load();
+    if (old >= 0 && old != idx) {
+        s_providers[old]->stop(s_providers[old]->ctx);
+    }
+    const FeedProvider &p = *s_providers[idx];
+    const esp_err_t e = p.start(p.ctx, s_symbol);
+    s_active.store(idx);
+    s_active_since_ms = esp_timer_get_time() / 1000ULL;
+    s_link_down_since_ms = 0;
+    ESP_LOGI(DIAG_TAG_MARKET, "provider=%s market=%s (%s)", p.name, s_symbol, esp_err_to_name(e));
+    return e;
+}
+
+/** Houdt bij hoe lang de WS-socket van de actieve provider al dicht is (elke tick, ook tijdens dwell). */
+static void track_link(const MarketSnapshot &snap, uint64_t now_ms)
+{
+    if (snap.ws_link_up) {
+        s_link_down_since_ms = 0;
+    } else if (s_link_down_since_ms == 0) {
+        s_link_down_since_ms = now_ms;
+    }
+}
+
+/** Stall-criterium op de snapshot van de actieve provider (alleen na dwell). */
+static bool active_stalled(const MarketSnapshot &snap, uint64_t now_ms)
+{
+    if (s_link_down_since_ms != 0) {
+        return now_ms - s_link_down_since_ms >= static_cast<uint64_t>(k_failover_gap_sec) * 1000ULL;
+    }
+    /* Verbonden, maar binnen de dwell-tijd nooit live gekomen (subscribe geweigerd, alleen REST). */
+    return snap.last_tick_source != TickSource::Ws;
+}
+
+static void maybe_failover()
+{
+    const int cur = s_active.load();
+    if (k_failover_gap_sec == 0 || s_provider_count < 2 || cur < 0 || !net_runtime::has_ip()) {
+        return;
+    }
+    const uint64_t now_ms = esp_timer_get_time() / 1000ULL;
+    const FeedProvider &p = *s_providers[cur];
+    const MarketSnapshot snap = p.snapshot(p.ctx);
+    track_link(snap, now_ms);
+    if (now_ms - s_active_since_ms < k_min_dwell_ms) {
+        return;
+    }
+    if (!active_stalled(snap, now_ms)) {
+        return;
+    }
+    const int next = static_cast<int>((static_cast<size_t>(cur) + 1U) % s_provider_count);
+    ++s_failover_count;
+    ESP_LOGW(DIAG_TAG_MARKET,
+             "[MD_FAILOVER] %s -> %s (link_down=%u s raw_gap=%u s, bron=%u, wissel #%u)",
+             p.name,
+             s_providers[next]->name,
+             static_cast<unsigned>(s_link_down_since_ms ? (now_ms - s_link_down_since_ms) / 1000ULL : 0),
+             static_cast<unsigned>(snap.ws_gap_sec_since_last_raw),
+             static_cast<unsigned>(snap.last_tick_source),
+             static_cast<unsigned>(s_failover_count));
+    (void)activate(next);
+}
+
+} // namespace
+
+esp_err_t register_provider(const FeedProvider &p)
+{
+    if (!p.name || !p.start || !p.stop || !p.tick || !p.snapshot) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (find_provider(p.name) >= 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_provider_count >= k_max_providers) {
+        return ESP_ERR_NO_MEM;
+    }
+    s_providers[s_provider_count++] = &p;
+    ESP_LOGI(DIAG_TAG_MARKET, "provider registered: %s (candles=%s)", p.name, p.fetch_candles ? "ja" : "nee");
+    return ESP_OK;
+}
+
 esp_err_t init(const config_store::RuntimeConfig &cfg)
 {
+    std::strncpy(s_symbol, cfg.default_symbol, sizeof(s_symbol) - 1);
 #if CONFIG_MD_USE_EXCHANGE_BITVAVO
-    ESP_LOGI(DIAG_TAG_MARKET, "provider=Bitvavo exchange (T-103)");
-    return exchange_bitvavo::init(cfg.default_symbol);
-#else
-    ESP_LOGI(DIAG_TAG_MARKET, "provider=mock");
-    return mock_init();
+    (void)register_provider(exchange_bitvavo::provider());
+#endif
+#if CONFIG_MD_USE_EXCHANGE_GENERIC
+    (void)register_provider(exchange_generic::provider());
 #endif
+#if CONFIG_MD_USE_LOOPBACK_FEED
+    (void)register_provider(exchange_generic::loopback_provider());
+#endif
+    if (s_provider_count == 0) {
+        (void)register_provider(mock_provider());
+    }
+    int idx = find_provider(CONFIG_MD_PRIMARY_PROVIDER);
+    if (idx < 0) {
+        ESP_LOGW(DIAG_TAG_MARKET, "primaire provider '%s' niet geregistreerd — %s", CONFIG_MD_PRIMARY_PROVIDER,
+                 s_providers[0]->name);
+        idx = 0;
+    }
+    ESP_LOGI(DIAG_TAG_MARKET, "providers=%u failover_gap=%u s dwell=%u s", static_cast<unsigned>(s_provider_count),
+             static_cast<unsigned>(k_failover_gap_sec), static_cast<unsigned>(k_min_dwell_ms / 1000ULL));
+    return activate(idx);
 }
 
 void tick()
 {
-#if CONFIG_MD_USE_EXCHANGE_BITVAVO
-    exchange_bitvavo::tick();
-#else
-    mock_tick();
-#endif
+    const int cur = s_active.load();
+    if (cur < 0) {
+        return;
+    }
+    s_providers[cur]->tick(s_providers[cur]->ctx);
+    maybe_failover();
 }
 
 MarketSnapshot snapshot()
 {
-#if CONFIG_MD_USE_EXCHANGE_BITVAVO
-    return exchange_bitvavo::snapshot();
-#else
-    return mock_snapshot();
-#endif
+    const int cur = s_active.load();
+    if (cur < 0) {
+        return MarketSnapshot{};
+    }
+    const FeedProvider &p = *s_providers[cur];
+    MarketSnapshot o = p.snapshot(p.ctx);
+    std::strncpy(o.feed_provider, p.name, sizeof(o.feed_provider) - 1);
+    o.feed_failover_count = s_failover_count;
+    return o;
+}
+
+esp_err_t select_provider(const char *name)
+{
+    if (!name) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const int idx = find_provider(name);
+    if (idx < 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (idx == s_active.load()) {
+        return ESP_OK;
+    }
+    return activate(idx);
+}
+
+const char *active_provider()
+{
+    const int cur = s_active.load();
+    return cur < 0 ? "" : s_providers[cur]->name;
+}
+
+esp_err_t fetch_candles(const char *interval, CandleBar *out, size_t cap, size_t *n_out)
+{
+    const int cur = s_active.load();
+    if (cur < 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const FeedProvider &p = *s_providers[cur];
+    if (!p.fetch_candles) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    return p.fetch_candles(p.ctx, s_symbol, interval, out, cap, n_out);
 }
 
 } // namespace market_data
@@ -1,4 +1,4 @@
-#include "market_data/types.hpp"
+#include "market_data/market_data.hpp"
 #include "diagnostics/diagnostics.hpp"
 #include "esp_log.h"
 #include <cstring>
@@ -8,7 +8,7 @@ namespace market_data {
 static MarketSnapshot s_snap;
 static uint32_t s_gen = 0;
 
-esp_err_t mock_init()
+static esp_err_t mock_init()
 {
     s_snap.connection = ConnectionState::Connected;
     s_snap.valid = true;
@@ -23,7 +23,7 @@ esp_err_t mock_init()
     return ESP_OK;
 }
 
-void mock_tick()
+static void mock_tick()
 {
     ++s_gen;
     s_snap.last_tick.ts_ms = static_cast<int64_t>(s_gen) * 1000;
@@ -31,9 +31,24 @@ void mock_tick()
     s_snap.last_tick.price_eur = 42000.0 + (s_gen % 7) * 0.25;
 }
 
-MarketSnapshot mock_snapshot()
+static MarketSnapshot mock_snapshot()
 {
     return s_snap;
 }
 
+/** MD-01: mock als provider (alleen geregistreerd als geen netwerkprovider aan staat). */
+const FeedProvider &mock_provider()
+{
+    static const FeedProvider p{
+        "mock",
+        nullptr,
+        [](void *, const char *) { return mock_init(); },
+        [](void *) {},
+        [](void *) { mock_tick(); },
+        [](void *) { return mock_snapshot(); },
+        nullptr,
+    };
+    return p;
+}
+
 } // namespace market_data
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "esp_err.h"
+#include "market_types/types.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * MD-01: provider-interface voor `market_data` — elke venue (exchange-component) levert één `FeedProvider`.
+ * Staat in `market_types` zodat exchange-componenten hem kunnen vullen zonder van `market_data` af te hangen.
+ */
+namespace market_types {
+
+/** Eén OHLCV-candle (open-tijd in Unix ms). */
+struct CandleBar {
+    int64_t open_ms{0};
+    double open{0.0};
+    double high{0.0};
+    double low{0.0};
+    double close{0.0};
+    double volume{0.0};
+};
+
+/**
+ * Functietabel per venue. `ctx` gaat ongewijzigd mee naar elke call (meerdere instanties per component).
+ * - `start`: state resetten; REST-bootstrap en live stream volgen lui in `tick` (zelfde patroon als Bitvavo).
+ * - `stop`: live stream sluiten en TLS vrijgeven (cold standby bij failover).
+ * - `tick`: vanuit de market_data-lus; bootstrap REST + stream-onderhoud + gap-metrics.
+ * - `fetch_candles`: optioneel (`nullptr` = niet ondersteund); oudste bar eerst in `out`.
+ */
+struct FeedProvider {
+    const char *name;
+    void *ctx;
+    esp_err_t (*start)(void *ctx, const char *market_symbol);
+    void (*stop)(void *ctx);
+    void (*tick)(void *ctx);
+    MarketSnapshot (*snapshot)(void *ctx);
+    esp_err_t (*fetch_candles)(void *ctx,
+                               const char *market_symbol,
+                               const char *interval,
+                               CandleBar *out,
+                               size_t cap,
+                               size_t *n_out);
+};
+
+} // namespace market_types
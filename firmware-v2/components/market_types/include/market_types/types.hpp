@@ -35,7 +35,10 @@ enum class TickSource : uint8_t {
 
 struct PriceTick {
     double price_eur{0.0};
+    /** Lokale monotone ontvangsttijd (ms, esp_timer_get_time/1000). */
     int64_t ts_ms{0};
+    /** Exchange-tijdstempel (Unix ms) als de bron die meelevert; 0 = onbekend (REST, ticker zonder ts). */
+    int64_t ts_exchange_ms{0};
 };
 
 struct MarketSnapshot {
@@ -63,6 +66,11 @@ struct MarketSnapshot {
     uint32_t ws_gap_sec_since_last_raw{0};
     /** RWS-01: seconden sinds laatste geslaagde canonical tick (parse→prijs). */
     uint32_t ws_gap_sec_since_last_canonical{0};
+    /**
+     * MD-01: WS-socket open (CONNECTED gezien, nog geen DISCONNECTED). Los van `connection`, dat ook op
+     * REST-succes Connected wordt; failover kijkt hiernaar i.p.v. naar tick-stilte.
+     */
+    bool ws_link_up{false};
     /**
      * RWS-01: vast label huidige officiële seconde-prijsketen (geen runtime-switch in RWS-01).
      * Waarde `"bitvavo_ticker_ws_v1"`.
@@ -83,6 +91,15 @@ struct MarketSnapshot {
     uint32_t ws_gap_sec_since_last_trade{0};
     /** RWS-02: lokale monotoon tijdstip laatste trade (ms, esp_timer_get_time/1000); 0 = nog geen trade. */
     int64_t ws_last_trade_local_ms{0};
+    /**
+     * Exchange-tijdstempel (Unix ms) van diezelfde laatste trade; 0 = onbekend.
+     * Paar (`ws_last_trade_exchange_ms`, `ws_last_trade_local_ms`) voedt de klok-offsetschatting in `domain_metrics`.
+     */
+    int64_t ws_last_trade_exchange_ms{0};
+    /** MD-01: naam van de actieve provider in de `market_data`-registry (bv. `"bitvavo"`). */
+    char feed_provider[16]{};
+    /** MD-01: aantal automatische provider-wissels sinds boot (stall → volgende venue). */
+    uint32_t feed_failover_count{0};
 };
 
 /**
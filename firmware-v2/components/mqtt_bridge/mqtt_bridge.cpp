@@ -5,6 +5,7 @@
  */
 #include "mqtt_bridge/mqtt_bridge.hpp"
 #include "config_store/config_store.hpp"
+#include "diagnostics/trace.hpp"
 #include "esp_crt_bundle.h"
 #include "esp_log.h"
 #include "mqtt_client.h"
@@ -28,6 +29,13 @@ static esp_mqtt_client_handle_t s_client{nullptr};
 static bool s_connected{false};
 static bool s_pending_ready{false};
 
+/** Alle publishes via deze helper: één tracepoint voor de esp-mqtt enqueue/verzending. */
+static int publish_traced(const char *topic, const char *payload, int len, int qos, int retain)
+{
+    DIAG_TRACE_SPAN(MqttPublish);
+    return esp_mqtt_client_publish(s_client, topic, payload, len, qos, retain);
+}
+
 static esp_err_t do_publish_ready()
 {
     if (!s_client || !s_connected) {
@@ -36,7 +44,7 @@ static esp_err_t do_publish_ready()
     const char *topic = CONFIG_MQTT_TOPIC_BOOT;
     const char *payload = "online";
     const int len = static_cast<int>(strlen(payload));
-    const int mid = esp_mqtt_client_publish(s_client, topic, payload, len, 1, 0);
+    const int mid = publish_traced(topic, payload, len, 1, 0);
     if (mid < 0) {
         ESP_LOGW(TAG, "publish failed (mid=%d)", mid);
         return ESP_FAIL;
@@ -203,12 +211,7 @@ void publish_domain_alert_1m(const char *symbol,
              sym_safe,
              dir);
 
-    const int mid = esp_mqtt_client_publish(s_client,
-                                            CONFIG_MQTT_TOPIC_DOMAIN_ALERT_1M,
-                                            payload,
-                                            plen,
-                                            1,
-                                            0);
+    const int mid = publish_traced(CONFIG_MQTT_TOPIC_DOMAIN_ALERT_1M, payload, plen, 1, 0);
     if (mid < 0) {
         ESP_LOGW(TAG, "M-012b: publish domain alert mislukt (mid=%d)", mid);
         return;
@@ -276,12 +279,7 @@ void publish_domain_alert_5m(const char *symbol,
              sym_safe,
              dir);
 
-    const int mid = esp_mqtt_client_publish(s_client,
-                                            CONFIG_MQTT_TOPIC_DOMAIN_ALERT_5M,
-                                            payload,
-                                            plen,
-                                            1,
-                                            0);
+    const int mid = publish_traced(CONFIG_MQTT_TOPIC_DOMAIN_ALERT_5M, payload, plen, 1, 0);
     if (mid < 0) {
         ESP_LOGW(TAG, "M-010c: publish 5m domain alert mislukt (mid=%d)", mid);
         return;
@@ -352,12 +350,7 @@ void publish_domain_alert_confluence_1m5m(const char *symbol,
              sym_safe,
              dir);
 
-    const int mid = esp_mqtt_client_publish(s_client,
-                                            CONFIG_MQTT_TOPIC_DOMAIN_ALERT_CONF_1M5M,
-                                            payload,
-                                            plen,
-                                            1,
-                                            0);
+    const int mid = publish_traced(CONFIG_MQTT_TOPIC_DOMAIN_ALERT_CONF_1M5M, payload, plen, 1, 0);
     if (mid < 0) {
         ESP_LOGW(TAG, "M-010d: publish confluence mislukt (mid=%d)", mid);
         return;
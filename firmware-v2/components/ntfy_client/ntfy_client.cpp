@@ -3,6 +3,7 @@
  */
 #include "ntfy_client/ntfy_client.hpp"
 #include "config_store/config_store.hpp"
+#include "diagnostics/trace.hpp"
 #include "esp_crt_bundle.h"
 #include "esp_http_client.h"
 #include "esp_log.h"
@@ -21,6 +22,7 @@ static const char TAG[] = "ntfy";
 
 static esp_err_t send_locked(const char *title, const char *body)
 {
+    DIAG_TRACE_SPAN(NtfySend);
     const config_store::ServiceRuntimeConfig &svc = config_store::service_runtime();
     if (!svc.ntfy_enabled) {
         ESP_LOGD(TAG, "ntfy uit (runtime M-003a)");
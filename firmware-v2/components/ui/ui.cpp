@@ -6,6 +6,7 @@
 #include "ui/ui.hpp"
 #include "display_port/display_port.hpp"
 #include "diagnostics/diagnostics.hpp"
+#include "diagnostics/trace.hpp"
 #include "esp_check.h"
 #include "esp_log.h"
 #include "market_data/types.hpp"
@@ -181,6 +182,7 @@ esp_err_t init()
 
 void refresh_from_snapshot(const market_data::MarketSnapshot &snap)
 {
+    DIAG_TRACE_SPAN(UiRefresh);
     if (!s_lbl_symbol || !s_price_col || !s_lbl_price || !s_lbl_price_unit || !s_lbl_ws_in ||
         !s_lbl_source) {
         return;
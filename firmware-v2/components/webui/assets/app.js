@@ -0,0 +1,10 @@
+// M-013g: alert-runtime formulier
+(function(){var f=document.getElementById('alert-runtime-form');var m=document.getElementById('alert-runtime-msg');if(!f||!m)return;f.addEventListener('submit',function(e){e.preventDefault();m.textContent='Bezig…';m.style.color='#333';var body=JSON.stringify({threshold_1m_bps:parseInt(document.getElementById('ar_1m').value,10),threshold_5m_bps:parseInt(document.getElementById('ar_5m').value,10),regime_calm_scale_permille:parseInt(document.getElementById('ar_calm').value,10),regime_hot_scale_permille:parseInt(document.getElementById('ar_hot').value,10)});fetch('/api/alert-runtime.json',{method:'POST',headers:{'Content-Type':'application/json'},body:body}).then(function(r){return r.text().then(function(t){return {ok:r.ok,status:r.status,text:t};});}).then(function(x){try{var j=JSON.parse(x.text);if(x.ok){m.style.color='#063';m.textContent='Opgeslagen. '+(j.note||'');}else{m.style.color='#800';m.textContent='Fout '+x.status+': '+(j.error||x.text);}}catch(err){m.style.color=x.ok?'#063':'#800';m.textContent=x.ok?x.text:('Fout '+x.status+': '+x.text);}}).catch(function(err){m.style.color='#800';m.textContent='Netwerkfout: '+err;});});})();
+// M-013j: alert-policy formulier
+(function(){var f=document.getElementById('alert-policy-form');var m=document.getElementById('alert-policy-msg');if(!f||!m)return;f.addEventListener('submit',function(e){e.preventDefault();m.textContent='Bezig…';m.style.color='#333';var body=JSON.stringify({cooldown_1m_s:parseInt(document.getElementById('ap_cd1').value,10),cooldown_5m_s:parseInt(document.getElementById('ap_cd5').value,10),cooldown_conf_1m5m_s:parseInt(document.getElementById('ap_cf').value,10),suppress_loose_after_conf_s:parseInt(document.getElementById('ap_sup').value,10)});fetch('/api/alert-policy-timing.json',{method:'POST',headers:{'Content-Type':'application/json'},body:body}).then(function(r){return r.text().then(function(t){return {ok:r.ok,status:r.status,text:t};});}).then(function(x){try{var j=JSON.parse(x.text);if(x.ok){m.style.color='#063';m.textContent='Opgeslagen. '+(j.note||'');}else{m.style.color='#800';m.textContent='Fout '+x.status+': '+(j.error||x.text);}}catch(err){m.style.color=x.ok?'#063':'#800';m.textContent=x.ok?x.text:('Fout '+x.status+': '+x.text);}}).catch(function(err){m.style.color='#800';m.textContent='Netwerkfout: '+err;});});})();
+// M-013l: confluence-policy formulier
+(function(){var f=document.getElementById('alert-confluence-form');var m=document.getElementById('alert-conf-msg');if(!f||!m)return;f.addEventListener('submit',function(e){e.preventDefault();m.textContent='Bezig…';m.style.color='#333';var body=JSON.stringify({confluence_enabled:document.getElementById('acf_en').checked,confluence_require_same_direction:document.getElementById('acf_sd').checked,confluence_require_both_thresholds:document.getElementById('acf_bt').checked,confluence_emit_loose_alerts_when_conf_fails:document.getElementById('acf_lo').checked});fetch('/api/alert-confluence-policy.json',{method:'POST',headers:{'Content-Type':'application/json'},body:body}).then(function(r){return r.text().then(function(t){return {ok:r.ok,status:r.status,text:t};});}).then(function(x){try{var j=JSON.parse(x.text);if(x.ok){m.style.color='#063';m.textContent='Opgeslagen. '+(j.note||'');}else{m.style.color='#800';m.textContent='Fout '+x.status+': '+(j.error||x.text);}}catch(err){m.style.color=x.ok?'#063':'#800';m.textContent=x.ok?x.text:('Fout '+x.status+': '+x.text);}}).catch(function(err){m.style.color='#800';m.textContent='Netwerkfout: '+err;});});})();
+// M-013c: services formulier
+(function(){var f=document.getElementById('svc-form');var m=document.getElementById('svc-msg');if(!f||!m)return;f.addEventListener('submit',function(e){e.preventDefault();m.textContent='Bezig…';m.style.color='#333';var body=JSON.stringify({mqtt_enabled:document.getElementById('mqtt_enabled').checked,mqtt_broker_uri:document.getElementById('mqtt_broker_uri').value,ntfy_enabled:document.getElementById('ntfy_enabled').checked,ntfy_topic:document.getElementById('ntfy_topic').value});fetch('/api/services.json',{method:'POST',headers:{'Content-Type':'application/json'},body:body}).then(function(r){return r.text().then(function(t){return {ok:r.ok,status:r.status,text:t};});}).then(function(x){try{var j=JSON.parse(x.text);if(x.ok){m.style.color='#063';m.textContent='Opgeslagen. '+(j.note||'');}else{m.style.color='#800';m.textContent='Fout '+x.status+': '+(j.error||x.text);}}catch(err){m.style.color=x.ok?'#063':'#800';m.textContent=x.ok?x.text:('Fout '+x.status+': '+x.text);}}).catch(function(err){m.style.color='#800';m.textContent='Netwerkfout: '+err;});});})();
+// M-014a: OTA-upload
+(function(){var b=document.getElementById('ota-btn');if(!b)return;b.addEventListener('click',function(){var f=document.getElementById('ota-file');var o=document.getElementById('ota-msg');if(!f||!f.files.length){o.textContent='Kies een .bin';o.style.color='#800';return;}o.textContent='Upload…';o.style.color='#333';fetch('/api/ota',{method:'POST',headers:{'Content-Type':'application/octet-stream'},body:f.files[0]}).then(function(r){return r.text().then(function(t){return {ok:r.ok,s:r.status,t:t};});}).then(function(x){o.style.color=x.ok?'#063':'#800';o.textContent=x.t;}).catch(function(e){o.style.color='#800';o.textContent=''+e;});});})();
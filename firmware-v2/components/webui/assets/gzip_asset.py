@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+"""Gzip één WebUI-asset reproduceerbaar (mtime=0, level 9) — aangeroepen vanuit CMakeLists.txt."""
+
+import gzip
+import sys
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write("gebruik: gzip_asset.py <in> <out.gz>\n")
+        return 2
+    with open(sys.argv[1], "rb") as f:
+        raw = f.read()
+    with open(sys.argv[2], "wb") as f:
+        f.write(gzip.compress(raw, compresslevel=9, mtime=0))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
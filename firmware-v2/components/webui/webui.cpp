@@ -19,11 +19,16 @@
  * M-013h: read-only alert-beslissing per pad (1m/5m/confluence) in status.json + compact op /.
  * C1/C2: read-only `alert_engine_runtime_stats` (emits, suppress, edge-transities) + regime `last_regime_change_epoch_ms`.
  * M-002h: read-only outbound-queue observability in status.json (geen nieuwe settings).
+ * M-013m: CSS/JS van / als statische assets (/assets/app.css, /assets/app.js): gzip + ETag + Cache-Control.
+ * M-013n: /api/status.json gestreamd via json_stream (chunked, zonder cJSON-boom).
+ * M-013o: WebSocket /api/live — compact frame alleen bij wijziging, fan-out naar max. 4 clients.
  */
 #include "webui/webui.hpp"
 #include "alert_engine/alert_engine.hpp"
 #include "alert_observability/alert_observability.hpp"
 #include "config_store/config_store.hpp"
+#include "diagnostics/trace.hpp"
+#include "domain_metrics/domain_metrics.hpp"
 #include "cJSON.h"
 #include "esp_app_desc.h"
 #include "esp_check.h"
@@ -31,6 +36,7 @@
 #include "esp_http_server.h"
 #include "esp_log.h"
 #include "esp_netif.h"
+#include "json_stream/json_stream.hpp"
 #include "market_data/market_data.hpp"
 #include "market_types/types.hpp"
 #include "net_runtime/net_runtime.hpp"
@@ -38,8 +44,12 @@
 #include "sdkconfig.h"
 
 #if CONFIG_WEBUI_ENABLE
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
 #include "lwip/def.h"
 #include "ota_service/ota_service.hpp"
+#include <atomic>
+#include <cinttypes>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -54,6 +64,9 @@ static const char TAG[] = "web_ui";
 
 static httpd_handle_t s_httpd{nullptr};
 
+/** Chunkbuffer voor /api/status.json (stack van de httpd-taak, 8 KiB). */
+static constexpr size_t kStatusJsonChunkBytes = 512;
+
 static const char *conn_str(market_types::ConnectionState c)
 {
     switch (c) {
@@ -95,41 +108,32 @@ static void fmt_rem_ms(char *buf, size_t len, int64_t ms)
     }
 }
 
-static void add_alert_decision_path_json(cJSON *parent,
-                                         const char *key,
-                                         const alert_engine::AlertPathDecisionSnapshot &p)
+static void write_alert_decision_path_json(json_stream::Writer &w,
+                                           const char *key,
+                                           const alert_engine::AlertPathDecisionSnapshot &p)
 {
-    cJSON *o = cJSON_CreateObject();
-    if (!o || !parent || !key) {
-        return;
-    }
-    cJSON_AddStringToObject(o, "status", p.status[0] ? p.status : "?");
+    w.begin_object(key);
+    w.str("status", p.status[0] ? p.status : "?");
     if (p.reason[0] != '\0') {
-        cJSON_AddStringToObject(o, "reason", p.reason);
+        w.str("reason", p.reason);
     }
-    cJSON_AddNumberToObject(o, "remaining_cooldown_ms", static_cast<double>(p.remaining_cooldown_ms));
-    cJSON_AddNumberToObject(o, "remaining_suppress_ms", static_cast<double>(p.remaining_suppress_ms));
-    cJSON_AddItemToObject(parent, key, o);
+    w.int64("remaining_cooldown_ms", p.remaining_cooldown_ms);
+    w.int64("remaining_suppress_ms", p.remaining_suppress_ms);
+    w.end_object();
 }
 
-static void add_path_edge_json(cJSON *parent,
-                               const char *key,
-                               const alert_engine::AlertPathEdgeStats &e)
+static void write_path_edge_json(json_stream::Writer &w,
+                                 const char *key,
+                                 const alert_engine::AlertPathEdgeStats &e)
 {
-    cJSON *o = cJSON_CreateObject();
-    if (!o || !parent || !key) {
-        return;
-    }
-    cJSON_AddNumberToObject(o, "enter_cooldown", static_cast<double>(e.enter_cooldown));
-    cJSON_AddNumberToObject(o, "enter_suppressed", static_cast<double>(e.enter_suppressed));
-    cJSON_AddNumberToObject(o, "enter_not_ready", static_cast<double>(e.enter_not_ready));
-    cJSON_AddNumberToObject(o, "last_epoch_ms_enter_cooldown",
-                             static_cast<double>(e.last_epoch_ms_enter_cooldown));
-    cJSON_AddNumberToObject(o, "last_epoch_ms_enter_suppressed",
-                             static_cast<double>(e.last_epoch_ms_enter_suppressed));
-    cJSON_AddNumberToObject(o, "last_epoch_ms_enter_not_ready",
-                             static_cast<double>(e.last_epoch_ms_enter_not_ready));
-    cJSON_AddItemToObject(parent, key, o);
+    w.begin_object(key);
+    w.number("enter_cooldown", static_cast<double>(e.enter_cooldown));
+    w.number("enter_suppressed", static_cast<double>(e.enter_suppressed));
+    w.number("enter_not_ready", static_cast<double>(e.enter_not_ready));
+    w.int64("last_epoch_ms_enter_cooldown", e.last_epoch_ms_enter_cooldown);
+    w.int64("last_epoch_ms_enter_suppressed", e.last_epoch_ms_enter_suppressed);
+    w.int64("last_epoch_ms_enter_not_ready", e.last_epoch_ms_enter_not_ready);
+    w.end_object();
 }
 
 static void sta_ip_str(char *out, size_t out_len)
@@ -152,6 +156,15 @@ static void sta_ip_str(char *out, size_t out_len)
              static_cast<unsigned>(h & 0xffu));
 }
 
+static esp_err_t status_json_sink(const char *data, size_t len, void *ctx)
+{
+    return httpd_resp_send_chunk(static_cast<httpd_req_t *>(ctx), data, static_cast<ssize_t>(len));
+}
+
+/**
+ * Streamt direct uit de snapshots naar chunked HTTP (json_stream): geen cJSON-boom en geen
+ * print-buffer per poll. Sleutels en volgorde zijn gelijk aan de eerdere cJSON-variant.
+ */
 static esp_err_t handle_status_json(httpd_req_t *req)
 {
     const market_data::MarketSnapshot snap = market_data::snapshot();
@@ -162,214 +175,407 @@ static esp_err_t handle_status_json(httpd_req_t *req)
     ota_service::OtaStatusSnapshot ota{};
     ota_service::get_status_snapshot(&ota);
 
-    cJSON *root = cJSON_CreateObject();
-    if (!root) {
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "no mem");
-        return ESP_ERR_NO_MEM;
-    }
-    cJSON_AddStringToObject(root, "app", "CryptoAlert V2");
-    cJSON_AddStringToObject(root, "version", (app && app->version[0]) ? app->version : "?");
-    cJSON_AddBoolToObject(root, "has_ip", net_runtime::has_ip() ? 1 : 0);
-    cJSON_AddStringToObject(root, "ip", ipbuf);
-    cJSON_AddStringToObject(root, "symbol", snap.market_label[0] ? snap.market_label : "—");
-    cJSON_AddNumberToObject(root, "price_eur", snap.last_tick.price_eur);
-    cJSON_AddBoolToObject(root, "valid", snap.valid ? 1 : 0);
-    cJSON_AddStringToObject(root, "connection", conn_str(snap.connection));
-    cJSON_AddStringToObject(root, "tick_source", tick_str(snap.last_tick_source));
-    cJSON_AddNumberToObject(root, "last_tick_ms", static_cast<double>(snap.last_tick.ts_ms));
-    cJSON_AddNumberToObject(root,
-                           "ws_inbound_ticks_last_sec",
-                           static_cast<double>(snap.ws_inbound_ticks_last_sec));
-    {
-        cJSON *wsf = cJSON_CreateObject();
-        if (wsf) {
-            cJSON_AddStringToObject(wsf, "official_price_stream",
-                                     snap.ws_official_price_stream[0] ? snap.ws_official_price_stream
-                                                                      : "bitvavo_ticker_ws_v1");
-            cJSON_AddNumberToObject(wsf, "raw_msgs_last_sec", static_cast<double>(snap.ws_raw_msgs_last_sec));
-            cJSON_AddNumberToObject(wsf, "canonical_ticks_last_sec",
-                                     static_cast<double>(snap.ws_inbound_ticks_last_sec));
-            cJSON_AddNumberToObject(wsf, "gap_sec_since_last_raw",
-                                     static_cast<double>(snap.ws_gap_sec_since_last_raw));
-            cJSON_AddNumberToObject(wsf, "gap_sec_since_last_canonical",
-                                     static_cast<double>(snap.ws_gap_sec_since_last_canonical));
-            cJSON_AddItemToObject(root, "ws_feed_observability", wsf);
-        }
-    }
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    httpd_resp_set_type(req, "application/json; charset=utf-8");
+
+    char chunk[kStatusJsonChunkBytes];
+    json_stream::Writer w(chunk, sizeof(chunk), status_json_sink, req);
+    w.begin_object();
+    w.str("app", "CryptoAlert V2");
+    w.str("version", (app && app->version[0]) ? app->version : "?");
+    w.boolean("has_ip", net_runtime::has_ip());
+    w.str("ip", ipbuf);
+    w.str("symbol", snap.market_label[0] ? snap.market_label : "—");
+    w.number("price_eur", snap.last_tick.price_eur);
+    w.boolean("valid", snap.valid);
+    w.str("connection", conn_str(snap.connection));
+    w.str("tick_source", tick_str(snap.last_tick_source));
+    w.str("feed_provider", snap.feed_provider[0] ? snap.feed_provider : "—");
+    w.number("feed_failover_count", static_cast<double>(snap.feed_failover_count));
+    w.int64("last_tick_ms", snap.last_tick.ts_ms);
+    w.number("ws_inbound_ticks_last_sec", static_cast<double>(snap.ws_inbound_ticks_last_sec));
+
+    w.begin_object("ws_feed_observability");
+    w.str("official_price_stream",
+          snap.ws_official_price_stream[0] ? snap.ws_official_price_stream : "bitvavo_ticker_ws_v1");
+    w.number("raw_msgs_last_sec", static_cast<double>(snap.ws_raw_msgs_last_sec));
+    w.number("canonical_ticks_last_sec", static_cast<double>(snap.ws_inbound_ticks_last_sec));
+    w.number("gap_sec_since_last_raw", static_cast<double>(snap.ws_gap_sec_since_last_raw));
+    w.number("gap_sec_since_last_canonical", static_cast<double>(snap.ws_gap_sec_since_last_canonical));
+    w.boolean("link_up", snap.ws_link_up);
+    w.end_object();
+
+    w.begin_object("ws_trades_observability");
+    w.number("trades_last_sec", static_cast<double>(snap.ws_trade_events_last_sec));
+    w.number("trades_total_since_boot", static_cast<double>(snap.ws_trades_total_since_boot));
+    w.number("ring_capacity", static_cast<double>(snap.ws_trade_ring_capacity));
+    w.number("ring_occupancy", static_cast<double>(snap.ws_trade_ring_occupancy));
+    w.number("ring_drop_total", static_cast<double>(snap.ws_trade_ring_drop_total));
+    w.number("gap_sec_since_last_trade", static_cast<double>(snap.ws_gap_sec_since_last_trade));
+    w.int64("last_trade_local_ms", snap.ws_last_trade_local_ms);
+    w.int64("last_trade_exchange_ms", snap.ws_last_trade_exchange_ms);
+    w.end_object();
+
     {
-        cJSON *wst = cJSON_CreateObject();
-        if (wst) {
-            cJSON_AddNumberToObject(wst, "trades_last_sec", static_cast<double>(snap.ws_trade_events_last_sec));
-            cJSON_AddNumberToObject(wst, "trades_total_since_boot",
-                                     static_cast<double>(snap.ws_trades_total_since_boot));
-            cJSON_AddNumberToObject(wst, "ring_capacity", static_cast<double>(snap.ws_trade_ring_capacity));
-            cJSON_AddNumberToObject(wst, "ring_occupancy", static_cast<double>(snap.ws_trade_ring_occupancy));
-            cJSON_AddNumberToObject(wst, "ring_drop_total", static_cast<double>(snap.ws_trade_ring_drop_total));
-            cJSON_AddNumberToObject(wst, "gap_sec_since_last_trade",
-                                     static_cast<double>(snap.ws_gap_sec_since_last_trade));
-            cJSON_AddNumberToObject(wst, "last_trade_local_ms", static_cast<double>(snap.ws_last_trade_local_ms));
-            cJSON_AddItemToObject(root, "ws_trades_observability", wst);
-        }
-    }
-    cJSON_AddNumberToObject(root,
-                           "outbound_queue_waiting",
-                           static_cast<double>(service_outbound::queue_waiting()));
-    cJSON_AddNumberToObject(root,
-                           "outbound_queue_capacity",
-                           static_cast<double>(service_outbound::queue_capacity()));
-    cJSON_AddNumberToObject(root,
-                           "outbound_drop_total",
-                           static_cast<double>(service_outbound::drop_total()));
-
-    cJSON *ota_j = cJSON_CreateObject();
-    if (ota_j) {
-        cJSON_AddStringToObject(ota_j,
-                                "running_partition",
-                                ota.running_label[0] ? ota.running_label : "?");
-        cJSON_AddStringToObject(ota_j,
-                                "next_update_partition",
-                                ota.next_update_label[0] ? ota.next_update_label : "?");
-        cJSON_AddNumberToObject(ota_j, "running_address", static_cast<double>(ota.running_address));
-        cJSON_AddNumberToObject(ota_j, "running_size_bytes", static_cast<double>(ota.running_size_bytes));
-        cJSON_AddStringToObject(ota_j, "img_state", ota.img_state[0] ? ota.img_state : "?");
-        cJSON_AddStringToObject(ota_j, "boot_confirm", ota.boot_confirm[0] ? ota.boot_confirm : "?");
-        cJSON_AddStringToObject(ota_j, "reset_reason", ota.reset_reason[0] ? ota.reset_reason : "?");
-        cJSON_AddItemToObject(root, "ota", ota_j);
-    }
-
-    alert_observability::add_alerts_to_cjson(root);
+        const domain_metrics::CanonicalClockStats cc = domain_metrics::canonical_clock_stats();
+        w.begin_object("canonical_clock");
+        w.boolean("offset_valid", cc.offset_valid);
+        w.int64("offset_ms", cc.offset_ms);
+        w.number("offset_samples", static_cast<double>(cc.offset_samples));
+        w.number("offset_resets", static_cast<double>(cc.offset_resets));
+        w.number("watermark_ms", static_cast<double>(cc.watermark_ms));
+        w.number("ticks_exchange_time", static_cast<double>(cc.ticks_exchange_time));
+        w.number("ticks_local_time", static_cast<double>(cc.ticks_local_time));
+        w.number("reordered_ticks", static_cast<double>(cc.reordered_ticks));
+        w.number("late_ticks_dropped", static_cast<double>(cc.late_ticks_dropped));
+        w.number("carry_seconds", static_cast<double>(cc.carry_seconds));
+        w.end_object();
+    }
+
+    w.number("outbound_queue_waiting", static_cast<double>(service_outbound::queue_waiting()));
+    w.number("outbound_queue_capacity", static_cast<double>(service_outbound::queue_capacity()));
+    w.number("outbound_drop_total", static_cast<double>(service_outbound::drop_total()));
+
+    w.begin_object("ota");
+    w.str("running_partition", ota.running_label[0] ? ota.running_label : "?");
+    w.str("next_update_partition", ota.next_update_label[0] ? ota.next_update_label : "?");
+    w.number("running_address", static_cast<double>(ota.running_address));
+    w.number("running_size_bytes", static_cast<double>(ota.running_size_bytes));
+    w.str("img_state", ota.img_state[0] ? ota.img_state : "?");
+    w.str("boot_confirm", ota.boot_confirm[0] ? ota.boot_confirm : "?");
+    w.str("reset_reason", ota.reset_reason[0] ? ota.reset_reason : "?");
+    w.end_object();
+
+    alert_observability::write_alerts_json(w);
 
-    alert_engine::RegimeObservabilitySnapshot rob{};
-    alert_engine::get_regime_observability_snapshot(&rob);
-    cJSON *reg_j = cJSON_CreateObject();
-    if (reg_j) {
-        cJSON_AddStringToObject(reg_j, "regime", rob.regime[0] ? rob.regime : "normal");
-        cJSON_AddBoolToObject(reg_j, "vol_metric_ready", rob.vol_metric_ready ? 1 : 0);
-        cJSON_AddNumberToObject(reg_j, "vol_mean_abs_step_bps", rob.vol_mean_abs_step_bps);
-        cJSON_AddNumberToObject(reg_j, "vol_pairs_used", static_cast<double>(rob.vol_pairs_used));
-        cJSON_AddBoolToObject(reg_j, "vol_unavailable_fallback", rob.vol_unavailable_fallback ? 1 : 0);
-        cJSON_AddNumberToObject(reg_j, "threshold_scale_permille", static_cast<double>(rob.threshold_scale_permille));
-        cJSON_AddNumberToObject(reg_j, "threshold_scale_permille_raw", static_cast<double>(rob.threshold_scale_permille_raw));
-        cJSON_AddBoolToObject(reg_j, "threshold_scale_clamped", rob.threshold_scale_clamped ? 1 : 0);
-        cJSON_AddNumberToObject(reg_j, "regime_calm_max_step_bps", static_cast<double>(rob.regime_calm_max_step_bps));
-        cJSON_AddNumberToObject(reg_j, "regime_hot_min_step_bps", static_cast<double>(rob.regime_hot_min_step_bps));
-        cJSON *base_thr = cJSON_CreateObject();
-        if (base_thr) {
-            cJSON_AddNumberToObject(base_thr, "move_pct_1m", rob.base_threshold_move_pct_1m);
-            cJSON_AddNumberToObject(base_thr, "move_pct_5m", rob.base_threshold_move_pct_5m);
-            cJSON_AddItemToObject(reg_j, "base_threshold_move_pct", base_thr);
-        }
-        cJSON *eff_thr = cJSON_CreateObject();
-        if (eff_thr) {
-            cJSON_AddNumberToObject(eff_thr, "move_pct_1m", rob.effective_threshold_move_pct_1m);
-            cJSON_AddNumberToObject(eff_thr, "move_pct_5m", rob.effective_threshold_move_pct_5m);
-            cJSON_AddItemToObject(reg_j, "effective_threshold_move_pct", eff_thr);
-        }
-        cJSON *conf_g = cJSON_CreateObject();
-        if (conf_g) {
-            cJSON_AddNumberToObject(conf_g, "requires_abs_move_pct_1m", rob.effective_threshold_move_pct_1m);
-            cJSON_AddNumberToObject(conf_g, "requires_abs_move_pct_5m", rob.effective_threshold_move_pct_5m);
-            cJSON_AddItemToObject(reg_j, "confluence_effective_gate_pct", conf_g);
+    {
+        alert_engine::RegimeObservabilitySnapshot rob{};
+        alert_engine::get_regime_observability_snapshot(&rob);
+        w.begin_object("regime_observability");
+        w.str("regime", rob.regime[0] ? rob.regime : "normal");
+        w.boolean("vol_metric_ready", rob.vol_metric_ready);
+        w.number("vol_mean_abs_step_bps", rob.vol_mean_abs_step_bps);
+        w.number("vol_pairs_used", static_cast<double>(rob.vol_pairs_used));
+        {
+            static const char *const k_horizons[VOL_HORIZON_COUNT] = {"1s", "1m", "5m", "1h"};
+            w.begin_object("vol_surface");
+            for (size_t i = 0; i < VOL_HORIZON_COUNT; ++i) {
+                const VolHorizonStats &h = rob.vol_surface[i];
+                w.begin_object(k_horizons[i]);
+                w.number("vol_pct", static_cast<double>(h.volPct));
+                w.number("vol_per_min_pct", static_cast<double>(h.volPerMinPct));
+                w.number("bars", static_cast<double>(h.bars));
+                w.boolean("ready", h.ready);
+                w.end_object();
+            }
+            w.end_object();
         }
-        cJSON_AddNumberToObject(reg_j, "last_regime_change_epoch_ms",
-                                 static_cast<double>(rob.last_regime_change_epoch_ms));
-        cJSON_AddItemToObject(root, "regime_observability", reg_j);
+        w.boolean("vol_unavailable_fallback", rob.vol_unavailable_fallback);
+        w.number("threshold_scale_permille", static_cast<double>(rob.threshold_scale_permille));
+        w.number("threshold_scale_permille_raw", static_cast<double>(rob.threshold_scale_permille_raw));
+        w.boolean("threshold_scale_clamped", rob.threshold_scale_clamped);
+        w.number("regime_calm_max_step_bps", static_cast<double>(rob.regime_calm_max_step_bps));
+        w.number("regime_hot_min_step_bps", static_cast<double>(rob.regime_hot_min_step_bps));
+        w.begin_object("base_threshold_move_pct");
+        w.number("move_pct_1m", rob.base_threshold_move_pct_1m);
+        w.number("move_pct_5m", rob.base_threshold_move_pct_5m);
+        w.end_object();
+        w.begin_object("effective_threshold_move_pct");
+        w.number("move_pct_1m", rob.effective_threshold_move_pct_1m);
+        w.number("move_pct_5m", rob.effective_threshold_move_pct_5m);
+        w.end_object();
+        w.begin_object("confluence_effective_gate_pct");
+        w.number("requires_abs_move_pct_1m", rob.effective_threshold_move_pct_1m);
+        w.number("requires_abs_move_pct_5m", rob.effective_threshold_move_pct_5m);
+        w.end_object();
+        w.int64("last_regime_change_epoch_ms", rob.last_regime_change_epoch_ms);
+        w.end_object();
     }
 
     {
         alert_engine::AlertDecisionObservabilitySnapshot ado{};
         alert_engine::get_alert_decision_observability_snapshot(&ado);
-        cJSON *ado_j = cJSON_CreateObject();
-        if (ado_j) {
-            add_alert_decision_path_json(ado_j, "1m", ado.tf_1m);
-            add_alert_decision_path_json(ado_j, "5m", ado.tf_5m);
-            add_alert_decision_path_json(ado_j, "confluence_1m5m", ado.confluence_1m5m);
-            cJSON_AddItemToObject(root, "alert_decision_observability", ado_j);
-        }
+        w.begin_object("alert_decision_observability");
+        write_alert_decision_path_json(w, "1m", ado.tf_1m);
+        write_alert_decision_path_json(w, "5m", ado.tf_5m);
+        write_alert_decision_path_json(w, "confluence_1m5m", ado.confluence_1m5m);
+        w.end_object();
     }
 
     {
         alert_engine::AlertEngineRuntimeStatsSnapshot ars{};
         alert_engine::get_alert_runtime_stats_snapshot(&ars);
-        cJSON *ars_j = cJSON_CreateObject();
-        if (ars_j) {
-            cJSON_AddNumberToObject(ars_j, "emit_total_1m", static_cast<double>(ars.emit_total_1m));
-            cJSON_AddNumberToObject(ars_j, "emit_total_5m", static_cast<double>(ars.emit_total_5m));
-            cJSON_AddNumberToObject(ars_j, "emit_total_confluence_1m5m",
-                                     static_cast<double>(ars.emit_total_conf));
-            cJSON_AddNumberToObject(ars_j, "last_emit_epoch_ms_1m", static_cast<double>(ars.last_emit_epoch_ms_1m));
-            cJSON_AddNumberToObject(ars_j, "last_emit_epoch_ms_5m", static_cast<double>(ars.last_emit_epoch_ms_5m));
-            cJSON_AddNumberToObject(ars_j, "last_emit_epoch_ms_confluence_1m5m",
-                                     static_cast<double>(ars.last_emit_epoch_ms_conf));
-            cJSON_AddNumberToObject(ars_j, "suppress_after_conf_window_episodes_1m",
-                                     static_cast<double>(ars.suppress_after_conf_window_1m));
-            cJSON_AddNumberToObject(ars_j, "suppress_after_conf_window_episodes_5m",
-                                     static_cast<double>(ars.suppress_after_conf_window_5m));
-            add_path_edge_json(ars_j, "edge_1m", ars.edge_1m);
-            add_path_edge_json(ars_j, "edge_5m", ars.edge_5m);
-            add_path_edge_json(ars_j, "edge_confluence_1m5m", ars.edge_confluence);
-            cJSON_AddItemToObject(root, "alert_engine_runtime_stats", ars_j);
-        }
+        w.begin_object("alert_engine_runtime_stats");
+        w.number("emit_total_1m", static_cast<double>(ars.emit_total_1m));
+        w.number("emit_total_5m", static_cast<double>(ars.emit_total_5m));
+        w.number("emit_total_confluence_1m5m", static_cast<double>(ars.emit_total_conf));
+        w.int64("last_emit_epoch_ms_1m", ars.last_emit_epoch_ms_1m);
+        w.int64("last_emit_epoch_ms_5m", ars.last_emit_epoch_ms_5m);
+        w.int64("last_emit_epoch_ms_confluence_1m5m", ars.last_emit_epoch_ms_conf);
+        w.number("suppress_after_conf_window_episodes_1m", static_cast<double>(ars.suppress_after_conf_window_1m));
+        w.number("suppress_after_conf_window_episodes_5m", static_cast<double>(ars.suppress_after_conf_window_5m));
+        write_path_edge_json(w, "edge_1m", ars.edge_1m);
+        write_path_edge_json(w, "edge_5m", ars.edge_5m);
+        write_path_edge_json(w, "edge_confluence_1m5m", ars.edge_confluence);
+        w.end_object();
     }
 
     {
         const config_store::AlertRuntimeConfig &ar = config_store::alert_runtime();
-        cJSON *arc_j = cJSON_CreateObject();
-        if (arc_j) {
-            cJSON_AddNumberToObject(arc_j, "schema_version", static_cast<double>(config_store::kSchemaVersion));
-            cJSON_AddNumberToObject(arc_j, "threshold_1m_bps", static_cast<double>(ar.threshold_1m_bps));
-            cJSON_AddNumberToObject(arc_j, "threshold_5m_bps", static_cast<double>(ar.threshold_5m_bps));
-            cJSON_AddNumberToObject(arc_j, "regime_calm_scale_permille", static_cast<double>(ar.regime_calm_scale_permille));
-            cJSON_AddNumberToObject(arc_j, "regime_hot_scale_permille", static_cast<double>(ar.regime_hot_scale_permille));
-            cJSON_AddItemToObject(root, "alert_runtime_config", arc_j);
-        }
+        w.begin_object("alert_runtime_config");
+        w.number("schema_version", static_cast<double>(config_store::kSchemaVersion));
+        w.number("threshold_1m_bps", static_cast<double>(ar.threshold_1m_bps));
+        w.number("threshold_5m_bps", static_cast<double>(ar.threshold_5m_bps));
+        w.number("regime_calm_scale_permille", static_cast<double>(ar.regime_calm_scale_permille));
+        w.number("regime_hot_scale_permille", static_cast<double>(ar.regime_hot_scale_permille));
+        w.end_object();
     }
 
     {
         const config_store::AlertPolicyTimingConfig &apt = config_store::alert_policy_timing();
-        cJSON *apt_j = cJSON_CreateObject();
-        if (apt_j) {
-            cJSON_AddNumberToObject(apt_j, "schema_version", static_cast<double>(config_store::kSchemaVersion));
-            cJSON_AddNumberToObject(apt_j, "cooldown_1m_s", static_cast<double>(apt.cooldown_1m_s));
-            cJSON_AddNumberToObject(apt_j, "cooldown_5m_s", static_cast<double>(apt.cooldown_5m_s));
-            cJSON_AddNumberToObject(apt_j, "cooldown_conf_1m5m_s", static_cast<double>(apt.cooldown_conf_1m5m_s));
-            cJSON_AddNumberToObject(apt_j, "suppress_loose_after_conf_s",
-                                     static_cast<double>(apt.suppress_loose_after_conf_s));
-            cJSON_AddItemToObject(root, "alert_policy_timing", apt_j);
-        }
+        w.begin_object("alert_policy_timing");
+        w.number("schema_version", static_cast<double>(config_store::kSchemaVersion));
+        w.number("cooldown_1m_s", static_cast<double>(apt.cooldown_1m_s));
+        w.number("cooldown_5m_s", static_cast<double>(apt.cooldown_5m_s));
+        w.number("cooldown_conf_1m5m_s", static_cast<double>(apt.cooldown_conf_1m5m_s));
+        w.number("suppress_loose_after_conf_s", static_cast<double>(apt.suppress_loose_after_conf_s));
+        w.end_object();
     }
 
     {
         const config_store::AlertConfluencePolicyConfig &acfp = config_store::alert_confluence_policy();
-        cJSON *acf_j = cJSON_CreateObject();
-        if (acf_j) {
-            cJSON_AddNumberToObject(acf_j, "schema_version", static_cast<double>(config_store::kSchemaVersion));
-            cJSON_AddBoolToObject(acf_j, "confluence_enabled", acfp.confluence_enabled ? 1 : 0);
-            cJSON_AddBoolToObject(acf_j,
-                                  "confluence_require_same_direction",
-                                  acfp.confluence_require_same_direction ? 1 : 0);
-            cJSON_AddBoolToObject(acf_j,
-                                  "confluence_require_both_thresholds",
-                                  acfp.confluence_require_both_thresholds ? 1 : 0);
-            cJSON_AddBoolToObject(acf_j,
-                                  "confluence_emit_loose_alerts_when_conf_fails",
-                                  acfp.confluence_emit_loose_alerts_when_conf_fails ? 1 : 0);
-            cJSON_AddItemToObject(root, "alert_confluence_policy", acf_j);
+        w.begin_object("alert_confluence_policy");
+        w.number("schema_version", static_cast<double>(config_store::kSchemaVersion));
+        w.boolean("confluence_enabled", acfp.confluence_enabled);
+        w.boolean("confluence_require_same_direction", acfp.confluence_require_same_direction);
+        w.boolean("confluence_require_both_thresholds", acfp.confluence_require_both_thresholds);
+        w.boolean("confluence_emit_loose_alerts_when_conf_fails",
+                  acfp.confluence_emit_loose_alerts_when_conf_fails);
+        w.end_object();
+    }
+
+    w.end_object();
+    const esp_err_t we = w.finish();
+    if (we != ESP_OK) {
+        // Headers zijn al weg: verbinding afbreken i.p.v. een half JSON-document afsluiten
+        ESP_LOGW(TAG, "status.json stream: %s", esp_err_to_name(we));
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
+#if CONFIG_WEBUI_LIVE_PUSH
+/**
+ * Live push (WebSocket /api/live): één compact frame per wijziging, naar alle clients uit dezelfde
+ * buffer. Een esp_timer zet elke kLivePeriodMs een build in de httpd-werkqueue zolang er clients
+ * zijn; bouwen, hash-vergelijken en versturen gebeuren in de httpd-taak, dus de fd-lijst en
+ * framebuffers hebben geen lock nodig. Ongewijzigd frame (zelfde FNV-1a) → niets verstuurd.
+ */
+static constexpr size_t kLiveMaxClients = 4;
+static constexpr size_t kLiveFrameBytes = 768;
+static constexpr uint32_t kLivePeriodMs = 250;
+
+struct LiveFrame {
+    char data[kLiveFrameBytes];
+    size_t len;
+};
+
+static int s_live_fds[kLiveMaxClients] = {-1, -1, -1, -1};
+static LiveFrame s_live_a{};
+static LiveFrame s_live_b{};
+static LiveFrame *s_live_cur = &s_live_a; ///< Laatst verstuurd (ook voor nieuwe clients)
+static LiveFrame *s_live_next = &s_live_b;
+static uint32_t s_live_hash{0};
+static esp_timer_handle_t s_live_timer{nullptr};
+static std::atomic<uint8_t> s_live_clients{0};
+static std::atomic<bool> s_live_queued{false};
+
+struct LiveStats {
+    uint32_t frames;
+    uint32_t unchanged;
+    uint32_t sends;
+    uint32_t dropped;
+    uint32_t rejected;
+};
+static LiveStats s_live_stats{};
+
+static esp_err_t live_frame_sink(const char *data, size_t len, void *ctx)
+{
+    LiveFrame *f = static_cast<LiveFrame *>(ctx);
+    if (f->len + len > sizeof(f->data)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(f->data + f->len, data, len);
+    f->len += len;
+    return ESP_OK;
+}
+
+/** Compacte subset van status.json: prijs/tick, regime, alert-tellers. */
+static bool live_build_frame(LiveFrame *f)
+{
+    const market_data::MarketSnapshot snap = market_data::snapshot();
+    alert_engine::RegimeObservabilitySnapshot rob{};
+    alert_engine::get_regime_observability_snapshot(&rob);
+    alert_engine::AlertEngineRuntimeStatsSnapshot ars{};
+    alert_engine::get_alert_runtime_stats_snapshot(&ars);
+
+    f->len = 0;
+    char chunk[256];
+    json_stream::Writer w(chunk, sizeof(chunk), live_frame_sink, f);
+    w.begin_object();
+    w.str("symbol", snap.market_label[0] ? snap.market_label : "—");
+    w.number("price_eur", snap.last_tick.price_eur);
+    w.boolean("valid", snap.valid);
+    w.str("connection", conn_str(snap.connection));
+    w.str("tick_source", tick_str(snap.last_tick_source));
+    w.int64("last_tick_ms", snap.last_tick.ts_ms);
+    w.begin_object("regime");
+    w.str("regime", rob.regime[0] ? rob.regime : "normal");
+    w.number("vol_mean_abs_step_bps", rob.vol_mean_abs_step_bps);
+    w.number("threshold_scale_permille", static_cast<double>(rob.threshold_scale_permille));
+    w.number("effective_move_pct_1m", rob.effective_threshold_move_pct_1m);
+    w.number("effective_move_pct_5m", rob.effective_threshold_move_pct_5m);
+    w.end_object();
+    w.begin_object("alerts");
+    w.number("emit_total_1m", static_cast<double>(ars.emit_total_1m));
+    w.number("emit_total_5m", static_cast<double>(ars.emit_total_5m));
+    w.number("emit_total_confluence_1m5m", static_cast<double>(ars.emit_total_conf));
+    w.int64("last_emit_epoch_ms_1m", ars.last_emit_epoch_ms_1m);
+    w.int64("last_emit_epoch_ms_5m", ars.last_emit_epoch_ms_5m);
+    w.int64("last_emit_epoch_ms_confluence_1m5m", ars.last_emit_epoch_ms_conf);
+    w.end_object();
+    w.end_object();
+    return w.finish() == ESP_OK;
+}
+
+static uint32_t live_hash(const LiveFrame &f)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < f.len; ++i) {
+        h ^= static_cast<uint8_t>(f.data[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void live_drop(size_t slot)
+{
+    s_live_fds[slot] = -1;
+    s_live_clients.fetch_sub(1);
+    s_live_stats.dropped++;
+}
+
+/** httpd-taak: build → vergelijk → fan-out. */
+static void live_work(void *)
+{
+    s_live_queued.store(false);
+    for (size_t i = 0; i < kLiveMaxClients; ++i) {
+        if (s_live_fds[i] >= 0 && httpd_ws_get_fd_info(s_httpd, s_live_fds[i]) != HTTPD_WS_CLIENT_WEBSOCKET) {
+            live_drop(i);
         }
     }
+    if (s_live_clients.load() == 0) {
+        return;
+    }
+    if (!live_build_frame(s_live_next)) {
+        return;
+    }
+    const uint32_t h = live_hash(*s_live_next);
+    if (s_live_cur->len > 0 && h == s_live_hash) {
+        s_live_stats.unchanged++;
+        return;
+    }
+    LiveFrame *tmp = s_live_cur;
+    s_live_cur = s_live_next;
+    s_live_next = tmp;
+    s_live_hash = h;
+    s_live_stats.frames++;
+
+    httpd_ws_frame_t frame{};
+    frame.type = HTTPD_WS_TYPE_TEXT;
+    frame.payload = reinterpret_cast<uint8_t *>(s_live_cur->data);
+    frame.len = s_live_cur->len;
+    for (size_t i = 0; i < kLiveMaxClients; ++i) {
+        const int fd = s_live_fds[i];
+        if (fd < 0) {
+            continue;
+        }
+        if (httpd_ws_get_fd_info(s_httpd, fd) != HTTPD_WS_CLIENT_WEBSOCKET ||
+            httpd_ws_send_frame_async(s_httpd, fd, &frame) != ESP_OK) {
+            live_drop(i);
+            continue;
+        }
+        s_live_stats.sends++;
+    }
+}
 
-    char *printed = cJSON_PrintUnformatted(root);
-    cJSON_Delete(root);
-    if (!printed) {
-        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "overflow");
-        return ESP_FAIL;
+static void live_timer_cb(void *)
+{
+    if (!s_httpd || s_live_clients.load() == 0 || s_live_queued.exchange(true)) {
+        return;
     }
-    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
-    httpd_resp_set_type(req, "application/json; charset=utf-8");
-    const esp_err_t se = httpd_resp_send(req, printed, HTTPD_RESP_USE_STRLEN);
-    cJSON_free(printed);
-    return se;
+    if (httpd_queue_work(s_httpd, live_work, nullptr) != ESP_OK) {
+        s_live_queued.store(false);
+    }
+}
+
+static esp_err_t handle_live_ws(httpd_req_t *req)
+{
+    if (req->method == HTTP_GET) {
+        // Handshake afgerond: registreer de socket en stuur direct het laatste frame
+        const int fd = httpd_req_to_sockfd(req);
+        size_t slot = kLiveMaxClients;
+        for (size_t i = 0; i < kLiveMaxClients; ++i) {
+            if (s_live_fds[i] >= 0 && httpd_ws_get_fd_info(s_httpd, s_live_fds[i]) != HTTPD_WS_CLIENT_WEBSOCKET) {
+                live_drop(i);
+            }
+            if (s_live_fds[i] < 0 && slot == kLiveMaxClients) {
+                slot = i;
+            }
+        }
+        if (slot == kLiveMaxClients) {
+            s_live_stats.rejected++;
+            ESP_LOGW(TAG, "live: max %u clients, fd %d geweigerd", static_cast<unsigned>(kLiveMaxClients), fd);
+            return ESP_FAIL;
+        }
+        s_live_fds[slot] = fd;
+        s_live_clients.fetch_add(1);
+        ESP_LOGI(TAG, "live: client fd %d (%u actief)", fd, static_cast<unsigned>(s_live_clients.load()));
+        if (s_live_cur->len > 0) {
+            httpd_ws_frame_t frame{};
+            frame.type = HTTPD_WS_TYPE_TEXT;
+            frame.payload = reinterpret_cast<uint8_t *>(s_live_cur->data);
+            frame.len = s_live_cur->len;
+            return httpd_ws_send_frame(req, &frame);
+        }
+        return ESP_OK;
+    }
+    // Server → client kanaal: inkomende tekst/binaire frames lezen en negeren
+    httpd_ws_frame_t pkt{};
+    esp_err_t err = httpd_ws_recv_frame(req, &pkt, 0);
+    if (err != ESP_OK) {
+        return err;
+    }
+    uint8_t scratch[64];
+    if (pkt.len > sizeof(scratch)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (pkt.len > 0) {
+        pkt.payload = scratch;
+        err = httpd_ws_recv_frame(req, &pkt, pkt.len);
+    }
+    return err;
+}
+
+static esp_err_t live_start()
+{
+    esp_timer_create_args_t ta{};
+    ta.callback = live_timer_cb;
+    ta.name = "webui_live";
+    ESP_RETURN_ON_ERROR(esp_timer_create(&ta, &s_live_timer), TAG, "live timer");
+    return esp_timer_start_periodic(s_live_timer, static_cast<uint64_t>(kLivePeriodMs) * 1000u);
 }
+#endif // CONFIG_WEBUI_LIVE_PUSH
 
 static bool cjson_to_bool(const cJSON *j, bool *out)
 {
@@ -953,6 +1159,109 @@ static void html_attr_escape(const char *src, char *dst, size_t dst_sz)
     dst[j] = '\0';
 }
 
+/**
+ * Statische assets: CSS/JS uit `assets/`, bij build gzip-gecomprimeerd en ingebed (zie CMakeLists.txt).
+ * Sterke ETag = CRC32 van de bron, per representatie (gzip-body krijgt suffix `-gz`); `/` verwijst met `?v=<crc>` zodat browsers lang mogen cachen
+ * en een revalidatie een 304 zonder body oplevert.
+ */
+extern "C" {
+extern const uint8_t webui_app_css_gz_start[] asm("_binary_app_css_gz_start");
+extern const uint8_t webui_app_css_gz_end[] asm("_binary_app_css_gz_end");
+extern const uint8_t webui_app_css_start[] asm("_binary_app_css_start");
+extern const uint8_t webui_app_css_end[] asm("_binary_app_css_end");
+extern const uint8_t webui_app_js_gz_start[] asm("_binary_app_js_gz_start");
+extern const uint8_t webui_app_js_gz_end[] asm("_binary_app_js_gz_end");
+extern const uint8_t webui_app_js_start[] asm("_binary_app_js_start");
+extern const uint8_t webui_app_js_end[] asm("_binary_app_js_end");
+}
+
+struct WebAsset {
+    const char *uri;
+    const char *content_type;
+    const uint8_t *gz_start;
+    const uint8_t *gz_end;
+    const uint8_t *raw_start;
+    const uint8_t *raw_end;
+    uint32_t version; ///< CRC32 van raw; gezet in init_assets()
+    char etag[12];    ///< "\"%08x\"" (identity)
+    char etag_gz[16]; ///< "\"%08x-gz\"" (gzip-body: andere bytes, dus eigen sterke validator)
+};
+
+static WebAsset s_assets[] = {
+    {"/assets/app.css", "text/css", webui_app_css_gz_start, webui_app_css_gz_end, webui_app_css_start,
+     webui_app_css_end, 0, {}, {}},
+    {"/assets/app.js", "application/javascript", webui_app_js_gz_start, webui_app_js_gz_end, webui_app_js_start,
+     webui_app_js_end, 0, {}, {}},
+};
+
+static void init_assets()
+{
+    for (WebAsset &a : s_assets) {
+        const size_t raw_len = static_cast<size_t>(a.raw_end - a.raw_start);
+        a.version = esp_rom_crc32_le(0, a.raw_start, raw_len);
+        std::snprintf(a.etag, sizeof(a.etag), "\"%08x\"", static_cast<unsigned>(a.version));
+        std::snprintf(a.etag_gz, sizeof(a.etag_gz), "\"%08x-gz\"", static_cast<unsigned>(a.version));
+        ESP_LOGD(TAG, "asset %s: %u → %u bytes gzip", a.uri, static_cast<unsigned>(raw_len),
+                 static_cast<unsigned>(a.gz_end - a.gz_start));
+    }
+}
+
+static void metrics_send_chunk(const char *chunk, void *ctx)
+{
+    httpd_resp_sendstr_chunk(static_cast<httpd_req_t *>(ctx), chunk);
+}
+
+/** GET /metrics — tracepoints + heap (Prometheus-tekst), chunked zonder grote buffer. */
+static esp_err_t handle_metrics(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "text/plain; version=0.0.4; charset=utf-8");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    diagnostics::trace::write_metrics(metrics_send_chunk, req);
+
+#if CONFIG_WEBUI_LIVE_PUSH
+    char line[192];
+    snprintf(line, sizeof(line),
+             "crypto_livepush_clients %u\n"
+             "crypto_livepush_frames_total %" PRIu32 "\n"
+             "crypto_livepush_unchanged_total %" PRIu32 "\n"
+             "crypto_livepush_client_writes_total %" PRIu32 "\n"
+             "crypto_livepush_dropped_total %" PRIu32 "\n",
+             static_cast<unsigned>(s_live_clients.load()), s_live_stats.frames, s_live_stats.unchanged,
+             s_live_stats.sends, s_live_stats.dropped);
+    httpd_resp_sendstr_chunk(req, line);
+#endif
+    return httpd_resp_sendstr_chunk(req, nullptr);
+}
+
+static esp_err_t handle_static_asset(httpd_req_t *req)
+{
+    const WebAsset *a = static_cast<const WebAsset *>(req->user_ctx);
+    char ae[64]{};
+    const esp_err_t ae_err = httpd_req_get_hdr_value_str(req, "Accept-Encoding", ae, sizeof(ae));
+    const bool gzip_ok = (ae_err == ESP_OK || ae_err == ESP_ERR_HTTPD_RESULT_TRUNC) && std::strstr(ae, "gzip") != nullptr;
+    const char *etag = gzip_ok ? a->etag_gz : a->etag;
+    httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=604800");
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+
+    /* Alleen de variant die deze client krijgt; strstr voor lijsten (afsluitende quote scheidt x en x-gz). */
+    char inm[64]{};
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK &&
+        std::strstr(inm, etag) != nullptr) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
+    }
+
+    httpd_resp_set_type(req, a->content_type);
+    if (gzip_ok) {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+        return httpd_resp_send(req, reinterpret_cast<const char *>(a->gz_start),
+                               static_cast<ssize_t>(a->gz_end - a->gz_start));
+    }
+    return httpd_resp_send(req, reinterpret_cast<const char *>(a->raw_start),
+                           static_cast<ssize_t>(a->raw_end - a->raw_start));
+}
+
 static esp_err_t handle_root_html(httpd_req_t *req)
 {
     const market_data::MarketSnapshot snap = market_data::snapshot();
@@ -983,17 +1292,16 @@ static esp_err_t handle_root_html(httpd_req_t *req)
         "<!DOCTYPE html><html lang=\"nl\"><head><meta charset=\"utf-8\"/>"
         "<meta name=\"viewport\" content=\"width=device-width,initial-scale=1\"/>"
         "<title>CryptoAlert V2</title>"
-        "<style>body{font-family:system-ui,sans-serif;margin:1rem;line-height:1.4}"
-        "code{background:#eee;padding:2px 6px}fieldset{border:1px solid #ccc;border-radius:6px;padding:1rem;margin-top:1rem}"
-        "#svc-msg,#alert-runtime-msg,#alert-policy-msg,#alert-conf-msg{min-height:1.5em;margin-top:.75em;font-size:.95rem}"
-        "</style></head><body>"
+        "<link rel=\"stylesheet\" href=\"/assets/app.css?v=%08x\"/></head><body>"
         "<h1>CryptoAlert V2</h1>"
         "<p><strong>Versie</strong> %s · <strong>IP</strong> %s · <strong>WiFi IP bekend</strong> %s</p>"
         "<p><strong>Symbool</strong> %s · <strong>Prijs (EUR)</strong> %.4f · <strong>Geldig</strong> %s</p>"
-        "<p><strong>Verbinding feed</strong> %s · <strong>Bron tick</strong> %s · "
+        "<p><strong>Verbinding feed</strong> %s · <strong>Provider</strong> %s (wissels %u) · "
+        "<strong>Bron tick</strong> %s · "
         "<strong>WS raw/canonical (vorige s)</strong> %u/%u · "
         "<strong>GAP raw/canonical (s)</strong> %u/%u · <code>%s</code></p>"
         "<p><strong>WS trades (RWS-02)</strong> %u/s · tot %u · ring %u/%u · drops %u · gap %us</p>",
+        static_cast<unsigned>(s_assets[0].version),
         app ? app->version : "?",
         ipbuf[0] ? ipbuf : "—",
         net_runtime::has_ip() ? "ja" : "nee",
@@ -1001,6 +1309,8 @@ static esp_err_t handle_root_html(httpd_req_t *req)
         snap.last_tick.price_eur,
         snap.valid ? "ja" : "nee",
         conn_str(snap.connection),
+        snap.feed_provider[0] ? snap.feed_provider : "—",
+        static_cast<unsigned>(snap.feed_failover_count),
         tick_str(snap.last_tick_source),
         static_cast<unsigned>(snap.ws_raw_msgs_last_sec),
         static_cast<unsigned>(snap.ws_inbound_ticks_last_sec),
@@ -1201,25 +1511,7 @@ static esp_err_t handle_root_html(httpd_req_t *req)
             "min=\"%u\" max=\"%u\" step=\"1\" value=\"%u\"/></label></p>"
             "<p><button type=\"submit\">Alert-runtime opslaan</button></p>"
             "</fieldset></form>"
-            "<p id=\"alert-runtime-msg\"></p>"
-            "<script>"
-            "(function(){var f=document.getElementById('alert-runtime-form');"
-            "var m=document.getElementById('alert-runtime-msg');if(!f||!m)return;"
-            "f.addEventListener('submit',function(e){e.preventDefault();m.textContent='Bezig…';m.style.color='#333';"
-            "var body=JSON.stringify({"
-            "threshold_1m_bps:parseInt(document.getElementById('ar_1m').value,10),"
-            "threshold_5m_bps:parseInt(document.getElementById('ar_5m').value,10),"
-            "regime_calm_scale_permille:parseInt(document.getElementById('ar_calm').value,10),"
-            "regime_hot_scale_permille:parseInt(document.getElementById('ar_hot').value,10)"
-            "});"
-            "fetch('/api/alert-runtime.json',{method:'POST',headers:{'Content-Type':'application/json'},body:body})"
-            ".then(function(r){return r.text().then(function(t){return {ok:r.ok,status:r.status,text:t};});})"
-            ".then(function(x){try{var j=JSON.parse(x.text);if(x.ok){m.style.color='#063';"
-            "m.textContent='Opgeslagen. '+(j.note||'');}else{m.style.color='#800';"
-            "m.textContent='Fout '+x.status+': '+(j.error||x.text);}}catch(err){"
-            "m.style.color=x.ok?'#063':'#800';m.textContent=x.ok?x.text:('Fout '+x.status+': '+x.text);}})"
-            ".catch(function(err){m.style.color='#800';m.textContent='Netwerkfout: '+err;});});})();"
-            "</script>",
+            "<p id=\"alert-runtime-msg\"></p>",
             static_cast<unsigned>(config_store::kAlertThreshold1mBpsMin),
             static_cast<unsigned>(config_store::kAlertThreshold1mBpsMax),
             static_cast<unsigned>(ar.threshold_1m_bps),
@@ -1261,26 +1553,7 @@ static esp_err_t handle_root_html(httpd_req_t *req)
             "min=\"%u\" max=\"%u\" step=\"1\" value=\"%u\"/></label></p>"
             "<p><button type=\"submit\">Policy-timing opslaan</button></p>"
             "</fieldset></form>"
-            "<p id=\"alert-policy-msg\"></p>"
-            "<script>"
-            "(function(){var f=document.getElementById('alert-policy-form');"
-            "var m=document.getElementById('alert-policy-msg');if(!f||!m)return;"
-            "f.addEventListener('submit',function(e){e.preventDefault();m.textContent='Bezig…';m.style.color='#333';"
-            "var body=JSON.stringify({"
-            "cooldown_1m_s:parseInt(document.getElementById('ap_cd1').value,10),"
-            "cooldown_5m_s:parseInt(document.getElementById('ap_cd5').value,10),"
-            "cooldown_conf_1m5m_s:parseInt(document.getElementById('ap_cf').value,10),"
-            "suppress_loose_after_conf_s:parseInt(document.getElementById('ap_sup').value,10)"
-            "});"
-            "fetch('/api/alert-policy-timing.json',{method:'POST',headers:{'Content-Type':'application/json'},"
-            "body:body})"
-            ".then(function(r){return r.text().then(function(t){return {ok:r.ok,status:r.status,text:t};});})"
-            ".then(function(x){try{var j=JSON.parse(x.text);if(x.ok){m.style.color='#063';"
-            "m.textContent='Opgeslagen. '+(j.note||'');}else{m.style.color='#800';"
-            "m.textContent='Fout '+x.status+': '+(j.error||x.text);}}catch(err){"
-            "m.style.color=x.ok?'#063':'#800';m.textContent=x.ok?x.text:('Fout '+x.status+': '+x.text);}})"
-            ".catch(function(err){m.style.color='#800';m.textContent='Netwerkfout: '+err;});});})();"
-            "</script>",
+            "<p id=\"alert-policy-msg\"></p>",
             static_cast<unsigned>(config_store::kAlertPolicyCooldown1mSMin),
             static_cast<unsigned>(config_store::kAlertPolicyCooldown1mSMax),
             static_cast<unsigned>(apt.cooldown_1m_s),
@@ -1322,26 +1595,7 @@ static esp_err_t handle_root_html(httpd_req_t *req)
             "<p><label><input type=\"checkbox\" id=\"acf_lo\"%s/> confluence_emit_loose_alerts_when_conf_fails</label></p>"
             "<p><button type=\"submit\">Confluence-policy opslaan</button></p>"
             "</fieldset></form>"
-            "<p id=\"alert-conf-msg\"></p>"
-            "<script>"
-            "(function(){var f=document.getElementById('alert-confluence-form');"
-            "var m=document.getElementById('alert-conf-msg');if(!f||!m)return;"
-            "f.addEventListener('submit',function(e){e.preventDefault();m.textContent='Bezig…';m.style.color='#333';"
-            "var body=JSON.stringify({"
-            "confluence_enabled:document.getElementById('acf_en').checked,"
-            "confluence_require_same_direction:document.getElementById('acf_sd').checked,"
-            "confluence_require_both_thresholds:document.getElementById('acf_bt').checked,"
-            "confluence_emit_loose_alerts_when_conf_fails:document.getElementById('acf_lo').checked"
-            "});"
-            "fetch('/api/alert-confluence-policy.json',{method:'POST',headers:{'Content-Type':'application/json'},"
-            "body:body})"
-            ".then(function(r){return r.text().then(function(t){return {ok:r.ok,status:r.status,text:t};});})"
-            ".then(function(x){try{var j=JSON.parse(x.text);if(x.ok){m.style.color='#063';"
-            "m.textContent='Opgeslagen. '+(j.note||'');}else{m.style.color='#800';"
-            "m.textContent='Fout '+x.status+': '+(j.error||x.text);}}catch(err){"
-            "m.style.color=x.ok?'#063':'#800';m.textContent=x.ok?x.text:('Fout '+x.status+': '+x.text);}})"
-            ".catch(function(err){m.style.color='#800';m.textContent='Netwerkfout: '+err;});});})();"
-            "</script>",
+            "<p id=\"alert-conf-msg\"></p>",
             cf_en,
             cf_sd,
             cf_bt,
@@ -1382,35 +1636,13 @@ static esp_err_t handle_root_html(httpd_req_t *req)
         "<p><button type=\"submit\">Opslaan</button></p>"
         "</fieldset></form>"
         "<p id=\"svc-msg\"></p>"
-        "<script>"
-        "(function(){var f=document.getElementById('svc-form');var m=document.getElementById('svc-msg');"
-        "f.addEventListener('submit',function(e){e.preventDefault();m.textContent='Bezig…';m.style.color='#333';"
-        "var body=JSON.stringify({mqtt_enabled:document.getElementById('mqtt_enabled').checked,"
-        "mqtt_broker_uri:document.getElementById('mqtt_broker_uri').value,"
-        "ntfy_enabled:document.getElementById('ntfy_enabled').checked,"
-        "ntfy_topic:document.getElementById('ntfy_topic').value});"
-        "fetch('/api/services.json',{method:'POST',headers:{'Content-Type':'application/json'},body:body})"
-        ".then(function(r){return r.text().then(function(t){return {ok:r.ok,status:r.status,text:t};});})"
-        ".then(function(x){try{var j=JSON.parse(x.text);if(x.ok){m.style.color='#063';"
-        "m.textContent='Opgeslagen. '+(j.note||'');}else{m.style.color='#800';"
-        "m.textContent='Fout '+x.status+': '+(j.error||x.text);}}catch(err){"
-        "m.style.color=x.ok?'#063':'#800';m.textContent=x.ok?x.text:('Fout '+x.status+': '+x.text);}})"
-        ".catch(function(err){m.style.color='#800';m.textContent='Netwerkfout: '+err;});});})();"
-        "</script>"
         "<h2>OTA-firmware</h2>"
         "<p style=\"color:#666;font-size:.9rem\">Geen login — alleen op een vertrouwd netwerk. Gebruik het "
         "<code>build/*.bin</code> van <code>idf.py build</code>. Stroom stabiel houden.</p>"
         "<p><input type=\"file\" id=\"ota-file\" accept=\".bin,.BIN\"/></p>"
         "<p><button type=\"button\" id=\"ota-btn\">Firmware uploaden</button></p>"
         "<p id=\"ota-msg\"></p>"
-        "<script>(function(){var b=document.getElementById('ota-btn');if(!b)return;"
-        "b.addEventListener('click',function(){var f=document.getElementById('ota-file');"
-        "var o=document.getElementById('ota-msg');if(!f||!f.files.length){o.textContent='Kies een .bin';"
-        "o.style.color='#800';return;}o.textContent='Upload…';o.style.color='#333';"
-        "fetch('/api/ota',{method:'POST',headers:{'Content-Type':'application/octet-stream'},body:f.files[0]})"
-        ".then(function(r){return r.text().then(function(t){return {ok:r.ok,s:r.status,t:t};});})"
-        ".then(function(x){o.style.color=x.ok?'#063':'#800';o.textContent=x.t;})"
-        ".catch(function(e){o.style.color='#800';o.textContent=''+e;});});})();</script>"
+        "<script src=\"/assets/app.js?v=%08x\" defer></script>"
         "</body></html>",
         ota.running_label[0] ? ota.running_label : "?",
         (unsigned)ota.running_address,
@@ -1423,7 +1655,8 @@ static esp_err_t handle_root_html(httpd_req_t *req)
         static_cast<unsigned>(config_store::kMqttBrokerUriMax - 1),
         nt_chk,
         esc_topic,
-        static_cast<unsigned>(config_store::kNtfyTopicMax - 1));
+        static_cast<unsigned>(config_store::kNtfyTopicMax - 1),
+        static_cast<unsigned>(s_assets[1].version));
     if (n <= 0 || w + static_cast<size_t>(n) >= k_html_alloc) {
         ESP_LOGW(TAG, "M-013c/d: HTML deel2 overflow (n=%d)", n);
         std::free(html);
@@ -1523,9 +1756,37 @@ esp_err_t init()
     uo.user_ctx = nullptr;
     ESP_RETURN_ON_ERROR(httpd_register_uri_handler(s_httpd, &uo), TAG, "reg ota post");
 
+    httpd_uri_t um{};
+    um.uri = "/metrics";
+    um.method = HTTP_GET;
+    um.handler = handle_metrics;
+    um.user_ctx = nullptr;
+    ESP_RETURN_ON_ERROR(httpd_register_uri_handler(s_httpd, &um), TAG, "reg metrics");
+
+#if CONFIG_WEBUI_LIVE_PUSH
+    httpd_uri_t ul{};
+    ul.uri = "/api/live";
+    ul.method = HTTP_GET;
+    ul.handler = handle_live_ws;
+    ul.user_ctx = nullptr;
+    ul.is_websocket = true;
+    ESP_RETURN_ON_ERROR(httpd_register_uri_handler(s_httpd, &ul), TAG, "reg live ws");
+    ESP_RETURN_ON_ERROR(live_start(), TAG, "live start");
+#endif
+
+    init_assets();
+    for (WebAsset &a : s_assets) {
+        httpd_uri_t ux{};
+        ux.uri = a.uri;
+        ux.method = HTTP_GET;
+        ux.handler = handle_static_asset;
+        ux.user_ctx = &a;
+        ESP_RETURN_ON_ERROR(httpd_register_uri_handler(s_httpd, &ux), TAG, "reg asset");
+    }
+
     ESP_LOGI(TAG,
              "M-013a–l + M-014a/b: webui poort %u — status+alerts+OTA, services, alert-runtime + "
-             "alert-policy + confluence-policy POST+forms, OTA-upload",
+             "alert-policy + confluence-policy POST+forms, OTA-upload, /metrics, /api/live",
              static_cast<unsigned>(port));
     return ESP_OK;
 #endif
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Loopback-WS stand-in voor de `loopback`-provider (MD-01): speelt een opgenomen tickbestand af.
+
+Invoer (één tick per regel; `#`-regels en lege regels worden overgeslagen):
+  - CSV:  `<ts_ms>,<prijs>`
+  - JSON: `{"timestamp": <ms>, "price": "<prijs>"}` (bv. uit Bitvavo/Coinbase-logs)
+
+Per verbonden client (na subscribe) volgt een bericht per tick, in het oorspronkelijke tempo (`--speed`):
+  `{"event":"ticker","market":"<markt>","price":"<prijs>","timestamp":<opgenomen_ms + shift>}`
+
+De opgenomen tijdstempel gaat mee (exchange-tijd: canonieke seconde-indeling en klok-offset in
+`domain_metrics`), verschoven met een constante: `--ts-shift MS`, of `--rebase` zodat de eerste tick van
+elke doorloop op "nu" valt. Jitter en gaten uit de opname blijven zo intact.
+
+`--stall-after N` stopt na N ticks met zenden maar houdt de verbinding open: de feed moet dan **niet**
+wisselen (stille markt). `--drop-after N` sluit na N ticks de verbinding en weigert nieuwe; zo test je de
+failover op `ws_link_up` zonder netwerkstoring.
+
+Vereist: `pip install websockets` (≥ 11).
+"""
+
+import argparse
+import asyncio
+import json
+import sys
+import time
+
+import websockets
+
+
+def load_ticks(path):
+    ticks = []
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            if line.startswith("{"):
+                obj = json.loads(line)
+                ts, price = int(obj["timestamp"]), float(obj["price"])
+            else:
+                ts_s, price_s = line.split(",")[:2]
+                ts, price = int(ts_s), float(price_s)
+            ticks.append((ts, price))
+    return ticks
+
+
+def now_ms():
+    return int(time.time() * 1000)
+
+
+async def serve_client(ws, args, ticks, state):
+    if state["dropped"]:
+        await ws.close()
+        return
+    market = args.market
+    try:
+        first = await asyncio.wait_for(ws.recv(), timeout=10)
+        market = json.loads(first).get("market", market)
+    except (asyncio.TimeoutError, ValueError):
+        pass
+    print(f"[replay] client {ws.remote_address} market={market} ticks={len(ticks)}", flush=True)
+    sent = 0
+    while True:
+        prev_ts = None
+        shift = (now_ms() - ticks[0][0]) if args.rebase else args.ts_shift
+        for ts, price in ticks:
+            if prev_ts is not None:
+                await asyncio.sleep(max(0, ts - prev_ts) / 1000.0 / args.speed)
+            prev_ts = ts
+            if args.stall_after and sent >= args.stall_after:
+                print("[replay] stall: verbinding open, geen ticks meer", flush=True)
+                await ws.wait_closed()
+                return
+            if args.drop_after and sent >= args.drop_after:
+                print("[replay] drop: verbinding dicht, nieuwe clients geweigerd", flush=True)
+                state["dropped"] = True
+                await ws.close()
+                return
+            msg = {"event": "ticker", "market": market, "price": f"{price:.8g}",
+                   "timestamp": ts + shift}
+            await ws.send(json.dumps(msg, separators=(",", ":")))
+            sent += 1
+        if not args.loop:
+            await ws.wait_closed()
+            return
+
+
+async def main_async(args):
+    ticks = load_ticks(args.file)
+    if not ticks:
+        sys.stderr.write("geen ticks in bestand\n")
+        return 2
+    state = {"dropped": False}
+    async with websockets.serve(lambda ws: serve_client(ws, args, ticks, state), args.host, args.port):
+        print(f"[replay] ws://{args.host}:{args.port} ({args.file}, speed={args.speed})", flush=True)
+        await asyncio.Future()
+    return 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("file", help="tickbestand (CSV ts_ms,prijs of JSON-regels)")
+    ap.add_argument("--host", default="0.0.0.0")
+    ap.add_argument("--port", type=int, default=8765)
+    ap.add_argument("--market", default="BTC-EUR", help="fallback als de client geen markt meestuurt")
+    ap.add_argument("--speed", type=float, default=1.0, help="afspeelsnelheid (2.0 = twee keer zo snel)")
+    ap.add_argument("--loop", action="store_true", help="bestand blijven herhalen")
+    ap.add_argument("--ts-shift", type=int, default=0, help="constante verschuiving van de opgenomen ts (ms)")
+    ap.add_argument("--rebase", action="store_true", help="verschuif zodat de eerste tick per doorloop op nu valt")
+    ap.add_argument("--stall-after", type=int, default=0, help="stop met zenden na N ticks, verbinding open")
+    ap.add_argument("--drop-after", type=int, default=0, help="sluit na N ticks en weiger clients (failover-test)")
+    return asyncio.run(main_async(ap.parse_args()))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
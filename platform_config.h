@@ -179,6 +179,55 @@
 #define CRYPTO_ALERT_NETDIAG2_INTERVAL_MS 45000UL
 #endif
 
+// Hot-path tracepoints (src/Trace): cycle-count spans + histogrammen, uitlezen via GET /metrics.
+// 0 = TRACE_SPAN compileert weg (geen tabel, geen cycles).
+#ifndef CRYPTO_ALERT_TRACE_ENABLED
+#define CRYPTO_ALERT_TRACE_ENABLED 1
+#endif
+
+// WebUI live push (src/LivePush): GET /events (Server-Sent Events) i.p.v. /status-polling per dashboard.
+// 0 = geen route; de pagina valt dan terug op polling van /status.
+#ifndef CRYPTO_ALERT_LIVE_PUSH_ENABLED
+#define CRYPTO_ALERT_LIVE_PUSH_ENABLED 1
+#endif
+
+// Display flush (src/display): backend meldt "buffer vrij" asynchroon (DMA-ISR of flush-task),
+// LVGL rendert intussen in de tweede buffer. 0 = synchrone flush zoals voorheen.
+#ifndef CRYPTO_ALERT_DISPLAY_ASYNC_FLUSH
+#define CRYPTO_ALERT_DISPLAY_ASYNC_FLUSH 1
+#endif
+
+// Chart (UIController): 1 = circular update-mode; een nieuw punt invalideert alleen zijn eigen kolom
+// i.p.v. de hele schuivende lijn (sweep-weergave). 0 = klassiek schuiven.
+#ifndef CRYPTO_ALERT_CHART_CIRCULAR_UPDATE
+#define CRYPTO_ALERT_CHART_CIRCULAR_UPDATE 0
+#endif
+
+// Prijskaarten (UIController): priceLbl[] als numeriek label met vaste cijfercellen; een gewijzigd
+// cijfer invalideert alleen zijn eigen cel. 0 = gewone lv_label.
+#ifndef CRYPTO_ALERT_NUMERIC_PRICE_LABEL
+#define CRYPTO_ALERT_NUMERIC_PRICE_LABEL 1
+#endif
+
+// Marktfeed-endpoints (v1 spreekt het Bitvavo-protocol: REST /ticker/price + /candles, WS ticker).
+// Overschrijven voor een proxy of een LAN-replay (firmware-v2/tools/ws_replay.py); WS_TLS 0 = plain ws://.
+// ApiClient.cpp ziet platform_config.h niet: voor REST buiten de sketch via build-flag (-D) zetten.
+#ifndef CRYPTO_ALERT_FEED_API_BASE
+#define CRYPTO_ALERT_FEED_API_BASE "https://api.bitvavo.com/v2"
+#endif
+#ifndef CRYPTO_ALERT_FEED_WS_HOST
+#define CRYPTO_ALERT_FEED_WS_HOST "ws.bitvavo.com"
+#endif
+#ifndef CRYPTO_ALERT_FEED_WS_PORT
+#define CRYPTO_ALERT_FEED_WS_PORT 443
+#endif
+#ifndef CRYPTO_ALERT_FEED_WS_PATH
+#define CRYPTO_ALERT_FEED_WS_PATH "/v2/"
+#endif
+#ifndef CRYPTO_ALERT_FEED_WS_TLS
+#define CRYPTO_ALERT_FEED_WS_TLS 1
+#endif
+
 // uiTask: LVGL/updateUI zeldzamer (alleen A/B-diagnose). Productietestbuild: uit.
 #ifndef BOOT_DIAG_MINIMAL_UI_LOAD
 #define BOOT_DIAG_MINIMAL_UI_LOAD 0
@@ -209,6 +258,15 @@
 #define BOOT_DIAG_DISABLE_WEBUI_COLOR_FEATURE 0
 #endif
 
+// Settings-pagina (/): chunkgrootte van de paginaschrijver (past met chunk-header in één TCP-segment).
+#ifndef WEB_PAGE_CHUNK_SIZE
+#define WEB_PAGE_CHUNK_SIZE 1436
+#endif
+// Settings-pagina cache (PSRAM, per settings-versie). 0 = altijd live renderen. Zonder PSRAM: geen cache.
+#ifndef WEB_PAGE_CACHE_BYTES
+#define WEB_PAGE_CACHE_BYTES 65536
+#endif
+
 // A/B: vroege candle-REST alleen na vaste tijd sinds s_bootFlowEpochMs (geen vrijgave via WS-ticker in deze test).
 #ifndef CRYPTO_ALERT_CANDLE_BOOT_GUARD_MS
 #define CRYPTO_ALERT_CANDLE_BOOT_GUARD_MS 120000UL
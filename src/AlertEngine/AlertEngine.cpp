@@ -40,6 +40,7 @@ extern Alert2HThresholds alert2HThresholds;
 extern PriceData priceData;  // Voor getFiveMinutePrices()
 
 #include "../AlertAudit.h"
+#include "../Trace/Trace.h"
 
 // Forward declarations voor dependencies (worden later via modules)
 extern bool sendNotification(const char *title, const char *message, const char *colorTag = nullptr);
@@ -71,9 +72,6 @@ void safeStrncpy(char *dest, const char *src, size_t destSize);  // FASE X.5: Vo
 extern KlineMetrics lastKline1m;
 extern KlineMetrics lastKline5m;
 
-// Forward declaration voor computeTwoHMetrics()
-TwoHMetrics computeTwoHMetrics();
-
 // Persistent runtime state voor 2h notificaties
 static Alert2HState gAlert2H;
 
@@ -950,6 +948,7 @@ void AlertEngine::formatNotificationMessageInternal(float ret, const char* direc
 // Geoptimaliseerd: cache waarden, hergebruik buffers, early returns, validatie
 void AlertEngine::checkAndNotify(float ret_1m, float ret_5m, float ret_30m)
 {
+    TRACE_SPAN(TRACE_CHECK_NOTIFY);
     // Validatie: check voor NaN en Inf waarden
     if (isnan(ret_1m) || isinf(ret_1m) || isnan(ret_5m) || isinf(ret_5m) || isnan(ret_30m) || isinf(ret_30m)) {
         #if !DEBUG_BUTTON_ONLY
@@ -1966,7 +1965,7 @@ static void logSecondary2hThrottlePrecheckRateLimited(Alert2HType t, uint32_t no
 // Check 2-hour notifications (breakout, breakdown, compression, mean reversion, anchor context)
 // Wordt aangeroepen na elke price update
 // Geoptimaliseerd: early returns, hergebruik buffers, minder berekeningen, validatie
-void AlertEngine::check2HNotifications(float lastPrice, float anchorPrice)
+void AlertEngine::check2HNotifications(float lastPrice, float anchorPrice, const TwoHMetrics& metrics)
 {
     // Geconsolideerde validatie: check alle voorwaarden in één keer (sneller, minder branches)
     if (isnan(lastPrice) || isinf(lastPrice) || isnan(anchorPrice) || isinf(anchorPrice) ||
@@ -1979,9 +1978,6 @@ void AlertEngine::check2HNotifications(float lastPrice, float anchorPrice)
     // Auto Anchor: gebruik actieve anchor price (kan auto anchor zijn)
     float activeAnchorPrice = getActiveAnchorPrice(anchorPrice);
     
-    // Bereken 2h metrics
-    TwoHMetrics metrics = computeTwoHMetrics();
-    
     // Early return: check validiteit van metrics
     if (!metrics.valid) {
         // FASE X.5: Flush pending alert ook bij invalid metrics
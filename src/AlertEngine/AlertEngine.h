@@ -183,8 +183,8 @@ public:
     bool checkAndSendConfluenceAlert(unsigned long now, float ret_30m);
     
     // Check 2-hour notifications (breakout, breakdown, compression, mean reversion, anchor context)
-    // Wordt aangeroepen na elke price update
-    static void check2HNotifications(float lastPrice, float anchorPrice);
+    // Wordt aangeroepen na elke price update; metrics komen uit de AnalyticsSnapshot van die tick
+    static void check2HNotifications(float lastPrice, float anchorPrice, const TwoHMetrics& metrics);
     
     // Auto Anchor methods
     static float getActiveAnchorPrice(float manualAnchorPrice);
@@ -0,0 +1,69 @@
+#include "AnalyticsSnapshot.h"
+#include <atomic>
+
+namespace {
+
+// Twee buffers: de schrijver vult altijd de niet-actieve, lezers kopiëren de actieve.
+// gen per buffer is oneven tijdens het schrijven; een lezer die midden in zijn kopie door
+// twee publishes wordt ingehaald (buffer hergebruikt) ziet een andere gen en probeert opnieuw.
+struct SnapshotSlot {
+    std::atomic<uint32_t> gen;
+    AnalyticsSnapshot data;
+};
+
+static SnapshotSlot g_slots[2];
+static std::atomic<uint8_t> g_active{0};
+static std::atomic<uint32_t> g_seq{0};
+static std::atomic<uint32_t> g_readFailures{0};  // Reads die de retry-limiet haalden (/metrics)
+
+// Publish gebeurt hooguit een paar keer per seconde; dit is ruim voldoende
+static const uint8_t kReadRetries = 4;
+
+}  // namespace
+
+void analyticsSnapshotPublish(const AnalyticsSnapshot& snap) {
+    const uint32_t seq = g_seq.load(std::memory_order_relaxed) + 1;
+    const uint8_t idx = (uint8_t)(g_active.load(std::memory_order_relaxed) ^ 1u);
+    SnapshotSlot& slot = g_slots[idx];
+
+    const uint32_t gen = slot.gen.load(std::memory_order_relaxed);
+    slot.gen.store(gen + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.data = snap;
+    slot.data.seq = seq;
+    slot.gen.store(gen + 2, std::memory_order_release);
+
+    g_active.store(idx, std::memory_order_release);
+    g_seq.store(seq, std::memory_order_release);
+}
+
+bool analyticsSnapshotRead(AnalyticsSnapshot& out) {
+    if (g_seq.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    for (uint8_t attempt = 0; attempt < kReadRetries; attempt++) {
+        const SnapshotSlot& slot = g_slots[g_active.load(std::memory_order_acquire)];
+        const uint32_t before = slot.gen.load(std::memory_order_acquire);
+        if (before & 1u) {
+            continue;
+        }
+        out = slot.data;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.gen.load(std::memory_order_relaxed) == before) {
+            return true;
+        }
+    }
+    // Lezer is herhaaldelijk ingehaald (task lang gepreempt): gemengde kopie niet teruggeven
+    // Geen Serial op dit pad (UI/web lezen elke refresh): alleen tellen
+    out = AnalyticsSnapshot();
+    g_readFailures.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+uint32_t analyticsSnapshotReadFailures() {
+    return g_readFailures.load(std::memory_order_relaxed);
+}
+
+uint32_t analyticsSnapshotSeq() {
+    return g_seq.load(std::memory_order_acquire);
+}
@@ -0,0 +1,73 @@
+#ifndef ANALYTICS_SNAPSHOT_H
+#define ANALYTICS_SNAPSHOT_H
+
+#include <Arduino.h>
+#include "../TrendDetector/TrendDetector.h"
+#include "../VolatilityTracker/VolatilityTracker.h"
+#include "../AlertEngine/AlertEngine.h"
+#include "../RegimeEngine/RegimeEngine.h"
+
+/**
+ * AnalyticsSnapshot: alle afgeleide marktwaarden van één prijs-tick
+ *
+ * De apiTask vult dit één keer per succesvolle fetch (onder dataMutex, direct na de
+ * return-berekening en regimeEngineTick) en publiceert het. Web, UI, MQTT en alerts lezen
+ * daarna dezelfde kopie zonder dataMutex en zonder zelf returns of 2h-metrics te herberekenen,
+ * zodat alle kanalen per tick identieke getallen tonen.
+ */
+struct AnalyticsSnapshot {
+    uint32_t seq = 0;             // Oplopend per publish; 0 = nog nooit gepubliceerd
+    unsigned long tickMs = 0;     // lastApiMs van deze tick (0 bij publish zonder prijs, bv. na warm-start)
+    float price = 0.0f;
+
+    float ret1m = 0.0f;
+    float ret5m = 0.0f;
+    float ret30m = 0.0f;
+    float ret2h = 0.0f;
+    float ret4h = 0.0f;
+    float ret1d = 0.0f;
+    float ret7d = 0.0f;
+    bool hasRet30m = false;
+    bool hasRet2h = false;
+    bool hasRet4h = false;
+    bool hasRet1d = false;
+    bool hasRet7d = false;
+
+    // Percentage SOURCE_LIVE in het venster (rest is warm-start)
+    uint8_t livePct5m = 0;
+    uint8_t livePct30m = 0;
+    uint8_t livePct2h = 0;
+
+    TrendState trend = TREND_SIDEWAYS;
+    TrendState trendMedium = TREND_SIDEWAYS;
+    TrendState trendLong = TREND_SIDEWAYS;
+    VolatilityState volatility = VOLATILITY_MEDIUM;
+    VolumeRangeStatus volume;
+    TwoHMetrics twoH;
+    RegimeSnapshot regime;
+
+    bool anchorActive = false;
+    float anchorPrice = 0.0f;     // 0 als anchor uit of ongeldig
+    float anchorDeltaPct = 0.0f;
+};
+
+/**
+ * Publiceer een nieuwe snapshot (alleen vanuit de apiTask; één schrijver)
+ *
+ * Schrijft in de inactieve buffer en wisselt daarna de actieve index; seq wordt hier gezet.
+ */
+void analyticsSnapshotPublish(const AnalyticsSnapshot& snap);
+
+/**
+ * Kopieer de laatst gepubliceerde snapshot (lock-free, elke task)
+ * @return false als er nog niets gepubliceerd is (out blijft dan op defaults)
+ */
+bool analyticsSnapshotRead(AnalyticsSnapshot& out);
+
+// seq van de laatste publish (0 = nog geen); goedkoop om op wijzigingen te pollen
+uint32_t analyticsSnapshotSeq();
+
+// Aantal reads dat na kReadRetries pogingen nog geen consistente kopie had (GET /metrics)
+uint32_t analyticsSnapshotReadFailures();
+
+#endif // ANALYTICS_SNAPSHOT_H
@@ -2,6 +2,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include "../PriceFormat/QuotePriceFormat.h"
+#include "../UiCommand/UiCommand.h"
 
 // Forward declarations voor dependencies (worden later via modules)
 extern float openPrices[];  // Voor setAnchorPrice
@@ -486,10 +487,9 @@ bool AnchorSystem::setAnchorPrice(float anchorValue, bool shouldUpdateUI, bool s
             sendNotification(title, msg, "\xF0\x9F\x9F\xAB");  // 🟫
         }
         
-        // Update UI alleen als gevraagd (niet vanuit web/MQTT threads)
-        // Fase 8.11.2: Gebruik module versie
+        // UI-refresh alleen als gevraagd; uitgevoerd door de uiTask (geen LVGL vanuit deze task)
         if (shouldUpdateUI) {
-            uiController.updateUI();
+            uiCommandPost(UI_CMD_REFRESH);
         }
         
         return true;
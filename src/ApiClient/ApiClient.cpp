@@ -585,7 +585,7 @@ bool ApiClient::fetchBitvavoPrice(const char* symbol, float& out)
     
     // Build Bitvavo API URL
     char url[128];
-    snprintf(url, sizeof(url), "https://api.bitvavo.com/v2/ticker/price?market=%s", symbol);
+    snprintf(url, sizeof(url), CRYPTO_ALERT_FEED_API_BASE "/ticker/price?market=%s", symbol);
     
     #if DEBUG_CALCULATIONS
     Serial_printf(F("[API][DEBUG] fetchBitvavoPrice: URL: %s\n"), url);
@@ -16,6 +16,10 @@
 #ifndef DEBUG_CALCULATIONS
 #define DEBUG_CALCULATIONS 0
 #endif
+// REST-basis van de marktfeed (platform_config.h / build-flag); default Bitvavo
+#ifndef CRYPTO_ALERT_FEED_API_BASE
+#define CRYPTO_ALERT_FEED_API_BASE "https://api.bitvavo.com/v2"
+#endif
 
 // S0: FreeRTOS headers voor SemaphoreHandle_t
 #include <freertos/semphr.h>
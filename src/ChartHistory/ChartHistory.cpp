@@ -0,0 +1,108 @@
+#include "ChartHistory.h"
+#include <atomic>
+#include <math.h>
+
+static std::atomic<uint32_t> g_generation[CHART_SRC_COUNT];
+
+bool chartHorizonSource(ChartHorizon h, ChartHistorySource& src, uint16_t& windowBars) {
+    switch (h) {
+        case CHART_HORIZON_1H:
+            src = CHART_SRC_MINUTE;
+            windowBars = 60;
+            return true;
+        case CHART_HORIZON_24H:
+            src = CHART_SRC_HOUR;
+            windowBars = 24;
+            return true;
+        case CHART_HORIZON_7D:
+            src = CHART_SRC_HOUR;
+            windowBars = 168;
+            return true;
+        default:
+            return false;
+    }
+}
+
+void chartHistoryBarClosed(ChartHistorySource src) {
+    if (src < CHART_SRC_COUNT) {
+        g_generation[src].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint32_t chartHistoryGeneration(ChartHistorySource src) {
+    return (src < CHART_SRC_COUNT) ? g_generation[src].load(std::memory_order_relaxed) : 0;
+}
+
+uint16_t chartHistoryCollect(const float* ring, uint16_t ringSize, uint16_t nextIdx, bool filled,
+                             uint16_t windowBars, float* out) {
+    if (ring == nullptr || out == nullptr || ringSize == 0) {
+        return 0;
+    }
+    const uint16_t avail = filled ? ringSize : (nextIdx < ringSize ? nextIdx : ringSize);
+    const uint16_t take = (windowBars < avail) ? windowBars : avail;
+    uint16_t n = 0;
+    for (uint16_t i = take; i >= 1; i--) {
+        const uint16_t idx = (uint16_t)((nextIdx + ringSize - (i % ringSize)) % ringSize);
+        const float v = ring[idx];
+        if (v > 0.0f && isfinite(v)) {
+            out[n++] = v;
+        }
+    }
+    return n;
+}
+
+uint16_t lttbDownsample(const float* y, uint16_t n, float* out, uint16_t threshold) {
+    if (n <= threshold || threshold < 3) {
+        const uint16_t m = (n <= threshold) ? n : threshold;
+        for (uint16_t i = 0; i < m; i++) {
+            out[i] = y[(threshold < 3 && n > threshold && i == m - 1) ? (n - 1) : i];
+        }
+        return m;
+    }
+
+    const float every = (float)(n - 2) / (float)(threshold - 2);
+    uint16_t a = 0;
+    uint16_t k = 0;
+    out[k++] = y[0];
+
+    for (uint16_t i = 0; i < threshold - 2; i++) {
+        // Gemiddelde van de volgende bucket (derde hoekpunt)
+        uint16_t avgStart = (uint16_t)(floorf((float)(i + 1) * every) + 1);
+        uint16_t avgEnd = (uint16_t)(floorf((float)(i + 2) * every) + 1);
+        if (avgEnd > n) {
+            avgEnd = n;
+        }
+        if (avgStart >= avgEnd) {
+            avgStart = (uint16_t)(avgEnd - 1);
+        }
+        float avgX = 0.0f;
+        float avgY = 0.0f;
+        for (uint16_t j = avgStart; j < avgEnd; j++) {
+            avgX += (float)j;
+            avgY += y[j];
+        }
+        const float avgN = (float)(avgEnd - avgStart);
+        avgX /= avgN;
+        avgY /= avgN;
+
+        // Punt in de huidige bucket met de grootste driehoek (a, punt, gemiddelde)
+        const uint16_t rangeStart = (uint16_t)(floorf((float)i * every) + 1);
+        const uint16_t rangeEnd = (uint16_t)(floorf((float)(i + 1) * every) + 1);
+        const float ax = (float)a;
+        const float ay = y[a];
+        float maxArea = -1.0f;
+        uint16_t maxIdx = rangeStart;
+        for (uint16_t j = rangeStart; j < rangeEnd && j < n; j++) {
+            const float area = fabsf((ax - avgX) * (y[j] - ay) - (ax - (float)j) * (avgY - ay));
+            if (area > maxArea) {
+                maxArea = area;
+                maxIdx = j;
+            }
+        }
+        out[k++] = y[maxIdx];
+        a = maxIdx;
+    }
+
+    out[k++] = y[n - 1];
+    return k;
+}
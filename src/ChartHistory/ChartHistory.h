@@ -0,0 +1,44 @@
+#ifndef CHART_HISTORY_H
+#define CHART_HISTORY_H
+
+#include <stdint.h>
+
+// Grafiekhorizon (instelling chartHorizon). LIVE = laatste POINTS_TO_CHART live samples;
+// de andere horizons tonen de bestaande minuut-/uurbuffers, zo nodig gedownsampled.
+enum ChartHorizon : uint8_t {
+    CHART_HORIZON_LIVE = 0,
+    CHART_HORIZON_1H = 1,    // laatste 60 minuutgemiddelden
+    CHART_HORIZON_24H = 2,   // laatste 24 uurgemiddelden
+    CHART_HORIZON_7D = 3,    // laatste 168 uurgemiddelden
+    CHART_HORIZON_COUNT
+};
+
+enum ChartHistorySource : uint8_t {
+    CHART_SRC_MINUTE = 0,
+    CHART_SRC_HOUR = 1,
+    CHART_SRC_COUNT
+};
+
+// Bron en venstergrootte (bars) van een horizon; false voor LIVE
+bool chartHorizonSource(ChartHorizon h, ChartHistorySource& src, uint16_t& windowBars);
+
+// Aanroepen na het sluiten van een bar (apiTask); de UI herberekent alleen bij een nieuwe generatie
+void chartHistoryBarClosed(ChartHistorySource src);
+uint32_t chartHistoryGeneration(ChartHistorySource src);
+
+/**
+ * Laatste `windowBars` geldige waarden (>0) uit een ringbuffer, oudste eerst.
+ * @param nextIdx schrijfindex (volgende te schrijven slot)
+ * @return aantal waarden in out
+ */
+uint16_t chartHistoryCollect(const float* ring, uint16_t ringSize, uint16_t nextIdx, bool filled,
+                             uint16_t windowBars, float* out);
+
+/**
+ * Largest-Triangle-Three-Buckets: n punten -> maximaal `threshold` punten met behoud van
+ * pieken/dalen (eerste en laatste punt blijven). x = index (gelijke afstand).
+ * @return aantal punten in out (n als n <= threshold)
+ */
+uint16_t lttbDownsample(const float* y, uint16_t n, float* out, uint16_t threshold);
+
+#endif
@@ -0,0 +1,157 @@
+#include "LivePush.h"
+#include <lwip/sockets.h>
+
+namespace {
+
+static WiFiClient s_clients[LIVE_PUSH_MAX_CLIENTS];
+static bool s_used[LIVE_PUSH_MAX_CLIENTS] = {};
+
+// Eén kant-en-klaar SSE-bericht ("event: x\ndata: {...}\n\n"), voor alle clients hergebruikt
+static char s_wire[LIVE_PUSH_FRAME_BYTES + 40];
+static size_t s_wireLen = 0;
+static uint32_t s_frameHash = 0;
+static uint32_t s_lastKeepaliveMs = 0;
+static LivePushStats s_stats = {};
+
+static uint32_t frameHash(const char* data, size_t len) {
+    uint32_t h = 2166136261u;  // FNV-1a
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)data[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void dropClient(uint8_t i) {
+    s_clients[i].stop();
+    s_clients[i] = WiFiClient();
+    s_used[i] = false;
+    s_stats.clientsDropped++;
+}
+
+// Niet-blokkerend: WiFiClient::write() wacht bij een volle zendbuffer tot seconden per client, en
+// publish/keepalive kunnen in de PriceRepeat-task draaien (WEB_RUNTIME_INLINE_IN_PRICE_TASK).
+// Past het frame niet in één keer in de zendbuffer, dan valt de client af: een half frame zou de
+// SSE-stream toch corrumperen, en EventSource verbindt zelf opnieuw (retry: 3000).
+static bool writeAll(uint8_t i, const char* data, size_t len) {
+    const int fd = s_clients[i].connected() ? s_clients[i].fd() : -1;
+    if (fd < 0) {
+        dropClient(i);
+        return false;
+    }
+    const ssize_t sent = send(fd, data, len, MSG_DONTWAIT);
+    if (sent < 0 || (size_t)sent != len) {
+        if (sent >= 0 || errno == EAGAIN || errno == EWOULDBLOCK) {
+            s_stats.clientsStalled++;
+        }
+        dropClient(i);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+bool livePushAttach(WiFiClient& client) {
+    int8_t slot = -1;
+    for (uint8_t i = 0; i < LIVE_PUSH_MAX_CLIENTS; i++) {
+        if (s_used[i] && !s_clients[i].connected()) {
+            dropClient(i);
+        }
+        if (!s_used[i] && slot < 0) {
+            slot = (int8_t)i;
+        }
+    }
+    if (slot < 0) {
+        s_stats.clientsRejected++;
+        return false;
+    }
+
+    static const char kHeaders[] =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/event-stream\r\n"
+        "Cache-Control: no-store\r\n"
+        "Connection: keep-alive\r\n"
+        "Access-Control-Allow-Origin: *\r\n"
+        "\r\n"
+        "retry: 3000\n\n";
+    s_clients[slot] = client;  // Deelt de socket; WebServer laat zijn eigen kopie los na de handler
+    s_used[slot] = true;
+    if (!writeAll((uint8_t)slot, kHeaders, sizeof(kHeaders) - 1)) {
+        return false;
+    }
+    if (s_wireLen > 0) {
+        writeAll((uint8_t)slot, s_wire, s_wireLen);
+    }
+    return true;
+}
+
+uint8_t livePushClientCount() {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < LIVE_PUSH_MAX_CLIENTS; i++) {
+        if (s_used[i]) {
+            n++;
+        }
+    }
+    return n;
+}
+
+bool livePushPublish(const char* event, const char* json, size_t len) {
+    if (event == nullptr || json == nullptr || len == 0 || len > LIVE_PUSH_FRAME_BYTES) {
+        return false;
+    }
+    // SSE: een regeleinde in de payload zou het bericht splitsen
+    if (memchr(json, '\n', len) != nullptr) {
+        return false;
+    }
+    const uint32_t h = frameHash(json, len);
+    if (s_wireLen > 0 && h == s_frameHash) {
+        s_stats.framesUnchanged++;
+        return false;
+    }
+
+    int head = snprintf(s_wire, sizeof(s_wire), "event: %s\ndata: ", event);
+    if (head <= 0 || (size_t)head + len + 2 > sizeof(s_wire)) {
+        s_wireLen = 0;
+        return false;
+    }
+    memcpy(s_wire + head, json, len);
+    s_wire[head + len] = '\n';
+    s_wire[head + len + 1] = '\n';
+    s_wireLen = (size_t)head + len + 2;
+    s_frameHash = h;
+    s_stats.framesPublished++;
+
+    for (uint8_t i = 0; i < LIVE_PUSH_MAX_CLIENTS; i++) {
+        if (s_used[i] && writeAll(i, s_wire, s_wireLen)) {
+            s_stats.clientWrites++;
+        }
+    }
+    return true;
+}
+
+void livePushService(uint32_t nowMs) {
+    if (livePushClientCount() == 0) {
+        s_lastKeepaliveMs = nowMs;
+        return;
+    }
+    const bool keepalive = (nowMs - s_lastKeepaliveMs) >= LIVE_PUSH_KEEPALIVE_MS;
+    if (keepalive) {
+        s_lastKeepaliveMs = nowMs;
+    }
+    for (uint8_t i = 0; i < LIVE_PUSH_MAX_CLIENTS; i++) {
+        if (!s_used[i]) {
+            continue;
+        }
+        if (keepalive) {
+            writeAll(i, ":\n\n", 3);
+        } else if (!s_clients[i].connected()) {
+            dropClient(i);
+        }
+    }
+}
+
+void livePushGetStats(LivePushStats& out) {
+    out = s_stats;
+    out.clients = livePushClientCount();
+}
@@ -0,0 +1,67 @@
+#ifndef LIVE_PUSH_H
+#define LIVE_PUSH_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+// Max. gelijktijdige SSE-clients (browsers met het dashboard open)
+#ifndef LIVE_PUSH_MAX_CLIENTS
+#define LIVE_PUSH_MAX_CLIENTS 4
+#endif
+
+// Grootste frame (JSON zonder "event:/data:"-omlijsting)
+#ifndef LIVE_PUSH_FRAME_BYTES
+#define LIVE_PUSH_FRAME_BYTES 1024
+#endif
+
+// Minimale afstand tussen twee frame-builds (sub-seconde latency, max. 4 builds/s)
+#ifndef LIVE_PUSH_MIN_INTERVAL_MS
+#define LIVE_PUSH_MIN_INTERVAL_MS 250
+#endif
+
+// Rebuild zonder nieuwe API-prijs (WS-ticks, anchor-wijziging, STALE-teller)
+#ifndef LIVE_PUSH_REFRESH_MS
+#define LIVE_PUSH_REFRESH_MS 1000
+#endif
+
+// SSE-commentaar als keepalive; detecteert ook weggevallen clients
+#ifndef LIVE_PUSH_KEEPALIVE_MS
+#define LIVE_PUSH_KEEPALIVE_MS 15000
+#endif
+
+struct LivePushStats {
+    uint8_t clients;
+    uint32_t framesPublished;  // Frame gewijzigd en uitgestuurd
+    uint32_t framesUnchanged;  // Zelfde hash als vorige frame: niets verstuurd
+    uint32_t clientWrites;     // Frames x clients
+    uint32_t clientsDropped;   // Schrijffout of verbinding weg
+    uint32_t clientsStalled;   // Waarvan: zendbuffer vol (trage/hangende client)
+    uint32_t clientsRejected;  // Alle slots bezet (503)
+};
+
+/**
+ * LivePush: Server-Sent Events fan-out voor de WebUI (GET /events)
+ *
+ * De producent serialiseert één frame per statuswijziging; livePushPublish() vergelijkt de hash met
+ * het vorige frame en schrijft alleen bij verschil, naar alle clients uit dezelfde buffer. Nieuwe
+ * clients krijgen direct het laatste frame, zodat de pagina niet op de volgende wijziging wacht.
+ *
+ * Schrijven is niet-blokkerend (MSG_DONTWAIT); een client met een volle zendbuffer valt af.
+ * Niet thread-safe: attach/publish/keepalive alleen vanuit de task die handleClient() draait.
+ */
+
+// Neem de socket van een lopend request over als SSE-stream (schrijft de headers zelf)
+// @return false als alle slots bezet zijn (aanroeper stuurt 503; EventSource valt terug op polling)
+bool livePushAttach(WiFiClient& client);
+
+uint8_t livePushClientCount();
+
+// Publiceer `json` als event `event`; @return true als het frame gewijzigd was en is uitgestuurd
+bool livePushPublish(const char* event, const char* json, size_t len);
+
+// Keepalive + opruimen van verbroken clients; goedkoop, elke web-task-slice aanroepen
+void livePushService(uint32_t nowMs);
+
+void livePushGetStats(LivePushStats& out);
+
+#endif // LIVE_PUSH_H
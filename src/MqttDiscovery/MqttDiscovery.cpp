@@ -0,0 +1,356 @@
+#include "MqttDiscovery.h"
+#include <Preferences.h>
+#include "../SettingsSchema/SettingsSchema.h"
+
+// Include alleen DEBUG_BUTTON_ONLY, niet de hele platform_config.h (voorkomt PINS includes)
+#ifndef DEBUG_BUTTON_ONLY
+#define DEBUG_BUTTON_ONLY 1
+#endif
+
+namespace {
+
+// Volgorde bepaalt publish-volgorde; wijzigen is veilig (hash per index mismatcht → republish).
+// min/max van number-entiteiten uit src/SettingsSchema worden bij het bouwen uit het schema gehaald
+// (daar wordt /set gevalideerd); alleen entiteiten buiten het schema hebben ze in extra.
+static constexpr MqttDiscoveryEntity kEntities[] = {
+    {"number", "spike1m", "1m Spike Threshold", "config/spike1m", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\""},
+    {"number", "spike5m", "5m Spike Filter", "config/spike5m", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:filter\",\"mode\":\"box\""},
+    {"number", "move30m", "30m Move Threshold", "config/move30m", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:trending-up\",\"mode\":\"box\""},
+    {"number", "move5m", "5m Move Filter", "config/move5m", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:filter-variant\",\"mode\":\"box\""},
+    {"number", "move5mAlert", "5m Move Alert Threshold", "config/move5mAlert", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:alert\",\"mode\":\"box\""},
+    {"number", "cooldown1min", "1m Cooldown", "config/cooldown1min", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "cooldown30min", "30m Cooldown", "config/cooldown30min", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer-outline\",\"mode\":\"box\""},
+    {"number", "cooldown5min", "5m Cooldown", "config/cooldown5min", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer-sand\",\"mode\":\"box\""},
+    {"text", "bitvavoSymbol", "Bitvavo Market", "config/bitvavoSymbol", MQTT_DISC_CMD,
+     "\"icon\":\"mdi:currency-btc\""},
+    {"text", "ntfyTopic", "NTFY Topic", "config/ntfyTopic", MQTT_DISC_CMD,
+     "\"icon\":\"mdi:bell-ring\""},
+    {"sensor", "price", "Crypto Price", "values/price", 0,
+     "\"unit_of_measurement\":\"EUR\",\"icon\":\"mdi:currency-btc\",\"device_class\":\"monetary\""},
+    {"sensor", "return_1m", "1m Return", "values/return_1m", 0,
+     "\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-line-variant\""},
+    {"sensor", "return_5m", "5m Return", "values/return_5m", 0,
+     "\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant\""},
+    {"sensor", "return_30m", "30m Return", "values/return_30m", 0,
+     "\"unit_of_measurement\":\"%\",\"icon\":\"mdi:trending-up\""},
+    {"sensor", "return_2h", "2h Return", "values/return_2h", 0,
+     "\"unit_of_measurement\":\"%\",\"icon\":\"mdi:trending-up\""},
+    {"sensor", "return_1d", "1d Return", "values/return_1d", 0,
+     "\"unit_of_measurement\":\"%\",\"icon\":\"mdi:calendar-today\""},
+    {"sensor", "return_7d", "7d Return", "values/return_7d", 0,
+     "\"unit_of_measurement\":\"%\",\"icon\":\"mdi:calendar-week\""},
+    {"sensor", "trend_2h", "Trend 2h", "values/trend_2h", 0,
+     "\"icon\":\"mdi:chart-line\""},
+    {"sensor", "trend_1d", "Trend 1d", "values/trend_1d", 0,
+     "\"icon\":\"mdi:chart-line\""},
+    {"sensor", "trend_7d", "Trend 7d", "values/trend_7d", 0,
+     "\"icon\":\"mdi:chart-line\""},
+    {"number", "anchorTakeProfit", "Anchor Take Profit", "config/anchorTakeProfit", MQTT_DISC_CMD,
+     "\"step\":0.1,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:cash-plus\",\"mode\":\"box\""},
+    {"number", "anchorMaxLoss", "Anchor Max Loss", "config/anchorMaxLoss", MQTT_DISC_CMD,
+     "\"step\":0.1,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:cash-minus\",\"mode\":\"box\""},
+    {"select", "anchorStrategy", "TP/SL Strategie", "config/anchorStrategy", MQTT_DISC_CMD,
+     "\"options\":[\"0\",\"1\",\"2\"],\"icon\":\"mdi:strategy\""},
+    {"number", "anchorValue", "Reset Anchor Price", "config/anchorValue", MQTT_DISC_CMD,
+     "\"min\":0.01,\"max\":1000000.0,\"step\":0.01,\"unit_of_measurement\":\"EUR\",\"icon\":\"mdi:anchor\",\"mode\":\"box\""},
+    {"sensor", "anchor_event", "Anchor Event", "anchor/event", MQTT_DISC_JSON_ATTR,
+     "\"value_template\":\"{{ value_json.event }}\",\"icon\":\"mdi:anchor\""},
+    {"number", "trendThreshold", "Trend Threshold", "config/trendThreshold", MQTT_DISC_CMD,
+     "\"step\":0.1,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-line\",\"mode\":\"box\""},
+    {"number", "volatilityLowThreshold", "Volatility Low Threshold", "config/volatilityLowThreshold", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "volatilityHighThreshold", "Volatility High Threshold", "config/volatilityHighThreshold", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant-shimmer\",\"mode\":\"box\""},
+    {"number", "displayRotation", "Display Rotation", "config/displayRotation", MQTT_DISC_CMD,
+     "\"min\":0,\"max\":2,\"step\":2,\"icon\":\"mdi:rotate-3d-variant\",\"mode\":\"box\""},
+    {"sensor", "ip_address", "IP Address", "values/ip_address", 0,
+     "\"icon\":\"mdi:ip-network\""},
+    {"select", "language", "Language", "config/language", MQTT_DISC_CMD,
+     "\"options\":[\"0\",\"1\"],\"icon\":\"mdi:translate\""},
+    {"number", "2hBreakMargin", "2h Breakout Margin", "config/2hBreakMargin", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "2hBreakReset", "2h Breakout Reset", "config/2hBreakReset", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "2hBreakCD", "2h Breakout Cooldown", "config/2hBreakCD", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "2hMeanMinDist", "2h Mean Min Distance", "config/2hMeanMinDist", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "2hMeanTouch", "2h Mean Touch Band", "config/2hMeanTouch", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "2hMeanCD", "2h Mean Cooldown", "config/2hMeanCD", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "2hCompressTh", "2h Compress Threshold", "config/2hCompressTh", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "2hCompressReset", "2h Compress Reset", "config/2hCompressReset", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "2hCompressCD", "2h Compress Cooldown", "config/2hCompressCD", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "2hAnchorMargin", "2h Anchor Margin", "config/2hAnchorMargin", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:anchor\",\"mode\":\"box\""},
+    {"number", "2hAnchorCD", "2h Anchor Cooldown", "config/2hAnchorCD", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "2hTrendHyst", "2h Trend Hysteresis", "config/2hTrendHyst", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-line\",\"mode\":\"box\""},
+    {"number", "2hThrottleTC", "2h Throttle Trend Change", "config/2hThrottleTC", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "2hThrottleTM", "2h Throttle Trend→Mean", "config/2hThrottleTM", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "2hThrottleMT", "2h Throttle Mean Touch", "config/2hThrottleMT", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "2hThrottleComp", "2h Throttle Compress", "config/2hThrottleComp", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "2hSecGlobalCD", "2h Secondary Global Cooldown", "config/2hSecGlobalCD", MQTT_DISC_CMD,
+     "\"step\":60,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer-outline\",\"mode\":\"box\""},
+    {"number", "2hSecCoalesce", "2h Secondary Coalesce Window", "config/2hSecCoalesce", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer-sand\",\"mode\":\"box\""},
+    {"switch", "trendAdapt", "Trend-Adaptive Anchors", "config/trendAdapt", MQTT_DISC_CMD,
+     "\"icon\":\"mdi:chart-line-variant\""},
+    {"number", "upMLMult", "UP Trend Max Loss Mult", "config/upMLMult", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\""},
+    {"number", "upTPMult", "UP Trend Take Profit Mult", "config/upTPMult", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\""},
+    {"number", "downMLMult", "DOWN Trend Max Loss Mult", "config/downMLMult", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\""},
+    {"number", "downTPMult", "DOWN Trend Take Profit Mult", "config/downTPMult", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-line-variant\",\"mode\":\"box\""},
+    {"switch", "smartConf", "Smart Confluence Mode", "config/smartConf", MQTT_DISC_CMD,
+     "\"icon\":\"mdi:chart-timeline-variant\""},
+    {"switch", "nightMode", "Night Mode", "config/nightMode", MQTT_DISC_CMD,
+     "\"icon\":\"mdi:weather-night\""},
+    {"switch", "autoVol", "Auto-Volatility Mode", "config/autoVol", MQTT_DISC_CMD,
+     "\"icon\":\"mdi:chart-timeline-variant-shimmer\""},
+    {"number", "autoVolWin", "Auto-Volatility Window", "config/autoVolWin", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"min\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "autoVolBase", "Auto-Volatility Baseline", "config/autoVolBase", MQTT_DISC_CMD,
+     "\"step\":0.0001,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "autoVolMin", "Auto-Volatility Min Mult", "config/autoVolMin", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "autoVolMax", "Auto-Volatility Max Mult", "config/autoVolMax", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"switch", "warmStart", "Warm-Start Enabled", "config/warmStart", MQTT_DISC_CMD,
+     "\"icon\":\"mdi:fire\""},
+    {"number", "ws1mExtra", "Warm-Start 1m Extra", "config/ws1mExtra", MQTT_DISC_CMD,
+     "\"step\":1,\"icon\":\"mdi:fire\",\"mode\":\"box\""},
+    {"number", "ws5m", "Warm-Start 5m Candles", "config/ws5m", MQTT_DISC_CMD,
+     "\"step\":1,\"icon\":\"mdi:fire\",\"mode\":\"box\""},
+    {"number", "ws30m", "Warm-Start 30m Candles", "config/ws30m", MQTT_DISC_CMD,
+     "\"step\":1,\"icon\":\"mdi:fire\",\"mode\":\"box\""},
+    {"number", "ws2h", "Warm-Start 2h Candles", "config/ws2h", MQTT_DISC_CMD,
+     "\"step\":1,\"icon\":\"mdi:fire\",\"mode\":\"box\""},
+    {"number", "nightStartHour", "Night Start Hour", "config/nightStartHour", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"h\",\"icon\":\"mdi:clock-start\",\"mode\":\"box\""},
+    {"number", "nightEndHour", "Night End Hour", "config/nightEndHour", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"h\",\"icon\":\"mdi:clock-end\",\"mode\":\"box\""},
+    {"number", "nightSpike5m", "Night 5m Spike Filter", "config/nightSpike5m", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:filter\",\"mode\":\"box\""},
+    {"number", "nightMove5m", "Night 5m Move Threshold", "config/nightMove5m", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:trending-up\",\"mode\":\"box\""},
+    {"number", "nightMove30m", "Night 30m Move Threshold", "config/nightMove30m", MQTT_DISC_CMD,
+     "\"step\":0.01,\"unit_of_measurement\":\"%\",\"icon\":\"mdi:trending-up\",\"mode\":\"box\""},
+    {"number", "nightCd5m", "Night 5m Cooldown", "config/nightCd5m", MQTT_DISC_CMD,
+     "\"step\":1,\"unit_of_measurement\":\"s\",\"icon\":\"mdi:timer\",\"mode\":\"box\""},
+    {"number", "nightAvMin", "Night Auto-Vol Min", "config/nightAvMin", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+    {"number", "nightAvMax", "Night Auto-Vol Max", "config/nightAvMax", MQTT_DISC_CMD,
+     "\"step\":0.01,\"icon\":\"mdi:chart-timeline-variant\",\"mode\":\"box\""},
+};
+
+static constexpr uint16_t kEntityCount = sizeof(kEntities) / sizeof(kEntities[0]);
+
+static const char* PREF_NAMESPACE = "mqttdisc";
+static const char* PREF_KEY_HASHES = "h";
+
+static uint32_t g_hashes[kEntityCount];  // 0 = onbekend / nooit gepubliceerd
+static bool g_hashesLoaded = false;
+static bool g_hashesDirty = false;
+
+static bool g_active = false;
+static uint16_t g_cursor = 0;
+static uint16_t g_published = 0;
+static uint16_t g_skipped = 0;
+static uint16_t g_failed = 0;
+static uint8_t g_retries = 0;  // Opeenvolgende publish-fouten voor de huidige entiteit
+static const uint8_t MAX_PUBLISH_RETRIES = 3;
+
+static char g_deviceId[64];
+static char g_prefix[64];
+static char g_deviceJson[256];
+static char g_topic[128];
+static char g_payload[640];
+
+static uint32_t fnv1a(uint32_t h, const char* s) {
+    while (*s) {
+        h ^= (uint8_t)*s++;
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+static void jsonEscape(const char* input, char* output, size_t outputSize) {
+    if (output == nullptr || outputSize == 0) return;
+    output[0] = '\0';
+    if (input == nullptr) return;
+    size_t out = 0;
+    for (size_t i = 0; input[i] != '\0' && out + 1 < outputSize; ++i) {
+        char c = input[i];
+        if (c == '"' || c == '\\') {
+            if (out + 2 >= outputSize) break;
+            output[out++] = '\\';
+        }
+        output[out++] = c;
+    }
+    output[out] = '\0';
+}
+
+static void loadHashes() {
+    memset(g_hashes, 0, sizeof(g_hashes));
+    Preferences prefs;
+    if (prefs.begin(PREF_NAMESPACE, true)) {
+        // Blob met andere lengte (tabel gewijzigd) → alles als onbekend behandelen
+        if (prefs.getBytesLength(PREF_KEY_HASHES) == sizeof(g_hashes)) {
+            prefs.getBytes(PREF_KEY_HASHES, g_hashes, sizeof(g_hashes));
+        }
+        prefs.end();
+    }
+    g_hashesLoaded = true;
+}
+
+static void saveHashes() {
+    Preferences prefs;
+    if (prefs.begin(PREF_NAMESPACE, false)) {
+        prefs.putBytes(PREF_KEY_HASHES, g_hashes, sizeof(g_hashes));  // Eén NVS-write per ronde
+        prefs.end();
+    }
+    g_hashesDirty = false;
+}
+
+// Bouw topic + payload voor entiteit idx in g_topic/g_payload
+static bool buildEntity(uint16_t idx) {
+    const MqttDiscoveryEntity& e = kEntities[idx];
+    snprintf(g_topic, sizeof(g_topic), "homeassistant/%s/%s_%s/config", e.component, g_deviceId, e.objectId);
+
+    int n = snprintf(g_payload, sizeof(g_payload),
+                     "{\"name\":\"%s\",\"unique_id\":\"%s_%s\",\"state_topic\":\"%s/%s\"",
+                     e.name, g_deviceId, e.objectId, g_prefix, e.stateSuffix);
+    if ((e.flags & MQTT_DISC_CMD) && n > 0 && (size_t)n < sizeof(g_payload)) {
+        n += snprintf(g_payload + n, sizeof(g_payload) - n, ",\"command_topic\":\"%s/%s/set\"", g_prefix, e.stateSuffix);
+    }
+    if ((e.flags & MQTT_DISC_CMD) && strcmp(e.component, "number") == 0 && n > 0 && (size_t)n < sizeof(g_payload)) {
+        // Bereik = validatiebereik van /set; HA laat zo nooit een waarde toe die de device weigert
+        const SettingDesc* desc = settingsSchemaFind(e.objectId, strlen(e.objectId));
+        if (desc != nullptr) {
+            n += snprintf(g_payload + n, sizeof(g_payload) - n, ",\"min\":%g,\"max\":%g",
+                          (double)desc->minVal, (double)desc->maxVal);
+        }
+    }
+    if ((e.flags & MQTT_DISC_JSON_ATTR) && n > 0 && (size_t)n < sizeof(g_payload)) {
+        n += snprintf(g_payload + n, sizeof(g_payload) - n, ",\"json_attributes_topic\":\"%s/%s\"", g_prefix, e.stateSuffix);
+    }
+    if (n > 0 && (size_t)n < sizeof(g_payload)) {
+        n += snprintf(g_payload + n, sizeof(g_payload) - n, "%s%s,%s}",
+                      (e.extra[0] != '\0') ? "," : "", e.extra, g_deviceJson);
+    }
+    // Afgekapte JSON nooit publiceren (HA zou de entiteit weigeren)
+    return n > 0 && (size_t)n < sizeof(g_payload);
+}
+
+static void finishRound() {
+    g_active = false;
+    if (g_hashesDirty) {
+        saveHashes();
+    }
+#if !DEBUG_BUTTON_ONLY
+    Serial.printf("[MQTT] Discovery klaar: %u gepubliceerd, %u ongewijzigd, %u mislukt (%u entiteiten)\n",
+                  (unsigned)g_published, (unsigned)g_skipped, (unsigned)g_failed, (unsigned)kEntityCount);
+#endif
+}
+
+}  // namespace
+
+void mqttDiscoveryStart(const char* deviceId, const char* mqttPrefix, const char* deviceName, const char* deviceModel) {
+    if (!g_hashesLoaded) {
+        loadHashes();
+    }
+    strncpy(g_deviceId, deviceId ? deviceId : "", sizeof(g_deviceId) - 1);
+    g_deviceId[sizeof(g_deviceId) - 1] = '\0';
+    strncpy(g_prefix, mqttPrefix ? mqttPrefix : "", sizeof(g_prefix) - 1);
+    g_prefix[sizeof(g_prefix) - 1] = '\0';
+
+    char escapedName[96];
+    char escapedModel[96];
+    jsonEscape(deviceName, escapedName, sizeof(escapedName));
+    jsonEscape(deviceModel, escapedModel, sizeof(escapedModel));
+    snprintf(g_deviceJson, sizeof(g_deviceJson),
+             "\"device\":{\"identifiers\":[\"%s\"],\"name\":\"%s\",\"manufacturer\":\"JanP\",\"model\":\"%s\"}",
+             g_deviceId, escapedName, escapedModel);
+
+    g_cursor = 0;
+    g_published = 0;
+    g_skipped = 0;
+    g_failed = 0;
+    g_retries = 0;
+    g_active = true;
+}
+
+bool mqttDiscoveryStep(MqttDiscoveryPublishFn publishFn) {
+    if (!g_active || publishFn == nullptr) {
+        return g_active;
+    }
+    if (g_cursor >= kEntityCount) {
+        finishRound();
+        return false;
+    }
+
+    const uint16_t idx = g_cursor;
+    if (!buildEntity(idx)) {
+        g_failed++;
+        g_cursor++;
+        return true;
+    }
+    uint32_t h = fnv1a(2166136261UL, g_topic);
+    h = fnv1a(h, g_payload);
+    if (h == 0) h = 1;  // 0 is gereserveerd voor "onbekend"
+
+    if (g_hashes[idx] == h) {
+        g_skipped++;
+        g_cursor++;
+        return true;
+    }
+    if (!publishFn(g_topic, g_payload, true)) {
+        // Volgende slice opnieuw proberen; na MAX_PUBLISH_RETRIES doorschuiven (bijv. payload > client buffer)
+        if (++g_retries >= MAX_PUBLISH_RETRIES) {
+            g_retries = 0;
+            g_failed++;
+            g_cursor++;
+        }
+        return true;
+    }
+    g_retries = 0;
+    g_hashes[idx] = h;
+    g_hashesDirty = true;
+    g_published++;
+    g_cursor++;
+    return true;
+}
+
+void mqttDiscoveryInvalidate() {
+    memset(g_hashes, 0, sizeof(g_hashes));
+    g_hashesLoaded = true;
+    g_hashesDirty = true;
+}
+
+bool mqttDiscoveryActive() {
+    return g_active;
+}
+
+uint16_t mqttDiscoveryEntityCount() {
+    return kEntityCount;
+}
@@ -0,0 +1,52 @@
+#ifndef MQTT_DISCOVERY_H
+#define MQTT_DISCOVERY_H
+
+#include <Arduino.h>
+
+/**
+ * MqttDiscovery: incrementele Home Assistant discovery
+ *
+ * Entiteiten staan in een constexpr tabel (MqttDiscovery.cpp). Na start() serialiseert step()
+ * per aanroep één entiteit en vergelijkt een FNV-1a hash van topic+payload met de hash van de
+ * laatst succesvol (retained) gepubliceerde versie (persistent in NVS). Ongewijzigde entiteiten
+ * worden overgeslagen; reconnect kost zo alleen werk voor wat echt veranderde.
+ *
+ * Als Home Assistant herstart (birth message "online" op homeassistant/status) of de broker zijn
+ * retained state kwijt kan zijn, roep invalidate() aan: de volgende ronde publiceert alles.
+ */
+
+// Entiteit-flags
+#define MQTT_DISC_CMD 0x01        // command_topic = <prefix>/<stateSuffix>/set
+#define MQTT_DISC_JSON_ATTR 0x02  // json_attributes_topic = state_topic
+
+struct MqttDiscoveryEntity {
+    const char* component;    // HA component: number/sensor/select/switch/text/button
+    const char* objectId;     // unique_id suffix en topic-deel
+    const char* name;         // Weergavenaam in HA
+    const char* stateSuffix;  // state_topic relatief aan MQTT prefix
+    uint8_t flags;
+    const char* extra;        // Overige JSON-velden (zonder accolades), of ""
+};
+
+// Publish-callback: retourneert true bij succes
+typedef bool (*MqttDiscoveryPublishFn)(const char* topic, const char* payload, bool retained);
+
+/**
+ * Start een discovery-ronde (vanaf entiteit 0). Context wordt gekopieerd.
+ * Hashes worden bij de eerste aanroep eenmalig uit NVS geladen.
+ */
+void mqttDiscoveryStart(const char* deviceId, const char* mqttPrefix, const char* deviceName, const char* deviceModel);
+
+/**
+ * Verwerk maximaal één entiteit (serialiseren + evt. publish).
+ * @return true zolang de ronde nog niet klaar is
+ */
+bool mqttDiscoveryStep(MqttDiscoveryPublishFn publishFn);
+
+// Vergeet alle opgeslagen hashes (volgende ronde publiceert alle entiteiten)
+void mqttDiscoveryInvalidate();
+
+bool mqttDiscoveryActive();
+uint16_t mqttDiscoveryEntityCount();
+
+#endif // MQTT_DISCOVERY_H
@@ -0,0 +1,358 @@
+#include "MqttQueue.h"
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Include alleen DEBUG_BUTTON_ONLY, niet de hele platform_config.h (voorkomt PINS includes)
+#ifndef DEBUG_BUTTON_ONLY
+#define DEBUG_BUTTON_ONLY 1
+#endif
+
+namespace {
+
+// Slot-header; de payload (kLanePayloadLen van de lane) volgt direct na de header
+struct MqttQueueSlot {
+    char topic[MQTT_QUEUE_TOPIC_LEN];
+    uint32_t enqueuedMs;
+    uint16_t len;       // Payload-lengte (binair mag NUL bevatten)
+    uint32_t topicHash; // FNV-1a van topic: coalesce-scan vergelijkt eerst hash, strcmp alleen bij match
+    uint16_t gen;       // Nieuw per insert/coalesce; drain popt alleen als gen ongewijzigd is
+    bool retained;
+};
+
+struct MqttQueueLane {
+    uint8_t* slots;
+    size_t stride;          // sizeof(MqttQueueSlot) + payload-lengte van de lane
+    uint16_t payloadLen;
+    uint16_t capacity;
+    uint16_t head;
+    uint16_t count;
+    uint16_t nextGen;
+    MqttQueueClassStats stats;
+};
+
+// Lane-capaciteit per klasse: [0] = met PSRAM, [1] = zonder PSRAM (DRAM is schaars)
+// Settings-republish vult de lane incrementeel (serviceMqttSettings in de sketch) en hoeft er dus
+// niet in één keer in te passen; een grotere lane betekent alleen minder slices per ronde.
+// Values: één slot per status-topic (coalesce per topic); publishMqttValues biedt er ~12 tegelijk aan
+// (prijs, 6 returns, 3 trends, timestamp, ip), dus daar past een hele ronde in.
+// Diag: diag/tasks + diag/sampler, eens per minuut.
+static const uint16_t kLaneCapacity[2][MQTT_CLASS_COUNT] = {
+    {32, 16, 24, 2},
+    {3, 12, 6, 2},
+};
+// Payload per slot: kleine values, grote diag-objecten
+static const uint16_t kLanePayloadLen[MQTT_CLASS_COUNT] = {
+    MQTT_QUEUE_PAYLOAD_LEN,
+    MQTT_QUEUE_VALUES_PAYLOAD_LEN,
+    MQTT_QUEUE_PAYLOAD_LEN,
+    MQTT_QUEUE_DIAG_PAYLOAD_LEN,
+};
+
+static MqttQueueLane g_lanes[MQTT_CLASS_COUNT];
+// Mutex i.p.v. critical section: coalesce-scan + slot-memcpy mogen niet met interrupts uit draaien
+static SemaphoreHandle_t g_queueMutex = nullptr;
+static volatile bool g_ready = false;
+
+static inline void queueLock() {
+    xSemaphoreTake(g_queueMutex, portMAX_DELAY);
+}
+
+static inline void queueUnlock() {
+    xSemaphoreGive(g_queueMutex);
+}
+
+static uint32_t topicHashOf(const char* topic) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < MQTT_QUEUE_TOPIC_LEN - 1 && topic[i] != '\0'; i++) {
+        h = (h ^ (uint8_t)topic[i]) * 16777619u;
+    }
+    return h;
+}
+
+static inline uint16_t laneIndex(const MqttQueueLane& lane, uint16_t offset) {
+    return (uint16_t)((lane.head + offset) % lane.capacity);
+}
+
+static inline MqttQueueSlot& slotAt(const MqttQueueLane& lane, uint16_t idx) {
+    return *reinterpret_cast<MqttQueueSlot*>(lane.slots + (size_t)idx * lane.stride);
+}
+
+static inline char* slotPayload(MqttQueueSlot& s) {
+    return reinterpret_cast<char*>(&s + 1);
+}
+
+// Payload + lengte in het slot; afsluitende NUL zodat tekst-payloads ook als C-string leesbaar blijven
+static void storePayload(MqttQueueSlot& s, const MqttQueueLane& lane, const uint8_t* data, size_t len) {
+    char* dst = slotPayload(s);
+    if (data != nullptr && len > 0) {
+        memcpy(dst, data, len);
+    }
+    dst[len] = '\0';
+    s.len = (uint16_t)len;
+}
+
+static void copyBounded(char* dst, size_t dstSize, const char* src) {
+    if (src == nullptr) {
+        dst[0] = '\0';
+        return;
+    }
+    strncpy(dst, src, dstSize - 1);
+    dst[dstSize - 1] = '\0';
+}
+
+static void logQueueFullRateLimited(MqttTopicClass cls, const char* topic) {
+#if !DEBUG_BUTTON_ONLY
+    static unsigned long lastWarnMs = 0;
+    unsigned long now = millis();
+    if (now - lastWarnMs > 5000) {  // Max 1 warning per 5 seconden
+        Serial.printf("[MQTT Queue] Lane %s vol, bericht verloren: %s\n", mqttQueueClassName(cls), topic);
+        lastWarnMs = now;
+    }
+#else
+    (void)cls;
+    (void)topic;
+#endif
+}
+
+}  // namespace
+
+bool mqttQueueBegin(bool usePsram) {
+    if (g_ready) {
+        return true;
+    }
+    g_queueMutex = xSemaphoreCreateMutex();
+    if (g_queueMutex == nullptr) {
+        Serial.println(F("[MQTT Queue] mutex allocatie mislukt"));
+        return false;
+    }
+    const uint8_t profile = usePsram ? 0 : 1;
+    const uint32_t caps = usePsram ? (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT) : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    size_t totalBytes = 0;
+    bool ok = true;
+
+    for (uint8_t c = 0; c < MQTT_CLASS_COUNT; c++) {
+        MqttQueueLane& lane = g_lanes[c];
+        memset(&lane, 0, sizeof(lane));
+        const uint16_t cap = kLaneCapacity[profile][c];
+        lane.payloadLen = kLanePayloadLen[c];
+        // Stride op 4 bytes: header-velden van het volgende slot blijven uitgelijnd
+        lane.stride = (sizeof(MqttQueueSlot) + lane.payloadLen + 3u) & ~(size_t)3u;
+        const size_t bytes = (size_t)cap * lane.stride;
+        lane.slots = (uint8_t*)heap_caps_malloc(bytes, caps);
+        if (lane.slots == nullptr && usePsram) {
+            // PSRAM vol/ontbreekt: val terug op compact DRAM-profiel voor deze lane
+            lane.slots = (uint8_t*)heap_caps_malloc((size_t)kLaneCapacity[1][c] * lane.stride,
+                                                    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            lane.capacity = (lane.slots != nullptr) ? kLaneCapacity[1][c] : 0;
+        } else {
+            lane.capacity = (lane.slots != nullptr) ? cap : 0;
+        }
+        if (lane.slots == nullptr) {
+            ok = false;
+        }
+        lane.stats.capacity = lane.capacity;
+        totalBytes += (size_t)lane.capacity * lane.stride;
+    }
+
+    Serial.printf("[MQTT Queue] lanes event=%u values=%u settings=%u diag=%u (%u bytes, %s)\n",
+                  (unsigned)g_lanes[MQTT_CLASS_EVENT].capacity,
+                  (unsigned)g_lanes[MQTT_CLASS_VALUES].capacity,
+                  (unsigned)g_lanes[MQTT_CLASS_SETTINGS].capacity,
+                  (unsigned)g_lanes[MQTT_CLASS_DIAG].capacity,
+                  (unsigned)totalBytes,
+                  usePsram ? "PSRAM" : "DRAM");
+    g_ready = true;
+    return ok;
+}
+
+static bool enqueueImpl(MqttTopicClass cls, const char* topic, const uint8_t* payload, size_t len,
+                        bool retained, bool allowCoalesce) {
+    if (topic == nullptr || cls >= MQTT_CLASS_COUNT) {
+        return false;
+    }
+    MqttQueueLane& lane = g_lanes[cls];
+    if (!g_ready) {
+        lane.stats.dropped++;  // Vóór begin(): geen mutex, alleen de teller (best effort)
+        logQueueFullRateLimited(cls, topic);
+        return false;
+    }
+    const uint32_t nowMs = millis();
+    const uint32_t hash = topicHashOf(topic);
+    // Retained, values en diag: zelfde topic al in de lane → alleen payload vervangen (nieuwste wint)
+    const bool coalesce = allowCoalesce && (retained || cls == MQTT_CLASS_VALUES || cls == MQTT_CLASS_DIAG);
+    bool stored = false;
+    bool dropped = false;
+
+    queueLock();
+    do {
+        if (lane.capacity == 0 || len >= lane.payloadLen) {
+            lane.stats.dropped++;
+            dropped = true;
+            break;
+        }
+
+        if (coalesce) {
+            for (uint16_t i = 0; i < lane.count; i++) {
+                MqttQueueSlot& s = slotAt(lane, laneIndex(lane, i));
+                if (s.topicHash == hash && s.retained == retained &&
+                    strncmp(s.topic, topic, MQTT_QUEUE_TOPIC_LEN) == 0) {
+                    storePayload(s, lane, payload, len);
+                    s.gen = ++lane.nextGen;
+                    lane.stats.coalesced++;
+                    stored = true;
+                    break;
+                }
+            }
+            if (stored) {
+                break;
+            }
+        }
+
+        if (lane.count >= lane.capacity) {
+            if (cls != MQTT_CLASS_SETTINGS) {
+                // Verdring oudste bericht van dezelfde klasse; nooit een andere lane
+                lane.head = laneIndex(lane, 1);
+                lane.count--;
+                lane.stats.dropped++;
+            } else {
+                lane.stats.dropped++;
+                dropped = true;
+                break;
+            }
+        }
+
+        MqttQueueSlot& s = slotAt(lane, laneIndex(lane, lane.count));
+        copyBounded(s.topic, sizeof(s.topic), topic);
+        storePayload(s, lane, payload, len);
+        s.topicHash = hash;
+        s.retained = retained;
+        s.enqueuedMs = nowMs;
+        s.gen = ++lane.nextGen;
+        lane.count++;
+        lane.stats.enqueued++;
+        if (lane.count > lane.stats.highWater) {
+            lane.stats.highWater = lane.count;
+        }
+        stored = true;
+    } while (0);
+    queueUnlock();
+
+    if (dropped) {
+        logQueueFullRateLimited(cls, topic);
+    }
+    return stored;
+}
+
+bool mqttQueueEnqueue(MqttTopicClass cls, const char* topic, const char* payload, bool retained) {
+    const size_t len = (payload != nullptr) ? strnlen(payload, MQTT_QUEUE_DIAG_PAYLOAD_LEN) : 0;
+    return enqueueImpl(cls, topic, (const uint8_t*)payload, len, retained, true);
+}
+
+bool mqttQueueEnqueueBinary(MqttTopicClass cls, const char* topic, const uint8_t* data, size_t len, bool retained) {
+    // Nooit samenvoegen: binaire frames zijn delta's, elk frame moet aankomen
+    return enqueueImpl(cls, topic, data, len, retained, false);
+}
+
+uint16_t mqttQueueDrain(MqttQueuePublishFn publishFn, uint32_t budgetMs, uint16_t maxMsgs) {
+    if (publishFn == nullptr || !g_ready) {
+        return 0;
+    }
+    // Lokale kopie: publish gebeurt buiten de lock (netwerk-I/O)
+    static char topicCopy[MQTT_QUEUE_TOPIC_LEN];
+    static char payloadCopy[MQTT_QUEUE_DIAG_PAYLOAD_LEN > MQTT_QUEUE_PAYLOAD_LEN ? MQTT_QUEUE_DIAG_PAYLOAD_LEN
+                                                                                 : MQTT_QUEUE_PAYLOAD_LEN];
+    const uint32_t startMs = millis();
+    uint16_t published = 0;
+
+    while (published < maxMsgs && (millis() - startMs) < budgetMs) {
+        int8_t cls = -1;
+        uint16_t slotIdx = 0;
+        uint16_t gen = 0;
+        uint32_t enqMs = 0;
+        bool retained = false;
+        size_t len = 0;
+
+        queueLock();
+        for (uint8_t c = 0; c < MQTT_CLASS_COUNT; c++) {
+            MqttQueueLane& lane = g_lanes[c];
+            if (lane.count > 0) {
+                MqttQueueSlot& s = slotAt(lane, lane.head);
+                memcpy(topicCopy, s.topic, sizeof(topicCopy));
+                memcpy(payloadCopy, slotPayload(s), lane.payloadLen);
+                len = s.len;
+                retained = s.retained;
+                gen = s.gen;
+                enqMs = s.enqueuedMs;
+                slotIdx = lane.head;
+                cls = (int8_t)c;
+                break;
+            }
+        }
+        queueUnlock();
+
+        if (cls < 0) {
+            break;  // Alle lanes leeg
+        }
+        if (!publishFn(topicCopy, (const uint8_t*)payloadCopy, len, retained)) {
+            break;  // Publish faalt (verbinding/buffer): later opnieuw
+        }
+
+        const uint32_t latency = millis() - enqMs;
+        queueLock();
+        MqttQueueLane& lane = g_lanes[cls];
+        // Alleen poppen (en tellen) als het slot tijdens publish niet verdrongen of samengevoegd is:
+        // een verdrongen slot staat al in dropped, een samengevoegd slot wordt met nieuwe payload nog gepubliceerd
+        if (lane.count > 0 && lane.head == slotIdx && slotAt(lane, slotIdx).gen == gen) {
+            lane.head = laneIndex(lane, 1);
+            lane.count--;
+            lane.stats.published++;
+            lane.stats.latencySumMs += latency;
+            if (latency > lane.stats.latencyMaxMs) {
+                lane.stats.latencyMaxMs = latency;
+            }
+        }
+        queueUnlock();
+        published++;
+    }
+    return published;
+}
+
+uint16_t mqttQueuePendingCount() {
+    uint16_t total = 0;
+    if (!g_ready) {
+        return 0;
+    }
+    queueLock();
+    for (uint8_t c = 0; c < MQTT_CLASS_COUNT; c++) {
+        total += g_lanes[c].count;
+    }
+    queueUnlock();
+    return total;
+}
+
+void mqttQueueGetStats(MqttTopicClass cls, MqttQueueClassStats& out) {
+    if (cls >= MQTT_CLASS_COUNT) {
+        memset(&out, 0, sizeof(out));
+        return;
+    }
+    if (!g_ready) {
+        out = g_lanes[cls].stats;
+        out.depth = 0;
+        return;
+    }
+    queueLock();
+    out = g_lanes[cls].stats;
+    out.depth = g_lanes[cls].count;
+    queueUnlock();
+}
+
+const char* mqttQueueClassName(MqttTopicClass cls) {
+    switch (cls) {
+        case MQTT_CLASS_EVENT: return "event";
+        case MQTT_CLASS_VALUES: return "values";
+        case MQTT_CLASS_SETTINGS: return "settings";
+        case MQTT_CLASS_DIAG: return "diag";
+        default: return "?";
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef MQTT_QUEUE_H
+#define MQTT_QUEUE_H
+
+#include <Arduino.h>
+
+/**
+ * MqttQueue: uitgaande MQTT-berichten met prioriteitslanes
+ *
+ * Eén ringbuffer per topic-klasse, capaciteit bepaald bij begin() (groot in PSRAM, klein in DRAM).
+ * Een volle lane verdringt nooit berichten uit een andere lane: een settings-republish kan
+ * alerts/anchor events dus niet meer uit de queue duwen.
+ * Retained berichten (settings) en status-values op hetzelfde topic worden samengevoegd: alleen de
+ * nieuwste payload blijft staan. HA-discovery loopt niet via de queue (src/MqttDiscovery publiceert
+ * zelf één entiteit per slice).
+ *
+ * Threading: enqueue mag vanuit elke task; drain alleen vanuit de MQTT-context (loop(), die ook
+ * mqttClient.loop() doet), omdat PubSubClient niet thread-safe is. Andere tasks (apiTask) roepen
+ * mqttClient.publish() dus nooit zelf aan, ook niet als de verbinding op dat moment staat.
+ */
+
+// Topic-klassen in prioriteitsvolgorde (laagste waarde = eerst gepubliceerd)
+enum MqttTopicClass : uint8_t {
+    MQTT_CLASS_EVENT = 0,      // Alerts / anchor events: nooit gedropt achter bulk-verkeer
+    MQTT_CLASS_VALUES = 1,     // values/* (prijs, returns, trends, ip): vervangbaar, per topic samengevoegd
+    MQTT_CLASS_SETTINGS = 2,   // config/* republish (retained)
+    MQTT_CLASS_DIAG = 3,       // diag/* (tasks, sampler): grote JSON-objecten, laagste prioriteit
+    MQTT_CLASS_COUNT = 4
+};
+
+#define MQTT_QUEUE_TOPIC_LEN 128
+#define MQTT_QUEUE_PAYLOAD_LEN 256
+// Values-lane: getallen, trendlabels en ip-adres (< 32 bytes); kleine slots, want er staan er ~12 tegelijk
+#define MQTT_QUEUE_VALUES_PAYLOAD_LEN 64
+// Diag-lane: diag/tasks en diag/sampler zijn JSON-objecten tot ~400 bytes (PubSubClient-buffer = 768)
+#define MQTT_QUEUE_DIAG_PAYLOAD_LEN 512
+
+struct MqttQueueClassStats {
+    uint16_t capacity;
+    uint16_t depth;
+    uint16_t highWater;
+    uint32_t enqueued;
+    uint32_t published;
+    uint32_t dropped;
+    uint32_t coalesced;
+    uint32_t latencySumMs;   // Som enqueue→publish (voor gemiddelde: latencySumMs / published)
+    uint32_t latencyMaxMs;
+};
+
+// Publish-callback: retourneert true bij succes (bericht wordt dan uit de lane verwijderd).
+// payload is len bytes (binair mogelijk) en staat voor tekstberichten ook NUL-afgesloten.
+typedef bool (*MqttQueuePublishFn)(const char* topic, const uint8_t* payload, size_t len, bool retained);
+
+/**
+ * Alloceer lanes. Met PSRAM ruim, anders compact in DRAM.
+ * @return false als allocatie faalde (enqueue dropt dan alles en telt in dropped)
+ */
+bool mqttQueueBegin(bool usePsram);
+
+/**
+ * Zet bericht in de lane van zijn klasse. Een payload langer dan de slot van de lane wordt gedropt
+ * (geteld in dropped), niet afgekapt: een half JSON-object is voor een subscriber waardeloos. Bij volle lane wordt het oudste bericht van dezelfde
+ * klasse verdrongen (events/values: nieuwste info wint) of, voor retained bulk, het nieuwe bericht
+ * gedropt als er geen topic om samen te voegen is.
+ */
+bool mqttQueueEnqueue(MqttTopicClass cls, const char* topic, const char* payload, bool retained);
+
+/**
+ * Binaire variant (values/frame telemetrie): len bytes, mag NUL bevatten. Wordt nooit samengevoegd,
+ * want een delta-frame is alleen bruikbaar na zijn voorganger. Drop/verdringing telt in dropped;
+ * de aanroeper forceert dan een keyframe.
+ */
+bool mqttQueueEnqueueBinary(MqttTopicClass cls, const char* topic, const uint8_t* data, size_t len, bool retained);
+
+/**
+ * Publiceer berichten in prioriteitsvolgorde tot budgetMs of maxMsgs bereikt is, of een publish faalt.
+ * @return aantal gepubliceerde berichten
+ */
+uint16_t mqttQueueDrain(MqttQueuePublishFn publishFn, uint32_t budgetMs, uint16_t maxMsgs);
+
+uint16_t mqttQueuePendingCount();
+void mqttQueueGetStats(MqttTopicClass cls, MqttQueueClassStats& out);
+const char* mqttQueueClassName(MqttTopicClass cls);
+
+#endif // MQTT_QUEUE_H
@@ -0,0 +1,137 @@
+#include "MqttTelemetry.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace {
+
+// Gekwantiseerde velden: vergelijkingsbasis voor delta-frames (zelfde resolutie als wire-formaat,
+// zodat float-ruis onder de 0.01 geen veld-wijziging triggert).
+struct QuantizedFrame {
+    int32_t priceCents;
+    float price;
+    int16_t ret[6];
+    uint8_t trend;
+    uint8_t volatility;
+    uint8_t regime;
+};
+
+static QuantizedFrame g_sent;      // Laatst bevestigd verzonden frame (delta-basis)
+static QuantizedFrame g_pending;   // Laatst gebouwd frame (wacht op commit)
+static bool g_hasSent = false;
+static bool g_forceKeyframe = true;
+static bool g_pendingIsKeyframe = false;
+static uint16_t g_seq = 0;
+static uint16_t g_framesSinceKeyframe = 0;
+
+static int16_t quantizePct(float pct) {
+    if (isnan(pct)) {
+        return 0;
+    }
+    float c = roundf(pct * 100.0f);
+    if (c > 32767.0f) c = 32767.0f;
+    if (c < -32768.0f) c = -32768.0f;
+    return static_cast<int16_t>(c);
+}
+
+static uint8_t packTrend(uint8_t t2h, uint8_t t1d, uint8_t t7d) {
+    return static_cast<uint8_t>((t2h & 0x03) | ((t1d & 0x03) << 2) | ((t7d & 0x03) << 4));
+}
+
+static void quantize(const MqttTelemetryValues& v, QuantizedFrame& q) {
+    q.price = v.price;
+    q.priceCents = static_cast<int32_t>(lroundf(v.price * 100.0f));
+    q.ret[0] = quantizePct(v.ret1m);
+    q.ret[1] = quantizePct(v.ret5m);
+    q.ret[2] = quantizePct(v.ret30m);
+    q.ret[3] = quantizePct(v.ret2h);
+    q.ret[4] = quantizePct(v.ret1d);
+    q.ret[5] = quantizePct(v.ret7d);
+    q.trend = packTrend(v.trend2h, v.trend1d, v.trend7d);
+    q.volatility = v.volatility;
+    q.regime = v.regime;
+}
+
+static uint16_t changedMask(const QuantizedFrame& cur, const QuantizedFrame& prev) {
+    uint16_t mask = 0;
+    if (cur.priceCents != prev.priceCents) mask |= (1u << MQTT_TF_PRICE);
+    for (uint8_t i = 0; i < 6; i++) {
+        if (cur.ret[i] != prev.ret[i]) mask |= (1u << (MQTT_TF_RET_1M + i));
+    }
+    if (cur.trend != prev.trend) mask |= (1u << MQTT_TF_TREND);
+    if (cur.volatility != prev.volatility) mask |= (1u << MQTT_TF_VOLATILITY);
+    if (cur.regime != prev.regime) mask |= (1u << MQTT_TF_REGIME);
+    return mask;
+}
+
+static inline void putU16(uint8_t* p, uint16_t v) {
+    p[0] = static_cast<uint8_t>(v & 0xFF);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+}  // namespace
+
+size_t mqttTelemetryBuildFrame(const MqttTelemetryValues& v,
+                               uint8_t* out,
+                               size_t outCap,
+                               uint16_t keyframeInterval) {
+    if (out == nullptr || outCap < MQTT_TELEMETRY_FRAME_MAX_LEN) {
+        return 0;
+    }
+
+    QuantizedFrame q;
+    quantize(v, q);
+
+    const bool keyframe = g_forceKeyframe || !g_hasSent ||
+                          (keyframeInterval > 0 && g_framesSinceKeyframe >= keyframeInterval);
+    const uint16_t allFields = static_cast<uint16_t>((1u << MQTT_TF_COUNT) - 1u);
+    const uint16_t mask = keyframe ? allFields : changedMask(q, g_sent);
+    if (mask == 0) {
+        return 0;
+    }
+
+    size_t n = 0;
+    out[n++] = 'C';
+    out[n++] = 'A';
+    out[n++] = MQTT_TELEMETRY_FRAME_VERSION;
+    out[n++] = keyframe ? 0x01 : 0x00;
+    putU16(out + n, g_seq);
+    n += 2;
+    putU16(out + n, mask);
+    n += 2;
+
+    if (mask & (1u << MQTT_TF_PRICE)) {
+        // ESP32 is little-endian: float32 direct kopiëren
+        memcpy(out + n, &q.price, sizeof(float));
+        n += sizeof(float);
+    }
+    for (uint8_t i = 0; i < 6; i++) {
+        if (mask & (1u << (MQTT_TF_RET_1M + i))) {
+            putU16(out + n, static_cast<uint16_t>(q.ret[i]));
+            n += 2;
+        }
+    }
+    if (mask & (1u << MQTT_TF_TREND)) out[n++] = q.trend;
+    if (mask & (1u << MQTT_TF_VOLATILITY)) out[n++] = q.volatility;
+    if (mask & (1u << MQTT_TF_REGIME)) out[n++] = q.regime;
+
+    g_pending = q;
+    g_pendingIsKeyframe = keyframe;
+    return n;
+}
+
+void mqttTelemetryCommitFrame() {
+    g_sent = g_pending;
+    g_hasSent = true;
+    g_seq++;
+    if (g_pendingIsKeyframe) {
+        g_forceKeyframe = false;
+        g_framesSinceKeyframe = 0;
+    } else if (g_framesSinceKeyframe < 0xFFFF) {
+        g_framesSinceKeyframe++;
+    }
+}
+
+void mqttTelemetryForceKeyframe() {
+    g_forceKeyframe = true;
+}
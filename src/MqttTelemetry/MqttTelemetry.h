@@ -0,0 +1,82 @@
+#ifndef MQTT_TELEMETRY_H
+#define MQTT_TELEMETRY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Compacte binaire MQTT-telemetrie: één frame per publish-interval i.p.v. één topic per waarde.
+// Topic: <prefix>/values/frame (niet retained). Alle multi-byte velden little-endian.
+//
+// Frame-layout (versie 1):
+//   [0]    magic 'C' (0x43)
+//   [1]    magic 'A' (0x41)
+//   [2]    versie (MQTT_TELEMETRY_FRAME_VERSION)
+//   [3]    flags: bit0 = keyframe (alle velden aanwezig)
+//   [4..5] sequence (uint16, wrapt)
+//   [6..7] field mask (uint16): bit n gezet = veld n volgt, in oplopende bitvolgorde
+//   [8..]  velden:
+//     bit 0  price       float32 (EUR)
+//     bit 1  ret_1m      int16, centi-procent (0.01% resolutie, gelijk aan tekst-topics "%.2f")
+//     bit 2  ret_5m      int16, centi-procent
+//     bit 3  ret_30m     int16, centi-procent
+//     bit 4  ret_2h      int16, centi-procent
+//     bit 5  ret_1d      int16, centi-procent
+//     bit 6  ret_7d      int16, centi-procent
+//     bit 7  trend       uint8: bits 0-1 = 2h, 2-3 = 1d, 4-5 = 7d (0 = UP, 1 = DOWN, 2 = SIDEWAYS)
+//     bit 8  volatility  uint8 (0 = LOW, 1 = MEDIUM, 2 = HIGH)
+//     bit 9  regime      uint8 (0 = SLAP, 1 = GELADEN, 2 = ENERGIEK)
+//
+// Delta-frames bevatten alleen velden waarvan de gekwantiseerde waarde wijzigde t.o.v. het vorige
+// verzonden frame. Ontvanger houdt laatste waarde per veld vast; een keyframe overschrijft alles.
+// Grootte: keyframe 27 bytes, delta typisch 8-14 bytes (vs ~11 tekst-publishes per interval).
+
+#define MQTT_TELEMETRY_FRAME_VERSION 1
+#define MQTT_TELEMETRY_FRAME_MAX_LEN 32
+
+enum MqttTelemetryField : uint8_t {
+    MQTT_TF_PRICE = 0,
+    MQTT_TF_RET_1M = 1,
+    MQTT_TF_RET_5M = 2,
+    MQTT_TF_RET_30M = 3,
+    MQTT_TF_RET_2H = 4,
+    MQTT_TF_RET_1D = 5,
+    MQTT_TF_RET_7D = 6,
+    MQTT_TF_TREND = 7,
+    MQTT_TF_VOLATILITY = 8,
+    MQTT_TF_REGIME = 9,
+    MQTT_TF_COUNT = 10,
+};
+
+struct MqttTelemetryValues {
+    float price = 0.0f;
+    float ret1m = 0.0f;
+    float ret5m = 0.0f;
+    float ret30m = 0.0f;
+    float ret2h = 0.0f;
+    float ret1d = 0.0f;
+    float ret7d = 0.0f;
+    uint8_t trend2h = 2;     // TrendState (TREND_SIDEWAYS)
+    uint8_t trend1d = 2;
+    uint8_t trend7d = 2;
+    uint8_t volatility = 1;  // VolatilityState (VOLATILITY_MEDIUM)
+    uint8_t regime = 1;      // RegimeKind (REGIME_GELADEN)
+};
+
+// Bouwt het volgende frame in out (min. MQTT_TELEMETRY_FRAME_MAX_LEN bytes).
+// Keyframe wanneer geforceerd, bij eerste frame of na keyframeInterval delta-frames.
+// Retourneert framelengte, of 0 als een delta-frame geen gewijzigde velden zou bevatten
+// (niets publiceren; sequence en delta-basis blijven dan ongewijzigd).
+size_t mqttTelemetryBuildFrame(const MqttTelemetryValues& v,
+                               uint8_t* out,
+                               size_t outCap,
+                               uint16_t keyframeInterval);
+
+// Bevestig dat het laatst gebouwde frame in de MQTT-queue staat (values-lane). Zonder commit blijft
+// de delta-basis staan, zodat een geweigerd frame bij het volgende interval opnieuw alle wijzigingen
+// bevat. Gaat een frame daarna alsnog verloren (verdrongen/gedropt), dan forceert de aanroeper een keyframe.
+void mqttTelemetryCommitFrame();
+
+// Volgende frame wordt een keyframe (aanroepen na (re)connect, zodat nieuwe subscribers syncen).
+void mqttTelemetryForceKeyframe();
+
+#endif // MQTT_TELEMETRY_H
@@ -25,7 +25,9 @@
 // DataSource enum - gebruikt voor tracking waar data vandaan komt
 enum DataSource {
     SOURCE_BINANCE,  // Data van Binance historische klines
-    SOURCE_LIVE      // Data van live API calls
+    SOURCE_LIVE,     // Data van live API calls
+    SOURCE_BACKFILL, // Gemiste sampler-seconde, achteraf gevuld met de WS-close van die seconde
+    SOURCE_CARRY     // Gemiste sampler-seconde zonder WS-close: vorige prijs doorgetrokken
 };
 
 // Forward declarations voor globale arrays (parallel implementatie - stap 4.2.5)
@@ -88,7 +90,8 @@ public:
     
     // Fase 4.2.3: addPriceToSecondArray() toegevoegd
     // Fase 4.2.5: Gebruikt nu PriceData state variabelen (parallel, globale arrays blijven bestaan)
-    void addPriceToSecondArray(float price) {
+    // src: SOURCE_LIVE voor het actuele slot; SOURCE_BACKFILL/SOURCE_CARRY voor aangevulde slots (PriceSampler)
+    void addPriceToSecondArray(float price, DataSource src = SOURCE_LIVE) {
         // Validate input
         if (!ApiClient::isValidPrice(price))
         {
@@ -112,7 +115,7 @@ public:
         extern DataSource secondPricesSource[];
         
         secondPrices[this->secondIndex] = price;
-        secondPricesSource[this->secondIndex] = SOURCE_LIVE;  // Mark as live data
+        secondPricesSource[this->secondIndex] = src;
         
         // Geconsolideerde index update: check en update in één keer
         uint8_t oldSecondIndex = this->secondIndex;
@@ -147,7 +150,7 @@ public:
         }
         
         fiveMinutePrices[this->fiveMinuteIndex] = price;
-        fiveMinutePricesSource[this->fiveMinuteIndex] = SOURCE_LIVE;  // Mark as live data
+        fiveMinutePricesSource[this->fiveMinuteIndex] = src;
         
         // Geconsolideerde index update: check en update in één keer
         uint16_t oldFiveMinuteIndex = this->fiveMinuteIndex;
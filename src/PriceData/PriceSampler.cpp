@@ -0,0 +1,205 @@
+#include "PriceSampler.h"
+#include <freertos/FreeRTOS.h>
+#include <stdio.h>
+
+static const uint16_t kJitterUpperMs[PRICE_SAMPLER_JITTER_BUCKETS - 1] = {2, 5, 10, 20, 50, 100, 250};
+
+struct WsCloseEntry {
+    uint32_t bucket;
+    float close;
+};
+
+static WsCloseEntry s_wsRing[PRICE_SAMPLER_WS_RING];
+static portMUX_TYPE s_wsRingMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Sampler-state: alleen de sampler-task schrijft (onder dataMutex)
+static bool s_started = false;
+static uint32_t s_lastSlot = 0;
+static float s_lastPrice = 0.0f;
+static uint32_t s_lastRunMs = 0;
+static PriceSamplerStats s_stats = {};
+static portMUX_TYPE s_statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+void priceSamplerRecordWsClose(uint32_t secondBucket, float close)
+{
+    if (!(close > 0.0f)) {
+        return;
+    }
+    portENTER_CRITICAL(&s_wsRingMux);
+    WsCloseEntry& e = s_wsRing[secondBucket % PRICE_SAMPLER_WS_RING];
+    e.bucket = secondBucket;
+    e.close = close;
+    portEXIT_CRITICAL(&s_wsRingMux);
+}
+
+static bool wsCloseFor(uint32_t secondBucket, float& close)
+{
+    portENTER_CRITICAL(&s_wsRingMux);
+    const WsCloseEntry e = s_wsRing[secondBucket % PRICE_SAMPLER_WS_RING];
+    portEXIT_CRITICAL(&s_wsRingMux);
+    if (e.bucket != secondBucket || !(e.close > 0.0f)) {
+        return false;
+    }
+    close = e.close;
+    return true;
+}
+
+static inline uint32_t slotOf(uint32_t nowMs)
+{
+    return nowMs / PRICE_SAMPLER_SLOT_MS;
+}
+
+uint16_t priceSamplerRun(uint32_t nowMs, float livePrice, PriceSamplerSink sink)
+{
+    const uint32_t slot = slotOf(nowMs);
+    if (!s_started) {
+        s_started = true;
+        s_lastSlot = slot - 1;
+    }
+    if ((int32_t)(slot - s_lastSlot) <= 0) {
+        portENTER_CRITICAL(&s_statsMux);
+        s_stats.duplicate++;
+        portEXIT_CRITICAL(&s_statsMux);
+        return 0;
+    }
+
+    // Deadline = eerste slot na het vorige sample + fase. Bij gemiste slots ligt die één of meer
+    // slots terug: lateness uit het millis()-verschil, niet uit de fase (die wrapt per slot)
+    const uint32_t deadlineMs = (s_lastSlot + 1) * PRICE_SAMPLER_SLOT_MS + PRICE_SAMPLER_PHASE_MS;
+    const int32_t deltaMs = (int32_t)(nowMs - deadlineMs);
+    const uint32_t gapMs = (s_lastRunMs != 0) ? (nowMs - s_lastRunMs) : 0;
+    s_lastRunMs = nowMs;
+    uint32_t missing = slot - s_lastSlot - 1;
+    const bool late = missing > 0;
+    uint32_t dropped = 0;
+    if (missing > PRICE_SAMPLER_MAX_BACKFILL) {
+        dropped = missing - PRICE_SAMPLER_MAX_BACKFILL;
+        missing = PRICE_SAMPLER_MAX_BACKFILL;
+    }
+
+    uint16_t written = 0;
+    uint32_t fromWs = 0;
+    uint32_t carried = 0;
+    for (uint32_t s = slot - missing; s != slot; s++) {
+        // Slot s krijgt de close van seconde s - 1 (zoals de live sample in slot s)
+        float p = 0.0f;
+        DataSource src = SOURCE_CARRY;
+        if (wsCloseFor(s - 1, p)) {
+            src = SOURCE_BACKFILL;
+        } else {
+            p = s_lastPrice;
+        }
+        if (p > 0.0f) {
+            sink(s, p, src);
+            s_lastPrice = p;
+            written++;
+            if (src == SOURCE_BACKFILL) {
+                fromWs++;
+            } else {
+                carried++;
+            }
+        }
+    }
+
+    const bool haveLive = livePrice > 0.0f;
+    const float p = haveLive ? livePrice : s_lastPrice;
+    if (p > 0.0f) {
+        sink(slot, p, haveLive ? SOURCE_LIVE : SOURCE_CARRY);
+        s_lastPrice = p;
+        written++;
+        if (!haveLive) {
+            carried++;
+        }
+    }
+    s_lastSlot = slot;
+
+    // Wektijd t.o.v. de deadline (vroeg wakker telt als |verschil|); >= één slot altijd in de restbucket
+    const uint32_t lateMs = (deltaMs >= 0) ? (uint32_t)deltaMs : (uint32_t)(-deltaMs);
+    uint8_t b = 0;
+    if (lateMs >= PRICE_SAMPLER_SLOT_MS) {
+        b = PRICE_SAMPLER_JITTER_BUCKETS - 1;
+    } else {
+        while (b < PRICE_SAMPLER_JITTER_BUCKETS - 1 && lateMs > kJitterUpperMs[b]) {
+            b++;
+        }
+    }
+
+    portENTER_CRITICAL(&s_statsMux);
+    s_stats.slots++;
+    s_stats.backfillWs += fromWs;
+    s_stats.backfillCarry += carried;
+    s_stats.dropped += dropped;
+    s_stats.jitterHist[b]++;
+    if (lateMs > s_stats.jitterMaxMs) {
+        s_stats.jitterMaxMs = lateMs;
+    }
+    if (late) {
+        s_stats.late++;
+    }
+    s_stats.lastGapMs = gapMs;
+    if (gapMs > s_stats.maxGapMs) {
+        s_stats.maxGapMs = gapMs;
+    }
+    portEXIT_CRITICAL(&s_statsMux);
+    return written;
+}
+
+void priceSamplerRecordLockSkip()
+{
+    portENTER_CRITICAL(&s_statsMux);
+    s_stats.lockSkips++;
+    portEXIT_CRITICAL(&s_statsMux);
+}
+
+bool priceSamplerSlotDue(uint32_t nowMs)
+{
+    if (!s_started) {
+        return true;
+    }
+    return (int32_t)(slotOf(nowMs) - s_lastSlot) > 0 && (nowMs % PRICE_SAMPLER_SLOT_MS) >= PRICE_SAMPLER_PHASE_MS;
+}
+
+uint32_t priceSamplerMsUntilNextSlot(uint32_t nowMs)
+{
+    const uint32_t phase = nowMs % PRICE_SAMPLER_SLOT_MS;
+    const uint32_t slot = slotOf(nowMs);
+    // Huidig slot nog niet gesampled en deadline nog niet voorbij: wacht tot de fase in dit slot
+    if (s_started && (int32_t)(slot - s_lastSlot) > 0 && phase < PRICE_SAMPLER_PHASE_MS) {
+        return PRICE_SAMPLER_PHASE_MS - phase;
+    }
+    return PRICE_SAMPLER_SLOT_MS - phase + PRICE_SAMPLER_PHASE_MS;
+}
+
+PriceSamplerStats priceSamplerGetStats()
+{
+    portENTER_CRITICAL(&s_statsMux);
+    const PriceSamplerStats s = s_stats;
+    portEXIT_CRITICAL(&s_statsMux);
+    return s;
+}
+
+size_t priceSamplerFormatJson(char* buf, size_t bufSize)
+{
+    const PriceSamplerStats s = priceSamplerGetStats();
+    int w = snprintf(buf, bufSize,
+                     "\"priceSampler\":{\"slots\":%lu,\"backfillWs\":%lu,\"backfillCarry\":%lu,\"dropped\":%lu,"
+                     "\"duplicate\":%lu,\"late\":%lu,\"lockSkips\":%lu,\"lastGapMs\":%lu,\"maxGapMs\":%lu,"
+                     "\"jitterMaxMs\":%lu,\"jitterHist\":[",
+                     (unsigned long)s.slots, (unsigned long)s.backfillWs, (unsigned long)s.backfillCarry,
+                     (unsigned long)s.dropped, (unsigned long)s.duplicate, (unsigned long)s.late,
+                     (unsigned long)s.lockSkips, (unsigned long)s.lastGapMs, (unsigned long)s.maxGapMs,
+                     (unsigned long)s.jitterMaxMs);
+    if (w <= 0 || (size_t)w >= bufSize) {
+        return 0;
+    }
+    size_t len = (size_t)w;
+    for (uint8_t b = 0; b < PRICE_SAMPLER_JITTER_BUCKETS; b++) {
+        w = snprintf(buf + len, bufSize - len, "%s%lu%s", b ? "," : "", (unsigned long)s.jitterHist[b],
+                     (b == PRICE_SAMPLER_JITTER_BUCKETS - 1) ? "]}" : "");
+        if (w <= 0 || (size_t)w >= bufSize - len) {
+            return 0;
+        }
+        len += (size_t)w;
+    }
+    return len;
+}
@@ -0,0 +1,70 @@
+#ifndef PRICE_SAMPLER_H
+#define PRICE_SAMPLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "PriceData.h"
+
+// 1 Hz sampler op wandklokseconden: slot = millis() / PRICE_SAMPLER_SLOT_MS.
+// secondPrices/fiveMinutePrices rekenen met "één slot == één seconde" (calculateReturn1Minute,
+// calculateReturn5Minutes). Mist de sampler slots (mutex/TLS-stall), dan worden die alsnog
+// geschreven: met de WS-close van die seconde (SOURCE_BACKFILL) of de vorige prijs (SOURCE_CARRY).
+// Waarde van slot s = laatst afgesloten seconde vóór s (zelfde semantiek als de live sample).
+
+#define PRICE_SAMPLER_SLOT_MS 1000UL
+// Wekmoment binnen het slot: na de secondegrens zodat de WS-close van de vorige seconde er is
+#ifndef PRICE_SAMPLER_PHASE_MS
+#define PRICE_SAMPLER_PHASE_MS 50UL
+#endif
+// Langere gaten worden niet volledig aangevuld (anders is de 1m-buffer puur synthetisch)
+#ifndef PRICE_SAMPLER_MAX_BACKFILL
+#define PRICE_SAMPLER_MAX_BACKFILL 60
+#endif
+// Ring met recente WS-seconde-closes (backfill-bron)
+#define PRICE_SAMPLER_WS_RING 16
+// Jitter-histogram: wektijd t.o.v. de geplande deadline (eerste ontbrekende slotgrens + fase),
+// bovengrenzen in ms; laatste = rest (o.a. alles >= één slot te laat)
+#define PRICE_SAMPLER_JITTER_BUCKETS 8
+
+struct PriceSamplerStats {
+    uint32_t slots;            // Actuele slots (SOURCE_LIVE of carry bij ontbrekende prijs)
+    uint32_t backfillWs;
+    uint32_t backfillCarry;
+    uint32_t dropped;          // Gemiste slots voorbij PRICE_SAMPLER_MAX_BACKFILL
+    uint32_t duplicate;        // Tweede wake in hetzelfde slot (genegeerd)
+    uint32_t late;             // Runs met minstens één gemist slot (gemiste seconden = backfill + dropped)
+    uint32_t lockSkips;        // Slot wel bereikt, maar dataMutex niet gekregen (run overgeslagen)
+    uint32_t lastGapMs;        // Tijd tussen de laatste twee runs
+    uint32_t maxGapMs;
+    uint32_t jitterHist[PRICE_SAMPLER_JITTER_BUCKETS];
+    uint32_t jitterMaxMs;
+};
+
+// Per geschreven slot (actueel of aangevuld); aanroeper houdt dataMutex vast
+typedef void (*PriceSamplerSink)(uint32_t slot, float price, DataSource src);
+
+// WS-handler: afgesloten seconde (bucket = millis() / 1000); mag vanuit elke task
+void priceSamplerRecordWsClose(uint32_t secondBucket, float close);
+
+/**
+ * Eén sampler-run. Schrijft eerst gemiste slots (oud → nieuw), dan het actuele slot.
+ * @param livePrice prijs voor het actuele slot (<= 0: carry van de vorige prijs)
+ * @return aantal geschreven slots (0 bij dubbele wake in hetzelfde slot)
+ */
+uint16_t priceSamplerRun(uint32_t nowMs, float livePrice, PriceSamplerSink sink);
+
+// true als het volgende slot aan de beurt is (voor lussen met een eigen wake-periode)
+bool priceSamplerSlotDue(uint32_t nowMs);
+
+// Wachttijd tot de volgende deadline (slotgrens + PRICE_SAMPLER_PHASE_MS)
+uint32_t priceSamplerMsUntilNextSlot(uint32_t nowMs);
+
+// Sampler-task kreeg dataMutex niet: run overgeslagen (de gemiste slots volgen als backfill)
+void priceSamplerRecordLockSkip();
+
+PriceSamplerStats priceSamplerGetStats();
+
+// JSON-fragment `"priceSampler":{...}` (zonder omhullende accolades)
+size_t priceSamplerFormatJson(char* buf, size_t bufSize);
+
+#endif
@@ -2,7 +2,9 @@
 
 #include <Arduino.h>
 #include "../SettingsStore/SettingsStore.h"
+#include <atomic>
 #include <math.h>
+#include <string.h>
 
 // Globale instellingen (ESP32-Crypto-Alert.ino + loadSettings/saveSettings)
 extern AlertThresholds alertThresholds;
@@ -24,11 +26,74 @@ extern float regime2hCompressMaxPct;
 
 namespace {
 
+// Features waar regels op testen (index in de feature-vector van één tick)
+enum RegimeFeature : uint8_t {
+    FEAT_ENERGY = 0,
+    FEAT_LOADED,
+    FEAT_DIRECTION,
+    FEAT_COMPRESSION,
+    FEAT_COUNT
+};
+
+enum RegimeOp : uint8_t {
+    OP_GE = 0,
+    OP_GT,
+    OP_LE,
+    OP_LT
+};
+
+// Drempel-parameters: worden bij het compileren uit RegimeEngineConfig ingevuld
+enum RegimeParam : uint8_t {
+    PARAM_ENERGETIC_ENTER = 0,
+    PARAM_ENERGETIC_EXIT,
+    PARAM_SLAP_ENTER,
+    PARAM_SLAP_EXIT,
+    PARAM_LOADED_FLOOR,
+    PARAM_LOADED_DROP,
+    PARAM_COUNT
+};
+
+struct RegimeCondTemplate {
+    uint8_t feature;
+    uint8_t op;
+    uint8_t param;
+};
+
+struct RegimeRuleTemplate {
+    uint8_t from;
+    uint8_t to;
+    uint8_t condCount;  // 0 = altijd (laatste regel van een regime)
+    RegimeCondTemplate cond[REGIME_MAX_CONDS];
+};
+
+// Transities in evaluatievolgorde per huidig regime: eerste regel die klopt wint.
+// Geen regel = blijven. Hysterese zit in de aparte enter/exit-drempels.
+static const RegimeRuleTemplate kRuleTemplates[] = {
+    {REGIME_ENERGIEK, REGIME_ENERGIEK, 1, {{FEAT_ENERGY, OP_GE, PARAM_ENERGETIC_EXIT}, {}}},
+    {REGIME_ENERGIEK, REGIME_GELADEN, 1, {{FEAT_LOADED, OP_GE, PARAM_LOADED_DROP}, {}}},
+    {REGIME_ENERGIEK, REGIME_SLAP, 0, {{}, {}}},
+
+    {REGIME_SLAP, REGIME_SLAP, 2, {{FEAT_ENERGY, OP_LE, PARAM_SLAP_EXIT}, {FEAT_LOADED, OP_LT, PARAM_LOADED_FLOOR}}},
+    {REGIME_SLAP, REGIME_ENERGIEK, 1, {{FEAT_ENERGY, OP_GE, PARAM_ENERGETIC_ENTER}, {}}},
+    {REGIME_SLAP, REGIME_GELADEN, 0, {{}, {}}},
+
+    {REGIME_GELADEN, REGIME_ENERGIEK, 1, {{FEAT_ENERGY, OP_GE, PARAM_ENERGETIC_ENTER}, {}}},
+    {REGIME_GELADEN, REGIME_SLAP, 2, {{FEAT_ENERGY, OP_LE, PARAM_SLAP_ENTER}, {FEAT_LOADED, OP_LE, PARAM_LOADED_DROP}}},
+};
+
+static const size_t kRuleTemplateCount = sizeof(kRuleTemplates) / sizeof(kRuleTemplates[0]);
+static_assert(sizeof(kRuleTemplates) / sizeof(kRuleTemplates[0]) <= REGIME_MAX_RULES, "REGIME_MAX_RULES te klein");
+
+// Bovengrenzen (s) van het dwell-histogram: 1m, 5m, 15m, 1h, 4h, rest
+static const uint32_t kDwellBucketSec[REGIME_DWELL_BUCKETS] = {60, 300, 900, 3600, 14400, UINT32_MAX};
+
 static RegimeSnapshot g_snap;
+static RegimeTable g_table;
+static RegimeState g_state;
 
-static RegimeKind g_committed = REGIME_GELADEN;
-static uint8_t g_pendingRegime = 0xFF;
-static uint32_t g_pendingSinceMs = 0;
+// Verzoek (load/save, elke task) vs. gecompileerde generatie (alleen apiTask)
+static std::atomic<uint32_t> g_configRequested{1};
+static uint32_t g_configCompiled = 0;
 
 static float clampF(float v, float lo, float hi) {
     if (v < lo) return lo;
@@ -48,25 +113,94 @@ static int8_t signDb(float x, float db) {
     return (x > 0.0f) ? 1 : -1;
 }
 
-struct RegimeConfig {
-    bool enabled;
-    uint32_t minDwellSec;
-    float energeticEnter;
-    float energeticExit;
-    float slapEnter;
-    float slapExit;
-    float loadedFloor;
-    float loadedDrop;
-    float dd1m;
-    float dd5m;
-    float dd30m;
-    float dd2h;
-    float compressMinPct;
-    float compressMaxPct;
-};
+static float paramValue(const RegimeEngineConfig& cfg, uint8_t param) {
+    switch (param) {
+        case PARAM_ENERGETIC_ENTER: return cfg.energeticEnter;
+        case PARAM_ENERGETIC_EXIT:  return cfg.energeticExit;
+        case PARAM_SLAP_ENTER:      return cfg.slapEnter;
+        case PARAM_SLAP_EXIT:       return cfg.slapExit;
+        case PARAM_LOADED_FLOOR:    return cfg.loadedFloor;
+        case PARAM_LOADED_DROP:     return cfg.loadedDrop;
+        default:                    return 0.0f;
+    }
+}
+
+static bool condHolds(float v, uint8_t op, float thr) {
+    switch (op) {
+        case OP_GE: return v >= thr;
+        case OP_GT: return v > thr;
+        case OP_LE: return v <= thr;
+        case OP_LT: return v < thr;
+        default:    return false;
+    }
+}
 
-static RegimeConfig readConfigFromGlobals() {
-    RegimeConfig c;
+static RegimeKind classifyProposed(const RegimeTable& table, RegimeKind current, const float* feat) {
+    const uint8_t cur = (current < REGIME_COUNT) ? static_cast<uint8_t>(current) : static_cast<uint8_t>(REGIME_GELADEN);
+    for (uint8_t i = table.rowStart[cur]; i < table.rowStart[cur + 1]; i++) {
+        const RegimeRule& rule = table.rules[i];
+        bool match = true;
+        for (uint8_t c = 0; c < rule.condCount && match; c++) {
+            match = condHolds(feat[rule.feature[c]], rule.op[c], rule.threshold[c]);
+        }
+        if (match) {
+            return static_cast<RegimeKind>(rule.to);
+        }
+    }
+    return static_cast<RegimeKind>(cur);
+}
+
+static uint8_t dwellBucket(uint32_t sec) {
+    uint8_t b = 0;
+    while (b < REGIME_DWELL_BUCKETS - 1 && sec > kDwellBucketSec[b]) {
+        b++;
+    }
+    return b;
+}
+
+// Tijd sinds de vorige stap toeschrijven aan het huidige committed regime
+static void accountTime(RegimeState& st, uint32_t nowMs, RegimeSnapshot& out) {
+    st.accumMs += nowMs - st.lastTickMs;
+    st.lastTickMs = nowMs;
+    if (st.accumMs >= 1000UL) {
+        out.timeInRegimeSec[st.committed] += st.accumMs / 1000UL;
+        st.accumMs %= 1000UL;
+    }
+}
+
+static bool applyDwellAndCommit(const RegimeTable& table, RegimeState& st, uint32_t nowMs,
+                                RegimeKind proposed, RegimeSnapshot& out) {
+    if (proposed == st.committed) {
+        st.pending = 0xFF;
+        st.pendingSinceMs = 0;
+        return false;
+    }
+
+    if (st.pending != static_cast<uint8_t>(proposed)) {
+        st.pending = static_cast<uint8_t>(proposed);
+        st.pendingSinceMs = nowMs;
+        return false;
+    }
+
+    if ((nowMs - st.pendingSinceMs) < table.dwellMs) {
+        return false;
+    }
+    const uint32_t dwellSec = (nowMs - st.committedSinceMs) / 1000UL;
+    uint16_t& bucket = out.dwellHist[st.committed][dwellBucket(dwellSec)];
+    if (bucket < UINT16_MAX) {
+        bucket++;
+    }
+    st.committed = proposed;
+    st.committedSinceMs = nowMs;
+    st.pending = 0xFF;
+    st.pendingSinceMs = 0;
+    return true;
+}
+
+}  // namespace
+
+RegimeEngineConfig regimeEngineConfigFromGlobals() {
+    RegimeEngineConfig c;
     c.enabled = regimeEngineEnabled;
     c.minDwellSec = regimeMinDwellSec;
     c.energeticEnter = regimeEnergeticEnter;
@@ -81,94 +215,61 @@ static RegimeConfig readConfigFromGlobals() {
     c.dd2h = regimeDirDeadband2hPct;
     c.compressMinPct = regime2hCompressMinPct;
     c.compressMaxPct = regime2hCompressMaxPct;
+    c.ref1m = alertThresholds.spike1m;
+    c.ref5m = alertThresholds.move5mAlert;
+    c.ref30m = alertThresholds.move30m;
+    c.ref2h = trendThreshold;
     return c;
 }
 
-static RegimeKind classifyProposed(RegimeKind current,
-                                   float energyScore,
-                                   float loadedScore,
-                                   const RegimeConfig& cfg) {
-    switch (current) {
-        case REGIME_ENERGIEK:
-            if (energyScore >= cfg.energeticExit) {
-                return REGIME_ENERGIEK;
+void regimeEngineCompile(const RegimeEngineConfig& cfg, RegimeTable& out) {
+    memset(&out, 0, sizeof(out));
+    out.cfg = cfg;
+    out.dwellMs = cfg.minDwellSec * 1000UL;
+
+    uint8_t n = 0;
+    for (uint8_t r = 0; r < REGIME_COUNT; r++) {
+        out.rowStart[r] = n;
+        for (size_t t = 0; t < kRuleTemplateCount; t++) {
+            const RegimeRuleTemplate& tpl = kRuleTemplates[t];
+            if (tpl.from != r) {
+                continue;
             }
-            return (loadedScore >= cfg.loadedDrop) ? REGIME_GELADEN : REGIME_SLAP;
-
-        case REGIME_SLAP:
-            if (energyScore <= cfg.slapExit && loadedScore < cfg.loadedFloor) {
-                return REGIME_SLAP;
+            RegimeRule& rule = out.rules[n++];
+            rule.to = tpl.to;
+            rule.condCount = tpl.condCount;
+            for (uint8_t c = 0; c < tpl.condCount; c++) {
+                rule.feature[c] = tpl.cond[c].feature;
+                rule.op[c] = tpl.cond[c].op;
+                rule.threshold[c] = paramValue(cfg, tpl.cond[c].param);
             }
-            return (energyScore >= cfg.energeticEnter) ? REGIME_ENERGIEK : REGIME_GELADEN;
-
-        case REGIME_GELADEN:
-        default:
-            if (energyScore >= cfg.energeticEnter) {
-                return REGIME_ENERGIEK;
-            }
-            if (energyScore <= cfg.slapEnter && loadedScore <= cfg.loadedDrop) {
-                return REGIME_SLAP;
-            }
-            return REGIME_GELADEN;
+        }
     }
+    out.rowStart[REGIME_COUNT] = n;
 }
 
-static void applyDwellAndCommit(uint32_t nowMs,
-                                RegimeKind proposed,
-                                const RegimeConfig& cfg) {
-    if (proposed == g_committed) {
-        g_pendingRegime = 0xFF;
-        g_pendingSinceMs = 0;
-        return;
-    }
-
-    const uint32_t dwellMs = cfg.minDwellSec * 1000UL;
-
-    if (g_pendingRegime != static_cast<uint8_t>(proposed)) {
-        g_pendingRegime = static_cast<uint8_t>(proposed);
-        g_pendingSinceMs = nowMs;
-        return;
-    }
-
-    if ((nowMs - g_pendingSinceMs) >= dwellMs) {
-        const RegimeKind prev = g_committed;
-        g_committed = proposed;
-        g_pendingRegime = 0xFF;
-        g_pendingSinceMs = 0;
-        Serial.printf(
-            "[Regime] commit %u -> %u (dwell ok)\n",
-            static_cast<unsigned>(prev),
-            static_cast<unsigned>(g_committed));
-    }
+void regimeStateReset(RegimeState& st) {
+    st.committed = REGIME_GELADEN;
+    st.pending = 0xFF;
+    st.pendingSinceMs = 0;
+    st.committedSinceMs = 0;
+    st.lastTickMs = 0;
+    st.accumMs = 0;
+    st.started = false;
 }
 
-}  // namespace
-
-void regimeEngineTick(uint32_t nowMs,
-                      float ret_1m,
-                      float ret_5m,
-                      float ret_30m,
-                      float ret_2h,
-                      float twoHRangePct,
-                      bool twoHMetricsValid) {
-    const RegimeConfig cfg = readConfigFromGlobals();
-    g_snap.engineEnabledLastTick = cfg.enabled;
-
-    if (!cfg.enabled) {
-        g_snap.committedRegime = g_committed;
-        g_snap.proposedRegime = g_committed;
-        return;
-    }
+bool regimeEngineStep(const RegimeTable& table, RegimeState& st, const RegimeInput& in, RegimeSnapshot& out) {
+    const RegimeEngineConfig& cfg = table.cfg;
 
-    const float n1 = normAbs(ret_1m, alertThresholds.spike1m);
-    const float n5 = normAbs(ret_5m, alertThresholds.move5mAlert);
-    const float n30 = normAbs(ret_30m, alertThresholds.move30m);
-    const float n2h = normAbs(ret_2h, trendThreshold);
+    const float n1 = normAbs(in.ret1m, cfg.ref1m);
+    const float n5 = normAbs(in.ret5m, cfg.ref5m);
+    const float n30 = normAbs(in.ret30m, cfg.ref30m);
+    const float n2h = normAbs(in.ret2h, cfg.ref2h);
 
-    const int8_t d1 = signDb(ret_1m, cfg.dd1m);
-    const int8_t d5 = signDb(ret_5m, cfg.dd5m);
-    const int8_t d30 = signDb(ret_30m, cfg.dd30m);
-    const int8_t d2h = signDb(ret_2h, cfg.dd2h);
+    const int8_t d1 = signDb(in.ret1m, cfg.dd1m);
+    const int8_t d5 = signDb(in.ret5m, cfg.dd5m);
+    const int8_t d30 = signDb(in.ret30m, cfg.dd30m);
+    const int8_t d2h = signDb(in.ret2h, cfg.dd2h);
 
     const float align15 = (d1 != 0 && d1 == d5) ? 1.0f : 0.0f;
     const float align1530 = (align15 > 0.0f && d30 == d1) ? 1.0f : 0.0f;
@@ -181,8 +282,8 @@ void regimeEngineTick(uint32_t nowMs,
     const float directionScore =
         clampF((align15 + align1530 + ctx2h) / 2.5f, -1.0f, 1.0f);
 
-    float rangeUse = twoHRangePct;
-    if (!twoHMetricsValid) {
+    float rangeUse = in.twoHRangePct;
+    if (!in.twoHMetricsValid) {
         rangeUse = cfg.compressMaxPct;
     }
 
@@ -199,39 +300,142 @@ void regimeEngineTick(uint32_t nowMs,
         0.0f,
         1.0f);
 
-    const RegimeKind proposed = classifyProposed(g_committed, energyScore, loadedScore, cfg);
+    if (!st.started) {
+        st.started = true;
+        st.committedSinceMs = in.nowMs;
+        st.lastTickMs = in.nowMs;
+    }
+    accountTime(st, in.nowMs, out);
+
+    float feat[FEAT_COUNT];
+    feat[FEAT_ENERGY] = energyScore;
+    feat[FEAT_LOADED] = loadedScore;
+    feat[FEAT_DIRECTION] = directionScore;
+    feat[FEAT_COMPRESSION] = compressionScore;
+    const RegimeKind proposed = classifyProposed(table, st.committed, feat);
+    const bool changed = applyDwellAndCommit(table, st, in.nowMs, proposed, out);
+
+    out.n1 = n1;
+    out.n5 = n5;
+    out.n30 = n30;
+    out.n2h = n2h;
+    out.directionScore = directionScore;
+    out.compressionScore = compressionScore;
+    out.energyScore = energyScore;
+    out.loadedScore = loadedScore;
+    out.twoHRangePct = rangeUse;
+    out.proposedRegime = proposed;
+    out.committedRegime = st.committed;
+    out.pendingRegime = st.pending;
+    out.pendingSinceMs = st.pendingSinceMs;
+    out.committedSinceMs = st.committedSinceMs;
+    return changed;
+}
 
-    g_snap.n1 = n1;
-    g_snap.n5 = n5;
-    g_snap.n30 = n30;
-    g_snap.n2h = n2h;
-    g_snap.directionScore = directionScore;
-    g_snap.compressionScore = compressionScore;
-    g_snap.energyScore = energyScore;
-    g_snap.loadedScore = loadedScore;
-    g_snap.twoHRangePct = rangeUse;
-    g_snap.proposedRegime = proposed;
+size_t regimeEngineEvaluateSeries(const RegimeTable& table,
+                                  const RegimeInput* in,
+                                  size_t n,
+                                  RegimeKind* committedOut,
+                                  RegimeSnapshot* stats) {
+    if (in == nullptr) {
+        return 0;
+    }
+    RegimeState st;
+    regimeStateReset(st);
+    RegimeSnapshot local;
+    RegimeSnapshot& out = (stats != nullptr) ? *stats : local;
+    out = RegimeSnapshot();
+    out.engineEnabledLastTick = true;
+
+    size_t changes = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (regimeEngineStep(table, st, in[i], out)) {
+            changes++;
+        }
+        if (committedOut != nullptr) {
+            committedOut[i] = st.committed;
+        }
+    }
+    return changes;
+}
 
-    applyDwellAndCommit(nowMs, proposed, cfg);
+void regimeEngineConfigChanged() {
+    g_configRequested.fetch_add(1, std::memory_order_release);
+}
 
-    g_snap.committedRegime = g_committed;
-    g_snap.pendingRegime = g_pendingRegime;
-    g_snap.pendingSinceMs = g_pendingSinceMs;
+void regimeEngineTick(uint32_t nowMs,
+                      float ret_1m,
+                      float ret_5m,
+                      float ret_30m,
+                      float ret_2h,
+                      float twoHRangePct,
+                      bool twoHMetricsValid) {
+    const uint32_t t0 = micros();
+
+    const uint32_t requested = g_configRequested.load(std::memory_order_acquire);
+    if (requested != g_configCompiled) {
+        if (g_configCompiled == 0) {
+            regimeStateReset(g_state);
+        }
+        g_configCompiled = requested;
+        regimeEngineCompile(regimeEngineConfigFromGlobals(), g_table);
+        g_snap.configGen++;
+        Serial.printf("[Regime] tabel gecompileerd: %u regels, dwell=%lus (gen %lu)\n",
+                      static_cast<unsigned>(g_table.rowStart[REGIME_COUNT]),
+                      static_cast<unsigned long>(g_table.cfg.minDwellSec),
+                      static_cast<unsigned long>(g_snap.configGen));
+    }
+
+    g_snap.engineEnabledLastTick = g_table.cfg.enabled;
+
+    if (!g_table.cfg.enabled) {
+        // Uitgeschakeld: geen verblijfstijd tellen; bij herstart begint de huidige dwell opnieuw
+        g_state.started = false;
+        g_state.accumMs = 0;
+        g_snap.committedRegime = g_state.committed;
+        g_snap.proposedRegime = g_state.committed;
+        return;
+    }
+
+    RegimeInput in;
+    in.nowMs = nowMs;
+    in.ret1m = ret_1m;
+    in.ret5m = ret_5m;
+    in.ret30m = ret_30m;
+    in.ret2h = ret_2h;
+    in.twoHRangePct = twoHRangePct;
+    in.twoHMetricsValid = twoHMetricsValid;
+    const RegimeKind prev = g_state.committed;
+    const bool changed = regimeEngineStep(g_table, g_state, in, g_snap);
+
+    const uint32_t costUs = micros() - t0;
+    g_snap.tickCostUs = costUs;
+    if (costUs > g_snap.tickCostMaxUs) {
+        g_snap.tickCostMaxUs = costUs;
+    }
+
+    if (changed) {
+        Serial.printf(
+            "[Regime] commit %u -> %u (dwell ok)\n",
+            static_cast<unsigned>(prev),
+            static_cast<unsigned>(g_state.committed));
+    }
 
     Serial.printf(
         "[Regime] prop=%u comm=%u E=%.3f L=%.3f dir=%.3f cmp=%.3f n1=%.3f n5=%.3f n30=%.3f n2h=%.3f "
-        "2hR=%.3f\n",
-        static_cast<unsigned>(proposed),
-        static_cast<unsigned>(g_committed),
-        energyScore,
-        loadedScore,
-        directionScore,
-        compressionScore,
-        n1,
-        n5,
-        n30,
-        n2h,
-        rangeUse);
+        "2hR=%.3f %luus\n",
+        static_cast<unsigned>(g_snap.proposedRegime),
+        static_cast<unsigned>(g_snap.committedRegime),
+        g_snap.energyScore,
+        g_snap.loadedScore,
+        g_snap.directionScore,
+        g_snap.compressionScore,
+        g_snap.n1,
+        g_snap.n5,
+        g_snap.n30,
+        g_snap.n2h,
+        g_snap.twoHRangePct,
+        static_cast<unsigned long>(costUs));
 }
 
 const RegimeSnapshot& regimeEngineGetSnapshot() {
@@ -1,15 +1,23 @@
 #ifndef REGIME_ENGINE_H
 #define REGIME_ENGINE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 // Drie marktregimes (Fase A: alleen berekening + snapshot, geen alert-gating).
+// Nieuw regime: enum uitbreiden + regels in kRuleTemplates (RegimeEngine.cpp); geen nieuwe branches.
 enum RegimeKind : uint8_t {
     REGIME_SLAP = 0,
     REGIME_GELADEN = 1,
     REGIME_ENERGIEK = 2,
+    REGIME_COUNT
 };
 
+// Dwell-histogram: afgeronde verblijfsduur per regime, bovengrenzen in seconden (laatste = rest)
+#define REGIME_DWELL_BUCKETS 6
+#define REGIME_MAX_RULES 16
+#define REGIME_MAX_CONDS 2
+
 struct RegimeSnapshot {
     float n1 = 0.0f;
     float n5 = 0.0f;
@@ -25,9 +33,105 @@ struct RegimeSnapshot {
     uint8_t pendingRegime = 0xFF;  // 0xFF = geen pending wissel
     uint32_t pendingSinceMs = 0;
     bool engineEnabledLastTick = false;
+
+    // Kosten van regimeEngineTick (scores + tabel + dwell, zonder logregel)
+    uint32_t tickCostUs = 0;
+    uint32_t tickCostMaxUs = 0;
+    uint32_t configGen = 0;            // Verhoogd bij elke hercompilatie van de tabel
+    uint32_t committedSinceMs = 0;
+    uint32_t timeInRegimeSec[REGIME_COUNT] = {};
+    uint16_t dwellHist[REGIME_COUNT][REGIME_DWELL_BUCKETS] = {};
+};
+
+// Config-snapshot: alle instellingen die de classifier gebruikt (ook de normalisatie-referenties)
+struct RegimeEngineConfig {
+    bool enabled;
+    uint32_t minDwellSec;
+    float energeticEnter;
+    float energeticExit;
+    float slapEnter;
+    float slapExit;
+    float loadedFloor;
+    float loadedDrop;
+    float dd1m;
+    float dd5m;
+    float dd30m;
+    float dd2h;
+    float compressMinPct;
+    float compressMaxPct;
+    float ref1m;    // alertThresholds.spike1m
+    float ref5m;    // alertThresholds.move5mAlert
+    float ref30m;   // alertThresholds.move30m
+    float ref2h;    // trendThreshold
+};
+
+// Gecompileerde regel: naar `to` als alle condities gelden (feature op drempel)
+struct RegimeRule {
+    uint8_t to;
+    uint8_t condCount;
+    uint8_t feature[REGIME_MAX_CONDS];
+    uint8_t op[REGIME_MAX_CONDS];
+    float threshold[REGIME_MAX_CONDS];
+};
+
+// Transitietabel: regels per huidig regime aaneengesloten (rowStart[r] .. rowStart[r + 1])
+struct RegimeTable {
+    RegimeEngineConfig cfg;
+    uint32_t dwellMs;
+    uint8_t rowStart[REGIME_COUNT + 1];
+    RegimeRule rules[REGIME_MAX_RULES];
+};
+
+struct RegimeInput {
+    uint32_t nowMs;
+    float ret1m;
+    float ret5m;
+    float ret30m;
+    float ret2h;
+    float twoHRangePct;
+    bool twoHMetricsValid;
+};
+
+// Hysterese-state (één per serie; de live engine heeft er één)
+struct RegimeState {
+    RegimeKind committed;
+    uint8_t pending;
+    uint32_t pendingSinceMs;
+    uint32_t committedSinceMs;
+    uint32_t lastTickMs;
+    uint32_t accumMs;    // Nog niet in timeInRegimeSec verwerkte ms
+    bool started;
 };
 
-// Leest thresholds/regime-instellingen uit globale variabelen (gesynchroniseerd via SettingsStore).
+// Leest de instellingen uit globale variabelen (gesynchroniseerd via SettingsStore)
+RegimeEngineConfig regimeEngineConfigFromGlobals();
+
+// Config -> tabel (drempels ingevuld, regels per regime gegroepeerd)
+void regimeEngineCompile(const RegimeEngineConfig& cfg, RegimeTable& out);
+
+void regimeStateReset(RegimeState& st);
+
+/**
+ * Eén stap zonder globale state: scores, tabel, dwell. Vult scorevelden en regimes in `out`.
+ * @return true als het committed regime in deze stap wisselde
+ */
+bool regimeEngineStep(const RegimeTable& table, RegimeState& st, const RegimeInput& in, RegimeSnapshot& out);
+
+/**
+ * Batch-evaluatie over een historische serie (kalibratie): eigen state, geen logging.
+ * @param committedOut optioneel (n entries)
+ * @param stats optioneel: time-in-regime en dwell-histogram van deze serie
+ * @return aantal regimewissels
+ */
+size_t regimeEngineEvaluateSeries(const RegimeTable& table,
+                                  const RegimeInput* in,
+                                  size_t n,
+                                  RegimeKind* committedOut,
+                                  RegimeSnapshot* stats);
+
+// Instellingen gewijzigd (load/save): volgende tick hercompileert de tabel in de apiTask
+void regimeEngineConfigChanged();
+
 void regimeEngineTick(uint32_t nowMs,
                       float ret_1m,
                       float ret_5m,
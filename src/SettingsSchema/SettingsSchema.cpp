@@ -0,0 +1,309 @@
+#include "SettingsSchema.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include alleen DEBUG_BUTTON_ONLY, niet de hele platform_config.h (voorkomt PINS includes)
+#ifndef DEBUG_BUTTON_ONLY
+#define DEBUG_BUTTON_ONLY 1
+#endif
+
+#define SOFF(member) (uint16_t)offsetof(CryptoMonitorSettings, member)
+
+// Volgorde = publish-volgorde van de config-republish. Keys zijn tevens MQTT-topicdelen en
+// Home Assistant object-ids (zie MqttDiscovery.cpp): niet hernoemen zonder migratie in HA.
+constexpr SettingDesc kSettingsSchema[] = {
+    // 1m/5m/30m alerts
+    {"spike1m", SOFF(alertThresholds.spike1m), SETTING_F32, 0, 0.01f, 10.0f},
+    {"spike5m", SOFF(alertThresholds.spike5m), SETTING_F32, 0, 0.01f, 10.0f},
+    {"move30m", SOFF(alertThresholds.move30m), SETTING_F32, 0, 0.01f, 20.0f},
+    {"move5m", SOFF(alertThresholds.move5m), SETTING_F32, 0, 0.01f, 10.0f},
+    {"move5mAlert", SOFF(alertThresholds.move5mAlert), SETTING_F32, 0, 0.01f, 10.0f},
+    {"cooldown1min", SOFF(notificationCooldowns.cooldown1MinMs), SETTING_MS_AS_SEC, 0, 1.0f, 3600.0f},
+    {"cooldown30min", SOFF(notificationCooldowns.cooldown30MinMs), SETTING_MS_AS_SEC, 0, 1.0f, 3600.0f},
+    {"cooldown5min", SOFF(notificationCooldowns.cooldown5MinMs), SETTING_MS_AS_SEC, 0, 1.0f, 3600.0f},
+
+    // Anchor + trend/volatiliteit
+    {"anchorTakeProfit", SOFF(anchorTakeProfit), SETTING_F32, 0, 0.1f, 100.0f},
+    {"anchorMaxLoss", SOFF(anchorMaxLoss), SETTING_F32, 0, -100.0f, -0.1f},
+    {"trendThreshold", SOFF(trendThreshold), SETTING_F32, 0, 0.1f, 10.0f},
+    {"volatilityLowThreshold", SOFF(volatilityLowThreshold), SETTING_F32, 0, 0.01f, 1.0f},
+    {"volatilityHighThreshold", SOFF(volatilityHighThreshold), SETTING_F32, SETTING_F_GT_VOL_LOW, 0.01f, 1.0f},
+
+    // 2-hour alerts (cooldowns/throttling via MQTT in seconden; WebUI gebruikt minuten)
+    {"2hBreakMargin", SOFF(alert2HThresholds.breakMarginPct), SETTING_F32, 0, 0.01f, 5.0f},
+    {"2hBreakReset", SOFF(alert2HThresholds.breakResetMarginPct), SETTING_F32, 0, 0.01f, 5.0f},
+    {"2hMeanMinDist", SOFF(alert2HThresholds.meanMinDistancePct), SETTING_F32, 0, 0.01f, 10.0f},
+    {"2hMeanTouch", SOFF(alert2HThresholds.meanTouchBandPct), SETTING_F32, 0, 0.01f, 2.0f},
+    {"2hCompressTh", SOFF(alert2HThresholds.compressThresholdPct), SETTING_F32, 0, 0.01f, 5.0f},
+    {"2hCompressReset", SOFF(alert2HThresholds.compressResetPct), SETTING_F32, 0, 0.01f, 10.0f},
+    {"2hAnchorMargin", SOFF(alert2HThresholds.anchorOutsideMarginPct), SETTING_F32, 0, 0.01f, 5.0f},
+    {"2hTrendHyst", SOFF(alert2HThresholds.trendHysteresisFactor), SETTING_F32, 0, 0.1f, 1.0f},
+    {"2hBreakCD", SOFF(alert2HThresholds.breakCooldownMs), SETTING_MS_AS_SEC, 0, 1.0f, 36000.0f},
+    {"2hMeanCD", SOFF(alert2HThresholds.meanCooldownMs), SETTING_MS_AS_SEC, 0, 1.0f, 36000.0f},
+    {"2hCompressCD", SOFF(alert2HThresholds.compressCooldownMs), SETTING_MS_AS_SEC, 0, 1.0f, 36000.0f},
+    {"2hAnchorCD", SOFF(alert2HThresholds.anchorCooldownMs), SETTING_MS_AS_SEC, 0, 1.0f, 36000.0f},
+    {"2hThrottleTC", SOFF(alert2HThresholds.throttlingTrendChangeMs), SETTING_MS_AS_SEC, 0, 1.0f, 36000.0f},
+    {"2hThrottleTM", SOFF(alert2HThresholds.throttlingTrendToMeanMs), SETTING_MS_AS_SEC, 0, 1.0f, 36000.0f},
+    {"2hThrottleMT", SOFF(alert2HThresholds.throttlingMeanTouchMs), SETTING_MS_AS_SEC, 0, 1.0f, 36000.0f},
+    {"2hThrottleComp", SOFF(alert2HThresholds.throttlingCompressMs), SETTING_MS_AS_SEC, 0, 1.0f, 36000.0f},
+    {"2hSecGlobalCD", SOFF(alert2HThresholds.twoHSecondaryGlobalCooldownSec), SETTING_U32, 0, 60.0f, 86400.0f},
+    {"2hSecCoalesce", SOFF(alert2HThresholds.twoHSecondaryCoalesceWindowSec), SETTING_U32, 0, 10.0f, 600.0f},
+
+    // Trend-adaptive anchors
+    {"trendAdapt", SOFF(trendAdaptiveAnchorsEnabled), SETTING_BOOL, 0, 0.0f, 1.0f},
+    {"upMLMult", SOFF(uptrendMaxLossMultiplier), SETTING_F32, 0, 0.5f, 2.0f},
+    {"upTPMult", SOFF(uptrendTakeProfitMultiplier), SETTING_F32, 0, 0.5f, 2.0f},
+    {"downMLMult", SOFF(downtrendMaxLossMultiplier), SETTING_F32, 0, 0.5f, 2.0f},
+    {"downTPMult", SOFF(downtrendTakeProfitMultiplier), SETTING_F32, 0, 0.5f, 2.0f},
+    {"smartConf", SOFF(smartConfluenceEnabled), SETTING_BOOL, 0, 0.0f, 1.0f},
+
+    // Nachtstand
+    {"nightMode", SOFF(nightModeEnabled), SETTING_BOOL, 0, 0.0f, 1.0f},
+    {"nightStartHour", SOFF(nightModeStartHour), SETTING_U8, 0, 0.0f, 23.0f},
+    {"nightEndHour", SOFF(nightModeEndHour), SETTING_U8, 0, 0.0f, 23.0f},
+    {"nightSpike5m", SOFF(nightSpike5mThreshold), SETTING_F32, 0, 0.01f, 10.0f},
+    {"nightMove5m", SOFF(nightMove5mAlertThreshold), SETTING_F32, 0, 0.01f, 10.0f},
+    {"nightMove30m", SOFF(nightMove30mThreshold), SETTING_F32, 0, 0.01f, 20.0f},
+    {"nightCd5m", SOFF(nightCooldown5mSec), SETTING_U16, 0, 60.0f, 7200.0f},
+    {"nightAvMin", SOFF(nightAutoVolMinMultiplier), SETTING_F32, 0, 0.1f, 3.0f},
+    {"nightAvMax", SOFF(nightAutoVolMaxMultiplier), SETTING_F32, 0, 0.1f, 5.0f},
+
+    // Auto-Volatility
+    {"autoVol", SOFF(autoVolatilityEnabled), SETTING_BOOL, 0, 0.0f, 1.0f},
+    {"autoVolWin", SOFF(autoVolatilityWindowMinutes), SETTING_U8, 0, 10.0f, 120.0f},
+    {"autoVolBase", SOFF(autoVolatilityBaseline1mStdPct), SETTING_F32, 0, 0.01f, 1.0f},
+    {"autoVolMin", SOFF(autoVolatilityMinMultiplier), SETTING_F32, 0, 0.1f, 1.0f},
+    {"autoVolMax", SOFF(autoVolatilityMaxMultiplier), SETTING_F32, 0, 1.0f, 3.0f},
+
+    // Warm-Start
+    {"warmStart", SOFF(warmStartEnabled), SETTING_BOOL, 0, 0.0f, 1.0f},
+    {"ws1mExtra", SOFF(warmStart1mExtraCandles), SETTING_U8, 0, 0.0f, 100.0f},
+    {"ws5m", SOFF(warmStart5mCandles), SETTING_U8, 0, 2.0f, 200.0f},
+    {"ws30m", SOFF(warmStart30mCandles), SETTING_U8, 0, 2.0f, 200.0f},
+    {"ws2h", SOFF(warmStart2hCandles), SETTING_U8, 0, 2.0f, 200.0f},
+};
+
+#undef SOFF
+
+constexpr uint16_t kSettingsSchemaCountCe = sizeof(kSettingsSchema) / sizeof(kSettingsSchema[0]);
+const uint16_t kSettingsSchemaCount = kSettingsSchemaCountCe;
+
+namespace {
+
+// Hash-tabel: macht van 2, ~9x het aantal entries zodat de compile-time seed-zoektocht kort blijft
+#define SETTINGS_SCHEMA_HASH_SLOTS 512
+#define SETTINGS_SCHEMA_SEED_TRIES 4096u
+static_assert(kSettingsSchemaCountCe < 255, "schema-index + 1 past in uint8_t");
+static_assert(kSettingsSchemaCountCe < SETTINGS_SCHEMA_HASH_SLOTS, "hash-tabel te klein voor schema");
+
+constexpr uint32_t hashKey(const char* key, size_t len, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)key[i];
+        h *= 16777619u;
+    }
+    // Finalizer: FNV-vermenigvuldiging propageert alleen naar hogere bits, dus zonder mix
+    // hangen de lage (slot-)bits maar van 8 seed-bits af
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+}
+
+constexpr size_t keyLength(const char* key) {
+    size_t n = 0;
+    while (key[n] != '\0') {
+        n++;
+    }
+    return n;
+}
+
+struct SchemaIndex {
+    uint32_t seed;
+    bool perfect;
+    uint8_t slots[SETTINGS_SCHEMA_HASH_SLOTS];  // schema-index + 1, 0 = leeg
+};
+
+// Zoek bij compilatie een seed waarbij alle keys in een eigen slot vallen
+constexpr SchemaIndex buildIndex() {
+    SchemaIndex idx{};
+    for (uint32_t seed = 0; seed < SETTINGS_SCHEMA_SEED_TRIES; seed++) {
+        for (uint16_t s = 0; s < SETTINGS_SCHEMA_HASH_SLOTS; s++) {
+            idx.slots[s] = 0;
+        }
+        bool collision = false;
+        for (uint16_t i = 0; i < kSettingsSchemaCountCe && !collision; i++) {
+            const char* key = kSettingsSchema[i].key;
+            const uint32_t slot = hashKey(key, keyLength(key), seed) & (SETTINGS_SCHEMA_HASH_SLOTS - 1);
+            if (idx.slots[slot] != 0) {
+                collision = true;
+            } else {
+                idx.slots[slot] = (uint8_t)(i + 1);
+            }
+        }
+        if (!collision) {
+            idx.seed = seed;
+            idx.perfect = true;
+            return idx;
+        }
+    }
+    return idx;
+}
+
+// In flash (.rodata); geen runtime-zoektocht meer in de MQTT-callback
+constexpr SchemaIndex kIndex = buildIndex();
+static_assert(kIndex.perfect, "geen botsingsvrije seed: verhoog SETTINGS_SCHEMA_HASH_SLOTS of SEED_TRIES");
+
+static inline bool keyEquals(const char* schemaKey, const char* key, size_t keyLen) {
+    return strncmp(schemaKey, key, keyLen) == 0 && schemaKey[keyLen] == '\0';
+}
+
+static inline uint8_t* fieldPtr(CryptoMonitorSettings& s, const SettingDesc& d) {
+    return reinterpret_cast<uint8_t*>(&s) + d.offset;
+}
+
+static inline const uint8_t* fieldPtr(const CryptoMonitorSettings& s, const SettingDesc& d) {
+    return reinterpret_cast<const uint8_t*>(&s) + d.offset;
+}
+
+// Numerieke parse: volledige string moet een getal zijn (trailing whitespace toegestaan)
+static bool parseNumber(const char* value, float& out) {
+    if (value == nullptr || value[0] == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const float v = strtof(value, &end);
+    if (end == value || isnan(v) || isinf(v)) {
+        return false;
+    }
+    while (*end == ' ' || *end == '\t' || *end == '\r' || *end == '\n') {
+        end++;
+    }
+    if (*end != '\0') {
+        return false;
+    }
+    out = v;
+    return true;
+}
+
+}  // namespace
+
+const SettingDesc* settingsSchemaFind(const char* key, size_t keyLen) {
+    if (key == nullptr || keyLen == 0) {
+        return nullptr;
+    }
+    const uint32_t slot = hashKey(key, keyLen, kIndex.seed) & (SETTINGS_SCHEMA_HASH_SLOTS - 1);
+    const uint8_t idx = kIndex.slots[slot];
+    if (idx != 0 && keyEquals(kSettingsSchema[idx - 1].key, key, keyLen)) {
+        return &kSettingsSchema[idx - 1];
+    }
+    return nullptr;
+}
+
+bool settingsSchemaApply(const SettingDesc& desc, const char* value, CryptoMonitorSettings& settings) {
+    uint8_t* p = fieldPtr(settings, desc);
+
+    if (desc.type == SETTING_BOOL) {
+        // Home Assistant switch: "ON" = true, "OFF" = false
+        const bool v = (strcmp(value, "ON") == 0 || strcmp(value, "on") == 0 ||
+                        strcmp(value, "1") == 0 || strcmp(value, "true") == 0);
+        *reinterpret_cast<bool*>(p) = v;
+        return true;
+    }
+
+    float v;
+    if (!parseNumber(value, v) || v < desc.minVal || v > desc.maxVal) {
+        return false;
+    }
+    if ((desc.flags & SETTING_F_GT_VOL_LOW) != 0 && v <= settings.volatilityLowThreshold) {
+        return false;
+    }
+
+    // Integer types: HA number-entities kunnen "120.0" sturen → afronden
+    const uint32_t u = (desc.type == SETTING_F32) ? 0u : (uint32_t)lroundf(v);
+    switch (desc.type) {
+        case SETTING_F32: {
+            memcpy(p, &v, sizeof(v));
+            break;
+        }
+        case SETTING_U8:
+            *p = (uint8_t)u;
+            break;
+        case SETTING_U16: {
+            const uint16_t x = (uint16_t)u;
+            memcpy(p, &x, sizeof(x));
+            break;
+        }
+        case SETTING_U32: {
+            memcpy(p, &u, sizeof(u));
+            break;
+        }
+        case SETTING_MS_AS_SEC: {
+            const uint32_t ms = u * 1000UL;  // maxVal houdt dit ruim onder UINT32_MAX
+            memcpy(p, &ms, sizeof(ms));
+            break;
+        }
+        default:
+            return false;
+    }
+    return true;
+}
+
+size_t settingsSchemaFieldSize(const SettingDesc& desc) {
+    switch (desc.type) {
+        case SETTING_U8:
+            return sizeof(uint8_t);
+        case SETTING_U16:
+            return sizeof(uint16_t);
+        case SETTING_BOOL:
+            return sizeof(bool);
+        default:
+            return sizeof(uint32_t);  // F32, U32, MS_AS_SEC
+    }
+}
+
+size_t settingsSchemaFormat(const SettingDesc& desc, const CryptoMonitorSettings& settings, char* out, size_t outLen) {
+    if (out == nullptr || outLen == 0) {
+        return 0;
+    }
+    const uint8_t* p = fieldPtr(settings, desc);
+    int n = 0;
+    switch (desc.type) {
+        case SETTING_F32: {
+            float v;
+            memcpy(&v, p, sizeof(v));
+            n = snprintf(out, outLen, "%.2f", v);
+            break;
+        }
+        case SETTING_U8:
+            n = snprintf(out, outLen, "%u", (unsigned)*p);
+            break;
+        case SETTING_U16: {
+            uint16_t v;
+            memcpy(&v, p, sizeof(v));
+            n = snprintf(out, outLen, "%u", (unsigned)v);
+            break;
+        }
+        case SETTING_U32: {
+            uint32_t v;
+            memcpy(&v, p, sizeof(v));
+            n = snprintf(out, outLen, "%lu", (unsigned long)v);
+            break;
+        }
+        case SETTING_MS_AS_SEC: {
+            uint32_t v;
+            memcpy(&v, p, sizeof(v));
+            n = snprintf(out, outLen, "%lu", (unsigned long)(v / 1000UL));
+            break;
+        }
+        case SETTING_BOOL:
+            n = snprintf(out, outLen, "%s", *reinterpret_cast<const bool*>(p) ? "ON" : "OFF");
+            break;
+        default:
+            out[0] = '\0';
+            break;
+    }
+    return (n > 0) ? (size_t)n : 0;
+}
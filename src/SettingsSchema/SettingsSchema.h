@@ -0,0 +1,62 @@
+#ifndef SETTINGS_SCHEMA_H
+#define SETTINGS_SCHEMA_H
+
+#include <Arduino.h>
+#include "../SettingsStore/SettingsStore.h"
+
+/**
+ * SettingsSchema: één compile-time beschrijving per instelbare scalar
+ *
+ * Elke entry koppelt een key (MQTT-topicdeel: <prefix>/config/<key>[/set]) aan type, offset in
+ * CryptoMonitorSettings en geldig bereik. MQTT-commando's en de config-republish lopen via deze
+ * tabel i.p.v. losse lookup-tabellen en strcmp-ketens; persistentie gaat via SettingsStore-records
+ * (zelfde offsets). Strings en settings met neveneffecten (symbool, taal, rotatie, anchor) blijven
+ * als speciale gevallen in mqttCallback.
+ *
+ * Lookup: perfect hash (FNV-1a met seed; seed en slot-tabel constexpr bij compilatie bepaald), dus
+ * per binnenkomend bericht één hash + één strcmp, onafhankelijk van het aantal settings.
+ */
+
+enum SettingType : uint8_t {
+    SETTING_F32 = 0,     // float, state met 2 decimalen
+    SETTING_U8,
+    SETTING_U16,
+    SETTING_U32,
+    SETTING_MS_AS_SEC,   // uint32_t in ms, extern (MQTT) in seconden
+    SETTING_BOOL         // HA switch: ON/OFF
+};
+
+// Setting-flags
+#define SETTING_F_GT_VOL_LOW 0x01  // Moet groter zijn dan volatilityLowThreshold
+
+struct SettingDesc {
+    const char* key;
+    uint16_t offset;     // offsetof in CryptoMonitorSettings
+    SettingType type;
+    uint8_t flags;
+    float minVal;        // Bereik in externe eenheid (seconden voor SETTING_MS_AS_SEC)
+    float maxVal;
+};
+
+extern const SettingDesc kSettingsSchema[];
+extern const uint16_t kSettingsSchemaCount;
+
+/**
+ * Zoek een setting op key (niet nul-getermineerd: keyLen bytes).
+ * @return nullptr als de key niet in het schema staat
+ */
+const SettingDesc* settingsSchemaFind(const char* key, size_t keyLen);
+
+/**
+ * Parse en valideer value; bij succes wordt het veld in settings gezet.
+ * @return false bij ongeldige waarde of buiten bereik (settings ongewijzigd)
+ */
+bool settingsSchemaApply(const SettingDesc& desc, const char* value, CryptoMonitorSettings& settings);
+
+// Grootte van het veld in CryptoMonitorSettings (voor kopiëren van/naar de bijbehorende globale variabele)
+size_t settingsSchemaFieldSize(const SettingDesc& desc);
+
+// Formatteer de huidige waarde zoals hij als MQTT-state gepubliceerd wordt
+size_t settingsSchemaFormat(const SettingDesc& desc, const CryptoMonitorSettings& settings, char* out, size_t outLen);
+
+#endif // SETTINGS_SCHEMA_H
@@ -5,6 +5,11 @@
 // Forward declaration voor hasPSRAM (gedefinieerd in main sketch)
 extern bool hasPSRAM();
 
+// Include alleen DEBUG_BUTTON_ONLY, niet de hele platform_config.h (voorkomt PINS includes)
+#ifndef DEBUG_BUTTON_ONLY
+#define DEBUG_BUTTON_ONLY 1
+#endif
+
 // Include default constants (moet vanuit hoofdbestand komen)
 // Voor nu gebruiken we de waarden direct - deze worden later via includes opgelost
 #ifndef THRESHOLD_1MIN_UP_DEFAULT
@@ -375,6 +380,10 @@ void SettingsStore::generateDefaultNtfyTopic(char* buffer, size_t bufferSize) {
 }
 
 CryptoMonitorSettings::CryptoMonitorSettings() {
+    // Eerst alles (incl. padding en string-staarten) op 0: records worden byte-voor-byte
+    // vergeleken (dirty-mask) en gepersisteerd, dus de inhoud moet deterministisch zijn
+    memset(static_cast<void*>(this), 0, sizeof(*this));
+
     // Initialize met defaults
     ntfyTopic[0] = '\0';
     strncpy(bitvavoSymbol, BITVAVO_SYMBOL_DEFAULT, sizeof(bitvavoSymbol) - 1);
@@ -385,6 +394,7 @@ CryptoMonitorSettings::CryptoMonitorSettings() {
     chartColorMode[sizeof(chartColorMode) - 1] = '\0';
     strncpy(chartColorManual, "orange", sizeof(chartColorManual) - 1);
     chartColorManual[sizeof(chartColorManual) - 1] = '\0';
+    chartHorizon = 0;  // Live
 
     // Alert thresholds defaults
     alertThresholds.spike1m = SPIKE_1M_THRESHOLD_DEFAULT;
@@ -540,30 +550,135 @@ CryptoMonitorSettings::CryptoMonitorSettings() {
     alert2HThresholds.autoAnchorFlags = 0;  // intervalMode=0, notifyEnabled=false
 }
 
-CryptoMonitorSettings SettingsStore::load() {
-    CryptoMonitorSettings settings;
-    prefs.begin(PREF_NAMESPACE, true); // read-only mode
-    
+// Settings-records: aaneengesloten member-ranges van CryptoMonitorSettings, elk als één NVS-blob.
+// Nieuwe velden alleen ACHTERAAN een record toevoegen: een korter opgeslagen record wordt dan als
+// prefix geladen (rest = defaults). Andere layout-wijzigingen vereisen SETTINGS_BLOB_VERSION++.
+// Auto-anchor state blijft in zijn eigen AutoAnchorPersist-blob (record SETTINGS_REC_AUTO_ANCHOR).
+#define SETTINGS_RANGE(first, next) \
+    (uint16_t)offsetof(CryptoMonitorSettings, first), \
+    (uint16_t)(offsetof(CryptoMonitorSettings, next) - offsetof(CryptoMonitorSettings, first))
+
+static const size_t kAutoAnchorOffset =
+    offsetof(CryptoMonitorSettings, alert2HThresholds) + offsetof(Alert2HThresholds, anchorSourceMode);
+static const size_t kAutoAnchorEnd =
+    offsetof(CryptoMonitorSettings, alert2HThresholds) + offsetof(Alert2HThresholds, autoAnchorFlags) + 1;
+
+const SettingsStore::Record SettingsStore::RECORDS[SETTINGS_REC_BLOB_COUNT] = {
+    {"sbBasic", SETTINGS_RANGE(ntfyTopic, alertThresholds)},
+    {"sbAlert", SETTINGS_RANGE(alertThresholds, alert2HThresholds)},
+    {"sb2h", (uint16_t)offsetof(CryptoMonitorSettings, alert2HThresholds),
+             (uint16_t)(kAutoAnchorOffset - offsetof(CryptoMonitorSettings, alert2HThresholds))},
+    {"sbCdMqtt", SETTINGS_RANGE(notificationCooldowns, anchorTakeProfit)},
+    {"sbModes", SETTINGS_RANGE(anchorTakeProfit, regimeEngineEnabled)},
+    {"sbRegime", (uint16_t)offsetof(CryptoMonitorSettings, regimeEngineEnabled),
+                 (uint16_t)(sizeof(CryptoMonitorSettings) - offsetof(CryptoMonitorSettings, regimeEngineEnabled))},
+};
+
+#undef SETTINGS_RANGE
+
+static_assert(offsetof(CryptoMonitorSettings, anchorTakeProfit) - offsetof(CryptoMonitorSettings, notificationCooldowns)
+                  <= SETTINGS_BLOB_MAX_PAYLOAD, "sbCdMqtt record te groot");
+static_assert(sizeof(CryptoMonitorSettings) - offsetof(CryptoMonitorSettings, regimeEngineEnabled)
+                  <= SETTINGS_BLOB_MAX_PAYLOAD, "sbRegime record te groot");
+static_assert(offsetof(CryptoMonitorSettings, regimeEngineEnabled) - offsetof(CryptoMonitorSettings, anchorTakeProfit)
+                  <= SETTINGS_BLOB_MAX_PAYLOAD, "sbModes record te groot");
+
+// CRC16 (poly 0xA001), zelfde als AutoAnchorPersist::calculateCRC
+static uint16_t settingsCrc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc & 1) crc = (crc >> 1) ^ 0xA001;
+            else crc >>= 1;
+        }
+    }
+    return crc;
+}
+
+// Lees-/schrijfbuffer voor één record (header + payload). Static: load/save draaien niet parallel
+// (Preferences-handle 'prefs' is ook gedeeld) en dit houdt ~500 bytes van de task-stacks af.
+static uint8_t s_recordBuf[sizeof(SettingsBlobHeader) + SETTINGS_BLOB_MAX_PAYLOAD];
+
+// Laad alle settings-records; retourneert mask van records die geldig uit een blob kwamen.
+// needsRewrite krijgt records die wel geladen zijn maar opnieuw weggeschreven moeten worden
+// (opgeslagen met andere lengte na firmware-update).
+uint8_t SettingsStore::loadRecords(CryptoMonitorSettings& settings, uint8_t& needsRewrite, uint8_t& corruptMask) {
+    uint8_t loadedMask = 0;
+    uint8_t* dst = reinterpret_cast<uint8_t*>(&settings);
+    for (uint8_t r = 0; r < SETTINGS_REC_BLOB_COUNT; r++) {
+        const Record& rec = RECORDS[r];
+        size_t got = prefs.getBytes(rec.key, s_recordBuf, sizeof(s_recordBuf));
+        if (got < sizeof(SettingsBlobHeader)) {
+            continue;  // Nog geen blob (eerste boot na update) of te groot
+        }
+        SettingsBlobHeader hdr;
+        memcpy(&hdr, s_recordBuf, sizeof(hdr));
+        const uint8_t* payload = s_recordBuf + sizeof(hdr);
+        if (hdr.magic != SETTINGS_BLOB_MAGIC || hdr.version != SETTINGS_BLOB_VERSION || hdr.record != r ||
+            got != sizeof(hdr) + hdr.length || hdr.crc != settingsCrc16(payload, hdr.length)) {
+            Serial.printf("[SettingsStore] Record %s ongeldig (len=%u, CRC/header), fallback naar defaults\n",
+                          rec.key, (unsigned)got);
+            corruptMask |= (uint8_t)(1u << r);
+            continue;
+        }
+        const uint16_t copyLen = (hdr.length < rec.length) ? hdr.length : rec.length;
+        memcpy(dst + rec.offset, payload, copyLen);
+        if (hdr.length != rec.length) {
+            needsRewrite |= (uint8_t)(1u << r);
+        }
+        loadedMask |= (uint8_t)(1u << r);
+    }
+    return loadedMask;
+}
+
+// Schrijf één record als blob; true bij succes
+bool SettingsStore::writeRecord(uint8_t r, const CryptoMonitorSettings& settings) {
+    const Record& rec = RECORDS[r];
+    SettingsBlobHeader hdr;
+    hdr.magic = SETTINGS_BLOB_MAGIC;
+    hdr.version = SETTINGS_BLOB_VERSION;
+    hdr.record = r;
+    hdr.length = rec.length;
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(&settings) + rec.offset;
+    hdr.crc = settingsCrc16(src, rec.length);
+    memcpy(s_recordBuf, &hdr, sizeof(hdr));
+    memcpy(s_recordBuf + sizeof(hdr), src, rec.length);
+    const size_t total = sizeof(hdr) + rec.length;
+    return prefs.putBytes(rec.key, s_recordBuf, total) == total;
+}
+
+// Dirty-mask: welke records verschillen van wat laatst naar NVS geschreven/gelezen is
+uint8_t SettingsStore::computeDirtyMask(const CryptoMonitorSettings& settings) const {
+    if (!persistedValid) {
+        return SETTINGS_REC_ALL;
+    }
+    const uint8_t* cur = reinterpret_cast<const uint8_t*>(&settings);
+    const uint8_t* old = reinterpret_cast<const uint8_t*>(&persisted);
+    uint8_t mask = 0;
+    for (uint8_t r = 0; r < SETTINGS_REC_BLOB_COUNT; r++) {
+        if (memcmp(cur + RECORDS[r].offset, old + RECORDS[r].offset, RECORDS[r].length) != 0) {
+            mask |= (uint8_t)(1u << r);
+        }
+    }
+    if (memcmp(cur + kAutoAnchorOffset, old + kAutoAnchorOffset, kAutoAnchorEnd - kAutoAnchorOffset) != 0) {
+        mask |= (uint8_t)(1u << SETTINGS_REC_AUTO_ANCHOR);
+    }
+    return mask;
+}
+
+// Legacy: één key per veld (firmware vóór settings-records). Alleen nog gebruikt voor migratie
+// en als fallback voor een ontbrekend/corrupt record.
+void SettingsStore::loadLegacyKeys(CryptoMonitorSettings& settings) {
     // Generate default NTFY topic
     char defaultTopic[64];
     generateDefaultNtfyTopic(defaultTopic, sizeof(defaultTopic));
     
-    // Load NTFY topic with migration logic (geoptimaliseerd: gebruik helper)
+    // Load NTFY topic (migratie van oude topic-formaten gebeurt in load(), voor blob én legacy)
     char topicBuffer[64];
     String topic = prefs.getString(PREF_KEY_NTFY_TOPIC, defaultTopic);
     topic.toCharArray(topicBuffer, sizeof(topicBuffer));
     
-    // Geoptimaliseerd: gebruik helper functie voor migration check
-    if (needsTopicMigration(topicBuffer)) {
-        strncpy(topicBuffer, defaultTopic, sizeof(topicBuffer) - 1);
-        topicBuffer[sizeof(topicBuffer) - 1] = '\0';
-        prefs.end();
-        prefs.begin(PREF_NAMESPACE, false);
-        prefs.putString(PREF_KEY_NTFY_TOPIC, topicBuffer);
-        prefs.end();
-        prefs.begin(PREF_NAMESPACE, true);
-    }
-    
     strncpy(settings.ntfyTopic, topicBuffer, sizeof(settings.ntfyTopic) - 1);
     settings.ntfyTopic[sizeof(settings.ntfyTopic) - 1] = '\0';
     
@@ -739,6 +854,47 @@ CryptoMonitorSettings SettingsStore::load() {
     settings.alert2HThresholds.twoHSecondaryGlobalCooldownSec = prefs.getULong(PREF_KEY_2H_SEC_GLOBAL_CD, 14400UL);
     settings.alert2HThresholds.twoHSecondaryCoalesceWindowSec = prefs.getULong(PREF_KEY_2H_SEC_COALESCE, 180UL);
     
+}
+
+CryptoMonitorSettings SettingsStore::load() {
+    CryptoMonitorSettings settings;
+    prefs.begin(PREF_NAMESPACE, true); // read-only mode
+
+    // Snelle pad: één getBytes per record
+    uint8_t rewriteMask = 0;
+    uint8_t corruptMask = 0;
+    const uint8_t loadedMask = loadRecords(settings, rewriteMask, corruptMask);
+    const uint8_t blobMask = (uint8_t)((1u << SETTINGS_REC_BLOB_COUNT) - 1u);
+    // Ontbrekende records (nog nooit als blob geschreven): migratie uit de losse keys.
+    // Corrupte records (CRC/header): defaults uit de constructor; de losse keys zijn na migratie
+    // niet meer bijgewerkt en dus mogelijk sterk verouderd.
+    const uint8_t missingMask = (uint8_t)(blobMask & ~loadedMask & ~corruptMask);
+    if (missingMask != 0) {
+        CryptoMonitorSettings legacy;
+        loadLegacyKeys(legacy);
+        uint8_t* dst = reinterpret_cast<uint8_t*>(&settings);
+        const uint8_t* src = reinterpret_cast<const uint8_t*>(&legacy);
+        for (uint8_t r = 0; r < SETTINGS_REC_BLOB_COUNT; r++) {
+            if ((missingMask & (1u << r)) != 0) {
+                memcpy(dst + RECORDS[r].offset, src + RECORDS[r].offset, RECORDS[r].length);
+                rewriteMask |= (uint8_t)(1u << r);
+            }
+        }
+    }
+    if (corruptMask != 0) {
+        Serial.printf("[SettingsStore] Corrupte records (mask 0x%02X) teruggezet naar defaults\n", corruptMask);
+        rewriteMask |= corruptMask;
+    }
+
+    // NTFY topic migratie (oude formaten → device-specifiek default topic)
+    if (settings.ntfyTopic[0] == '\0' || needsTopicMigration(settings.ntfyTopic)) {
+        char defaultTopic[64];
+        generateDefaultNtfyTopic(defaultTopic, sizeof(defaultTopic));
+        memset(settings.ntfyTopic, 0, sizeof(settings.ntfyTopic));
+        strncpy(settings.ntfyTopic, defaultTopic, sizeof(settings.ntfyTopic) - 1);
+        rewriteMask |= (uint8_t)(1u << SETTINGS_REC_BASIC);
+    }
+    
     // Load Auto Anchor settings (gebruik config-blob indien beschikbaar, anders individuele keys)
     bool psramAvailable = hasPSRAM();
     AutoAnchorPersist blob;
@@ -820,129 +976,25 @@ CryptoMonitorSettings SettingsStore::load() {
     if (settings.alert2HThresholds.autoAnchorW4hTrendBoost_x100 > 100) settings.alert2HThresholds.autoAnchorW4hTrendBoost_x100 = 100;  // 1.0
     
     prefs.end();
+
+    // Cache = NVS-inhoud; records die gemigreerd/aangepast zijn worden nu weggeschreven
+    persisted = settings;
+    persistedValid = true;
+    if (rewriteMask != 0) {
+        prefs.begin(PREF_NAMESPACE, false);
+        for (uint8_t r = 0; r < SETTINGS_REC_BLOB_COUNT; r++) {
+            if ((rewriteMask & (1u << r)) != 0 && !writeRecord(r, settings)) {
+                persistedValid = false;  // Volgende save schrijft alles opnieuw
+            }
+        }
+        prefs.end();
+        Serial.printf("[SettingsStore] Settings-records gemigreerd (mask 0x%02X)\n", rewriteMask);
+    }
     return settings;
 }
 
-void SettingsStore::save(const CryptoMonitorSettings& settings) {
-    prefs.begin(PREF_NAMESPACE, false); // read-write mode
-    
-    // Save basic settings
-    prefs.putString(PREF_KEY_NTFY_TOPIC, settings.ntfyTopic);
-    prefs.putString(PREF_KEY_BITVAVO_SYMBOL, settings.bitvavoSymbol);
-    prefs.putUChar(PREF_KEY_LANGUAGE, settings.language);
-    prefs.putUChar(PREF_KEY_DISPLAY_ROTATION, settings.displayRotation);
-    prefs.putString(PREF_KEY_CHART_COLOR_MODE, settings.chartColorMode);
-    prefs.putString(PREF_KEY_CHART_COLOR_MANUAL, settings.chartColorManual);
-
-    // Save alert thresholds
-    prefs.putFloat(PREF_KEY_TH1_UP, settings.alertThresholds.threshold1MinUp);
-    prefs.putFloat(PREF_KEY_TH1_DOWN, settings.alertThresholds.threshold1MinDown);
-    prefs.putFloat(PREF_KEY_TH30_UP, settings.alertThresholds.threshold30MinUp);
-    prefs.putFloat(PREF_KEY_TH30_DOWN, settings.alertThresholds.threshold30MinDown);
-    prefs.putFloat(PREF_KEY_SPIKE1M, settings.alertThresholds.spike1m);
-    prefs.putFloat(PREF_KEY_SPIKE5M, settings.alertThresholds.spike5m);
-    prefs.putFloat(PREF_KEY_MOVE30M, settings.alertThresholds.move30m);
-    prefs.putFloat(PREF_KEY_MOVE5M, settings.alertThresholds.move5m);
-    prefs.putFloat(PREF_KEY_MOVE5M_ALERT, settings.alertThresholds.move5mAlert);
-    
-    // Save notification cooldowns
-    prefs.putULong(PREF_KEY_CD1MIN, settings.notificationCooldowns.cooldown1MinMs);
-    prefs.putULong(PREF_KEY_CD30MIN, settings.notificationCooldowns.cooldown30MinMs);
-    prefs.putULong(PREF_KEY_CD5MIN, settings.notificationCooldowns.cooldown5MinMs);
-    
-    // Save MQTT settings
-    prefs.putString(PREF_KEY_MQTT_HOST, settings.mqttHost);
-    prefs.putUInt(PREF_KEY_MQTT_PORT, settings.mqttPort);
-    prefs.putString(PREF_KEY_MQTT_USER, settings.mqttUser);
-    prefs.putString(PREF_KEY_MQTT_PASS, settings.mqttPass);
-    
-    // Save anchor settings
-    prefs.putFloat(PREF_KEY_ANCHOR_TP, settings.anchorTakeProfit);
-    prefs.putFloat(PREF_KEY_ANCHOR_ML, settings.anchorMaxLoss);
-    prefs.putUChar(PREF_KEY_ANCHOR_STRATEGY, settings.anchorStrategy);
-    
-    // Save trend-adaptive anchor settings
-    prefs.putBool(PREF_KEY_TREND_ADAPT, settings.trendAdaptiveAnchorsEnabled);
-    prefs.putFloat(PREF_KEY_UP_ML_MULT, settings.uptrendMaxLossMultiplier);
-    prefs.putFloat(PREF_KEY_UP_TP_MULT, settings.uptrendTakeProfitMultiplier);
-    prefs.putFloat(PREF_KEY_DOWN_ML_MULT, settings.downtrendMaxLossMultiplier);
-    prefs.putFloat(PREF_KEY_DOWN_TP_MULT, settings.downtrendTakeProfitMultiplier);
-    
-    // Save Smart Confluence Mode
-    prefs.putBool(PREF_KEY_SMART_CONF, settings.smartConfluenceEnabled);
-    
-    // Save Nachtstand
-    prefs.putBool(PREF_KEY_NIGHT_MODE, settings.nightModeEnabled);
-    prefs.putUChar(PREF_KEY_NIGHT_START_HOUR, settings.nightModeStartHour);
-    prefs.putUChar(PREF_KEY_NIGHT_END_HOUR, settings.nightModeEndHour);
-    prefs.putFloat(PREF_KEY_NIGHT_SPIKE5M, settings.nightSpike5mThreshold);
-    prefs.putFloat(PREF_KEY_NIGHT_MOVE5M, settings.nightMove5mAlertThreshold);
-    prefs.putFloat(PREF_KEY_NIGHT_MOVE30M, settings.nightMove30mThreshold);
-    prefs.putUShort(PREF_KEY_NIGHT_CD5M, settings.nightCooldown5mSec);
-    prefs.putFloat(PREF_KEY_NIGHT_AV_MIN, settings.nightAutoVolMinMultiplier);
-    prefs.putFloat(PREF_KEY_NIGHT_AV_MAX, settings.nightAutoVolMaxMultiplier);
-    
-    // Save Warm-Start settings
-    prefs.putBool(PREF_KEY_WARM_START, settings.warmStartEnabled);
-    prefs.putUChar(PREF_KEY_WS1M_EXTRA, settings.warmStart1mExtraCandles);
-    prefs.putUChar(PREF_KEY_WS5M, settings.warmStart5mCandles);
-    prefs.putUChar(PREF_KEY_WS30M, settings.warmStart30mCandles);
-    prefs.putUChar(PREF_KEY_WS2H, settings.warmStart2hCandles);
-    prefs.putBool(PREF_KEY_WS_SKIP_1M, settings.warmStartSkip1m);
-    prefs.putBool(PREF_KEY_WS_SKIP_5M, settings.warmStartSkip5m);
-    
-    // Save Auto-Volatility Mode settings
-    prefs.putBool(PREF_KEY_AUTO_VOL, settings.autoVolatilityEnabled);
-    prefs.putUChar(PREF_KEY_AUTO_VOL_WIN, settings.autoVolatilityWindowMinutes);
-    prefs.putFloat(PREF_KEY_AUTO_VOL_BASE, settings.autoVolatilityBaseline1mStdPct);
-    prefs.putFloat(PREF_KEY_AUTO_VOL_MIN, settings.autoVolatilityMinMultiplier);
-    prefs.putFloat(PREF_KEY_AUTO_VOL_MAX, settings.autoVolatilityMaxMultiplier);
-    
-    // Save trend and volatility settings
-    prefs.putFloat(PREF_KEY_TREND_TH, settings.trendThreshold);
-    prefs.putFloat(PREF_KEY_VOL_LOW, settings.volatilityLowThreshold);
-    prefs.putFloat(PREF_KEY_VOL_HIGH, settings.volatilityHighThreshold);
-
-    // Save regime-engine settings
-    prefs.putBool(PREF_KEY_REGIME_EN, settings.regimeEngineEnabled);
-    prefs.putUInt(PREF_KEY_REGIME_DWELL, settings.regimeMinDwellSec);
-    prefs.putFloat(PREF_KEY_REGIME_EG_IN, settings.regimeEnergeticEnter);
-    prefs.putFloat(PREF_KEY_REGIME_EG_OUT, settings.regimeEnergeticExit);
-    prefs.putFloat(PREF_KEY_REGIME_SL_IN, settings.regimeSlapEnter);
-    prefs.putFloat(PREF_KEY_REGIME_SL_OUT, settings.regimeSlapExit);
-    prefs.putFloat(PREF_KEY_REGIME_LD_FLR, settings.regimeLoadedFloor);
-    prefs.putFloat(PREF_KEY_REGIME_LD_DR, settings.regimeLoadedDrop);
-    prefs.putFloat(PREF_KEY_REGIME_DD_1M, settings.regimeDirDeadband1mPct);
-    prefs.putFloat(PREF_KEY_REGIME_DD_5M, settings.regimeDirDeadband5mPct);
-    prefs.putFloat(PREF_KEY_REGIME_DD_30M, settings.regimeDirDeadband30mPct);
-    prefs.putFloat(PREF_KEY_REGIME_DD_2H, settings.regimeDirDeadband2hPct);
-    prefs.putFloat(PREF_KEY_REGIME_2H_CMIN, settings.regime2hCompressMinPct);
-    prefs.putFloat(PREF_KEY_REGIME_2H_CMAX, settings.regime2hCompressMaxPct);
-
-    // Save regime Fase B multipliers
-    prefs.putFloat(PREF_KEY_RG_SL_S1, settings.regimeSlapSpike1mMult);
-    prefs.putFloat(PREF_KEY_RG_SL_M5, settings.regimeSlapMove5mAlertMult);
-    prefs.putFloat(PREF_KEY_RG_SL_M30, settings.regimeSlapMove30mMult);
-    prefs.putFloat(PREF_KEY_RG_SL_C1, settings.regimeSlapCooldown1mMult);
-    prefs.putFloat(PREF_KEY_RG_SL_C5, settings.regimeSlapCooldown5mMult);
-    prefs.putFloat(PREF_KEY_RG_SL_C30, settings.regimeSlapCooldown30mMult);
-    prefs.putFloat(PREF_KEY_RG_GE_S1, settings.regimeGeladenSpike1mMult);
-    prefs.putFloat(PREF_KEY_RG_GE_M5, settings.regimeGeladenMove5mAlertMult);
-    prefs.putFloat(PREF_KEY_RG_GE_M30, settings.regimeGeladenMove30mMult);
-    prefs.putFloat(PREF_KEY_RG_GE_C1, settings.regimeGeladenCooldown1mMult);
-    prefs.putFloat(PREF_KEY_RG_GE_C5, settings.regimeGeladenCooldown5mMult);
-    prefs.putFloat(PREF_KEY_RG_GE_C30, settings.regimeGeladenCooldown30mMult);
-    prefs.putFloat(PREF_KEY_RG_EN_S1, settings.regimeEnergiekSpike1mMult);
-    prefs.putFloat(PREF_KEY_RG_EN_M5, settings.regimeEnergiekMove5mAlertMult);
-    prefs.putFloat(PREF_KEY_RG_EN_M30, settings.regimeEnergiekMove30mMult);
-    prefs.putFloat(PREF_KEY_RG_EN_C1, settings.regimeEnergiekCooldown1mMult);
-    prefs.putFloat(PREF_KEY_RG_EN_C5, settings.regimeEnergiekCooldown5mMult);
-    prefs.putFloat(PREF_KEY_RG_EN_C30, settings.regimeEnergiekCooldown30mMult);
-    prefs.putBool(PREF_KEY_RG_EN_S1BR, settings.regimeEnergiekAllowStandalone1mBurst);
-    prefs.putFloat(PREF_KEY_RG_EN_S1FX, settings.regimeEnergiekStandalone1mFactor);
-    prefs.putFloat(PREF_KEY_RG_EN_DIR, settings.regimeEnergiekMinDirectionStrength);
-    
-    // Save Auto Anchor settings (gebruik config-blob)
+// Auto Anchor state (eigen config-blob, met fallback naar individuele keys)
+void SettingsStore::saveAutoAnchorRecord(const CryptoMonitorSettings& settings) {
     AutoAnchorPersist blob;
     blob.version = 1;
     blob.anchorSourceMode = settings.alert2HThresholds.anchorSourceMode;
@@ -990,28 +1042,32 @@ void SettingsStore::save(const CryptoMonitorSettings& settings) {
         prefs.putUChar(PREF_KEY_AUTO_ANCHOR_INTERVAL_MODE, settings.alert2HThresholds.getAutoAnchorIntervalMode());
         prefs.putBool(PREF_KEY_AUTO_ANCHOR_NOTIFY_ENABLED, settings.alert2HThresholds.getAutoAnchorNotifyEnabled());
     }
-    
-    // Save 2-hour alert thresholds
-    prefs.putFloat(PREF_KEY_2H_BREAK_MARGIN, settings.alert2HThresholds.breakMarginPct);
-    prefs.putFloat(PREF_KEY_2H_BREAK_RESET, settings.alert2HThresholds.breakResetMarginPct);
-    prefs.putULong(PREF_KEY_2H_BREAK_CD, settings.alert2HThresholds.breakCooldownMs);
-    prefs.putFloat(PREF_KEY_2H_MEAN_MIN_DIST, settings.alert2HThresholds.meanMinDistancePct);
-    prefs.putFloat(PREF_KEY_2H_MEAN_TOUCH, settings.alert2HThresholds.meanTouchBandPct);
-    prefs.putULong(PREF_KEY_2H_MEAN_CD, settings.alert2HThresholds.meanCooldownMs);
-    prefs.putFloat(PREF_KEY_2H_COMPRESS_TH, settings.alert2HThresholds.compressThresholdPct);
-    prefs.putFloat(PREF_KEY_2H_COMPRESS_RESET, settings.alert2HThresholds.compressResetPct);
-    prefs.putULong(PREF_KEY_2H_COMPRESS_CD, settings.alert2HThresholds.compressCooldownMs);
-    prefs.putFloat(PREF_KEY_2H_ANCHOR_MARGIN, settings.alert2HThresholds.anchorOutsideMarginPct);
-    prefs.putULong(PREF_KEY_2H_ANCHOR_CD, settings.alert2HThresholds.anchorCooldownMs);
-    // FASE X.4: Trend hysteresis en throttling settings
-    prefs.putFloat(PREF_KEY_2H_TREND_HYSTERESIS, settings.alert2HThresholds.trendHysteresisFactor);
-    prefs.putULong(PREF_KEY_2H_THROTTLE_TREND_CHANGE, settings.alert2HThresholds.throttlingTrendChangeMs);
-    prefs.putULong(PREF_KEY_2H_THROTTLE_TREND_MEAN, settings.alert2HThresholds.throttlingTrendToMeanMs);
-    prefs.putULong(PREF_KEY_2H_THROTTLE_MEAN_TOUCH, settings.alert2HThresholds.throttlingMeanTouchMs);
-    prefs.putULong(PREF_KEY_2H_THROTTLE_COMPRESS, settings.alert2HThresholds.throttlingCompressMs);
-    // FASE X.5: Secondary global cooldown en coalescing settings
-    prefs.putULong(PREF_KEY_2H_SEC_GLOBAL_CD, settings.alert2HThresholds.twoHSecondaryGlobalCooldownSec);
-    prefs.putULong(PREF_KEY_2H_SEC_COALESCE, settings.alert2HThresholds.twoHSecondaryCoalesceWindowSec);
-    
+}
+
+void SettingsStore::save(const CryptoMonitorSettings& settings) {
+    // Alleen gewijzigde records schrijven: één WebUI/MQTT-wijziging = één blob-write
+    const uint8_t dirty = computeDirtyMask(settings);
+    if (dirty == 0) {
+        return;  // Niets gewijzigd: geen flash-write
+    }
+
+    prefs.begin(PREF_NAMESPACE, false); // read-write mode
+    bool ok = true;
+    for (uint8_t r = 0; r < SETTINGS_REC_BLOB_COUNT; r++) {
+        if ((dirty & (1u << r)) != 0 && !writeRecord(r, settings)) {
+            Serial.printf("[SettingsStore] WARNING: Failed to save record %s\n", RECORDS[r].key);
+            ok = false;
+        }
+    }
+    if ((dirty & (1u << SETTINGS_REC_AUTO_ANCHOR)) != 0) {
+        saveAutoAnchorRecord(settings);
+    }
     prefs.end();
+
+    persisted = settings;
+    persistedValid = ok;  // Bij een mislukte write: volgende save schrijft alle records opnieuw
+
+#if !DEBUG_BUTTON_ONLY
+    Serial.printf("[SettingsStore] Saved records mask 0x%02X\n", dirty);
+#endif
 }
@@ -234,11 +234,42 @@ struct CryptoMonitorSettings {
     bool regimeEnergiekAllowStandalone1mBurst;
     float regimeEnergiekStandalone1mFactor;
     float regimeEnergiekMinDirectionStrength;
+
+    // Grafiekhorizon (ChartHistory): 0 = live, 1 = 1u, 2 = 24u, 3 = 7d. Achteraan record sbRegime.
+    uint8_t chartHorizon;
     
     // Constructor met defaults
     CryptoMonitorSettings();
 };
 
+// Settings worden per record (groep aaneengesloten velden) als één NVS-blob opgeslagen:
+// header + ruwe bytes. save() schrijft alleen records die verschillen van de laatst
+// gepersisteerde inhoud; load() doet één getBytes per record.
+#define SETTINGS_BLOB_MAGIC 0x5342       // 'SB'
+#define SETTINGS_BLOB_VERSION 1          // Ophogen bij niet-append layout-wijziging
+#define SETTINGS_BLOB_MAX_PAYLOAD 480    // Ruimte voor groei van het grootste record
+
+struct SettingsBlobHeader {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t record;     // Record-index (SETTINGS_REC_*)
+    uint16_t length;    // Payload-lengte in bytes
+    uint16_t crc;       // CRC16 over de payload
+};
+static_assert(sizeof(SettingsBlobHeader) == 8, "SettingsBlobHeader layout");
+
+enum SettingsRecordId : uint8_t {
+    SETTINGS_REC_BASIC = 0,       // ntfy, symbool, taal, rotatie, grafiekkleur
+    SETTINGS_REC_ALERTS = 1,      // 1m/5m/30m thresholds
+    SETTINGS_REC_2H = 2,          // 2h thresholds/throttling (zonder auto-anchor state)
+    SETTINGS_REC_CD_MQTT = 3,     // Cooldowns + MQTT
+    SETTINGS_REC_MODES = 4,       // Anchor, trend-adaptive, nachtstand, warm-start, auto-vol, trend/vol
+    SETTINGS_REC_REGIME = 5,      // Regime-engine + multipliers
+    SETTINGS_REC_BLOB_COUNT = 6,
+    SETTINGS_REC_AUTO_ANCHOR = 6, // Bestaande AutoAnchorPersist-blob
+    SETTINGS_REC_ALL = 0x7F
+};
+
 class SettingsStore {
 public:
     SettingsStore();
@@ -254,6 +285,23 @@ public:
 private:
     Preferences prefs;
     static const char* PREF_NAMESPACE;
+
+    struct Record {
+        const char* key;
+        uint16_t offset;   // offsetof in CryptoMonitorSettings
+        uint16_t length;
+    };
+    static const Record RECORDS[SETTINGS_REC_BLOB_COUNT];
+
+    // Laatst naar NVS geschreven/gelezen settings (basis voor de dirty-mask)
+    CryptoMonitorSettings persisted;
+    bool persistedValid = false;
+
+    uint8_t loadRecords(CryptoMonitorSettings& settings, uint8_t& needsRewrite, uint8_t& corruptMask);
+    bool writeRecord(uint8_t record, const CryptoMonitorSettings& settings);
+    uint8_t computeDirtyMask(const CryptoMonitorSettings& settings) const;
+    void loadLegacyKeys(CryptoMonitorSettings& settings);
+    void saveAutoAnchorRecord(const CryptoMonitorSettings& settings);
     
     // Helper: Load string preference (geoptimaliseerd: elimineert duplicatie)
     void loadStringPreference(const char* key, char* buffer, size_t bufferSize, const char* defaultValue);
@@ -0,0 +1,182 @@
+#include "TaskTopology.h"
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+
+#if (configGENERATE_RUN_TIME_STATS == 1) && (configUSE_TRACE_FACILITY == 1)
+#define TASK_TOPOLOGY_RUNTIME_STATS 1
+#else
+#define TASK_TOPOLOGY_RUNTIME_STATS 0
+#endif
+
+struct TaskEntry {
+    TaskSpec spec;
+    TaskHandle_t handle;
+    uint32_t lastRunTime;
+};
+
+static TaskEntry s_tasks[TASK_TOPOLOGY_MAX];
+static size_t s_taskCount = 0;
+static TaskCpuStats s_stats[TASK_TOPOLOGY_MAX];
+static float s_idlePct[2] = {-1.0f, -1.0f};
+static portMUX_TYPE s_statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+static bool addEntry(const TaskSpec& sp, TaskHandle_t h)
+{
+    if (h == nullptr) {
+        return false;
+    }
+    portENTER_CRITICAL(&s_statsMux);
+    const bool room = s_taskCount < TASK_TOPOLOGY_MAX;
+    if (room) {
+        TaskEntry& e = s_tasks[s_taskCount];
+        e.spec = sp;
+        e.handle = h;
+        e.lastRunTime = 0;
+        s_stats[s_taskCount].name = sp.name;
+        s_stats[s_taskCount].core = (int8_t)sp.core;
+        s_stats[s_taskCount].cpuPct = -1.0f;
+        s_stats[s_taskCount].stackHwmBytes = 0;
+        s_taskCount++;
+    }
+    portEXIT_CRITICAL(&s_statsMux);
+    if (!room) {
+        Serial.printf("[TaskTopo] WARN: tabel vol (%u), %s niet gevolgd\n", (unsigned)TASK_TOPOLOGY_MAX, sp.name);
+    }
+    return room;
+}
+
+bool taskTopologyStart(const char* profile, const TaskSpec* specs, size_t count)
+{
+    bool ok = true;
+#if !TASK_TOPOLOGY_RUNTIME_STATS
+    Serial.println(F("[TaskTopo] cpuPct/idlePct niet beschikbaar: configGENERATE_RUN_TIME_STATS of "
+                     "configUSE_TRACE_FACILITY staat uit in de core-sdkconfig (waarden blijven -1)"));
+#endif
+    for (size_t i = 0; i < count; i++) {
+        const TaskSpec& sp = specs[i];
+        TaskHandle_t h = nullptr;
+        const BaseType_t rc = xTaskCreatePinnedToCore(sp.fn, sp.name, sp.stackBytes, NULL, sp.priority, &h, sp.core);
+        if (rc != pdPASS) {
+            ok = false;
+            h = nullptr;
+        }
+        if (sp.handleOut != nullptr) {
+            *sp.handleOut = h;
+        }
+        Serial.printf("[TaskTopo] profile=%s task=%s core=%d prio=%u stack=%lu period=%ums%s\n",
+                      profile, sp.name, (int)sp.core, (unsigned)sp.priority,
+                      (unsigned long)sp.stackBytes, (unsigned)sp.periodMs, (rc == pdPASS) ? "" : " CREATE_FAILED");
+        addEntry(sp, h);
+    }
+    return ok;
+}
+
+bool taskTopologyRegister(const TaskSpec& spec, TaskHandle_t handle)
+{
+    Serial.printf("[TaskTopo] extern task=%s core=%d prio=%u stack=%lu period=%ums\n",
+                  spec.name, (int)spec.core, (unsigned)spec.priority,
+                  (unsigned long)spec.stackBytes, (unsigned)spec.periodMs);
+    return addEntry(spec, handle);
+}
+
+void taskTopologyTick(uint32_t nowMs)
+{
+    static uint32_t s_lastWindowMs = 0;
+    if (s_lastWindowMs != 0 && (nowMs - s_lastWindowMs) < TASK_STATS_WINDOW_MS) {
+        return;
+    }
+    s_lastWindowMs = nowMs;
+    // Vast aantal voor dit venster: taskTopologyRegister() kan intussen een entry toevoegen
+    portENTER_CRITICAL(&s_statsMux);
+    const size_t count = s_taskCount;
+    portEXIT_CRITICAL(&s_statsMux);
+
+    TaskCpuStats fresh[TASK_TOPOLOGY_MAX];
+    float idle[2] = {-1.0f, -1.0f};
+    for (size_t i = 0; i < count; i++) {
+        fresh[i] = s_stats[i];
+        fresh[i].stackHwmBytes = (uint32_t)(uxTaskGetStackHighWaterMark(s_tasks[i].handle) * sizeof(StackType_t));
+    }
+
+#if TASK_TOPOLOGY_RUNTIME_STATS
+    // Run-time counters per task (vTaskGetInfo i.p.v. uxTaskGetSystemState: geen heap-array over alle
+    // systeemtasks); wall-delta = delta van de totale teller (één core)
+    static TaskStatus_t s_info[TASK_TOPOLOGY_MAX + 2];  // Eigen tasks + idle core 0/1
+    static uint32_t s_lastTotal = 0;
+    static uint32_t s_lastIdle[2] = {0, 0};
+    const uint32_t total = (uint32_t)portGET_RUN_TIME_COUNTER_VALUE();
+    const uint32_t dTotal = total - s_lastTotal;
+    const bool haveWindow = (s_lastTotal != 0 && dTotal > 0);
+    s_lastTotal = total;
+    for (size_t i = 0; i < count; i++) {
+        vTaskGetInfo(s_tasks[i].handle, &s_info[i], pdFALSE, eRunning);
+        const uint32_t d = s_info[i].ulRunTimeCounter - s_tasks[i].lastRunTime;
+        s_tasks[i].lastRunTime = s_info[i].ulRunTimeCounter;
+        fresh[i].cpuPct = haveWindow ? (100.0f * (float)d / (float)dTotal) : -1.0f;
+    }
+    for (int c = 0; c < 2; c++) {
+        TaskStatus_t& st = s_info[TASK_TOPOLOGY_MAX + c];
+        vTaskGetInfo(xTaskGetIdleTaskHandleForCore(c), &st, pdFALSE, eReady);
+        const uint32_t d = st.ulRunTimeCounter - s_lastIdle[c];
+        s_lastIdle[c] = st.ulRunTimeCounter;
+        idle[c] = haveWindow ? (100.0f * (float)d / (float)dTotal) : -1.0f;
+    }
+#endif
+
+    portENTER_CRITICAL(&s_statsMux);
+    memcpy(s_stats, fresh, sizeof(TaskCpuStats) * count);
+    s_idlePct[0] = idle[0];
+    s_idlePct[1] = idle[1];
+    portEXIT_CRITICAL(&s_statsMux);
+}
+
+size_t taskTopologyGetStats(TaskCpuStats* out, size_t maxCount, float idlePct[2])
+{
+    portENTER_CRITICAL(&s_statsMux);
+    const size_t n = (s_taskCount < maxCount) ? s_taskCount : maxCount;
+    memcpy(out, s_stats, sizeof(TaskCpuStats) * n);
+    if (idlePct != nullptr) {
+        idlePct[0] = s_idlePct[0];
+        idlePct[1] = s_idlePct[1];
+    }
+    portEXIT_CRITICAL(&s_statsMux);
+    return n;
+}
+
+size_t taskTopologyFormatJson(char* buf, size_t bufSize)
+{
+    TaskCpuStats st[TASK_TOPOLOGY_MAX];
+    float idle[2];
+    const size_t n = taskTopologyGetStats(st, TASK_TOPOLOGY_MAX, idle);
+
+    size_t len = 0;
+    int w = snprintf(buf, bufSize, "\"tasks\":[");
+    if (w <= 0 || (size_t)w >= bufSize) {
+        return 0;
+    }
+    len = (size_t)w;
+    for (size_t i = 0; i < n; i++) {
+#if TASK_TOPOLOGY_RUNTIME_STATS
+        w = snprintf(buf + len, bufSize - len, "%s{\"name\":\"%s\",\"core\":%d,\"cpuPct\":%.1f,\"stackHwm\":%lu}",
+                     i ? "," : "", st[i].name, (int)st[i].core, st[i].cpuPct, (unsigned long)st[i].stackHwmBytes);
+#else
+        // Geen run-time stats in deze core: geen cpuPct i.p.v. een altijd -1 veld
+        w = snprintf(buf + len, bufSize - len, "%s{\"name\":\"%s\",\"core\":%d,\"stackHwm\":%lu}",
+                     i ? "," : "", st[i].name, (int)st[i].core, (unsigned long)st[i].stackHwmBytes);
+#endif
+        if (w <= 0 || (size_t)w >= bufSize - len) {
+            return 0;
+        }
+        len += (size_t)w;
+    }
+#if TASK_TOPOLOGY_RUNTIME_STATS
+    w = snprintf(buf + len, bufSize - len, "],\"idlePct\":[%.1f,%.1f]", idle[0], idle[1]);
+#else
+    w = snprintf(buf + len, bufSize - len, "]");
+#endif
+    if (w <= 0 || (size_t)w >= bufSize - len) {
+        return 0;
+    }
+    return len + (size_t)w;
+}
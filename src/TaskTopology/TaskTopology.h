@@ -0,0 +1,61 @@
+#ifndef TASK_TOPOLOGY_H
+#define TASK_TOPOLOGY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Task-topologie als tabel (naam, core, prioriteit, stack, periode) + runtime-accounting:
+// CPU-aandeel per task (FreeRTOS run-time stats) en stack-HWM. Deadline-tellers van de 1 Hz
+// sampler staan in PriceSampler; samen tonen ze of UI, web of API/TLS de core bezet hield.
+
+#define TASK_TOPOLOGY_MAX 8  // Tabel-tasks + extern aangemaakte (Disp_Flush)
+// Meetvenster voor CPU-percentages
+#ifndef TASK_STATS_WINDOW_MS
+#define TASK_STATS_WINDOW_MS 10000UL
+#endif
+
+struct TaskSpec {
+    const char* name;
+    TaskFunction_t fn;
+    uint32_t stackBytes;
+    UBaseType_t priority;
+    BaseType_t core;
+    uint16_t periodMs;         // Nominale periode (0 = event-gedreven); alleen rapportage
+    TaskHandle_t* handleOut;   // Optioneel
+};
+
+struct TaskCpuStats {
+    const char* name;
+    int8_t core;
+    float cpuPct;              // Aandeel van één core in het laatste venster; < 0 = run-time stats niet beschikbaar
+                               // (vereist configGENERATE_RUN_TIME_STATS + configUSE_TRACE_FACILITY; in de
+                               // standaard Arduino-core uit, dan blijft dit -1 en staat het niet in de JSON)
+    uint32_t stackHwmBytes;
+};
+
+/**
+ * Maak alle tasks uit de tabel aan (volgorde = tabelvolgorde) en onthoud ze voor accounting.
+ * @return false als minstens één task niet aangemaakt kon worden
+ */
+bool taskTopologyStart(const char* profile, const TaskSpec* specs, size_t count);
+
+/**
+ * Neem een elders aangemaakte task op in de accounting (bv. Disp_Flush: heeft een eigen arg nodig).
+ * spec beschrijft hoe hij is aangemaakt (fn/handleOut worden genegeerd).
+ * @return false als de tabel vol is of handle nullptr
+ */
+bool taskTopologyRegister(const TaskSpec& spec, TaskHandle_t handle);
+
+// Periodiek aanroepen (apiTask); herberekent CPU-percentages eens per TASK_STATS_WINDOW_MS
+void taskTopologyTick(uint32_t nowMs);
+
+// Kopie van de laatste meting; idlePct[core] < 0 als niet beschikbaar. @return aantal entries
+size_t taskTopologyGetStats(TaskCpuStats* out, size_t maxCount, float idlePct[2]);
+
+// JSON-fragment `"tasks":[...],"idlePct":[..]` (zonder omhullende accolades). Zonder run-time stats
+// ontbreken cpuPct en idlePct (alleen name/core/stackHwm)
+size_t taskTopologyFormatJson(char* buf, size_t bufSize);
+
+#endif
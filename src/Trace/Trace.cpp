@@ -0,0 +1,236 @@
+// Platform config voor CRYPTO_ALERT_TRACE_ENABLED (zonder PINS includes)
+#define MODULE_INCLUDE
+#include "../../platform_config.h"
+#undef MODULE_INCLUDE
+
+#include "Trace.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "../Memory/HeapMon.h"
+
+namespace {
+
+static const char* const kSpanNames[TRACE_COUNT] = {
+    "fetch_price",
+    "ws_message",
+    "check_notify",
+    "update_ui",
+    "disp_flush",
+    "ntfy_send",
+    "mqtt_publish",
+};
+
+#if CRYPTO_ALERT_TRACE_ENABLED
+
+struct TraceSlot {
+    uint32_t count;
+    uint32_t migrated;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t sumUs;
+    uint64_t sumCycles;
+    uint16_t hist[TRACE_HIST_BUCKETS];
+    char task[16];
+};
+
+static TraceSlot g_slots[TRACE_COUNT];
+static portMUX_TYPE g_traceMux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t g_cpuMhz = 0;
+
+// Log-lineaire bucket: waarden < 4 exact, daarna 4 sub-buckets per macht van 2
+static uint8_t bucketForUs(uint32_t us) {
+    const uint32_t sub = 1u << TRACE_HIST_SUB_BITS;
+    if (us < sub) {
+        return (uint8_t)us;
+    }
+    const uint32_t msb = 31u - (uint32_t)__builtin_clz(us);
+    const uint32_t shift = msb - TRACE_HIST_SUB_BITS;
+    const uint32_t idx = (msb - TRACE_HIST_SUB_BITS + 1u) * sub + ((us >> shift) & (sub - 1u));
+    return (uint8_t)((idx < TRACE_HIST_BUCKETS) ? idx : (TRACE_HIST_BUCKETS - 1));
+}
+
+// Hoogste waarde (us) die nog in bucket idx valt
+static uint32_t bucketUpperUs(uint8_t idx) {
+    const uint32_t sub = 1u << TRACE_HIST_SUB_BITS;
+    if (idx < sub) {
+        return idx;
+    }
+    const uint32_t octave = idx / sub;  // >= 1
+    const uint32_t shift = octave - 1u;
+    const uint32_t lower = (sub + (idx % sub)) << shift;
+    return lower + (1u << shift) - 1u;
+}
+
+static uint32_t percentileUs(const uint16_t* hist, uint32_t total, uint32_t permille) {
+    if (total == 0) {
+        return 0;
+    }
+    const uint32_t target = (total * permille + 999u) / 1000u;
+    uint32_t acc = 0;
+    for (uint8_t i = 0; i < TRACE_HIST_BUCKETS; i++) {
+        acc += hist[i];
+        if (acc >= target) {
+            return bucketUpperUs(i);
+        }
+    }
+    return bucketUpperUs(TRACE_HIST_BUCKETS - 1);
+}
+
+#endif // CRYPTO_ALERT_TRACE_ENABLED
+
+}  // namespace
+
+#if CRYPTO_ALERT_TRACE_ENABLED
+
+void traceRecord(TraceId id, uint32_t startCycles, uint32_t startMs, int startCore) {
+    const uint32_t endCycles = ESP.getCycleCount();
+    if (id >= TRACE_COUNT) {
+        return;
+    }
+    TraceSlot& slot = g_slots[id];
+    if (xPortGetCoreID() != startCore) {
+        portENTER_CRITICAL(&g_traceMux);
+        slot.migrated++;
+        portEXIT_CRITICAL(&g_traceMux);
+        return;
+    }
+    if (g_cpuMhz == 0) {
+        g_cpuMhz = ESP.getCpuFreqMHz();
+        if (g_cpuMhz == 0) {
+            g_cpuMhz = 240;
+        }
+    }
+
+    const uint32_t elapsedMs = millis() - startMs;
+    uint32_t cycles = 0;
+    uint32_t us;
+    if (elapsedMs >= TRACE_CYCLE_WRAP_GUARD_MS) {
+        us = (elapsedMs > UINT32_MAX / 1000u) ? UINT32_MAX : elapsedMs * 1000u;
+    } else {
+        cycles = endCycles - startCycles;
+        us = cycles / g_cpuMhz;
+    }
+    const uint8_t bucket = bucketForUs(us);
+
+    // Tasknaam buiten de critical section ophalen (alleen bij wissel kopiëren)
+    const char* taskName = pcTaskGetName(nullptr);
+
+    portENTER_CRITICAL(&g_traceMux);
+    if (slot.count == 0 || us < slot.minUs) {
+        slot.minUs = us;
+    }
+    if (us > slot.maxUs) {
+        slot.maxUs = us;
+    }
+    slot.count++;
+    slot.sumUs += us;
+    slot.sumCycles += cycles;
+    if (slot.hist[bucket] == UINT16_MAX) {
+        // Verzadigd: halveer alle buckets (verhoudingen blijven, oude samples wegen minder)
+        for (uint8_t i = 0; i < TRACE_HIST_BUCKETS; i++) {
+            slot.hist[i] >>= 1;
+        }
+    }
+    slot.hist[bucket]++;
+    if (taskName != nullptr && strncmp(slot.task, taskName, sizeof(slot.task) - 1) != 0) {
+        strncpy(slot.task, taskName, sizeof(slot.task) - 1);
+        slot.task[sizeof(slot.task) - 1] = '\0';
+    }
+    portEXIT_CRITICAL(&g_traceMux);
+}
+
+#endif // CRYPTO_ALERT_TRACE_ENABLED
+
+const char* traceSpanName(TraceId id) {
+    return (id < TRACE_COUNT) ? kSpanNames[id] : "?";
+}
+
+bool traceGetStats(TraceId id, TraceSpanStats& out) {
+    memset(&out, 0, sizeof(out));
+#if CRYPTO_ALERT_TRACE_ENABLED
+    if (id >= TRACE_COUNT) {
+        return false;
+    }
+    static uint16_t hist[TRACE_HIST_BUCKETS];
+    uint32_t histTotal = 0;
+    portENTER_CRITICAL(&g_traceMux);
+    const TraceSlot& slot = g_slots[id];
+    out.count = slot.count;
+    out.migrated = slot.migrated;
+    out.minUs = slot.minUs;
+    out.maxUs = slot.maxUs;
+    out.sumUs = slot.sumUs;
+    out.sumCycles = slot.sumCycles;
+    memcpy(out.task, slot.task, sizeof(out.task));
+    memcpy(hist, slot.hist, sizeof(hist));
+    portEXIT_CRITICAL(&g_traceMux);
+
+    for (uint8_t i = 0; i < TRACE_HIST_BUCKETS; i++) {
+        histTotal += hist[i];
+    }
+    out.p50Us = percentileUs(hist, histTotal, 500);
+    out.p99Us = percentileUs(hist, histTotal, 990);
+    // Bucket-bovengrens kan boven het gemeten maximum liggen
+    if (out.p50Us > out.maxUs) {
+        out.p50Us = out.maxUs;
+    }
+    if (out.p99Us > out.maxUs) {
+        out.p99Us = out.maxUs;
+    }
+    return true;
+#else
+    (void)id;
+    return false;
+#endif
+}
+
+void traceWriteMetrics(TraceMetricsSink sink, void* ctx) {
+    if (sink == nullptr) {
+        return;
+    }
+    static char line[192];
+
+    sink("# HELP crypto_span_duration_us Hot-path span duur in microseconden\n"
+         "# TYPE crypto_span_duration_us summary\n", ctx);
+    for (uint8_t i = 0; i < TRACE_COUNT; i++) {
+        TraceSpanStats st;
+        if (!traceGetStats((TraceId)i, st)) {
+            continue;
+        }
+        const char* name = kSpanNames[i];
+        const char* task = (st.task[0] != '\0') ? st.task : "-";
+        snprintf(line, sizeof(line),
+                 "crypto_span_duration_us{span=\"%s\",task=\"%s\",quantile=\"0.5\"} %lu\n"
+                 "crypto_span_duration_us{span=\"%s\",task=\"%s\",quantile=\"0.99\"} %lu\n",
+                 name, task, (unsigned long)st.p50Us, name, task, (unsigned long)st.p99Us);
+        sink(line, ctx);
+        snprintf(line, sizeof(line),
+                 "crypto_span_duration_us_sum{span=\"%s\",task=\"%s\"} %llu\n"
+                 "crypto_span_duration_us_count{span=\"%s\",task=\"%s\"} %lu\n",
+                 name, task, (unsigned long long)st.sumUs, name, task, (unsigned long)st.count);
+        sink(line, ctx);
+        snprintf(line, sizeof(line),
+                 "crypto_span_min_us{span=\"%s\"} %lu\n"
+                 "crypto_span_max_us{span=\"%s\"} %lu\n"
+                 "crypto_span_mean_us{span=\"%s\"} %lu\n",
+                 name, (unsigned long)st.minUs,
+                 name, (unsigned long)st.maxUs,
+                 name, (unsigned long)(st.count > 0 ? (uint32_t)(st.sumUs / st.count) : 0u));
+        sink(line, ctx);
+        snprintf(line, sizeof(line),
+                 "crypto_span_cycles_total{span=\"%s\"} %llu\n"
+                 "crypto_span_migrated_total{span=\"%s\"} %lu\n",
+                 name, (unsigned long long)st.sumCycles, name, (unsigned long)st.migrated);
+        sink(line, ctx);
+    }
+
+    const HeapSnap heap = snapHeap();
+    snprintf(line, sizeof(line),
+             "crypto_heap_free_bytes %lu\n"
+             "crypto_heap_largest_block_bytes %lu\n"
+             "crypto_heap_min_free_bytes %lu\n"
+             "crypto_uptime_seconds %lu\n",
+             (unsigned long)heap.freeHeap, (unsigned long)heap.largestBlock,
+             (unsigned long)heap.minFreeHeap, (unsigned long)(millis() / 1000UL));
+    sink(line, ctx);
+}
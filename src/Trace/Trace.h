@@ -0,0 +1,96 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+
+// Tracepoints aan/uit (platform_config.h kan overschrijven). 0 = TRACE_SPAN compileert naar niets.
+#ifndef CRYPTO_ALERT_TRACE_ENABLED
+#define CRYPTO_ALERT_TRACE_ENABLED 1
+#endif
+
+/**
+ * Trace: vaste tracepoints op de hot paths, gemeten met de CPU cycle counter
+ *
+ * Elke span-ID heeft een vaste slot in een statische tabel (geen string-lookup, geen heap):
+ * count/som/min/max sinds boot plus een log-lineair histogram (4 sub-buckets per octaaf, in us)
+ * waaruit p50/p99 worden bepaald. Histogram-tellers halveren bij verzadiging, dus percentielen
+ * wegen recente samples zwaarder. Uitlezen via GET /metrics (Prometheus-tekstformaat).
+ *
+ * Gebruik:  void fetchPrice() { TRACE_SPAN(TRACE_FETCH_PRICE); ... }
+ * De start-cycles en core staan in het TraceScope-object op de stack van de aanroepende task;
+ * wisselt de task tijdens de span van core (andere cycle counter), dan wordt het sample verworpen.
+ */
+
+enum TraceId : uint8_t {
+    TRACE_FETCH_PRICE = 0,   // fetchPrice(): REST-poll + verwerking
+    TRACE_WS_MESSAGE,        // processWsTextMessage(): één WS-tekstframe
+    TRACE_CHECK_NOTIFY,      // AlertEngine::checkAndNotify()
+    TRACE_UPDATE_UI,         // UIController::updateUI()
+    TRACE_DISP_FLUSH,        // LVGL flush callback (incl. backend-transfer)
+    TRACE_NTFY_SEND,         // sendNtfyNotification(): HTTPS POST
+    TRACE_MQTT_PUBLISH,      // Eén publish uit de MQTT-queue drain
+    TRACE_COUNT
+};
+
+#define TRACE_HIST_SUB_BITS 2
+#define TRACE_HIST_BUCKETS 96           // 1 us .. ~33 s; daarboven in laatste bucket
+#define TRACE_CYCLE_WRAP_GUARD_MS 10000 // Langere spans: millis() i.p.v. (wrappende) cycle counter
+
+struct TraceSpanStats {
+    uint32_t count;       // Geldige samples sinds boot
+    uint32_t migrated;    // Verworpen: task wisselde van core tijdens de span
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t sumUs;
+    uint64_t sumCycles;   // Ruwe cycles (alleen spans korter dan TRACE_CYCLE_WRAP_GUARD_MS)
+    uint32_t p50Us;       // Bovengrens van de histogram-bucket
+    uint32_t p99Us;
+    char task[16];        // Task die de span het laatst registreerde
+};
+
+#if CRYPTO_ALERT_TRACE_ENABLED
+
+// Registreer een afgeronde span (aangeroepen door ~TraceScope)
+void traceRecord(TraceId id, uint32_t startCycles, uint32_t startMs, int startCore);
+
+class TraceScope {
+public:
+    explicit TraceScope(TraceId id)
+        : id_(id), core_(xPortGetCoreID()), startMs_(millis()), startCycles_(ESP.getCycleCount()) {}
+    ~TraceScope() { traceRecord(id_, startCycles_, startMs_, core_); }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    TraceId id_;
+    int core_;
+    uint32_t startMs_;
+    uint32_t startCycles_;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SPAN(id) TraceScope TRACE_CONCAT(traceSpan_, __LINE__)(id)
+
+#else
+
+#define TRACE_SPAN(id) do { } while (0)
+
+#endif // CRYPTO_ALERT_TRACE_ENABLED
+
+// Vaste naam per span-ID (label in /metrics)
+const char* traceSpanName(TraceId id);
+
+/**
+ * Kopieer statistieken van één span.
+ * @return false als tracing uit staat of id ongeldig is (out = nullen)
+ */
+bool traceGetStats(TraceId id, TraceSpanStats& out);
+
+// Sink voor tekst-output (bijv. WebServer::sendContent); chunk is nul-getermineerd
+typedef void (*TraceMetricsSink)(const char* chunk, void* ctx);
+
+// Schrijf alle spans + heap/uptime in Prometheus-tekstformaat naar sink (per regel)
+void traceWriteMetrics(TraceMetricsSink sink, void* ctx);
+
+#endif // TRACE_H
@@ -0,0 +1,69 @@
+// Schaduw van de LVGL-chartserie: laatste N punten met lopend min/max/gemiddelde.
+// min/max via monotone deques (amortized O(1) per push) i.p.v. elke update alle punten
+// uit lv_chart_get_series_y_array te scannen.
+
+#pragma once
+
+#include <stdint.h>
+
+template <uint16_t N>
+class ChartWindow {
+public:
+    ChartWindow() { clear(); }
+
+    void clear()
+    {
+        seq_ = 0;
+        count_ = 0;
+        sum_ = 0;
+        minHead_ = minTail_ = 0;
+        maxHead_ = maxTail_ = 0;
+    }
+
+    // Nieuw punt (zelfde volgorde als lv_chart_set_next_value); oudste valt eruit bij vol venster
+    void push(int32_t v)
+    {
+        const uint32_t s = seq_++;
+        if (count_ == N) {
+            sum_ -= vals_[s % N];
+        } else {
+            count_++;
+        }
+        vals_[s % N] = v;
+        sum_ += v;
+
+        const uint32_t oldest = (s + 1 >= N) ? (s + 1 - N) : 0;
+        while (minHead_ != minTail_ && minQ_[minHead_ % N] < oldest) {
+            minHead_++;
+        }
+        while (maxHead_ != maxTail_ && maxQ_[maxHead_ % N] < oldest) {
+            maxHead_++;
+        }
+        while (minHead_ != minTail_ && vals_[minQ_[(minTail_ - 1) % N] % N] >= v) {
+            minTail_--;
+        }
+        while (maxHead_ != maxTail_ && vals_[maxQ_[(maxTail_ - 1) % N] % N] <= v) {
+            maxTail_--;
+        }
+        minQ_[minTail_++ % N] = s;
+        maxQ_[maxTail_++ % N] = s;
+    }
+
+    uint16_t count() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    int32_t min() const { return vals_[minQ_[minHead_ % N] % N]; }
+    int32_t max() const { return vals_[maxQ_[maxHead_ % N] % N]; }
+    int32_t average() const { return count_ ? (int32_t)(sum_ / count_) : 0; }
+    // i = 0 is het oudste punt in het venster
+    int32_t at(uint16_t i) const { return vals_[(seq_ - count_ + i) % N]; }
+
+private:
+    int32_t vals_[N];
+    uint32_t minQ_[N];   // Volgnummers, waarden oplopend
+    uint32_t maxQ_[N];   // Volgnummers, waarden aflopend
+    uint32_t seq_;
+    uint32_t minHead_, minTail_;
+    uint32_t maxHead_, maxTail_;
+    int64_t sum_;
+    uint16_t count_;
+};
@@ -0,0 +1,231 @@
+#include "NumericLabel.h"
+#include <Arduino.h>
+#include <string.h>
+
+// Glyph-breedtes per font: één keer opgevraagd, daarna tabel-lookup i.p.v. font-engine per teken
+#define NUMERIC_ATLAS_FONTS 6
+
+struct NumericGlyphAtlas {
+    const lv_font_t* font;
+    uint8_t advance[128];   // Breedte per ASCII-teken (0 = nog niet opgevraagd)
+    uint8_t digitCell;      // Breedste cijfer: vaste celbreedte voor 0-9
+    uint8_t lineHeight;
+};
+
+// Atlas-index + font i.p.v. een pointer: wordt het slot verdrongen, dan ziet de label de
+// mismatch en zoekt zijn font opnieuw op (zelfde font → zelfde breedtes, cellen blijven geldig)
+struct NumericLabelState {
+    const lv_font_t* atlasFont;   // nullptr = nog geen layout
+    uint8_t atlasIdx;
+    char text[NUMERIC_LABEL_MAX_CHARS + 1];
+    uint8_t len;
+    uint16_t cellX[NUMERIC_LABEL_MAX_CHARS];   // Tot 24 brede glyphs: past niet in uint8_t
+    uint8_t cellW[NUMERIC_LABEL_MAX_CHARS];
+};
+
+static NumericGlyphAtlas s_atlas[NUMERIC_ATLAS_FONTS];
+static uint8_t s_atlasCount = 0;
+static uint8_t s_atlasEvictNext = 0;
+
+static uint8_t numericAtlasFor(const lv_font_t* font)
+{
+    for (uint8_t i = 0; i < s_atlasCount; i++) {
+        if (s_atlas[i].font == font) {
+            return i;
+        }
+    }
+    // In de praktijk 2-3 fonts; vol = meer fonts dan verwacht: round-robin verdringen en melden
+    uint8_t idx;
+    if (s_atlasCount < NUMERIC_ATLAS_FONTS) {
+        idx = s_atlasCount++;
+    } else {
+        idx = s_atlasEvictNext;
+        s_atlasEvictNext = (uint8_t)((s_atlasEvictNext + 1) % NUMERIC_ATLAS_FONTS);
+        Serial.printf("[NumericLabel] WARN: glyph-atlas vol (%u fonts), slot %u verdrongen\n",
+                      (unsigned)NUMERIC_ATLAS_FONTS, (unsigned)idx);
+    }
+    NumericGlyphAtlas& a = s_atlas[idx];
+    memset(&a, 0, sizeof(a));
+    a.font = font;
+    a.lineHeight = (uint8_t)lv_font_get_line_height(font);
+    for (uint8_t c = 32; c < 127; c++) {
+        const uint32_t w = lv_font_get_glyph_width(font, c, 0);
+        a.advance[c] = (uint8_t)(w > 255 ? 255 : w);
+    }
+    for (char d = '0'; d <= '9'; d++) {
+        if (a.advance[(uint8_t)d] > a.digitCell) {
+            a.digitCell = a.advance[(uint8_t)d];
+        }
+    }
+    return idx;
+}
+
+// Atlas van deze label; na verdringing van zijn slot opnieuw opgezocht
+static const NumericGlyphAtlas* numericAtlasOf(NumericLabelState* st)
+{
+    if (st->atlasFont == nullptr) {
+        return nullptr;
+    }
+    if (s_atlas[st->atlasIdx].font != st->atlasFont) {
+        st->atlasIdx = numericAtlasFor(st->atlasFont);
+    }
+    return &s_atlas[st->atlasIdx];
+}
+
+static inline bool numericIsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static uint8_t numericGlyphWidth(const NumericGlyphAtlas* a, char c)
+{
+    if (numericIsDigit(c)) {
+        return a->digitCell;
+    }
+    const uint8_t u = (uint8_t)c;
+    return (u < 128) ? a->advance[u] : a->digitCell;
+}
+
+// Cellen opnieuw uitleggen en objectgrootte zetten (fontwissel of andere tekstvorm)
+static void numericRelayout(lv_obj_t* obj, NumericLabelState* st)
+{
+    st->atlasFont = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    st->atlasIdx = numericAtlasFor(st->atlasFont);
+    const NumericGlyphAtlas* atlas = &s_atlas[st->atlasIdx];
+    uint16_t x = 0;
+    for (uint8_t i = 0; i < st->len; i++) {
+        const uint8_t w = numericGlyphWidth(atlas, st->text[i]);
+        st->cellX[i] = x;
+        st->cellW[i] = w;
+        x += w;
+    }
+    lv_obj_set_size(obj, x, atlas->lineHeight);
+    lv_obj_invalidate(obj);
+}
+
+static void numericLabelEvent(lv_event_t* e)
+{
+    lv_obj_t* obj = (lv_obj_t*)lv_event_get_current_target(e);
+    NumericLabelState* st = (NumericLabelState*)lv_obj_get_user_data(obj);
+    if (st == nullptr) {
+        return;
+    }
+    const lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_DELETE) {
+        lv_obj_set_user_data(obj, nullptr);
+        lv_free(st);
+        return;
+    }
+    if (code == LV_EVENT_STYLE_CHANGED) {
+        if (st->atlasFont != lv_obj_get_style_text_font(obj, LV_PART_MAIN)) {
+            numericRelayout(obj, st);
+        }
+        return;
+    }
+    if (code != LV_EVENT_DRAW_MAIN || st->len == 0) {
+        return;
+    }
+    const NumericGlyphAtlas* atlas = numericAtlasOf(st);
+    if (atlas == nullptr) {
+        return;
+    }
+
+    lv_layer_t* layer = lv_event_get_layer(e);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &dsc);
+
+    for (uint8_t i = 0; i < st->len; i++) {
+        const char c = st->text[i];
+        if (c == ' ') {
+            continue;
+        }
+        // Glyph gecentreerd in zijn cel (smalle "1" staat niet links in een brede cijfercel)
+        const uint8_t u = (uint8_t)c;
+        const uint8_t adv = (u < 128) ? atlas->advance[u] : st->cellW[i];
+        lv_area_t a;
+        a.x1 = coords.x1 + st->cellX[i] + (st->cellW[i] - adv) / 2;
+        a.x2 = a.x1 + adv;  // +1 px marge: font-engine breekt niet af op exacte breedte
+        a.y1 = coords.y1;
+        a.y2 = coords.y2;
+        const char glyph[2] = {c, '\0'};
+        dsc.text = glyph;
+        dsc.text_local = 1;  // LVGL kopieert; glyph[] leeft alleen in deze loop
+        lv_draw_label(layer, &dsc, &a);
+    }
+}
+
+lv_obj_t* numericLabelCreate(lv_obj_t* parent)
+{
+    lv_obj_t* obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+
+    NumericLabelState* st = (NumericLabelState*)lv_malloc(sizeof(NumericLabelState));
+    if (st == nullptr) {
+        return obj;
+    }
+    memset(st, 0, sizeof(*st));
+    lv_obj_set_user_data(obj, st);
+    lv_obj_add_event_cb(obj, numericLabelEvent, LV_EVENT_ALL, nullptr);
+    return obj;
+}
+
+void numericLabelSetText(lv_obj_t* obj, const char* text)
+{
+    if (obj == nullptr || text == nullptr) {
+        return;
+    }
+    NumericLabelState* st = (NumericLabelState*)lv_obj_get_user_data(obj);
+    if (st == nullptr) {
+        return;
+    }
+    size_t len = strlen(text);
+    if (len > NUMERIC_LABEL_MAX_CHARS) {
+        len = NUMERIC_LABEL_MAX_CHARS;
+    }
+    if (len == st->len && memcmp(text, st->text, len) == 0) {
+        return;
+    }
+
+    // Zelfde vorm: zelfde lengte en elk teken blijft cijfer of exact hetzelfde niet-cijfer
+    bool sameShape = (st->atlasFont != nullptr && len == st->len);
+    for (size_t i = 0; sameShape && i < len; i++) {
+        const char o = st->text[i];
+        const char n = text[i];
+        sameShape = (numericIsDigit(o) && numericIsDigit(n)) || o == n;
+    }
+
+    if (!sameShape) {
+        memcpy(st->text, text, len);
+        st->text[len] = '\0';
+        st->len = (uint8_t)len;
+        numericRelayout(obj, st);
+        return;
+    }
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    for (size_t i = 0; i < len; i++) {
+        if (st->text[i] == text[i]) {
+            continue;
+        }
+        st->text[i] = text[i];
+        lv_area_t cell;
+        cell.x1 = coords.x1 + st->cellX[i];
+        cell.x2 = cell.x1 + st->cellW[i] - 1;
+        cell.y1 = coords.y1;
+        cell.y2 = coords.y2;
+        lv_obj_invalidate_area(obj, &cell);
+    }
+}
+
+const char* numericLabelGetText(const lv_obj_t* obj)
+{
+    const NumericLabelState* st = (obj != nullptr) ? (const NumericLabelState*)lv_obj_get_user_data((lv_obj_t*)obj) : nullptr;
+    return (st != nullptr) ? st->text : "";
+}
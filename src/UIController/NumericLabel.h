@@ -0,0 +1,18 @@
+// Lichtgewicht label voor prijzen/percentages: elk teken een vaste cel, cijfers allemaal even breed.
+// Een wijziging van "69420" naar "69421" invalideert alleen de laatste cel i.p.v. het hele label;
+// op SPI-panels scheelt dat flush-tijd. Glyph-breedtes per font staan in een gedeelde cache.
+// Alleen ASCII (uitvoer van QuotePriceFormat / %-formatters).
+
+#pragma once
+
+#include <lvgl.h>
+
+#define NUMERIC_LABEL_MAX_CHARS 24
+
+// Maakt het object (geen thema-stijlen); font/kleur via de gewone text-stijlen
+lv_obj_t* numericLabelCreate(lv_obj_t* parent);
+
+// Alleen gewijzigde cellen worden geïnvalideerd zolang de "vorm" (positie van punten/tekens) gelijk blijft
+void numericLabelSetText(lv_obj_t* obj, const char* text);
+
+const char* numericLabelGetText(const lv_obj_t* obj);
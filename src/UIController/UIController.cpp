@@ -15,8 +15,12 @@
 
 #include "../PriceFormat/QuotePriceFormat.h"
 #include "ChartPriceScale.h"
+#include "ChartWindow.h"
+#include "NumericLabel.h"
+#include "../ChartHistory/ChartHistory.h"
 
 #include "UIController.h"
+#include "../Trace/Trace.h"
 #include <cstdint>  // int32_t
 #include <cstring>   // strcmp, strncpy
 #include <math.h>  // fabsf — vlakke return-kleur in updatePriceCardColor()
@@ -34,7 +38,10 @@
 // Fase 8.6.1: updateBTCEURCard() dependencies
 #include "../AnchorSystem/AnchorSystem.h"  // Voor AnchorConfigEffective struct
 
-extern TwoHMetrics computeTwoHMetrics();  // Definitie in ESP32-Crypto-Alert.ino (zelfde bron als /status)
+// AnalyticsSnapshot: één kopie per updateUI()-ronde; labels tonen dezelfde tick als /status en MQTT
+#include "../AnalyticsSnapshot/AnalyticsSnapshot.h"
+#include "../UiCommand/UiCommand.h"
+static AnalyticsSnapshot s_uiSnap;
 
 // Platform-specifieke constants (gedefinieerd in platform_config.h, maar we includen niet om dubbele definitie van gfx/bus te voorkomen)
 // Fase 8.3: createChart() dependencies - constants worden extern gebruikt
@@ -97,6 +104,44 @@ extern const lv_font_t lv_font_montserrat_14;
 #define POINTS_TO_CHART 60  // Default value (wordt overschreven door .ino als het later wordt gedefinieerd)
 #endif
 
+// Lopend min/max/gemiddelde van de chartserie (gevuld naast lv_chart_set_next_value)
+static ChartWindow<POINTS_TO_CHART> s_chartWindow;
+
+// Prijslabels (priceLbl[]): numeriek label met vaste cijfercellen of gewoon lv_label
+static lv_obj_t* priceLblCreate(lv_obj_t* parent)
+{
+#if CRYPTO_ALERT_NUMERIC_PRICE_LABEL
+    return numericLabelCreate(parent);
+#else
+    return lv_label_create(parent);
+#endif
+}
+
+static void priceLblSetText(lv_obj_t* lbl, const char* text)
+{
+#if CRYPTO_ALERT_NUMERIC_PRICE_LABEL
+    numericLabelSetText(lbl, text);
+#else
+    lv_label_set_text(lbl, text);
+#endif
+}
+
+// Grafiekhorizon (instelling) + bar-historie uit de .ino ringbuffers
+#ifndef HOURS_FOR_7D
+#define HOURS_FOR_7D 168
+#endif
+// Max. punten voor 1h/24h/7d: ~2 px per punt; langere series gaan door LTTB
+#ifndef CHART_HISTORY_MAX_POINTS
+#define CHART_HISTORY_MAX_POINTS (CHART_WIDTH / 2)
+#endif
+extern uint8_t chartHorizon;
+extern float *minuteAverages;
+extern float *hourlyAverages;
+extern uint16_t hourIndex;
+extern bool hourArrayFilled;
+static ChartHorizon s_chartShownHorizon = CHART_HORIZON_LIVE;
+static uint32_t s_chartShownGen = 0;
+
 // Forward declarations voor globale variabelen (worden gebruikt door callbacks)
 extern void Serial_println(const char*);
 extern void Serial_println(const __FlashStringHelper*);
@@ -396,10 +441,61 @@ uint32_t UIController::millis_cb(void) {
     return millis();
 }
 
+#if CRYPTO_ALERT_DISPLAY_ASYNC_FLUSH
+// Async flush: backend meldt "buffer vrij" (evt. vanuit DMA-ISR); LVGL wacht in de flush-wait-cb
+// i.p.v. te pollen, en rendert intussen in de andere buffer.
+static SemaphoreHandle_t s_flushDoneSem = nullptr;
+static volatile uint32_t s_flushWaitTimeouts = 0;
+// Na zoveel opeenvolgende wait-timeouts (x 500 ms) geldt de flush-task als dood: synchroon verder
+static const uint8_t kFlushWaitMaxTimeouts = 4;
+static volatile bool s_asyncFlushBroken = false;
+
+static void onDisplayFlushDone(void *ctx, bool fromIsr) {
+    if (s_asyncFlushBroken) {
+        return;  // Late completion na opgeven: LVGL is al synchroon verder, niet dubbel afmelden
+    }
+    lv_display_t *d = static_cast<lv_display_t *>(ctx);
+    lv_display_flush_ready(d);
+    if (s_flushDoneSem == nullptr) {
+        return;
+    }
+    if (fromIsr) {
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(s_flushDoneSem, &woken);
+        portYIELD_FROM_ISR(woken);
+    } else {
+        xSemaphoreGive(s_flushDoneSem);
+    }
+}
+
+// LVGL roept dit alleen aan als er nog een flush loopt; daarna zet LVGL zelf flushing=0.
+// Wacht tot de transfer klaar is: bij opgeven hergebruikt LVGL de buffer terwijl de backend er
+// mogelijk nog uit leest. Daarom pas na kFlushWaitMaxTimeouts opgeven (worker dood/hangend): dan
+// async definitief uit, zodat de UI-task niet voor altijd blijft hangen.
+static void dispFlushWait(lv_display_t *d) {
+    (void)d;
+    if (s_flushDoneSem == nullptr || s_asyncFlushBroken) {
+        return;
+    }
+    uint8_t misses = 0;
+    while (xSemaphoreTake(s_flushDoneSem, pdMS_TO_TICKS(500)) != pdTRUE) {
+        s_flushWaitTimeouts = s_flushWaitTimeouts + 1;
+        if (++misses >= kFlushWaitMaxTimeouts) {
+            s_asyncFlushBroken = true;
+            Serial.printf("[LVGL] ERROR: geen flush completion na %u ms, verder met synchrone flush\n",
+                          (unsigned)(misses * 500U));
+            return;
+        }
+        Serial.printf("[LVGL] WARN: flush completion traag, wacht verder (%u)\n", (unsigned)s_flushWaitTimeouts);
+    }
+}
+#endif
+
 // LVGL callback: flush display buffer
 // Fase 8.1.3: Verplaatst naar UIController module
 // Note: Deze functie moet extern blijven voor LVGL (niet static in header)
 void UIController::my_disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    TRACE_SPAN(TRACE_DISP_FLUSH);
     static bool s_loggedFirstFlush = false;
     if (!s_loggedFirstFlush) {
         if (area) {
@@ -409,6 +505,19 @@ void UIController::my_disp_flush(lv_display_t *disp, const lv_area_t *area, uint
         }
     }
 
+#if CRYPTO_ALERT_DISPLAY_ASYNC_FLUSH
+    // Eerste flush blijft synchroon (bootlogging hieronder)
+    if (s_loggedFirstFlush && !s_asyncFlushBroken && g_displayBackend && area && px_map &&
+        g_displayBackend->supportsAsyncFlush()) {
+        // Oude token (van een flush die LVGL zelf al zag aflopen) weggooien vóór de nieuwe transfer
+        if (s_flushDoneSem != nullptr) {
+            (void)xSemaphoreTake(s_flushDoneSem, 0);
+        }
+        g_displayBackend->flushAsync(area, px_map, onDisplayFlushDone, disp);
+        return;
+    }
+#endif
+
     if (g_displayBackend && area && px_map) {
         g_displayBackend->flush(area, px_map);
     }
@@ -668,6 +777,12 @@ void UIController::createChart() {
     #endif
     lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
     disableScroll(chart);
+#if CRYPTO_ALERT_CHART_CIRCULAR_UPDATE
+    // Nieuw punt invalideert alleen zijn eigen kolom i.p.v. de hele (schuivende) chart
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+#endif
+    s_chartWindow.clear();
+    s_chartShownHorizon = CHART_HORIZON_LIVE;
     
     // Initiële Y-range: zelfde EUR→chart-eenheden en dynamische half-range als updateChartRange()
     // (ChartPriceScale.h). Gebruik geen oude cent-schaal open*100 of vaste PRICE_RANGE.
@@ -908,7 +1023,7 @@ void UIController::createPriceBoxes() {
         }
         
         // Live price - platform-specifieke layout
-        priceLbl[dataIndex] = lv_label_create(priceBox[dataIndex]);
+        priceLbl[dataIndex] = priceLblCreate(priceBox[dataIndex]);
         ::priceLbl[dataIndex] = priceLbl[dataIndex];  // Fase 8.4.3: Synchroniseer
         if (dataIndex == 0) {
             lv_obj_set_style_text_font(priceLbl[dataIndex], FONT_SIZE_PRICE_BTCEUR, 0);
@@ -1004,7 +1119,7 @@ void UIController::createPriceBoxes() {
         }
         #endif
         
-        lv_label_set_text(priceLbl[dataIndex], "--");
+        priceLblSetText(priceLbl[dataIndex], "--");
         
         // Min/Max/Diff labels voor 1 min blok
         if (dataIndex == 1)
@@ -1492,7 +1607,7 @@ void UIController::updateTrendLabel()
     if (::trendLabel == nullptr) return;
     
     // Toon trend alleen als beide availability flags true zijn
-    if (hasRet2h && hasRet30m)
+    if (s_uiSnap.hasRet2h && s_uiSnap.hasRet30m)
     {
         const char* trendText = "";
         lv_color_t trendColor = lv_palette_main(LV_PALETTE_GREY);
@@ -1501,8 +1616,7 @@ void UIController::updateTrendLabel()
         bool isFromWarmStart = (hasRet2hWarm && hasRet30mWarm) && !(hasRet2hLive && hasRet30mLive);
         bool isFromLive = (hasRet2hLive && hasRet30mLive);
         
-        // Fase 5.3.14: Gebruik TrendDetector module getter i.p.v. globale variabele
-        TrendState currentTrend = trendDetector.getTrendState();
+        TrendState currentTrend = s_uiSnap.trend;
         switch (currentTrend) {
             case TREND_UP:
                 trendText = getText("2h//", "2h//");
@@ -1615,7 +1729,7 @@ void UIController::updateVolatilityLabel()
 
     // Regime op dezelfde plek als volatility (rechtsonder chart); bij uit: bestaande VLAK/GOLVEND/GRILLIG
     if (regimeEngineEnabled) {
-        const RegimeSnapshot& rs = regimeEngineGetSnapshot();
+        const RegimeSnapshot& rs = s_uiSnap.regime;
         lv_label_set_text(::volatilityLabel, regimeDisplayLabelText(rs.committedRegime));
         lv_obj_set_style_text_color(::volatilityLabel, regimeDisplayLabelColor(rs.committedRegime), 0);
         return;
@@ -1624,8 +1738,7 @@ void UIController::updateVolatilityLabel()
     const char* volText = "";
     lv_color_t volColor = lv_palette_main(LV_PALETTE_GREY);
     
-    // Fase 5.3.14: Gebruik VolatilityTracker module getter i.p.v. globale variabele
-    VolatilityState currentVol = volatilityTracker.getVolatilityState();
+    VolatilityState currentVol = s_uiSnap.volatility;
     switch (currentVol) {
         case VOLATILITY_LOW:
             volText = getText("VLAK", "FLAT");
@@ -1682,10 +1795,10 @@ void UIController::updateMediumTrendLabel()
     // Fase 8.5.4: Gebruik globale pointer (synchroniseert met module pointer)
     if (::mediumTrendLabel == nullptr) return;
     
-    extern bool hasRet1d;
+    const bool hasRet1d = s_uiSnap.hasRet1d;
     if (hasRet1d)
     {
-        extern float ret_1d;
+        const float ret_1d = s_uiSnap.ret1d;
         extern TrendDetector trendDetector;
         
         // Gebruik threshold van 2.0% voor 1d trend
@@ -1750,10 +1863,10 @@ void UIController::updateLongTermTrendLabel()
     if (::longTermTrendLabel == nullptr) return;
     
     // Toon lange termijn trend alleen als 7d beschikbaar is
-    extern bool hasRet7d;
+    const bool hasRet7d = s_uiSnap.hasRet7d;
     if (hasRet7d)
     {
-        extern float ret_7d;
+        const float ret_7d = s_uiSnap.ret7d;
         extern TrendDetector trendDetector;
         
         // Gebruik threshold van 1.0% voor lange termijn trend
@@ -1812,6 +1925,20 @@ void UIController::updateLongTermTrendLabel()
 
 // Fase 8.6.1: updateBTCEURCard() naar Module
 // Helper functie om BTCEUR card bij te werken
+// Hoofdprijslabel alleen bijwerken als de geformatteerde string verandert (gedeeld EUR-format)
+static void setMainPriceLabel(float displayPrice)
+{
+    static char s_lastMainPriceFmt[PRICE_LBL_BUFFER_SIZE] = "";
+    formatQuotePriceEur(priceLblBuffer, PRICE_LBL_BUFFER_SIZE, displayPrice);
+    if (::priceLbl[0] != nullptr &&
+        (strcmp(priceLblBuffer, s_lastMainPriceFmt) != 0 || s_lastMainPriceFmt[0] == '\0')) {
+        strncpy(s_lastMainPriceFmt, priceLblBuffer, sizeof(s_lastMainPriceFmt));
+        s_lastMainPriceFmt[sizeof(s_lastMainPriceFmt) - 1] = '\0';
+        priceLblSetText(::priceLbl[0], priceLblBuffer);
+        lastPriceLblValue = displayPrice;
+    }
+}
+
 void UIController::updateBTCEURCard(bool hasNewData)
 {
     // Fase 8.6.1: Gebruik globale pointers (synchroniseert met module pointers)
@@ -1829,18 +1956,7 @@ void UIController::updateBTCEURCard(bool hasNewData)
         displayPrice = (lk > 0.0f) ? lk : px;
     }
     
-    // Update price label alleen als geformatteerde string verandert (gedeeld EUR-format)
-    {
-        static char s_lastMainPriceFmt[PRICE_LBL_BUFFER_SIZE] = "";
-        formatQuotePriceEur(priceLblBuffer, PRICE_LBL_BUFFER_SIZE, displayPrice);
-        if (::priceLbl[0] != nullptr &&
-            (strcmp(priceLblBuffer, s_lastMainPriceFmt) != 0 || s_lastMainPriceFmt[0] == '\0')) {
-            strncpy(s_lastMainPriceFmt, priceLblBuffer, sizeof(s_lastMainPriceFmt));
-            s_lastMainPriceFmt[sizeof(s_lastMainPriceFmt) - 1] = '\0';
-            lv_label_set_text(::priceLbl[0], priceLblBuffer);
-            lastPriceLblValue = displayPrice;
-        }
-    }
+    setMainPriceLabel(displayPrice);
     
     // Bitcoin waarde linksonderin volgt quote kleur (EUR blauw, USDC groen)
     if (::priceLbl[0] != nullptr) {
@@ -1852,8 +1968,7 @@ void UIController::updateBTCEURCard(bool hasNewData)
     // Bereken dynamische anchor-waarden op basis van trend voor UI weergave
     AnchorConfigEffective effAnchorUI;
     if (anchorDisplayActive) {
-        // Fase 5.3.14: Gebruik TrendDetector module getter i.p.v. globale variabele
-        TrendState currentTrend = trendDetector.getTrendState();
+        TrendState currentTrend = s_uiSnap.trend;
         // Fase 6.2.7: Gebruik AnchorSystem module i.p.v. globale functie
         effAnchorUI = anchorSystem.calcEffectiveAnchor(anchorMaxLoss, anchorTakeProfit, currentTrend);
     }
@@ -2490,7 +2605,7 @@ void UIController::updateAveragePriceCard(uint8_t index)
     #if defined(PLATFORM_ESP32S3_LCDWIKI_28) || defined(PLATFORM_ESP32S3_JC3248W535)
     if (index == 3 && ::price2HMaxLabel != nullptr && ::price2HMinLabel != nullptr && ::price2HDiffLabel != nullptr)
     {
-        TwoHMetrics m = computeTwoHMetrics();
+        const TwoHMetrics& m = s_uiSnap.twoH;
         bool ok = m.valid;
         if (!ok) {
             if (hasData2hMinimal) {
@@ -2637,7 +2752,7 @@ void UIController::updateAveragePriceCard(uint8_t index)
     {
         // Update alleen als label niet al "--" is
         if (lastPriceLblValueArray[index] >= 0.0f || strcmp(priceLblBufferArray[index], "--") != 0) {
-            lv_label_set_text(::priceLbl[index], "--");
+            priceLblSetText(::priceLbl[index], "--");
             strcpy(priceLblBufferArray[index], "--");
             lastPriceLblValueArray[index] = -1.0f;
             
@@ -2659,7 +2774,7 @@ void UIController::updateAveragePriceCard(uint8_t index)
         if (strcmp(avgFmt, priceLblBufferArray[index]) != 0 || lastPriceLblValueArray[index] < 0.0f) {
             strncpy(priceLblBufferArray[index], avgFmt, sizeof(priceLblBufferArray[index]));
             priceLblBufferArray[index][sizeof(priceLblBufferArray[index]) - 1] = '\0';
-            lv_label_set_text(::priceLbl[index], priceLblBufferArray[index]);
+            priceLblSetText(::priceLbl[index], priceLblBufferArray[index]);
             lastPriceLblValueArray[index] = averagePrices[index];
             
             // FASE 7.2: UI Average label update verificatie logging
@@ -2678,7 +2793,7 @@ void UIController::updateAveragePriceCard(uint8_t index)
         // averagePrices[index] is 0.0f of niet gezet
         // Update alleen als label niet al "--" is
         if (lastPriceLblValueArray[index] >= 0.0f || strcmp(priceLblBufferArray[index], "--") != 0) {
-            lv_label_set_text(::priceLbl[index], "--");
+            priceLblSetText(::priceLbl[index], "--");
             strcpy(priceLblBufferArray[index], "--");
             lastPriceLblValueArray[index] = -1.0f;
             
@@ -2752,6 +2867,79 @@ void UIController::updatePriceCardColor(uint8_t index, float pct)
     lv_obj_set_height(::priceBox[index], LV_SIZE_CONTENT);
 }
 
+// Bar-historie tonen (1h/24h/7d). Alleen herberekend (verzamelen + LTTB) als er een bar gesloten is
+// of de horizon wisselt, niet per redraw. Geeft false als de data nu niet gelezen kon worden.
+static bool chartShowHistory(ChartHorizon horizon, bool force)
+{
+    ChartHistorySource src;
+    uint16_t windowBars;
+    if (!chartHorizonSource(horizon, src, windowBars)) {
+        return false;
+    }
+    const uint32_t gen = chartHistoryGeneration(src);
+    if (!force && gen == s_chartShownGen) {
+        return true;
+    }
+
+    static float s_histRaw[HOURS_FOR_7D];
+    static float s_histOut[HOURS_FOR_7D];
+    if (windowBars > HOURS_FOR_7D) {
+        windowBars = HOURS_FOR_7D;
+    }
+    if (dataMutex != nullptr && !safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "UI chart history")) {
+        return false;  // Volgende ronde opnieuw
+    }
+    uint16_t n = 0;
+    if (src == CHART_SRC_MINUTE) {
+        n = chartHistoryCollect(minuteAverages, MINUTES_FOR_30MIN_CALC, minuteIndex, minuteArrayFilled,
+                                windowBars, s_histRaw);
+    } else {
+        n = chartHistoryCollect(hourlyAverages, HOURS_FOR_7D, hourIndex, hourArrayFilled, windowBars, s_histRaw);
+    }
+    if (dataMutex != nullptr) {
+        safeMutexGive(dataMutex, "UI chart history");
+    }
+    const uint16_t m = lttbDownsample(s_histRaw, n, s_histOut, CHART_HISTORY_MAX_POINTS);
+
+    s_chartShownGen = gen;
+    s_chartShownHorizon = horizon;
+
+    lv_chart_set_point_count(::chart, (m >= 2) ? m : 2);
+    lv_chart_set_all_value(::chart, ::dataSeries, LV_CHART_POINT_NONE);
+    lv_chart_set_x_start_point(::chart, ::dataSeries, 0);
+    if (m > 0) {
+        int32_t lo = INT32_MAX;
+        int32_t hi = INT32_MIN;
+        for (uint16_t i = 0; i < m; i++) {
+            const int32_t y = chartPriceEurToY(s_histOut[i]);
+            lv_chart_set_value_by_id(::chart, ::dataSeries, i, y);
+            if (y < lo) lo = y;
+            if (y > hi) hi = y;
+        }
+        int32_t margin = (hi - lo) / 20;
+        if (margin < 10) margin = 10;
+        minRange = (lo - margin > 0) ? (lo - margin) : 0;
+        maxRange = hi + margin;
+        lv_chart_set_range(::chart, LV_CHART_AXIS_PRIMARY_Y, minRange, maxRange);
+    }
+    lv_chart_refresh(::chart);
+    return true;
+}
+
+// Terug naar live: laatste POINTS_TO_CHART samples uit het schaduwvenster (rechts uitgelijnd)
+static void chartRestoreLive()
+{
+    lv_chart_set_point_count(::chart, POINTS_TO_CHART);
+    lv_chart_set_all_value(::chart, ::dataSeries, LV_CHART_POINT_NONE);
+    lv_chart_set_x_start_point(::chart, ::dataSeries, 0);
+    const uint16_t k = s_chartWindow.count();
+    for (uint16_t i = 0; i < k; i++) {
+        lv_chart_set_value_by_id(::chart, ::dataSeries, (uint32_t)(POINTS_TO_CHART - k + i), s_chartWindow.at(i));
+    }
+    lv_chart_refresh(::chart);
+    s_chartShownHorizon = CHART_HORIZON_LIVE;
+}
+
 // Fase 8.7.1: updateChartSection() naar Module
 // Helper functie om chart section bij te werken
 void UIController::updateChartSection(int32_t currentPrice, bool hasNewPriceData, float refPriceEur)
@@ -2784,25 +2972,31 @@ void UIController::updateChartSection(int32_t currentPrice, bool hasNewPriceData
 
     // Fase 8.7.1: Gebruik globale pointers (synchroniseert met module pointers)
     // Voeg een punt toe aan de grafiek als er geldige data is (currentPrice volgt live snapshot in updateUI)
-    if (currentPrice > 0) {
-        // Track laatste chart waarde om conditional invalidate te doen
-        static int32_t lastChartValue = 0;
-        bool valueChanged = (currentPrice != lastChartValue);
-        
-        lv_chart_set_next_value(::chart, ::dataSeries, currentPrice);
-        
-        // Conditional invalidate: alleen als waarde is veranderd of er nieuwe data is
-        if (valueChanged || hasNewPriceData || newPriceDataAvailable) {
-            lv_obj_invalidate(::chart);
-            lastChartValue = currentPrice;
+    const ChartHorizon horizon = (chartHorizon < CHART_HORIZON_COUNT) ? (ChartHorizon)chartHorizon : CHART_HORIZON_LIVE;
+    if (horizon != CHART_HORIZON_LIVE) {
+        // Live samples blijven in het schaduwvenster zodat terugschakelen direct een volle grafiek geeft
+        if (currentPrice > 0) {
+            s_chartWindow.push(currentPrice);
+            newPriceDataAvailable = false;
+        }
+        (void)chartShowHistory(horizon, horizon != s_chartShownHorizon);
+    } else {
+        if (s_chartShownHorizon != CHART_HORIZON_LIVE) {
+            chartRestoreLive();
+        }
+        if (currentPrice > 0) {
+            // lv_chart_set_next_value invalideert zelf: hele chart (shift) of alleen het nieuwe segment (circular)
+            lv_chart_set_next_value(::chart, ::dataSeries, currentPrice);
+            s_chartWindow.push(currentPrice);
+            
+            // Reset flag na gebruik
+            newPriceDataAvailable = false;
         }
         
-        // Reset flag na gebruik
-        newPriceDataAvailable = false;
+        // Update chart range (refPriceEur bepaalt schaal / halfRange, los van Y-waarde)
+        this->updateChartRange(currentPrice, refPriceEur);
     }
-    
-    // Update chart range (refPriceEur bepaalt schaal / halfRange, los van Y-waarde)
-    this->updateChartRange(currentPrice, refPriceEur);
+    (void)hasNewPriceData;
     
     // Update chart title (device-id in titel waar van toepassing)
     if (::chartTitle != nullptr) {
@@ -2835,6 +3029,7 @@ void UIController::updateChartSection(int32_t currentPrice, bool hasNewPriceData
 // Main UI update functie
 void UIController::updateUI()
 {
+    TRACE_SPAN(TRACE_UPDATE_UI);
     // Fase 8.8.1: Gebruik globale pointers (synchroniseert met module pointers)
     // Veiligheid: controleer of chart en dataSeries bestaan
     if (::chart == nullptr || ::dataSeries == nullptr) {
@@ -2864,6 +3059,14 @@ void UIController::updateUI()
         hasNewPriceData = (timeSinceLastApi < 3000);  // 2000ms interval + 1000ms marge voor retries
     }
     
+    // Eén lock-free kopie van de laatste tick voor alle labels hieronder (mislukt: vorige ronde houden)
+    {
+        AnalyticsSnapshot fresh;
+        if (analyticsSnapshotRead(fresh)) {
+            s_uiSnap = fresh;
+        }
+    }
+    
     // Update UI sections (gebruik module versies)
     updateChartSection(p, hasNewPriceData, chartPriceFloat);
     updateHeaderSection();
@@ -2871,6 +3074,27 @@ void UIController::updateUI()
     updateFooter();
 }
 
+// UI_CMD_PRICE_CARD: prijs van de tick direct tonen (waarde uit het commando, geen mutex)
+void UIController::applyPriceCard(const UiPriceCardCmd& cmd)
+{
+    if (cmd.price > 0.0f) {
+        setMainPriceLabel(cmd.price);
+    }
+}
+
+// UI_CMD_MARKET_STATE: trend/volatiliteit/regime uit het commando in de UI-kopie zetten en alleen
+// de labels die ervan afhangen opnieuw tekenen (volledige snapshot volgt bij de volgende updateUI)
+void UIController::applyMarketState(const UiMarketStateCmd& cmd)
+{
+    s_uiSnap.trend = (TrendState)cmd.trend;
+    s_uiSnap.trendMedium = (TrendState)cmd.trendMedium;
+    s_uiSnap.trendLong = (TrendState)cmd.trendLong;
+    s_uiSnap.volatility = (VolatilityState)cmd.volatility;
+    s_uiSnap.regime.committedRegime = (RegimeKind)cmd.regime;
+    updateTrendLabel();
+    updateVolatilityLabel();
+}
+
 // Fase 8.9.1: checkButton() naar Module
 // Physical button check function (boards met HAS_PHYSICAL_BUTTON)
 void UIController::checkButton()
@@ -3079,6 +3303,17 @@ void UIController::setupLVGL()
 
     disp = lv_display_create(screenWidth, screenHeight);
     lv_display_set_flush_cb(disp, my_disp_flush);
+#if CRYPTO_ALERT_DISPLAY_ASYNC_FLUSH
+    if (g_displayBackend && g_displayBackend->supportsAsyncFlush()) {
+        if (s_flushDoneSem == nullptr) {
+            s_flushDoneSem = xSemaphoreCreateBinary();
+        }
+        if (s_flushDoneSem != nullptr) {
+            lv_display_set_flush_wait_cb(disp, dispFlushWait);
+        }
+        Serial.printf("[LVGL] Async flush: aan (wait-cb: %s)\n", s_flushDoneSem ? "semafoor" : "polling");
+    }
+#endif
     
     // LVGL buffer setup: single of double buffering, full of partial frame
     size_t bufSizePixels = bufSize;
@@ -3099,6 +3334,27 @@ void UIController::setupLVGL()
     if (useDoubleBuffer) {
         buf2 = (uint8_t *)disp_draw_buf + bufSizeBytesPerBuffer;
     }
+#if defined(PLATFORM_ESP32S3_JC3248W535) && CRYPTO_ALERT_DISPLAY_ASYNC_FLUSH
+    // Full-frame: twee aaneengesloten buffers passen niet intern. Tweede buffer apart:
+    // INTERNAL+DMA als het past (directe DMA), anders SPIRAM (backend gebruikt dan het stripe-pad).
+    else if (g_displayBackend && g_displayBackend->supportsAsyncFlush()) {
+        static void *s_dispDrawBuf2 = nullptr;
+        const char *buf2Location = "INTERNAL+DMA";
+        if (s_dispDrawBuf2 == nullptr) {
+            s_dispDrawBuf2 = heap_caps_malloc(bufSizeBytesPerBuffer, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+            if (s_dispDrawBuf2 == nullptr && psramAvailable) {
+                s_dispDrawBuf2 = heap_caps_malloc(bufSizeBytesPerBuffer, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+                buf2Location = "SPIRAM";
+            }
+        }
+        buf2 = s_dispDrawBuf2;
+        if (buf2) {
+            Serial.printf("[LVGL] Tweede draw buffer: %u bytes (%s)\n", (unsigned)bufSizeBytesPerBuffer, buf2Location);
+        } else {
+            Serial.println("[LVGL] Tweede draw buffer niet beschikbaar; single buffer");
+        }
+    }
+#endif
     lv_display_set_buffers(disp, disp_draw_buf, buf2, bufSizeBytesPerBuffer, renderMode);
 
     const char *renderModeStr = (renderMode == LV_DISPLAY_RENDER_MODE_FULL) ? "FULL" :
@@ -3237,30 +3493,24 @@ void UIController::updateChartRange(int32_t currentPrice, float refPriceEur)
 
     const int32_t halfRange = chartHalfRangeY(refPriceEur, getChartPriceScale(refPriceEur));
     
+    // Min/max/gemiddelde uit het lopende venster (geen scan over de serie)
     int32_t chartMin = INT32_MAX;
     int32_t chartMax = INT32_MIN;
-    int32_t sum = 0;
-    uint16_t count = 0;
-    
-    // Gebruik member pointers i.p.v. globale pointers
-    int32_t *yArray = lv_chart_get_series_y_array(this->chart, this->dataSeries);
-    
-    for (uint16_t i = 0; i < POINTS_TO_CHART; i++)
-    {
-        int32_t val = yArray[i];
-        if (val != LV_CHART_POINT_NONE)
-        {
-            if (val < chartMin) chartMin = val;
-            if (val > chartMax) chartMax = val;
-            sum += val;
-            count++;
-        }
+    uint16_t count = s_chartWindow.count();
+    if (count > 0) {
+        chartMin = s_chartWindow.min();
+        chartMax = s_chartWindow.max();
     }
+    const int32_t lo = (count > 0 && chartMin < currentPrice) ? chartMin : currentPrice;
+    const int32_t hi = (count > 0 && chartMax > currentPrice) ? chartMax : currentPrice;
     
+    // Doelrange (zelfde regels als voorheen); minRange/maxRange blijven de toegepaste range
+    int32_t targetMin = minRange;
+    int32_t targetMax = maxRange;
     int32_t chartAverage = 0;
     if (count > 0 && chartMin != INT32_MAX && chartMax != INT32_MIN)
     {
-        chartAverage = sum / count;
+        chartAverage = s_chartWindow.average();
         
         if (chartMin == INT32_MAX || chartMax == INT32_MIN || chartMin > chartMax)
         {
@@ -3280,22 +3530,21 @@ void UIController::updateChartRange(int32_t currentPrice, float refPriceEur)
         int32_t margin = range / 20;
         if (margin < 10) margin = 10;
         
-        // Update globale minRange en maxRange (extern gedeclareerd)
-        minRange = chartMin - margin;
-        maxRange = chartMax + margin;
+        targetMin = chartMin - margin;
+        targetMax = chartMax + margin;
         
-        if (currentPrice < minRange) minRange = currentPrice - margin;
-        if (currentPrice > maxRange) maxRange = currentPrice + margin;
+        if (currentPrice < targetMin) targetMin = currentPrice - margin;
+        if (currentPrice > targetMax) targetMax = currentPrice + margin;
         
-        if (minRange < 0) minRange = 0;
-        if (maxRange < 0) maxRange = 0;
-        if (minRange >= maxRange)
+        if (targetMin < 0) targetMin = 0;
+        if (targetMax < 0) targetMax = 0;
+        if (targetMin >= targetMax)
         {
             int32_t fallbackMargin = halfRange / 20;
             if (fallbackMargin < 10) fallbackMargin = 10;
-            minRange = chartAverage - halfRange - fallbackMargin;
-            maxRange = chartAverage + halfRange + fallbackMargin;
-            if (minRange < 0) minRange = 0;
+            targetMin = chartAverage - halfRange - fallbackMargin;
+            targetMax = chartAverage + halfRange + fallbackMargin;
+            if (targetMin < 0) targetMin = 0;
         }
     }
     else
@@ -3303,9 +3552,21 @@ void UIController::updateChartRange(int32_t currentPrice, float refPriceEur)
         chartAverage = currentPrice;
         int32_t margin = halfRange / 20;
         if (margin < 10) margin = 10;
-        minRange = currentPrice - halfRange - margin;
-        maxRange = currentPrice + halfRange + margin;
+        targetMin = currentPrice - halfRange - margin;
+        targetMax = currentPrice + halfRange + margin;
+    }
+    
+    // Hysterese: lv_chart_set_range hertekent de hele chart. Alleen herschalen als data buiten de
+    // huidige range valt, of als een rand meer dan een kwart halfRange te ruim is geworden.
+    int32_t hyst = halfRange / 4;
+    if (hyst < 10) hyst = 10;
+    const bool outside = (lo < minRange) || (hi > maxRange) || (minRange >= maxRange);
+    const bool tooWide = (targetMin - minRange > hyst) || (maxRange - targetMax > hyst);
+    if (!outside && !tooWide) {
+        return;
     }
+    minRange = targetMin;
+    maxRange = targetMax;
     
     // Gebruik member pointer i.p.v. globale pointer
     lv_chart_set_range(this->chart, LV_CHART_AXIS_PRIMARY_Y, minRange, maxRange);
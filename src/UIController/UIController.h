@@ -11,6 +11,8 @@ class PriceData;
 class TrendDetector;
 class VolatilityTracker;
 class AnchorSystem;
+struct UiPriceCardCmd;
+struct UiMarketStateCmd;
 
 // SYMBOL_COUNT wordt gedefinieerd in platform_config.h (per platform)
 // Hier alleen een fallback als het nog niet gedefinieerd is
@@ -71,6 +73,10 @@ public:
     
     // Fase 8.8: updateUI() naar Module
     void updateUI();
+
+    // Getypeerde UiCommands (alleen render-task): tekenen uit de payload, zonder dataMutex
+    void applyPriceCard(const UiPriceCardCmd& cmd);
+    void applyMarketState(const UiMarketStateCmd& cmd);
     
     // Fase 8.9: checkButton() naar Module
     void checkButton();
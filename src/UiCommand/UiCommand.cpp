@@ -0,0 +1,91 @@
+#include "UiCommand.h"
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static std::atomic<uint32_t> g_pendingMask{0};
+static std::atomic<uint32_t> g_args[UI_CMD_COUNT];
+static std::atomic<uint32_t> g_posted{0};
+static std::atomic<uint32_t> g_coalesced{0};
+static std::atomic<uint32_t> g_drained{0};
+static std::atomic<TaskHandle_t> g_renderTask{nullptr};
+
+// Payloads van de getypeerde commando's; kopie onder een spinlock (paar bytes, geen blokkeren)
+static portMUX_TYPE g_payloadMux = portMUX_INITIALIZER_UNLOCKED;
+static UiPriceCardCmd g_priceCard = {};
+static UiMarketStateCmd g_marketState = {};
+
+static void markPending(UiCommandType type) {
+    const uint32_t bit = 1u << type;
+    const uint32_t prev = g_pendingMask.fetch_or(bit, std::memory_order_release);
+    g_posted.fetch_add(1, std::memory_order_relaxed);
+    if ((prev & bit) != 0) {
+        g_coalesced.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void uiCommandPost(UiCommandType type, uint32_t arg) {
+    if (type >= UI_CMD_COUNT) {
+        return;
+    }
+    // Eerst het argument, dan het bit: de render-task ziet nooit een bit zonder geldig argument
+    g_args[type].store(arg, std::memory_order_relaxed);
+    markPending(type);
+}
+
+void uiCommandPostPriceCard(const UiPriceCardCmd& cmd) {
+    portENTER_CRITICAL(&g_payloadMux);
+    g_priceCard = cmd;
+    portEXIT_CRITICAL(&g_payloadMux);
+    markPending(UI_CMD_PRICE_CARD);
+}
+
+void uiCommandPostMarketState(const UiMarketStateCmd& cmd) {
+    portENTER_CRITICAL(&g_payloadMux);
+    g_marketState = cmd;
+    portEXIT_CRITICAL(&g_payloadMux);
+    markPending(UI_CMD_MARKET_STATE);
+}
+
+void uiCommandReadPriceCard(UiPriceCardCmd& out) {
+    portENTER_CRITICAL(&g_payloadMux);
+    out = g_priceCard;
+    portEXIT_CRITICAL(&g_payloadMux);
+}
+
+void uiCommandReadMarketState(UiMarketStateCmd& out) {
+    portENTER_CRITICAL(&g_payloadMux);
+    out = g_marketState;
+    portEXIT_CRITICAL(&g_payloadMux);
+}
+
+uint32_t uiCommandTakeAll(uint32_t args[UI_CMD_COUNT]) {
+    const uint32_t mask = g_pendingMask.exchange(0, std::memory_order_acquire);
+    if (mask == 0) {
+        return 0;
+    }
+    for (uint8_t t = 0; t < UI_CMD_COUNT; t++) {
+        if ((mask & (1u << t)) != 0) {
+            args[t] = g_args[t].load(std::memory_order_relaxed);
+        }
+    }
+    g_drained.fetch_add(1, std::memory_order_relaxed);
+    return mask;
+}
+
+void uiCommandSetRenderTask() {
+    g_renderTask.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+}
+
+bool uiMayTouchLvgl() {
+    const TaskHandle_t owner = g_renderTask.load(std::memory_order_acquire);
+    return owner == nullptr || owner == xTaskGetCurrentTaskHandle();
+}
+
+UiCommandStats uiCommandGetStats() {
+    UiCommandStats s;
+    s.posted = g_posted.load(std::memory_order_relaxed);
+    s.coalesced = g_coalesced.load(std::memory_order_relaxed);
+    s.drained = g_drained.load(std::memory_order_relaxed);
+    return s;
+}
@@ -0,0 +1,64 @@
+#ifndef UI_COMMAND_H
+#define UI_COMMAND_H
+
+#include <stdint.h>
+
+// UI-commando's van andere tasks naar de render-task (uiTask). Alleen de render-task raakt LVGL
+// en het display aan; andere tasks posten en wachten nooit op LVGL of een flush.
+// Coalescing: per type één slot — een nieuwere post vervangt een nog niet verwerkte.
+enum UiCommandType : uint8_t {
+    UI_CMD_REFRESH = 0,        // updateUI() deze ronde (arg ongebruikt)
+    UI_CMD_ROTATE = 1,         // arg = rotatie (0 of 2)
+    UI_CMD_PRICE_CARD = 2,     // Payload UiPriceCardCmd (uiCommandPostPriceCard)
+    UI_CMD_MARKET_STATE = 3,   // Payload UiMarketStateCmd (uiCommandPostMarketState)
+    UI_CMD_COUNT
+};
+
+// Hoofdprijs van één tick: de render-task tekent hieruit zonder dataMutex of globals te lezen
+struct UiPriceCardCmd {
+    float price;
+    uint32_t tickMs;
+};
+
+// Trend/volatiliteit/regime van één tick (enum-waarden als uint8_t; UI-headers blijven hier buiten)
+struct UiMarketStateCmd {
+    uint8_t trend;          // TrendState 2h
+    uint8_t trendMedium;    // TrendState 1d
+    uint8_t trendLong;      // TrendState 7d
+    uint8_t volatility;     // VolatilityState
+    uint8_t regime;         // RegimeKind (committed)
+};
+
+struct UiCommandStats {
+    uint32_t posted;
+    uint32_t coalesced;   // Posts die een onverwerkte post van hetzelfde type vervingen
+    uint32_t drained;
+};
+
+// Vanuit elke task (niet uit ISR); blokkeert nooit
+void uiCommandPost(UiCommandType type, uint32_t arg = 0);
+
+// Getypeerde posts: payload wordt gekopieerd (korte kritieke sectie), daarna het pending-bit gezet
+void uiCommandPostPriceCard(const UiPriceCardCmd& cmd);
+void uiCommandPostMarketState(const UiMarketStateCmd& cmd);
+
+// Alleen vanuit de render-task, voor bits uit uiCommandTakeAll(): laatst geposte payload
+void uiCommandReadPriceCard(UiPriceCardCmd& out);
+void uiCommandReadMarketState(UiMarketStateCmd& out);
+
+/**
+ * Alleen vanuit de render-task: haal alle pending commando's op.
+ * @param args per type het laatst geposte argument (alleen geldig voor bits in het resultaat)
+ * @return bitmask (1u << UiCommandType)
+ */
+uint32_t uiCommandTakeAll(uint32_t args[UI_CMD_COUNT]);
+
+// Render-task registreert zichzelf bij start; daarna is LVGL exclusief van die task
+void uiCommandSetRenderTask();
+
+// true vóór de render-task draait (setup/warm-start) of als de aanroeper de render-task is
+bool uiMayTouchLvgl();
+
+UiCommandStats uiCommandGetStats();
+
+#endif
@@ -0,0 +1,144 @@
+#include "VolSurface.h"
+#include <math.h>
+#include <string.h>
+
+namespace {
+
+static const float kLn2 = 0.69314718f;
+
+static const VolHorizonConfig kDefaultConfig[VOL_HORIZON_COUNT] = {
+    // barSec, spanBars, minBars, maxGapBars
+    {1, 90, 30, 5},
+    {60, 30, 5, 2},
+    {300, 12, 3, 2},
+    {3600, 24, 3, 1},
+};
+
+}  // namespace
+
+VolSurfaceEngine::VolSurfaceEngine() {
+    for (uint8_t i = 0; i < VOL_HORIZON_COUNT; i++) {
+        st_[i].cfg = kDefaultConfig[i];
+    }
+    reset();
+}
+
+VolHorizonConfig VolSurfaceEngine::defaultConfig(VolHorizon h) {
+    return (h < VOL_HORIZON_COUNT) ? kDefaultConfig[h] : kDefaultConfig[VOL_H_1S];
+}
+
+void VolSurfaceEngine::configure(VolHorizon h, const VolHorizonConfig& cfg) {
+    if (h >= VOL_HORIZON_COUNT || cfg.barSec == 0) {
+        return;
+    }
+    st_[h].cfg = cfg;
+    resetHorizon(h);
+}
+
+void VolSurfaceEngine::reset() {
+    memset(&snap_, 0, sizeof(snap_));
+    for (uint8_t i = 0; i < VOL_HORIZON_COUNT; i++) {
+        resetHorizon(i);
+    }
+}
+
+void VolSurfaceEngine::resetHorizon(uint8_t i) {
+    HorizonState& s = st_[i];
+    const uint16_t span = (s.cfg.spanBars > 0) ? s.cfg.spanBars : 1;
+    s.alpha = 2.0f / ((float)span + 1.0f);
+    s.scaleToMin = sqrtf(60.0f / (float)s.cfg.barSec);
+    s.barStart = 0;
+    s.firstSec = 0;
+    s.n = 0;
+    s.o = s.hi = s.lo = s.c = 0.0f;
+    s.prevClose = 0.0f;
+    s.prevBarStart = 0;
+    s.ewmaVar = 0.0f;
+    memset(&snap_.h[i], 0, sizeof(snap_.h[i]));
+}
+
+void VolSurfaceEngine::feed(uint32_t sec, float price) {
+    if (!(price > 0.0f) || isinf(price)) {
+        return;
+    }
+    snap_.lastSec = sec;
+    snap_.samples++;
+
+    for (uint8_t i = 0; i < VOL_HORIZON_COUNT; i++) {
+        HorizonState& s = st_[i];
+        const uint32_t barStart = sec - (sec % s.cfg.barSec);
+        if (s.n > 0 && barStart != s.barStart) {
+            closeBar(i);
+        }
+        if (s.n == 0) {
+            s.barStart = barStart;
+            s.firstSec = sec;
+            s.o = s.hi = s.lo = s.c = price;
+            s.n = 1;
+            continue;
+        }
+        if (price > s.hi) {
+            s.hi = price;
+        }
+        if (price < s.lo) {
+            s.lo = price;
+        }
+        s.c = price;
+        if (s.n < UINT16_MAX) {
+            s.n++;
+        }
+    }
+}
+
+void VolSurfaceEngine::closeBar(uint8_t i) {
+    HorizonState& s = st_[i];
+    const uint16_t barSec = s.cfg.barSec;
+
+    // Bar telt alleen als hij minstens de helft van zijn duur gevolgd is
+    const bool complete = (s.firstSec - s.barStart) <= (uint32_t)(barSec / 2);
+    uint32_t gapBars = 1;
+    bool hasPrev = false;
+    if (s.prevClose > 0.0f && s.barStart > s.prevBarStart) {
+        gapBars = (s.barStart - s.prevBarStart) / barSec;
+        hasPrev = (gapBars >= 1 && gapBars <= s.cfg.maxGapBars);
+    }
+
+    float var = 0.0f;
+    uint8_t est = VOL_EST_NONE;
+    if (s.n >= 2 && s.hi > s.lo) {
+        const float a = logf(s.hi / s.lo);
+        if (VOL_SURFACE_RANGE_ESTIMATOR == VOL_EST_PARKINSON) {
+            var = (a * a) / (4.0f * kLn2);
+        } else {
+            const float b = logf(s.c / s.o);
+            var = 0.5f * a * a - (2.0f * kLn2 - 1.0f) * b * b;
+        }
+        if (hasPrev) {
+            // Sprong prevClose→open overspant gapBars bar-intervallen: alleen die term per bar schalen;
+            // de intrabar-range is van deze ene (waargenomen) bar en telt volledig
+            const float j = logf(s.o / s.prevClose);
+            var += (j * j) / (float)gapBars;
+        }
+        est = VOL_SURFACE_RANGE_ESTIMATOR;
+    } else if (hasPrev) {
+        const float r = logf(s.c / s.prevClose);
+        var = (r * r) / (float)gapBars;
+        est = VOL_EST_CLOSE;
+    }
+
+    if (complete && est != VOL_EST_NONE) {
+        VolHorizonStats& out = snap_.h[i];
+        s.ewmaVar = (out.bars == 0) ? var : (s.ewmaVar + s.alpha * (var - s.ewmaVar));
+        if (out.bars < UINT16_MAX) {
+            out.bars++;
+        }
+        out.volPct = sqrtf(s.ewmaVar) * 100.0f;
+        out.volPerMinPct = out.volPct * s.scaleToMin;
+        out.ready = (out.bars >= s.cfg.minBars);
+        out.estimator = est;
+    }
+
+    s.prevClose = s.c;
+    s.prevBarStart = s.barStart;
+    s.n = 0;
+}
@@ -0,0 +1,102 @@
+#ifndef VOL_SURFACE_H
+#define VOL_SURFACE_H
+
+#include <stdint.h>
+
+/**
+ * VolSurface: realised volatility op meerdere horizons uit één 1 Hz prijsstroom
+ *
+ * Gedeelde kern voor v1 (src/VolatilityTracker) en v2 (components/domain_metrics): geen
+ * Arduino- of ESP-IDF-afhankelijkheden, geen heap, geen locking (aanroeper regelt dat).
+ *
+ * Per horizon wordt uit de secondeprijzen een OHLC-bar opgebouwd. Bij het sluiten van een bar
+ * gaat één variantieschatting in een EWMA (O(1) per sample, geen vensterloop):
+ * - 1s: close-to-close (één sample per bar, geen range)
+ * - 1m/5m/1h: Garman-Klass (of Parkinson, zie VOL_SURFACE_RANGE_ESTIMATOR) plus de sprong
+ *   van de vorige close naar de open, zodat er tussen bars niets wegvalt (bij ontbrekende bars
+ *   wordt alleen de sprongterm per overspannen bar geschaald)
+ * Onvolledige bars (start na een reset of gat) tellen niet mee.
+ */
+
+enum VolHorizon : uint8_t {
+    VOL_H_1S = 0,
+    VOL_H_1M,
+    VOL_H_5M,
+    VOL_H_1H,
+    VOL_HORIZON_COUNT
+};
+
+enum VolEstimator : uint8_t {
+    VOL_EST_NONE = 0,
+    VOL_EST_CLOSE,          // ln(C/Cprev)^2
+    VOL_EST_PARKINSON,      // ln(H/L)^2 / (4 ln 2)
+    VOL_EST_GARMAN_KLASS,   // 0.5 ln(H/L)^2 - (2 ln 2 - 1) ln(C/O)^2
+};
+
+// Range-estimator voor bars met meerdere samples (GK gebruikt ook open/close)
+#ifndef VOL_SURFACE_RANGE_ESTIMATOR
+#define VOL_SURFACE_RANGE_ESTIMATOR VOL_EST_GARMAN_KLASS
+#endif
+
+struct VolHorizonStats {
+    float volPct;          // Sigma per bar (log-return, %)
+    float volPerMinPct;    // Zelfde sigma geschaald naar 1 minuut: vergelijkbaar tussen horizons
+    uint16_t bars;         // Meegetelde bars sinds reset (verzadigt op 65535)
+    bool ready;            // bars >= minBars
+    uint8_t estimator;     // VolEstimator van de laatst gesloten bar
+};
+
+struct VolSurfaceSnapshot {
+    VolHorizonStats h[VOL_HORIZON_COUNT];
+    uint32_t lastSec;      // Seconde van de laatste feed
+    uint32_t samples;      // Feeds sinds reset
+};
+
+struct VolHorizonConfig {
+    uint16_t barSec;       // Barlengte in seconden
+    uint16_t spanBars;     // EWMA-span (alpha = 2 / (span + 1))
+    uint16_t minBars;      // Minimaal aantal bars voor ready
+    uint16_t maxGapBars;   // Groter gat tussen bars: sprongterm overslaan (geen vorige close)
+};
+
+class VolSurfaceEngine {
+public:
+    VolSurfaceEngine();
+
+    // Standaard horizons: 1s (span 90), 1m (30), 5m (12), 1h (24)
+    static VolHorizonConfig defaultConfig(VolHorizon h);
+
+    // Config per horizon aanpassen (reset die horizon)
+    void configure(VolHorizon h, const VolHorizonConfig& cfg);
+    void reset();
+
+    /**
+     * Eén prijs per seconde (vaker mag: zelfde seconde werkt de lopende bars bij)
+     * @param sec monotone seconde-teller (millis()/1000 of esp_timer)
+     */
+    void feed(uint32_t sec, float price);
+
+    const VolSurfaceSnapshot& snapshot() const { return snap_; }
+
+private:
+    struct HorizonState {
+        VolHorizonConfig cfg;
+        float alpha;
+        float scaleToMin;    // sqrt(60 / barSec)
+        uint32_t barStart;   // Uitgelijnd op barSec
+        uint32_t firstSec;   // Eerste sample in de bar
+        uint16_t n;          // Samples in de bar
+        float o, hi, lo, c;
+        float prevClose;     // 0 = geen (na reset/gat)
+        uint32_t prevBarStart;
+        float ewmaVar;       // (log-return)^2 per bar
+    };
+
+    void resetHorizon(uint8_t i);
+    void closeBar(uint8_t i);
+
+    HorizonState st_[VOL_HORIZON_COUNT];
+    VolSurfaceSnapshot snap_;
+};
+
+#endif // VOL_SURFACE_H
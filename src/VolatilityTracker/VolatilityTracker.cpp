@@ -1,9 +1,7 @@
 #include "VolatilityTracker.h"
 #include <math.h>
 
-// Forward declarations voor globale arrays en settings (parallel implementatie)
-extern float abs1mReturns[];
-extern float volatility1mReturns[];
+// Forward declarations voor globale settings
 extern bool autoVolatilityEnabled;
 extern uint8_t autoVolatilityWindowMinutes;
 extern float autoVolatilityBaseline1mStdPct;
@@ -18,35 +16,60 @@ extern float currentVolFactor;  // Voor logging (moet niet static zijn in .ino)
 #define Serial_printf Serial.printf
 #endif
 
+// Half-lives (samples) voor de EWMA realised volatility: kort / middel / lang
+static const uint16_t kEwmaHalfLives[VOLATILITY_EWMA_COUNT] = {10, 60, 240};
+
 // Constructor - initialiseer state variabelen
 VolatilityTracker::VolatilityTracker() {
     volatilityState = VOLATILITY_MEDIUM;
-    volatilityIndex = 0;
-    volatilityArrayFilled = false;
-    volatility1mIndex = 0;
-    volatility1mArrayFilled = false;
+    surfaceMux = portMUX_INITIALIZER_UNLOCKED;
+    resetEstimators();
 }
 
-// Begin - synchroniseer state met globale variabelen (parallel implementatie)
+// Begin - reset alle schatters en neem de globale volatility state over
 void VolatilityTracker::begin() {
-    syncStateFromGlobals();
+    extern VolatilityState volatilityState;
+    this->volatilityState = volatilityState;
+    resetEstimators();
 }
 
-// Sync state: Update VolatilityTracker state met globale variabelen
-void VolatilityTracker::syncStateFromGlobals() {
-    // Forward declarations voor globale variabelen
-    extern VolatilityState volatilityState;
-    extern uint8_t volatilityIndex;
-    extern bool volatilityArrayFilled;
-    extern uint8_t volatility1mIndex;
-    extern bool volatility1mArrayFilled;
+void VolatilityTracker::resetEstimators() {
+    absIndex = 0;
+    absFilled = false;
+    absSum = 0.0f;
+    absSinceResync = 0;
+    
+    volHead = 0;
+    volStored = 0;
+    winSize = 0;
+    winCount = 0;
+    winMean = 0.0f;
+    winM2 = 0.0f;
+    volSinceResync = 0;
+    
+    // decay = 2^(-1/h): na h samples weegt een sample nog de helft
+    for (uint8_t i = 0; i < VOLATILITY_EWMA_COUNT; i++) {
+        ewmaVar[i] = 0.0f;
+        ewmaDecay[i] = powf(0.5f, 1.0f / (float)kEwmaHalfLives[i]);
+    }
+    ewmaSeeded = false;
     
-    // Kopieer waarden van globale variabelen naar VolatilityTracker state
-    this->volatilityState = volatilityState;
-    this->volatilityIndex = volatilityIndex;
-    this->volatilityArrayFilled = volatilityArrayFilled;
-    this->volatility1mIndex = volatility1mIndex;
-    this->volatility1mArrayFilled = volatility1mArrayFilled;
+    portENTER_CRITICAL(&surfaceMux);
+    surface.reset();
+    portEXIT_CRITICAL(&surfaceMux);
+}
+
+void VolatilityTracker::feedSecondPrice(uint32_t sec, float price) {
+    portENTER_CRITICAL(&surfaceMux);
+    surface.feed(sec, price);
+    portEXIT_CRITICAL(&surfaceMux);
+}
+
+VolSurfaceSnapshot VolatilityTracker::getVolSurface() {
+    portENTER_CRITICAL(&surfaceMux);
+    const VolSurfaceSnapshot snap = surface.snapshot();
+    portEXIT_CRITICAL(&surfaceMux);
+    return snap;
 }
 
 // Voeg absolute 1m return toe aan volatiliteit buffer (oude systeem)
@@ -61,44 +84,37 @@ void VolatilityTracker::addAbs1mReturnToVolatilityBuffer(float abs_ret_1m) {
         return;
     }
     
-    // Bounds check voor abs1mReturns array
-    if (this->volatilityIndex >= VOLATILITY_LOOKBACK_MINUTES)
-    {
-        Serial_printf("[Array] ERROR: volatilityIndex buiten bereik: %u >= %u\n", this->volatilityIndex, VOLATILITY_LOOKBACK_MINUTES);
-        this->volatilityIndex = 0; // Reset naar veilige waarde
+    // Lopende som: oudste waarde eruit (alleen als de ring vol is), nieuwe erin
+    if (absFilled) {
+        absSum -= absRing[absIndex];
     }
-    
-    abs1mReturns[this->volatilityIndex] = abs_ret_1m;
-    this->volatilityIndex = (this->volatilityIndex + 1) % VOLATILITY_LOOKBACK_MINUTES;
-    
-    if (this->volatilityIndex == 0)
-    {
-        this->volatilityArrayFilled = true;
+    absRing[absIndex] = abs_ret_1m;
+    absSum += abs_ret_1m;
+    absIndex = (absIndex + 1) % VOLATILITY_LOOKBACK_MINUTES;
+    if (absIndex == 0) {
+        absFilled = true;
     }
     
-    // Update globale variabelen voor backward compatibility
-    extern uint8_t volatilityIndex;
-    extern bool volatilityArrayFilled;
-    volatilityIndex = this->volatilityIndex;
-    volatilityArrayFilled = this->volatilityArrayFilled;
+    // Periodiek exact herberekenen tegen opgestapelde afrondingsfouten
+    if (++absSinceResync >= VOLATILITY_RESYNC_SAMPLES) {
+        absSinceResync = 0;
+        const uint8_t count = absFilled ? VOLATILITY_LOOKBACK_MINUTES : absIndex;
+        float sum = 0.0f;
+        for (uint8_t i = 0; i < count; i++) {
+            sum += absRing[i];
+        }
+        absSum = sum;
+    }
 }
 
-// Bereken gemiddelde van absolute 1m returns over laatste 60 minuten
+// Gemiddelde van absolute 1m returns over laatste 60 minuten
 float VolatilityTracker::calculateAverageAbs1mReturn() {
-    uint8_t count = this->volatilityArrayFilled ? VOLATILITY_LOOKBACK_MINUTES : this->volatilityIndex;
-    
-    if (count == 0)
-    {
+    const uint8_t count = absFilled ? VOLATILITY_LOOKBACK_MINUTES : absIndex;
+    if (count == 0) {
         return 0.0f;
     }
-    
-    float sum = 0.0f;
-    for (uint8_t i = 0; i < count; i++)
-    {
-        sum += abs1mReturns[i];
-    }
-    
-    return sum / count;
+    const float avg = absSum / count;
+    return (avg > 0.0f) ? avg : 0.0f;
 }
 
 // Bepaal volatiliteit state op basis van gemiddelde absolute 1m return
@@ -114,66 +130,136 @@ VolatilityState VolatilityTracker::determineVolatilityState(float avg_abs_1m, fl
     return VOLATILITY_HIGH;  // Volatiel: >= 0.15%
 }
 
-// Bereken standaarddeviatie van 1m returns in sliding window (auto-volatility mode)
-float VolatilityTracker::calculateStdDev1mReturns() {
-    if (!this->volatility1mArrayFilled && this->volatility1mIndex == 0) {
-        return 0.0f;  // Geen data beschikbaar
+float VolatilityTracker::volSampleAt(uint8_t age) const {
+    return volRing[(volHead + MAX_VOLATILITY_WINDOW_SIZE - 1 - age) % MAX_VOLATILITY_WINDOW_SIZE];
+}
+
+void VolatilityTracker::welfordAdd(float x) {
+    // winCount is al opgehoogd door de aanroeper
+    const float delta = x - winMean;
+    winMean += delta / winCount;
+    winM2 += delta * (x - winMean);
+}
+
+void VolatilityTracker::welfordRemove(float x) {
+    // winCount is al verlaagd door de aanroeper
+    if (winCount == 0) {
+        winMean = 0.0f;
+        winM2 = 0.0f;
+        return;
     }
-    
-    // Geoptimaliseerd: gebruik helper functie i.p.v. gedupliceerde berekening
-    uint8_t windowSize = getClampedWindowSize();
-    
-    // Validatie: window size moet minimaal 1 zijn
-    if (windowSize == 0) {
-        return 0.0f;
+    const float oldMean = winMean;
+    winMean -= (x - oldMean) / winCount;
+    winM2 -= (x - oldMean) * (x - winMean);
+    if (winM2 < 0.0f) {
+        winM2 = 0.0f;
     }
-    
-    uint8_t count = this->volatility1mArrayFilled ? windowSize : this->volatility1mIndex;
-    
-    if (count < 2) {
-        return 0.0f;  // Minimaal 2 samples nodig voor std dev
+}
+
+// Nieuwe window size: alleen het verschil aan de oude kant toevoegen of verwijderen
+void VolatilityTracker::applyWindowSize(uint8_t size) {
+    if (size == winSize) {
+        return;
+    }
+    while (winCount > size) {
+        const float oldest = volSampleAt(winCount - 1);
+        winCount--;
+        welfordRemove(oldest);
+    }
+    while (winCount < size && winCount < volStored) {
+        const float older = volSampleAt(winCount);
+        winCount++;
+        welfordAdd(older);
+    }
+    winSize = size;
+}
+
+// Exacte two-pass herberekening van het window (alleen elke VOLATILITY_RESYNC_SAMPLES samples)
+void VolatilityTracker::resyncWindow() {
+    if (winCount == 0) {
+        winMean = 0.0f;
+        winM2 = 0.0f;
+        return;
     }
-    
-    // Bereken gemiddelde
     float sum = 0.0f;
-    for (uint8_t i = 0; i < count; i++) {
-        sum += volatility1mReturns[i];
+    for (uint8_t i = 0; i < winCount; i++) {
+        sum += volSampleAt(i);
     }
-    float mean = sum / count;
-    
-    // Bereken variantie
-    float variance = 0.0f;
-    for (uint8_t i = 0; i < count; i++) {
-        float diff = volatility1mReturns[i] - mean;
-        variance += diff * diff;
+    const float mean = sum / winCount;
+    float m2 = 0.0f;
+    for (uint8_t i = 0; i < winCount; i++) {
+        const float d = volSampleAt(i) - mean;
+        m2 += d * d;
     }
-    variance /= (count - 1);  // Sample variance (n-1)
+    winMean = mean;
+    winM2 = m2;
+}
+
+// Standaarddeviatie van 1m returns in sliding window (auto-volatility mode)
+float VolatilityTracker::calculateStdDev1mReturns() {
+    applyWindowSize(getClampedWindowSize());
     
-    // Standaarddeviatie
-    return sqrtf(variance);
+    if (winCount < 2) {
+        return 0.0f;  // Minimaal 2 samples nodig voor std dev
+    }
+    return sqrtf(winM2 / (winCount - 1));  // Sample variance (n-1)
 }
 
 // Update sliding window met nieuwe 1m return (auto-volatility mode)
 void VolatilityTracker::updateVolatilityWindow(float ret_1m) {
     if (!autoVolatilityEnabled) return;
+    if (isnan(ret_1m) || isinf(ret_1m)) return;
     
-    // Geoptimaliseerd: gebruik helper functie i.p.v. gedupliceerde berekening
-    uint8_t windowSize = getClampedWindowSize();
+    applyWindowSize(getClampedWindowSize());
     
-    // Voeg nieuwe return toe aan circulaire buffer
-    volatility1mReturns[this->volatility1mIndex] = ret_1m;
-    this->volatility1mIndex++;
-    
-    if (this->volatility1mIndex >= windowSize) {
-        this->volatility1mIndex = 0;
-        this->volatility1mArrayFilled = true;
+    // Vol window: oudste sample eruit vóór de ring hem eventueel overschrijft
+    if (winSize > 0 && winCount >= winSize) {
+        const float oldest = volSampleAt(winCount - 1);
+        winCount--;
+        welfordRemove(oldest);
+    }
+    volRing[volHead] = ret_1m;
+    volHead = (volHead + 1) % MAX_VOLATILITY_WINDOW_SIZE;
+    if (volStored < MAX_VOLATILITY_WINDOW_SIZE) {
+        volStored++;
+    }
+    if (winSize > 0) {
+        winCount++;
+        welfordAdd(ret_1m);
+    }
+    if (++volSinceResync >= VOLATILITY_RESYNC_SAMPLES) {
+        volSinceResync = 0;
+        resyncWindow();
     }
     
-    // Update globale variabelen voor backward compatibility
-    extern uint8_t volatility1mIndex;
-    extern bool volatility1mArrayFilled;
-    volatility1mIndex = this->volatility1mIndex;
-    volatility1mArrayFilled = this->volatility1mArrayFilled;
+    // EWMA van r^2 (realised variance rond 0); eerste sample zaait alle half-lives
+    const float sq = ret_1m * ret_1m;
+    for (uint8_t i = 0; i < VOLATILITY_EWMA_COUNT; i++) {
+        ewmaVar[i] = ewmaSeeded ? (ewmaDecay[i] * ewmaVar[i] + (1.0f - ewmaDecay[i]) * sq) : sq;
+    }
+    ewmaSeeded = true;
+}
+
+float VolatilityTracker::getEwmaVolatility(uint8_t idx) const {
+    if (idx >= VOLATILITY_EWMA_COUNT || !ewmaSeeded) {
+        return 0.0f;
+    }
+    return sqrtf(ewmaVar[idx]);
+}
+
+uint16_t VolatilityTracker::getEwmaHalfLife(uint8_t idx) {
+    return (idx < VOLATILITY_EWMA_COUNT) ? kEwmaHalfLives[idx] : 0;
+}
+
+// Clamp tussen min en max multiplier; <= 0 (ongeldige settings) valt terug op 1.0
+static float clampVolFactor(float raw) {
+    float f = raw;
+    if (f < autoVolatilityMinMultiplier) {
+        f = autoVolatilityMinMultiplier;
+    } else if (f > autoVolatilityMaxMultiplier) {
+        f = autoVolatilityMaxMultiplier;
+    }
+    return (f > 0.0f) ? f : 1.0f;
 }
 
 // Bereken volatility factor en effective thresholds (auto-volatility mode)
@@ -189,16 +275,25 @@ EffectiveThresholds VolatilityTracker::calculateEffectiveThresholds(float baseSp
         return eff;
     }
     
-    // Bereken standaarddeviatie
-    eff.stdDev = this->calculateStdDev1mReturns();
-    
-    // Geoptimaliseerd: gebruik helper functie voor window size
-    uint8_t windowSize = getClampedWindowSize();
-    uint8_t minSamples = (windowSize < 10) ? windowSize : 10;
+    // Vol-surface heeft voorrang: 1m-horizon (GK op 1s-samples) voor spike1m, 5m-horizon
+    // (per minuut geschaald) voor move5m/move30m. Zonder genoeg bars: Welford-window als fallback.
+    const VolSurfaceSnapshot surf = getVolSurface();
+    const VolHorizonStats& h1m = surf.h[VOL_H_1M];
+    const VolHorizonStats& h5m = surf.h[VOL_H_5M];
     
-    // Geconsolideerde check: onvoldoende data of invalid stdDev
-    if (eff.stdDev <= 0.0f || (!this->volatility1mArrayFilled && this->volatility1mIndex < minSamples)) {
-        return eff;  // Base thresholds al ingesteld
+    if (h1m.ready && h1m.volPerMinPct > 0.0f) {
+        eff.stdDev = h1m.volPerMinPct;
+    } else {
+        eff.stdDev = this->calculateStdDev1mReturns();
+        
+        // Geoptimaliseerd: gebruik helper functie voor window size
+        uint8_t windowSize = getClampedWindowSize();
+        uint8_t minSamples = (windowSize < 10) ? windowSize : 10;
+        
+        // Geconsolideerde check: onvoldoende data of invalid stdDev
+        if (eff.stdDev <= 0.0f || winCount < minSamples) {
+            return eff;  // Base thresholds al ingesteld
+        }
     }
     
     // Validatie: voorkom deling door nul
@@ -206,21 +301,10 @@ EffectiveThresholds VolatilityTracker::calculateEffectiveThresholds(float baseSp
         return eff;  // Base thresholds al ingesteld
     }
     
-    // Bereken volatility factor
-    float rawVolFactor = eff.stdDev / autoVolatilityBaseline1mStdPct;
-    
-    // Geconsolideerde clamp operaties: clamp tussen min en max in één keer
-    if (rawVolFactor < autoVolatilityMinMultiplier) {
-        eff.volFactor = autoVolatilityMinMultiplier;
-    } else if (rawVolFactor > autoVolatilityMaxMultiplier) {
-        eff.volFactor = autoVolatilityMaxMultiplier;
-    } else {
-        eff.volFactor = rawVolFactor;
-    }
-    
-    // Validatie: voorkom negatieve of nul thresholds
-    if (eff.volFactor <= 0.0f) {
-        eff.volFactor = 1.0f;
+    eff.volFactor = clampVolFactor(eff.stdDev / autoVolatilityBaseline1mStdPct);
+    float slowFactor = eff.volFactor;
+    if (h5m.ready && h5m.volPerMinPct > 0.0f) {
+        slowFactor = clampVolFactor(h5m.volPerMinPct / autoVolatilityBaseline1mStdPct);
     }
     
     // Update globale volFactor voor logging
@@ -228,8 +312,8 @@ EffectiveThresholds VolatilityTracker::calculateEffectiveThresholds(float baseSp
     
     // Pas volFactor toe op thresholds
     eff.spike1m = baseSpike1m * eff.volFactor;
-    eff.move5m = baseMove5m * sqrtf(eff.volFactor);  // sqrt voor langere timeframes
-    eff.move30m = baseMove30m * sqrtf(eff.volFactor);
+    eff.move5m = baseMove5m * sqrtf(slowFactor);  // sqrt voor langere timeframes
+    eff.move30m = baseMove30m * sqrtf(slowFactor);
     
     // Geconsolideerde validatie: voorkom negatieve thresholds (safety check)
     if (eff.spike1m < 0.0f) eff.spike1m = baseSpike1m;
@@ -2,6 +2,8 @@
 #define VOLATILITYTRACKER_H
 
 #include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include "../VolSurface/VolSurface.h"
 
 // VolatilityState enum - gebruikt voor volatiliteit detection
 enum VolatilityState {
@@ -23,7 +25,17 @@ struct EffectiveThresholds {
 #define VOLATILITY_LOOKBACK_MINUTES 60  // Bewaar laatste 60 minuten aan absolute 1m returns
 #define MAX_VOLATILITY_WINDOW_SIZE 120  // Maximum window size (voor array grootte)
 
+// EWMA realised volatility: aantal half-lives (in samples van updateVolatilityWindow)
+#define VOLATILITY_EWMA_COUNT 3
+
+// Lopende sommen worden na zoveel samples één keer exact herberekend (float-drift)
+#ifndef VOLATILITY_RESYNC_SAMPLES
+#define VOLATILITY_RESYNC_SAMPLES 1024
+#endif
+
 // VolatilityTracker class - beheert volatiliteit berekeningen en auto-volatility mode
+// Alle schatters zijn streaming (O(1) per sample): lopende som voor het 60m-gemiddelde,
+// Welford met verwijderen aan de staart voor de std dev van het sliding window, en EWMA's.
 class VolatilityTracker {
 public:
     VolatilityTracker();
@@ -37,24 +49,34 @@ public:
     // Voeg absolute 1m return toe aan volatiliteit buffer
     void addAbs1mReturnToVolatilityBuffer(float abs_ret_1m);
     
-    // Bereken gemiddelde van absolute 1m returns over laatste 60 minuten
+    // Gemiddelde van absolute 1m returns over laatste 60 minuten (lopende som, geen loop)
     float calculateAverageAbs1mReturn();
     
     // Bepaal volatiliteit state op basis van gemiddelde absolute 1m return
     VolatilityState determineVolatilityState(float avg_abs_1m, float volatilityLowThreshold, float volatilityHighThreshold);
     
     // Auto-Volatility Mode functies (nieuwe systeem - sliding window)
-    // Bereken standaarddeviatie van 1m returns in sliding window
+    // Standaarddeviatie van 1m returns in sliding window (Welford, geen loop)
     float calculateStdDev1mReturns();
     
-    // Update sliding window met nieuwe 1m return
+    // Update sliding window met nieuwe 1m return (Welford + EWMA's)
     void updateVolatilityWindow(float ret_1m);
     
     // Bereken volatility factor en effective thresholds
     EffectiveThresholds calculateEffectiveThresholds(float baseSpike1m, float baseMove5m, float baseMove30m);
     
-    // Sync state: Update VolatilityTracker state met globale variabelen (voor parallel implementatie)
-    void syncStateFromGlobals();
+    // EWMA realised volatility (std dev van 1m returns, %) per half-life; 0 zonder samples
+    float getEwmaVolatility(uint8_t idx) const;
+    static uint16_t getEwmaHalfLife(uint8_t idx);
+    
+    // Aantal samples in het actieve sliding window
+    uint8_t getWindowCount() const { return winCount; }
+    
+    // Multi-horizon realised vol (1s/1m/5m/1h): één prijs per seconde vanuit priceRepeatTask
+    void feedSecondPrice(uint32_t sec, float price);
+    
+    // Kopie van de vol-surface (spinlock; veilig vanuit elke task)
+    VolSurfaceSnapshot getVolSurface();
     
     // Helper: Get clamped window size (geoptimaliseerd: elimineert code duplicatie)
     static inline uint8_t getClampedWindowSize() {
@@ -73,18 +95,40 @@ public:
 private:
     VolatilityState volatilityState;
     
-    // Oude systeem (60 minuten lookback)
-    uint8_t volatilityIndex;
-    bool volatilityArrayFilled;
+    // Oude systeem (60 minuten lookback): ring + lopende som
+    float absRing[VOLATILITY_LOOKBACK_MINUTES];
+    uint8_t absIndex;
+    bool absFilled;
+    float absSum;
+    uint16_t absSinceResync;
     
-    // Auto-Volatility Mode state (sliding window)
-    uint8_t volatility1mIndex;
-    bool volatility1mArrayFilled;
+    // Auto-Volatility Mode: ring met de laatste MAX_VOLATILITY_WINDOW_SIZE returns. Het actieve
+    // window (laatste winSize samples) wordt met Welford bijgehouden; een andere window size
+    // voegt alleen het verschil toe of haalt het weg (geen volledige rescan).
+    float volRing[MAX_VOLATILITY_WINDOW_SIZE];
+    uint8_t volHead;      // Volgende schrijfpositie
+    uint8_t volStored;    // Aantal geldige samples in de ring
+    uint8_t winSize;      // Toegepaste window size
+    uint8_t winCount;     // Samples in het window (min(winSize, volStored))
+    float winMean;
+    float winM2;          // Som van kwadratische afwijkingen t.o.v. winMean
+    uint16_t volSinceResync;
     
-    // Note: Globale arrays en settings worden via extern declarations in .cpp file gebruikt
-    // (parallel implementatie - arrays blijven globaal in .ino)
+    // EWMA van r^2 per half-life
+    float ewmaVar[VOLATILITY_EWMA_COUNT];
+    float ewmaDecay[VOLATILITY_EWMA_COUNT];
+    bool ewmaSeeded;
+    
+    // Vol-surface: schrijver is priceRepeatTask, lezers zijn apiTask (thresholds) en web
+    VolSurfaceEngine surface;
+    portMUX_TYPE surfaceMux;
+    
+    void resetEstimators();
+    float volSampleAt(uint8_t age) const;  // age 0 = nieuwste
+    void welfordAdd(float x);
+    void welfordRemove(float x);
+    void applyWindowSize(uint8_t size);
+    void resyncWindow();
 };
 
 #endif // VOLATILITYTRACKER_H
-
-
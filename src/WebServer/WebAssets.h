@@ -0,0 +1,703 @@
+// GEGENEREERD door src/WebServer/assets/build_web_assets.py - niet handmatig wijzigen.
+// Bron: src/WebServer/assets/*.css|*.js
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char* path;
+    const char* contentType;
+    const uint8_t* gz;
+    size_t gzLen;
+    const uint8_t* raw;
+    size_t rawLen;
+    const char* etag;       // Sterke ETag incl. quotes (identity-body)
+    const char* etagGz;     // Sterke ETag van de gzip-body: andere bytes, dus andere validator
+    const char* version;    // Voor ?v= in URL's (cache-busting na firmware-update)
+};
+
+// /assets/app.css: 2353 -> 770 bytes gzip
+static const uint8_t kWebAssetAppCssGz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x55, 0xed, 0x8a, 0x9c, 0x30,
+    0x14, 0xfd, 0xbf, 0x4f, 0x21, 0x2c, 0x85, 0xb6, 0xac, 0x83, 0x3a, 0xce, 0x30, 0x44, 0x0a, 0xfd,
+    0x7a, 0x8b, 0xb2, 0x3f, 0x62, 0x8c, 0x9a, 0x6e, 0x4c, 0x24, 0xc6, 0x1d, 0xa7, 0xb2, 0xef, 0xde,
+    0x24, 0x1a, 0x8d, 0x1f, 0xdb, 0x76, 0xcb, 0xc0, 0x80, 0x21, 0xf7, 0xdc, 0x9b, 0x73, 0xce, 0xbd,
+    0xf7, 0x63, 0x9f, 0xf2, 0xce, 0x6f, 0xc8, 0x2f, 0xc2, 0x0a, 0x90, 0x72, 0x91, 0x61, 0xe1, 0xab,
+    0x93, 0xe4, 0xe5, 0x2e, 0xe5, 0xd9, 0xad, 0xcf, 0x39, 0x93, 0x7e, 0x0e, 0x2b, 0x42, 0x6f, 0xe0,
+    0x8b, 0x20, 0x90, 0x26, 0x15, 0x14, 0x05, 0x61, 0x20, 0x48, 0x6a, 0x98, 0x65, 0x3a, 0x28, 0x0c,
+    0xea, 0x2e, 0x49, 0x21, 0x7a, 0x2a, 0x04, 0x6f, 0x59, 0x06, 0xee, 0x43, 0xa8, 0x7f, 0x09, 0xe2,
+    0x94, 0x0b, 0x70, 0x9f, 0xe7, 0xb9, 0x02, 0x3b, 0x20, 0x05, 0x04, 0x09, 0xc3, 0xa2, 0xaf, 0x60,
+    0xe7, 0x5f, 0x49, 0x26, 0x4b, 0x70, 0x0e, 0x74, 0xa8, 0x05, 0xf4, 0x60, 0x2b, 0xf9, 0x84, 0x1a,
+    0x78, 0x06, 0xf7, 0xe5, 0xae, 0x0c, 0xfb, 0x11, 0x29, 0x08, 0xbe, 0x7e, 0xfb, 0x1e, 0xdb, 0xfb,
+    0xe1, 0xa9, 0xee, 0xbc, 0x20, 0x31, 0x05, 0xaa, 0xf2, 0x31, 0x88, 0x62, 0x73, 0x3f, 0xe7, 0xa2,
+    0x72, 0x72, 0x84, 0x41, 0xf0, 0x4e, 0x9d, 0x52, 0x98, 0x62, 0xda, 0x67, 0xa4, 0xa9, 0x29, 0xbc,
+    0x81, 0x94, 0x72, 0xf4, 0xb4, 0x04, 0xf2, 0xd4, 0xbf, 0x2d, 0x19, 0x21, 0xa4, 0x42, 0x08, 0xab,
+    0x5b, 0xf9, 0x43, 0xde, 0x6a, 0xfc, 0x89, 0xb5, 0x55, 0x8a, 0xc5, 0xe3, 0x83, 0x73, 0x24, 0x71,
+    0x27, 0x1f, 0x1f, 0x1a, 0x4c, 0x31, 0x92, 0xbd, 0x93, 0xca, 0xd6, 0x7f, 0xd1, 0xa4, 0x18, 0x3a,
+    0x41, 0xa8, 0xf0, 0x1b, 0x4e, 0x49, 0xe6, 0xdd, 0xc7, 0x71, 0xbc, 0xa0, 0x2a, 0x82, 0xfa, 0xe7,
+    0x52, 0x35, 0x4a, 0x20, 0x60, 0x46, 0xda, 0x06, 0xc4, 0x06, 0xe5, 0x15, 0x7d, 0x5a, 0x29, 0x39,
+    0xeb, 0x5d, 0xb8, 0x91, 0x21, 0x07, 0x6e, 0x12, 0x29, 0x52, 0x45, 0x44, 0xf1, 0x5c, 0x14, 0xe3,
+    0x0c, 0xef, 0x24, 0x43, 0xad, 0x68, 0x54, 0x6c, 0xcd, 0x09, 0x93, 0x58, 0x38, 0xec, 0x86, 0xe7,
+    0x49, 0x2a, 0x5f, 0xf2, 0x1a, 0x44, 0x5a, 0x9d, 0x05, 0xc5, 0x43, 0x3d, 0xa0, 0xe4, 0xcf, 0x4a,
+    0xe4, 0x65, 0x55, 0x10, 0xa1, 0x50, 0x9b, 0x80, 0xb0, 0x9c, 0x5b, 0x35, 0x2f, 0x97, 0x8b, 0x0b,
+    0x1f, 0x2d, 0xe1, 0x4f, 0x46, 0xcb, 0x43, 0x23, 0xa1, 0x6c, 0x1b, 0xfd, 0xe0, 0x7e, 0x87, 0xb6,
+    0x57, 0xf8, 0xdd, 0x3c, 0x6a, 0x22, 0xe1, 0x34, 0xdb, 0x4d, 0xd7, 0xaf, 0xec, 0xb3, 0x31, 0x8a,
+    0x4d, 0x29, 0xf8, 0x75, 0xb2, 0x4b, 0x4e, 0x71, 0x97, 0xfc, 0x6c, 0x1b, 0x49, 0xf2, 0x9b, 0xaf,
+    0x8d, 0x8c, 0x99, 0x04, 0x4d, 0x0d, 0x11, 0xf6, 0x53, 0x2c, 0xaf, 0x18, 0x33, 0x8b, 0x7a, 0x31,
+    0xa0, 0x8e, 0x07, 0xd4, 0xd7, 0x24, 0x9a, 0xa2, 0xa7, 0x72, 0x8b, 0x3d, 0x1e, 0x8f, 0x89, 0x86,
+    0xf6, 0xaf, 0x02, 0xd6, 0x40, 0xff, 0x39, 0xf9, 0x07, 0xc3, 0xba, 0x5c, 0xa9, 0x9b, 0x20, 0x4c,
+    0x2a, 0x45, 0xd0, 0x58, 0x70, 0x14, 0x2c, 0x48, 0x7a, 0x86, 0xb4, 0xc5, 0xbd, 0xa3, 0xbd, 0x61,
+    0xf7, 0x8a, 0x49, 0x51, 0x4a, 0xe5, 0x1c, 0x9a, 0x25, 0xda, 0xb3, 0x3e, 0xa4, 0xa4, 0x60, 0x40,
+    0xe8, 0xd3, 0x1d, 0xcc, 0xc0, 0x62, 0x2a, 0x5b, 0x13, 0xce, 0xfc, 0x12, 0xc3, 0x6c, 0x25, 0xe7,
+    0xff, 0x92, 0x3f, 0x2b, 0x6c, 0x5b, 0x2e, 0x58, 0xdb, 0xed, 0x0d, 0x84, 0x9b, 0x67, 0xf8, 0x44,
+    0xe2, 0xaa, 0x01, 0x08, 0x9b, 0xe8, 0x4d, 0xd9, 0x3b, 0x5e, 0xd4, 0x9c, 0x6f, 0xee, 0x79, 0xe5,
+    0xb1, 0x9f, 0xc6, 0xda, 0x72, 0xd8, 0xac, 0x1a, 0xc0, 0x09, 0x1d, 0xcb, 0x9a, 0x4c, 0x62, 0x1a,
+    0x6a, 0xe1, 0xb4, 0x9d, 0x99, 0xf8, 0x47, 0xd2, 0xb4, 0xef, 0x77, 0xda, 0x52, 0xf1, 0xe4, 0x29,
+    0x22, 0xbd, 0x78, 0x37, 0xff, 0x01, 0xaa, 0xcf, 0x67, 0xbc, 0x1a, 0x6d, 0xce, 0xbd, 0x0c, 0x37,
+    0xe8, 0xdf, 0x7b, 0x6e, 0xfc, 0xb4, 0x66, 0x1d, 0xdb, 0x50, 0xf2, 0xa2, 0xa0, 0xd8, 0x27, 0x2a,
+    0x67, 0xff, 0x2a, 0x3f, 0x7a, 0xe2, 0x19, 0x3b, 0x37, 0xa5, 0x20, 0xec, 0x09, 0x04, 0x16, 0x8c,
+    0xe2, 0x5c, 0x82, 0x71, 0x9a, 0x1f, 0x44, 0xcb, 0x24, 0xa9, 0xf0, 0x50, 0x7e, 0x27, 0xfb, 0x25,
+    0x49, 0xae, 0xb3, 0xa2, 0x99, 0xa4, 0x31, 0xd9, 0x5b, 0xcc, 0xb5, 0x93, 0xcb, 0x2b, 0xa3, 0x49,
+    0x66, 0x6f, 0xdc, 0x2f, 0x7f, 0x51, 0xfb, 0x73, 0x85, 0x33, 0x02, 0xbd, 0xf7, 0xab, 0x9d, 0xf5,
+    0xa1, 0x1f, 0xb6, 0xa3, 0x4d, 0x3f, 0xd2, 0x34, 0xef, 0xb8, 0x79, 0x8b, 0x9d, 0xec, 0x12, 0x73,
+    0x16, 0x95, 0xb3, 0xf5, 0xc2, 0xc0, 0x16, 0xeb, 0x8c, 0xba, 0xc5, 0x66, 0xdd, 0xbc, 0xca, 0x19,
+    0x50, 0x86, 0xee, 0x8c, 0x88, 0x41, 0x6a, 0xa0, 0x1e, 0xd3, 0x56, 0x6c, 0x22, 0xe5, 0xbc, 0x8a,
+    0x18, 0x46, 0xca, 0xdc, 0xec, 0x66, 0xdf, 0x2e, 0x05, 0x3f, 0xee, 0x4c, 0x14, 0x67, 0x6a, 0x68,
+    0x25, 0x93, 0x15, 0xc0, 0x76, 0x58, 0x2c, 0xca, 0xdf, 0x6d, 0x36, 0x87, 0xe7, 0x7d, 0x57, 0xaf,
+    0x31, 0xc6, 0x5d, 0xe7, 0x9e, 0x7a, 0x86, 0xc6, 0x0d, 0xd2, 0xf0, 0xc8, 0xcd, 0xf1, 0x1b, 0x96,
+    0xf9, 0x2a, 0xd6, 0x61, 0x53, 0xe1, 0xbc, 0xdc, 0xfd, 0x06, 0x41, 0xe6, 0x88, 0x92, 0x31, 0x09,
+    0x00, 0x00,
+};
+static const uint8_t kWebAssetAppCssRaw[] PROGMEM = {
+    0x2a, 0x7b, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x6f, 0x72,
+    0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x78, 0x3b, 0x7d, 0x0a, 0x62, 0x6f, 0x64, 0x79, 0x7b, 0x66,
+    0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x41, 0x72, 0x69, 0x61, 0x6c,
+    0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
+    0x67, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+    0x64, 0x3a, 0x23, 0x31, 0x61, 0x31, 0x61, 0x31, 0x61, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+    0x23, 0x66, 0x66, 0x66, 0x3b, 0x7d, 0x0a, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65,
+    0x72, 0x7b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x36, 0x30, 0x30, 0x70,
+    0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b,
+    0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x7d,
+    0x0a, 0x68, 0x31, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x30, 0x30, 0x42, 0x43, 0x44,
+    0x34, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x20, 0x30, 0x3b,
+    0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x32, 0x34, 0x70, 0x78, 0x3b, 0x7d,
+    0x0a, 0x66, 0x6f, 0x72, 0x6d, 0x7b, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
+    0x31, 0x30, 0x30, 0x25, 0x3b, 0x7d, 0x0a, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b, 0x64, 0x69, 0x73,
+    0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69,
+    0x6e, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x20, 0x30, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x63, 0x6f, 0x6c,
+    0x6f, 0x72, 0x3a, 0x23, 0x63, 0x63, 0x63, 0x3b, 0x7d, 0x0a, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b,
+    0x74, 0x79, 0x70, 0x65, 0x3d, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5d, 0x2c, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x74, 0x65, 0x78, 0x74, 0x5d, 0x2c, 0x73, 0x65,
+    0x6c, 0x65, 0x63, 0x74, 0x7b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b,
+    0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x38, 0x70, 0x78, 0x3b, 0x62, 0x6f, 0x72, 0x64,
+    0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x34, 0x34,
+    0x34, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x32, 0x61,
+    0x32, 0x61, 0x32, 0x61, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b,
+    0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x34, 0x70,
+    0x78, 0x3b, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x6f, 0x72,
+    0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x78, 0x3b, 0x7d, 0x0a, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+    0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x30, 0x30, 0x42,
+    0x43, 0x44, 0x34, 0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x70,
+    0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x20, 0x32, 0x34, 0x70, 0x78,
+    0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x62, 0x6f, 0x72,
+    0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x34, 0x70, 0x78, 0x3b, 0x63,
+    0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x66, 0x6f,
+    0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72,
+    0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x7d, 0x0a, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+    0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+    0x64, 0x3a, 0x23, 0x30, 0x30, 0x61, 0x63, 0x63, 0x31, 0x3b, 0x7d, 0x0a, 0x2e, 0x69, 0x6e, 0x66,
+    0x6f, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x38, 0x38, 0x38, 0x3b, 0x66, 0x6f, 0x6e,
+    0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67,
+    0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x35, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x2d, 0x62, 0x6f, 0x78, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f,
+    0x75, 0x6e, 0x64, 0x3a, 0x23, 0x32, 0x61, 0x32, 0x61, 0x32, 0x61, 0x3b, 0x62, 0x6f, 0x72, 0x64,
+    0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x34, 0x34,
+    0x34, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a,
+    0x34, 0x70, 0x78, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x35, 0x70, 0x78,
+    0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x32, 0x30, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x6d,
+    0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x7d, 0x0a,
+    0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x72, 0x6f, 0x77, 0x7b, 0x64, 0x69, 0x73, 0x70,
+    0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79,
+    0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2d, 0x62,
+    0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x38, 0x70,
+    0x78, 0x20, 0x30, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x38, 0x70, 0x78, 0x20,
+    0x30, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a,
+    0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 0x66,
+    0x6c, 0x65, 0x78, 0x2d, 0x77, 0x72, 0x61, 0x70, 0x3a, 0x77, 0x72, 0x61, 0x70, 0x3b, 0x7d, 0x0a,
+    0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b, 0x63, 0x6f,
+    0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x38, 0x38, 0x38, 0x3b, 0x66, 0x6c, 0x65, 0x78, 0x3a, 0x31, 0x3b,
+    0x6d, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x32, 0x30, 0x70, 0x78, 0x3b,
+    0x7d, 0x0a, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x7b,
+    0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
+    0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x6f, 0x6c, 0x64, 0x3b, 0x74, 0x65, 0x78, 0x74,
+    0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3b, 0x66, 0x6c, 0x65,
+    0x78, 0x3a, 0x31, 0x3b, 0x6d, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30,
+    0x30, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+    0x3a, 0x23, 0x32, 0x61, 0x32, 0x61, 0x32, 0x61, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a,
+    0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x34, 0x34, 0x34, 0x3b, 0x62,
+    0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x34, 0x70, 0x78,
+    0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x6d, 0x61,
+    0x72, 0x67, 0x69, 0x6e, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x20, 0x30, 0x20, 0x30, 0x3b, 0x63, 0x75,
+    0x72, 0x73, 0x6f, 0x72, 0x3a, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x64, 0x69, 0x73,
+    0x70, 0x6c, 0x61, 0x79, 0x3a, 0x66, 0x6c, 0x65, 0x78, 0x3b, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66,
+    0x79, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2d,
+    0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x3b, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x69, 0x74,
+    0x65, 0x6d, 0x73, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x65,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3a, 0x68, 0x6f, 0x76,
+    0x65, 0x72, 0x7b, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x33,
+    0x33, 0x33, 0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x65,
+    0x61, 0x64, 0x65, 0x72, 0x20, 0x68, 0x33, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30,
+    0x3b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x30, 0x30, 0x42, 0x43, 0x44, 0x34, 0x3b, 0x66,
+    0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x7d, 0x0a,
+    0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x70, 0x61,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x3b, 0x62, 0x61, 0x63, 0x6b, 0x67,
+    0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x31, 0x61, 0x31, 0x61, 0x31, 0x61, 0x3b, 0x62, 0x6f,
+    0x72, 0x64, 0x65, 0x72, 0x3a, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23,
+    0x34, 0x34, 0x34, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x6e,
+    0x6f, 0x6e, 0x65, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75,
+    0x73, 0x3a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 0x3b, 0x7d, 0x0a,
+    0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+    0x2e, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x7b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a,
+    0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x2d, 0x64, 0x65, 0x73, 0x63, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x38, 0x38, 0x38,
+    0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x3b,
+    0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x35, 0x70, 0x78, 0x3b, 0x6d,
+    0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x31, 0x35, 0x70,
+    0x78, 0x3b, 0x7d, 0x0a, 0x2e, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x69, 0x63, 0x6f, 0x6e,
+    0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x30, 0x30, 0x42, 0x43, 0x44, 0x34, 0x3b, 0x66,
+    0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x38, 0x70, 0x78, 0x3b, 0x66, 0x6c,
+    0x65, 0x78, 0x2d, 0x73, 0x68, 0x72, 0x69, 0x6e, 0x6b, 0x3a, 0x30, 0x3b, 0x6d, 0x61, 0x72, 0x67,
+    0x69, 0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x2e,
+    0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x7b,
+    0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x23, 0x31, 0x61, 0x32, 0x61,
+    0x32, 0x61, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6f,
+    0x6c, 0x69, 0x64, 0x20, 0x23, 0x30, 0x30, 0x42, 0x43, 0x44, 0x34, 0x3b, 0x62, 0x6f, 0x72, 0x64,
+    0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x34, 0x70, 0x78, 0x3b, 0x70, 0x61,
+    0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69,
+    0x6e, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x7d, 0x0a, 0x2e, 0x72, 0x75, 0x6e, 0x74,
+    0x69, 0x6d, 0x65, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x20, 0x68, 0x32, 0x7b, 0x6d,
+    0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x63,
+    0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x23, 0x30, 0x30, 0x42, 0x43, 0x44, 0x34, 0x3b, 0x66, 0x6f, 0x6e,
+    0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x40, 0x6d,
+    0x65, 0x64, 0x69, 0x61, 0x20, 0x28, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
+    0x36, 0x30, 0x30, 0x70, 0x78, 0x29, 0x7b, 0x0a, 0x62, 0x6f, 0x64, 0x79, 0x7b, 0x70, 0x61, 0x64,
+    0x64, 0x69, 0x6e, 0x67, 0x3a, 0x35, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x2e, 0x63, 0x6f, 0x6e, 0x74,
+    0x61, 0x69, 0x6e, 0x65, 0x72, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x30, 0x20,
+    0x35, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x68, 0x31, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
+    0x7a, 0x65, 0x3a, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x31,
+    0x30, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d,
+    0x62, 0x6f, 0x78, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x30, 0x70, 0x78,
+    0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x31, 0x35, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x7d,
+    0x0a, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x72, 0x6f, 0x77, 0x7b, 0x66, 0x6c, 0x65,
+    0x78, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x63, 0x6f, 0x6c, 0x75,
+    0x6d, 0x6e, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x36, 0x70, 0x78, 0x20, 0x30,
+    0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+    0x7b, 0x6d, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b,
+    0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x33, 0x70,
+    0x78, 0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x76, 0x61, 0x6c, 0x75,
+    0x65, 0x7b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x6c, 0x65, 0x66,
+    0x74, 0x3b, 0x6d, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x61, 0x75, 0x74, 0x6f,
+    0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x3b,
+    0x7d, 0x0a, 0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x20, 0x68, 0x33, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31,
+    0x34, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x7b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31,
+    0x30, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x7b, 0x70, 0x61, 0x64,
+    0x64, 0x69, 0x6e, 0x67, 0x3a, 0x31, 0x30, 0x70, 0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x66,
+    0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x7d, 0x0a,
+    0x6c, 0x61, 0x62, 0x65, 0x6c, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
+    0x31, 0x34, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70,
+    0x65, 0x3d, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5d, 0x2c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b,
+    0x74, 0x79, 0x70, 0x65, 0x3d, 0x74, 0x65, 0x78, 0x74, 0x5d, 0x2c, 0x73, 0x65, 0x6c, 0x65, 0x63,
+    0x74, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31, 0x34, 0x70, 0x78,
+    0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x36, 0x70, 0x78, 0x3b, 0x7d, 0x0a, 0x7d,
+    0x0a,
+};
+
+// /assets/app.js: 5768 -> 1697 bytes gzip
+static const uint8_t kWebAssetAppJsGz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x18, 0x69, 0x4f, 0xdb, 0x48,
+    0xf4, 0x3b, 0xbf, 0xc2, 0x74, 0xb5, 0x1d, 0x5b, 0x10, 0x13, 0xb2, 0xa5, 0xb4, 0x64, 0xbd, 0x88,
+    0x72, 0x2c, 0xac, 0xa0, 0xa0, 0x26, 0xbb, 0x5d, 0xa9, 0xaa, 0x56, 0xc6, 0x7e, 0x49, 0xa6, 0x75,
+    0x66, 0xdc, 0xf1, 0x38, 0x21, 0x02, 0xfe, 0xfb, 0xbe, 0x39, 0xe2, 0x03, 0x72, 0x35, 0xbb, 0x15,
+    0x12, 0x19, 0xcf, 0x7b, 0xf3, 0xee, 0x79, 0xc7, 0xb8, 0xbd, 0x9c, 0x45, 0x92, 0x72, 0xe6, 0x7a,
+    0xf7, 0x1b, 0xd3, 0xb5, 0x23, 0x79, 0xbf, 0x9f, 0x40, 0x07, 0x0c, 0x84, 0xc6, 0x08, 0x1b, 0x85,
+    0xc2, 0x89, 0x38, 0x93, 0xc0, 0x64, 0x10, 0xf3, 0x28, 0x1f, 0xe2, 0xc2, 0xef, 0x83, 0x3c, 0x4d,
+    0x40, 0x2d, 0xdf, 0x4d, 0x2e, 0x62, 0x97, 0x58, 0x84, 0x06, 0xd9, 0xc2, 0x33, 0x6d, 0x7d, 0x86,
+    0xe2, 0xde, 0xfc, 0x03, 0x0a, 0x3a, 0xc5, 0xa6, 0x3d, 0x77, 0xd3, 0x12, 0x78, 0x78, 0xd8, 0x54,
+    0x10, 0x4f, 0x80, 0xcc, 0x05, 0x73, 0x7a, 0x61, 0x92, 0x81, 0x46, 0xb0, 0x70, 0x3f, 0x4a, 0xc2,
+    0x2c, 0xbb, 0xa4, 0x19, 0xae, 0x70, 0x27, 0xa4, 0x2c, 0x73, 0x49, 0x88, 0xd2, 0x8e, 0x80, 0x78,
+    0x28, 0xec, 0x73, 0x34, 0x01, 0x43, 0x3e, 0x82, 0x12, 0x09, 0xa9, 0x21, 0x92, 0x4f, 0x19, 0x03,
+    0x71, 0xde, 0xbd, 0xba, 0x0c, 0xc8, 0xcb, 0x9f, 0xde, 0xbe, 0xde, 0x7b, 0xd5, 0x26, 0xed, 0x8d,
+    0x47, 0x40, 0x76, 0xb3, 0x88, 0x84, 0x71, 0xbc, 0x8c, 0xc2, 0xeb, 0xa6, 0xa6, 0xb0, 0x51, 0x97,
+    0xfc, 0xb1, 0x34, 0x6d, 0x06, 0xf2, 0x88, 0x45, 0x03, 0x2e, 0xde, 0x49, 0xe6, 0x02, 0xca, 0x8a,
+    0x5a, 0xe1, 0x0f, 0xf8, 0xa9, 0x80, 0x11, 0xb2, 0x3b, 0x81, 0x5e, 0x98, 0x27, 0xd2, 0xf5, 0xda,
+    0xe0, 0x67, 0x92, 0xa7, 0x37, 0x82, 0xa7, 0x61, 0x3f, 0x34, 0x2e, 0x6a, 0x3f, 0x1a, 0x9b, 0xb2,
+    0x34, 0x5f, 0xe0, 0x85, 0x50, 0xd3, 0xff, 0x2b, 0x4c, 0x72, 0x23, 0x26, 0xda, 0x55, 0x9f, 0xf0,
+    0xee, 0xc3, 0x04, 0x84, 0x74, 0xc9, 0x85, 0xfa, 0x72, 0x18, 0x97, 0x4e, 0x8f, 0xe7, 0x2c, 0x46,
+    0xa4, 0x9a, 0xb8, 0x86, 0xc9, 0x28, 0x4c, 0x02, 0x7d, 0xcc, 0x1f, 0x29, 0x4a, 0x0f, 0x0f, 0x84,
+    0x18, 0x8f, 0xde, 0x0d, 0x44, 0xc0, 0x60, 0xec, 0xfc, 0x7d, 0x75, 0x79, 0x2e, 0x65, 0xfa, 0x01,
+    0xbe, 0xe5, 0x90, 0x29, 0x81, 0x37, 0x10, 0xe2, 0xf3, 0x14, 0x98, 0x4b, 0x6e, 0xae, 0x3b, 0x5d,
+    0xb2, 0x4d, 0x76, 0x8c, 0x28, 0x3b, 0xa8, 0x34, 0xd9, 0x96, 0x22, 0x07, 0x8b, 0x84, 0xdf, 0xf6,
+    0xd8, 0x39, 0x84, 0x31, 0x08, 0x97, 0x1c, 0xdb, 0xc8, 0xe9, 0x4e, 0x52, 0xc0, 0x83, 0x61, 0x9a,
+    0x26, 0x34, 0xd2, 0x5a, 0xef, 0xdc, 0x35, 0xc6, 0xe3, 0x71, 0xa3, 0xc7, 0xc5, 0xb0, 0x91, 0x8b,
+    0x04, 0x58, 0xc4, 0x63, 0x50, 0x32, 0x1b, 0x76, 0x4c, 0x20, 0x85, 0x49, 0x26, 0x43, 0x09, 0xd1,
+    0x20, 0x64, 0x7d, 0x08, 0xaa, 0x11, 0x8d, 0xba, 0x2b, 0x2c, 0x8d, 0xd3, 0x51, 0x38, 0x41, 0xf0,
+    0xaa, 0xdc, 0x56, 0xa7, 0xf2, 0x2c, 0x08, 0x5a, 0xcd, 0x26, 0x6e, 0x1a, 0xe3, 0x1c, 0x1f, 0xfd,
+    0x73, 0x7c, 0xf6, 0xbb, 0x6f, 0x04, 0xbf, 0xfe, 0x8a, 0x6c, 0x04, 0xf4, 0x04, 0x64, 0x83, 0x8e,
+    0x46, 0x56, 0x6a, 0xda, 0xf8, 0x98, 0x81, 0x7f, 0x2a, 0x84, 0x82, 0xab, 0xbf, 0xa9, 0xa2, 0x0c,
+    0x1d, 0xa2, 0x0d, 0x18, 0x90, 0x2d, 0x23, 0xfb, 0x9f, 0x1f, 0x2e, 0x8e, 0xf9, 0x30, 0xe5, 0x0c,
+    0xf5, 0x75, 0x11, 0xe4, 0x69, 0x1e, 0x73, 0xc2, 0x05, 0x39, 0x83, 0x7c, 0x2f, 0x7b, 0x93, 0xff,
+    0x10, 0x2e, 0xdf, 0xe3, 0x30, 0x86, 0xac, 0x76, 0x34, 0xd3, 0x9a, 0xc3, 0xfe, 0x47, 0x33, 0x23,
+    0xe9, 0x2e, 0x1d, 0x02, 0xcf, 0xa5, 0x5b, 0x21, 0x91, 0x70, 0xe3, 0x6d, 0xa4, 0x91, 0xf0, 0x30,
+    0x56, 0xb2, 0x6f, 0xef, 0x21, 0xfe, 0x6c, 0x6b, 0x2b, 0x29, 0x67, 0xdb, 0x7a, 0xa9, 0x2d, 0x3f,
+    0xd2, 0x1e, 0x5d, 0xd3, 0x96, 0x36, 0x41, 0xf5, 0xa8, 0x18, 0xba, 0xe4, 0x23, 0x3d, 0xa3, 0x86,
+    0xe2, 0xa1, 0x73, 0x42, 0xa5, 0x33, 0xc6, 0x04, 0xe1, 0x44, 0x02, 0x62, 0x24, 0x44, 0x91, 0xb5,
+    0x03, 0xcc, 0x19, 0x80, 0x40, 0xdd, 0x85, 0xc4, 0x85, 0x74, 0x62, 0x18, 0xd1, 0x08, 0x7c, 0x95,
+    0x9f, 0x66, 0xdc, 0xb6, 0xef, 0xf1, 0xd1, 0x18, 0x55, 0xf8, 0xa1, 0x3e, 0xb2, 0x69, 0xa2, 0x54,
+    0xd1, 0xc9, 0xa9, 0xec, 0xc3, 0x88, 0x83, 0x88, 0x7d, 0xe7, 0x44, 0x2b, 0x52, 0x28, 0x87, 0x1a,
+    0xa1, 0x0e, 0xda, 0x49, 0xf6, 0xdc, 0x19, 0xfa, 0xd6, 0xb9, 0xa5, 0x5f, 0x9c, 0x92, 0x80, 0xc6,
+    0x79, 0x5c, 0xe2, 0xa8, 0x31, 0x65, 0x31, 0x1f, 0xab, 0x2c, 0x7b, 0xaa, 0xdc, 0xa1, 0x52, 0x2e,
+    0x30, 0x95, 0x1c, 0x4e, 0xae, 0xaf, 0x6c, 0x7e, 0xb8, 0xc4, 0xd8, 0xc0, 0xcb, 0xbf, 0x5d, 0x55,
+    0x4c, 0x99, 0x8f, 0xe5, 0xc3, 0x5b, 0x10, 0x3a, 0xaf, 0x65, 0x65, 0x62, 0x44, 0x1b, 0x8a, 0x49,
+    0x07, 0x12, 0xac, 0x63, 0x5c, 0x1c, 0x25, 0x09, 0xd6, 0x1b, 0x85, 0xf1, 0x49, 0x62, 0x92, 0x09,
+    0x5e, 0x98, 0x33, 0x2f, 0x3e, 0xab, 0x54, 0x82, 0xd9, 0xc5, 0xd5, 0x99, 0x35, 0x68, 0xb6, 0xe9,
+    0xaf, 0x55, 0x6a, 0x3e, 0x66, 0x9c, 0xbe, 0x1c, 0xb4, 0xe9, 0xd6, 0x16, 0xf2, 0xaa, 0x42, 0x3e,
+    0xd1, 0xcf, 0x33, 0x64, 0xd5, 0x1c, 0x2a, 0x02, 0x82, 0x95, 0x50, 0xa5, 0x53, 0x39, 0xa0, 0x99,
+    0xc9, 0xa6, 0xe8, 0x86, 0x34, 0x09, 0x23, 0x2c, 0x48, 0xdb, 0xf8, 0xe7, 0xdb, 0x34, 0x8d, 0xa0,
+    0xcd, 0xa0, 0x82, 0xe5, 0xdd, 0x97, 0xeb, 0x00, 0xff, 0xb7, 0x1f, 0x1f, 0x11, 0x71, 0xb9, 0x0c,
+    0xb7, 0x49, 0x2e, 0x7e, 0xa8, 0x08, 0x26, 0x66, 0x33, 0x29, 0x30, 0x8c, 0xfa, 0xd6, 0xc2, 0x73,
+    0xcc, 0xee, 0x92, 0x4c, 0xaf, 0x3e, 0xb1, 0x70, 0x88, 0x46, 0x37, 0x79, 0xb2, 0x63, 0x4f, 0x1a,
+    0xe3, 0x23, 0xdb, 0x3a, 0x29, 0x95, 0x25, 0x6a, 0x1b, 0x33, 0x74, 0x34, 0x11, 0xfe, 0x3c, 0x12,
+    0x94, 0x92, 0x69, 0x28, 0x32, 0xb8, 0xc0, 0xec, 0x5a, 0xd1, 0xc3, 0xd4, 0x2e, 0x99, 0x5e, 0xd4,
+    0x6b, 0xe7, 0x13, 0x59, 0x4d, 0x7c, 0x54, 0x45, 0xed, 0xde, 0x18, 0x21, 0xd5, 0xe9, 0x61, 0xf2,
+    0xbd, 0xa7, 0xaf, 0x2e, 0x0b, 0x15, 0x95, 0x60, 0xc1, 0xae, 0xb9, 0x71, 0x56, 0x0c, 0xcf, 0xfe,
+    0x5a, 0xf3, 0x92, 0x5d, 0xff, 0x0d, 0xd1, 0xb8, 0x96, 0x91, 0x67, 0x7f, 0xa7, 0xf0, 0xc6, 0xae,
+    0xdf, 0x9a, 0xf6, 0x27, 0xce, 0x94, 0x64, 0x6b, 0x09, 0xc9, 0xd6, 0x62, 0x92, 0x4d, 0xff, 0xad,
+    0x6e, 0x58, 0x4a, 0xb7, 0x0e, 0x74, 0x49, 0x5e, 0x78, 0x8d, 0xf0, 0x0a, 0x6b, 0xa3, 0x37, 0x0c,
+    0xee, 0xf3, 0x1b, 0x64, 0x69, 0xd4, 0x2f, 0x8f, 0xdd, 0x9c, 0x1d, 0xb3, 0x11, 0xd6, 0xfb, 0xaf,
+    0x33, 0x82, 0x96, 0xc6, 0x26, 0x1a, 0xb1, 0xc9, 0x39, 0x92, 0x52, 0xd0, 0xdb, 0x5c, 0x62, 0xc8,
+    0xc6, 0xa1, 0x0c, 0x1b, 0x56, 0x08, 0xc5, 0xfd, 0x59, 0xc3, 0xda, 0xde, 0x98, 0x91, 0xd6, 0x9f,
+    0x66, 0x9c, 0x42, 0xe5, 0xdb, 0x30, 0xa3, 0xd1, 0x92, 0x2e, 0x55, 0xe3, 0x4c, 0x23, 0xc1, 0x78,
+    0x77, 0xc9, 0x09, 0x83, 0x54, 0x3f, 0x82, 0xa5, 0x67, 0x59, 0xe3, 0x86, 0x28, 0x36, 0x64, 0x8a,
+    0x6f, 0xd5, 0x9d, 0x4c, 0xd7, 0xf3, 0x6d, 0x57, 0x6d, 0x2d, 0x0b, 0xd5, 0x54, 0xa9, 0xfc, 0xa0,
+    0x52, 0xf0, 0x42, 0xce, 0x55, 0x2c, 0xcb, 0xbc, 0xba, 0xa5, 0x32, 0x5f, 0xe5, 0x73, 0xbe, 0x08,
+    0xd5, 0x76, 0xa5, 0x10, 0x41, 0xd5, 0xab, 0xe5, 0x22, 0x54, 0xb1, 0xac, 0x08, 0xd5, 0x2d, 0x14,
+    0xa1, 0xfa, 0xb9, 0x44, 0x04, 0x5b, 0xe5, 0xbd, 0x5a, 0xfd, 0x57, 0x4d, 0xe5, 0xc4, 0xb6, 0x71,
+    0xd3, 0x91, 0xe6, 0x5b, 0xce, 0xb1, 0x12, 0xda, 0xb6, 0x42, 0x7f, 0x18, 0x6f, 0x41, 0xb2, 0x60,
+    0xca, 0xc9, 0xc5, 0x8d, 0xc0, 0x12, 0x88, 0x52, 0xaa, 0x0e, 0x22, 0xf1, 0x20, 0xf1, 0x25, 0xdc,
+    0x49, 0x5b, 0xa3, 0x02, 0x57, 0xd5, 0x17, 0xde, 0x73, 0x62, 0x8c, 0x40, 0x44, 0xeb, 0x22, 0x28,
+    0x08, 0x02, 0x82, 0x29, 0x8d, 0xb2, 0x3e, 0x79, 0xf9, 0xb2, 0xb2, 0x6f, 0x2f, 0x48, 0x6d, 0x0f,
+    0xf3, 0x2f, 0x69, 0x10, 0xef, 0xb0, 0xb2, 0xb5, 0x45, 0x1c, 0xb2, 0xa5, 0xa5, 0x3b, 0x70, 0x5d,
+    0xbb, 0xff, 0x5b, 0xb3, 0x40, 0xf1, 0x25, 0x3f, 0xa3, 0x77, 0x10, 0xbb, 0x6f, 0xbc, 0x0a, 0x26,
+    0x69, 0x34, 0x94, 0x1d, 0x17, 0x69, 0x22, 0x05, 0x96, 0xe2, 0xd6, 0x60, 0x9e, 0x22, 0xb1, 0xaf,
+    0x11, 0xb0, 0xf5, 0x47, 0x52, 0x2b, 0x50, 0xda, 0x8d, 0x97, 0x50, 0xba, 0x82, 0x98, 0xe6, 0xc3,
+    0x95, 0xe9, 0xed, 0x2f, 0xa3, 0x77, 0xc9, 0x59, 0x7f, 0x15, 0x6a, 0x23, 0x9e, 0x60, 0x1b, 0x97,
+    0x50, 0x39, 0x99, 0x4f, 0xb0, 0xc4, 0x59, 0x85, 0xa2, 0x80, 0x3e, 0x36, 0xb1, 0x26, 0x98, 0xe6,
+    0xc6, 0x41, 0xec, 0x1b, 0x34, 0xf4, 0x28, 0x8e, 0x59, 0xd0, 0xa3, 0x0c, 0x62, 0xe5, 0xea, 0x62,
+    0x97, 0xe5, 0x49, 0xa2, 0xbc, 0x68, 0x36, 0x0e, 0x56, 0x52, 0x04, 0x01, 0x0b, 0x95, 0x40, 0xf8,
+    0x6a, 0x0a, 0xc8, 0xdd, 0xe1, 0x7c, 0x42, 0x1a, 0xbc, 0x19, 0x34, 0x0f, 0xed, 0xb2, 0x08, 0xb1,
+    0x16, 0x86, 0xd8, 0xcf, 0xe4, 0x60, 0x25, 0x06, 0x7b, 0x8b, 0x19, 0xec, 0x95, 0x0c, 0xf6, 0xd6,
+    0x63, 0xf0, 0x4b, 0x73, 0x31, 0x07, 0x84, 0x17, 0x2c, 0x70, 0xbd, 0x16, 0x8f, 0x45, 0xd7, 0x43,
+    0x83, 0x0b, 0x0e, 0xad, 0xc1, 0x5a, 0x0c, 0x16, 0xdd, 0x1a, 0x0d, 0x2e, 0xdd, 0x10, 0xaf, 0xc5,
+    0x60, 0x7f, 0x31, 0x83, 0xfd, 0x92, 0xc1, 0xfe, 0x1a, 0x0c, 0x8a, 0x2a, 0xb7, 0x24, 0x17, 0xda,
+    0x76, 0xea, 0x79, 0x32, 0x2c, 0x01, 0x95, 0x6c, 0x58, 0x6e, 0x96, 0xe9, 0xb0, 0xdc, 0x7b, 0x92,
+    0x0f, 0x0d, 0xc0, 0x24, 0x44, 0xb3, 0x5e, 0x3b, 0x23, 0x9a, 0xe3, 0x27, 0x90, 0xc8, 0x70, 0xbe,
+    0xd1, 0x2a, 0x48, 0x37, 0x91, 0x34, 0xd6, 0xab, 0xef, 0xad, 0x61, 0xc6, 0x94, 0xea, 0xa9, 0xec,
+    0x7c, 0xda, 0x51, 0x19, 0xde, 0xba, 0xb7, 0x43, 0xea, 0x29, 0x3d, 0x53, 0x8f, 0x10, 0x38, 0xad,
+    0xd6, 0x85, 0x21, 0xa4, 0x6d, 0x07, 0x64, 0xdd, 0x63, 0xe0, 0xcc, 0x67, 0xb0, 0x8f, 0xfa, 0x70,
+    0x95, 0x1d, 0x5e, 0x85, 0x72, 0xe0, 0x0b, 0xf5, 0xc6, 0x53, 0xd9, 0xdd, 0xd9, 0x6d, 0xe2, 0x90,
+    0x77, 0xd0, 0xd4, 0x96, 0xa8, 0x13, 0xeb, 0x74, 0x8f, 0x2e, 0x4f, 0xd1, 0x5c, 0x48, 0x67, 0x8b,
+    0x64, 0xaa, 0x2f, 0x7c, 0xac, 0x16, 0x50, 0x06, 0x38, 0x80, 0xa9, 0xa9, 0xf4, 0x7e, 0x69, 0x8d,
+    0x9c, 0xa3, 0xce, 0x53, 0x86, 0xef, 0x4f, 0xbb, 0x87, 0xe4, 0xc9, 0x90, 0x5e, 0x7b, 0x6d, 0xb9,
+    0xdf, 0xe8, 0x81, 0x8c, 0x06, 0x2e, 0xd9, 0xc9, 0x6c, 0xae, 0xf5, 0xe5, 0x00, 0x87, 0xe1, 0xa2,
+    0x4f, 0x14, 0xc5, 0x38, 0x2d, 0xfc, 0x2f, 0x99, 0x99, 0xd4, 0x2d, 0x4e, 0xa5, 0xde, 0x7b, 0x7e,
+    0x14, 0x2a, 0x32, 0x56, 0x83, 0xa2, 0x35, 0x49, 0x79, 0x92, 0xa8, 0xd7, 0x08, 0xa1, 0x53, 0x71,
+    0xbb, 0xf2, 0x4c, 0xa7, 0x46, 0xdb, 0x1b, 0x84, 0x62, 0x94, 0xda, 0xe9, 0xb9, 0xc0, 0xb5, 0xcf,
+    0x92, 0x33, 0x5e, 0x86, 0x4a, 0x72, 0xd8, 0x83, 0xe0, 0x00, 0x02, 0x02, 0xdb, 0x6c, 0xb7, 0x86,
+    0xb6, 0xdd, 0x6a, 0x9a, 0x67, 0x0d, 0xd3, 0xe0, 0xe8, 0x89, 0x57, 0x37, 0x32, 0x1d, 0x9e, 0x8b,
+    0x68, 0xda, 0xf5, 0x42, 0xa6, 0x5f, 0x03, 0x2a, 0x00, 0xb4, 0x80, 0xee, 0x66, 0x33, 0x1d, 0xc1,
+    0xd9, 0x8c, 0xfe, 0xc7, 0x1a, 0xa8, 0xde, 0x42, 0x4b, 0x31, 0xb9, 0xaf, 0xf6, 0x3d, 0x7f, 0x74,
+    0xae, 0xdf, 0xfb, 0x7a, 0x3e, 0x72, 0xc1, 0x57, 0x5d, 0xb4, 0x87, 0xf6, 0x32, 0xb6, 0xb9, 0xf3,
+    0xee, 0xcd, 0x18, 0x80, 0xd4, 0x39, 0x52, 0x14, 0xd8, 0xe0, 0x3e, 0x79, 0x40, 0x40, 0x48, 0xf5,
+    0xfd, 0x40, 0xcd, 0x1e, 0x75, 0x43, 0xd9, 0x60, 0x2c, 0x02, 0xa5, 0xad, 0x5f, 0x67, 0x6c, 0x84,
+    0x3e, 0x41, 0x9d, 0x0e, 0x1d, 0x9e, 0x5a, 0xff, 0x0b, 0xfc, 0x21, 0xf4, 0xbc, 0x88, 0x16, 0x00,
+    0x00,
+};
+static const uint8_t kWebAssetAppJsRaw[] PROGMEM = {
+    0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x0a, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x53, 0x65, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x28, 0x69, 0x64, 0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x63, 0x6f, 0x6e,
+    0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65,
+    0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63, 0x6f,
+    0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x27, 0x2b, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x76, 0x61, 0x72,
+    0x20, 0x69, 0x63, 0x6f, 0x6e, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x69,
+    0x63, 0x6f, 0x6e, 0x2d, 0x27, 0x2b, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x21, 0x63,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x7c, 0x7c, 0x21, 0x69, 0x63, 0x6f, 0x6e, 0x29, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x63,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74,
+    0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76,
+    0x65, 0x27, 0x29, 0x29, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x6c,
+    0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x27,
+    0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x63, 0x6f, 0x6e, 0x2e, 0x69,
+    0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x3d, 0x27, 0x26, 0x23, 0x39, 0x36, 0x35, 0x34,
+    0x3b, 0x27, 0x3b, 0x0a, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+    0x6e, 0x74, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4c, 0x69, 0x73, 0x74, 0x2e, 0x61, 0x64, 0x64,
+    0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x63, 0x6f, 0x6e,
+    0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x3d, 0x27, 0x26, 0x23, 0x39, 0x36,
+    0x36, 0x30, 0x3b, 0x27, 0x3b, 0x0a, 0x7d, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66,
+    0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x73, 0x65, 0x74, 0x41, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x42, 0x74, 0x6e, 0x28, 0x65, 0x29,
+    0x7b, 0x0a, 0x69, 0x66, 0x28, 0x65, 0x29, 0x7b, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e,
+    0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x65, 0x2e, 0x73, 0x74, 0x6f,
+    0x70, 0x50, 0x72, 0x6f, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x3b, 0x7d,
+    0x0a, 0x76, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x27, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x27,
+    0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x21, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x7b, 0x61, 0x6c,
+    0x65, 0x72, 0x74, 0x28, 0x27, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66,
+    0x6f, 0x75, 0x6e, 0x64, 0x27, 0x29, 0x3b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61,
+    0x6c, 0x73, 0x65, 0x3b, 0x7d, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x3d, 0x69, 0x6e,
+    0x70, 0x75, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x7c, 0x7c, 0x27, 0x27, 0x3b, 0x0a, 0x76,
+    0x61, 0x72, 0x20, 0x78, 0x68, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x58, 0x4d, 0x4c, 0x48, 0x74,
+    0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x29, 0x3b, 0x0a, 0x78, 0x68, 0x72,
+    0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c, 0x27, 0x2f, 0x61,
+    0x6e, 0x63, 0x68, 0x6f, 0x72, 0x2f, 0x73, 0x65, 0x74, 0x27, 0x2c, 0x74, 0x72, 0x75, 0x65, 0x29,
+    0x3b, 0x0a, 0x78, 0x68, 0x72, 0x2e, 0x73, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74,
+    0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x27, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d,
+    0x54, 0x79, 0x70, 0x65, 0x27, 0x2c, 0x27, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x2f, 0x78, 0x2d, 0x77, 0x77, 0x77, 0x2d, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x75, 0x72,
+    0x6c, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x64, 0x27, 0x29, 0x3b, 0x0a, 0x78, 0x68, 0x72, 0x2e,
+    0x6f, 0x6e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6e,
+    0x67, 0x65, 0x3d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x0a, 0x69,
+    0x66, 0x28, 0x78, 0x68, 0x72, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65,
+    0x3d, 0x3d, 0x34, 0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28, 0x78, 0x68, 0x72, 0x2e, 0x73, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0x3d, 0x3d, 0x32, 0x30, 0x30, 0x29, 0x7b, 0x0a, 0x61, 0x6c, 0x65, 0x72, 0x74,
+    0x28, 0x43, 0x41, 0x5f, 0x43, 0x46, 0x47, 0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x4f, 0x6b,
+    0x29, 0x3b, 0x0a, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x0a, 0x61, 0x6c, 0x65, 0x72, 0x74,
+    0x28, 0x43, 0x41, 0x5f, 0x43, 0x46, 0x47, 0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x45, 0x72,
+    0x72, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x7d, 0x3b, 0x0a, 0x78, 0x68, 0x72, 0x2e, 0x73,
+    0x65, 0x6e, 0x64, 0x28, 0x27, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x27, 0x2b, 0x65, 0x6e, 0x63,
+    0x6f, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x28,
+    0x76, 0x61, 0x6c, 0x29, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61,
+    0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x72, 0x65, 0x73, 0x65, 0x74, 0x4e, 0x74, 0x66, 0x79, 0x42, 0x74, 0x6e, 0x28, 0x65, 0x29, 0x7b,
+    0x0a, 0x69, 0x66, 0x28, 0x65, 0x29, 0x7b, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74,
+    0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x65, 0x2e, 0x73, 0x74, 0x6f, 0x70,
+    0x50, 0x72, 0x6f, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x3b, 0x7d, 0x0a,
+    0x76, 0x61, 0x72, 0x20, 0x78, 0x68, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x58, 0x4d, 0x4c, 0x48,
+    0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x29, 0x3b, 0x0a, 0x78, 0x68,
+    0x72, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x2c, 0x27, 0x2f,
+    0x6e, 0x74, 0x66, 0x79, 0x2f, 0x72, 0x65, 0x73, 0x65, 0x74, 0x27, 0x2c, 0x74, 0x72, 0x75, 0x65,
+    0x29, 0x3b, 0x0a, 0x78, 0x68, 0x72, 0x2e, 0x6f, 0x6e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28, 0x78, 0x68, 0x72, 0x2e, 0x72, 0x65, 0x61,
+    0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x3d, 0x34, 0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28,
+    0x78, 0x68, 0x72, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3d, 0x3d, 0x32, 0x30, 0x30, 0x29,
+    0x7b, 0x0a, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+    0x2e, 0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x29, 0x3b, 0x7d, 0x2c, 0x35, 0x30, 0x30, 0x29,
+    0x3b, 0x0a, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x0a, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x43,
+    0x41, 0x5f, 0x43, 0x46, 0x47, 0x2e, 0x6e, 0x74, 0x66, 0x79, 0x45, 0x72, 0x72, 0x29, 0x3b, 0x0a,
+    0x7d, 0x0a, 0x7d, 0x0a, 0x7d, 0x3b, 0x0a, 0x78, 0x68, 0x72, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28,
+    0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b,
+    0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x65,
+    0x74, 0x57, 0x69, 0x66, 0x69, 0x42, 0x74, 0x6e, 0x28, 0x65, 0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28,
+    0x65, 0x29, 0x7b, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61,
+    0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x65, 0x2e, 0x73, 0x74, 0x6f, 0x70, 0x50, 0x72, 0x6f, 0x70,
+    0x61, 0x67, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x3b, 0x7d, 0x0a, 0x69, 0x66, 0x28, 0x21,
+    0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x27, 0x57, 0x69, 0x46, 0x69, 0x20, 0x72, 0x65,
+    0x73, 0x65, 0x74, 0x3f, 0x20, 0x44, 0x69, 0x74, 0x20, 0x77, 0x69, 0x73, 0x74, 0x20, 0x63, 0x72,
+    0x65, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x73, 0x20, 0x65, 0x6e, 0x20, 0x68, 0x65, 0x72,
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x68, 0x65, 0x74, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65,
+    0x2e, 0x27, 0x29, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73,
+    0x65, 0x3b, 0x7d, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x78, 0x68, 0x72, 0x3d, 0x6e, 0x65, 0x77, 0x20,
+    0x58, 0x4d, 0x4c, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x29,
+    0x3b, 0x0a, 0x78, 0x68, 0x72, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x27, 0x50, 0x4f, 0x53, 0x54,
+    0x27, 0x2c, 0x27, 0x2f, 0x77, 0x69, 0x66, 0x69, 0x2f, 0x72, 0x65, 0x73, 0x65, 0x74, 0x27, 0x2c,
+    0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0x0a, 0x78, 0x68, 0x72, 0x2e, 0x6f, 0x6e, 0x72, 0x65, 0x61,
+    0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28, 0x78, 0x68, 0x72,
+    0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x3d, 0x34, 0x29, 0x7b,
+    0x0a, 0x69, 0x66, 0x28, 0x78, 0x68, 0x72, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3d, 0x3d,
+    0x32, 0x30, 0x30, 0x29, 0x7b, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x28, 0x27, 0x57, 0x69, 0x46, 0x69,
+    0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x75, 0x69, 0x74, 0x67, 0x65, 0x76, 0x6f, 0x65, 0x72,
+    0x64, 0x2e, 0x20, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20, 0x68, 0x65, 0x72, 0x73, 0x74, 0x61,
+    0x72, 0x74, 0x2e, 0x27, 0x29, 0x3b, 0x7d, 0x0a, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x61, 0x6c, 0x65,
+    0x72, 0x74, 0x28, 0x27, 0x46, 0x6f, 0x75, 0x74, 0x20, 0x62, 0x69, 0x6a, 0x20, 0x57, 0x69, 0x46,
+    0x69, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x27, 0x29, 0x3b, 0x7d, 0x0a, 0x7d, 0x7d, 0x3b, 0x0a,
+    0x78, 0x68, 0x72, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x77, 0x69, 0x6e, 0x64,
+    0x6f, 0x77, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x65, 0x72, 0x28, 0x27, 0x44, 0x4f, 0x4d, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x4c,
+    0x6f, 0x61, 0x64, 0x65, 0x64, 0x27, 0x2c, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28,
+    0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x49, 0x6e, 0x70,
+    0x75, 0x74, 0x73, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65,
+    0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x41, 0x6c, 0x6c, 0x28, 0x27, 0x69,
+    0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+    0x72, 0x22, 0x5d, 0x27, 0x29, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69,
+    0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74,
+    0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x7b, 0x0a, 0x6e,
+    0x75, 0x6d, 0x62, 0x65, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x2e, 0x61,
+    0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+    0x27, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x27, 0x2c, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x28, 0x65, 0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x3d, 0x74, 0x68, 0x69,
+    0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28,
+    0x27, 0x2c, 0x27, 0x2c, 0x27, 0x2e, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x76, 0x61, 0x6c,
+    0x21, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x7b, 0x74,
+    0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x76, 0x61, 0x6c, 0x3b, 0x7d, 0x7d,
+    0x29, 0x3b, 0x0a, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x73, 0x5b,
+    0x69, 0x5d, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x65, 0x72, 0x28, 0x27, 0x62, 0x6c, 0x75, 0x72, 0x27, 0x2c, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x28, 0x65, 0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x3d,
+    0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61,
+    0x63, 0x65, 0x28, 0x27, 0x2c, 0x27, 0x2c, 0x27, 0x2e, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28,
+    0x76, 0x61, 0x6c, 0x21, 0x3d, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65,
+    0x29, 0x7b, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x76, 0x61, 0x6c,
+    0x3b, 0x7d, 0x7d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 0x72, 0x61,
+    0x74, 0x65, 0x67, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f,
+    0x72, 0x28, 0x27, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x5b, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+    0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x53, 0x74, 0x72, 0x61, 0x74, 0x65, 0x67, 0x79, 0x22, 0x5d,
+    0x27, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x73, 0x74, 0x72, 0x61, 0x74, 0x65, 0x67, 0x79, 0x53,
+    0x65, 0x6c, 0x65, 0x63, 0x74, 0x29, 0x7b, 0x0a, 0x73, 0x74, 0x72, 0x61, 0x74, 0x65, 0x67, 0x79,
+    0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
+    0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x27,
+    0x2c, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72,
+    0x20, 0x76, 0x61, 0x6c, 0x3d, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74, 0x28, 0x74, 0x68,
+    0x69, 0x73, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x3b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x74,
+    0x70, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+    0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x69,
+    0x6e, 0x70, 0x75, 0x74, 0x5b, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x61, 0x6e, 0x63, 0x68, 0x6f,
+    0x72, 0x54, 0x50, 0x22, 0x5d, 0x27, 0x29, 0x3b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x6d, 0x6c, 0x49,
+    0x6e, 0x70, 0x75, 0x74, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75,
+    0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x27, 0x69, 0x6e, 0x70,
+    0x75, 0x74, 0x5b, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x4d,
+    0x4c, 0x22, 0x5d, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x76, 0x61, 0x6c, 0x3d, 0x3d, 0x31,
+    0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28, 0x74, 0x70, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x74, 0x70,
+    0x49, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x27, 0x31, 0x2e, 0x38,
+    0x27, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x6d, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x6d, 0x6c,
+    0x49, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x27, 0x2d, 0x31, 0x2e,
+    0x32, 0x27, 0x3b, 0x0a, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x76, 0x61, 0x6c,
+    0x3d, 0x3d, 0x32, 0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28, 0x74, 0x70, 0x49, 0x6e, 0x70, 0x75, 0x74,
+    0x29, 0x74, 0x70, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x27,
+    0x31, 0x2e, 0x32, 0x27, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x6d, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74,
+    0x29, 0x6d, 0x6c, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x27,
+    0x2d, 0x30, 0x2e, 0x39, 0x27, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x76,
+    0x61, 0x72, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x6f,
+    0x72, 0x41, 0x6c, 0x6c, 0x28, 0x27, 0x2e, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x68,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x27, 0x29, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72,
+    0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2e, 0x6c,
+    0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x7b, 0x0a, 0x68, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c,
+    0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x65, 0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72,
+    0x20, 0x69, 0x64, 0x3d, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72,
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x27, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x73, 0x65, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x53, 0x65, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x28, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76,
+    0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x0a, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6e, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a,
+    0x7d, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x62, 0x61, 0x73, 0x69, 0x63, 0x3d, 0x64, 0x6f, 0x63, 0x75,
+    0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x69, 0x63, 0x6f, 0x6e, 0x2d, 0x62, 0x61, 0x73, 0x69, 0x63, 0x27,
+    0x29, 0x3b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x3d, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x69, 0x63, 0x6f, 0x6e, 0x2d, 0x61, 0x6e, 0x63, 0x68,
+    0x6f, 0x72, 0x27, 0x29, 0x3b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72,
+    0x42, 0x74, 0x6e, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74,
+    0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x6e, 0x63,
+    0x68, 0x6f, 0x72, 0x42, 0x74, 0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x61, 0x6e, 0x63,
+    0x68, 0x6f, 0x72, 0x42, 0x74, 0x6e, 0x29, 0x7b, 0x0a, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x42,
+    0x74, 0x6e, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65,
+    0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x73, 0x65, 0x74, 0x41,
+    0x6e, 0x63, 0x68, 0x6f, 0x72, 0x42, 0x74, 0x6e, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x61, 0x72,
+    0x20, 0x6e, 0x74, 0x66, 0x79, 0x52, 0x65, 0x73, 0x65, 0x74, 0x42, 0x74, 0x6e, 0x3d, 0x64, 0x6f,
+    0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6e, 0x74, 0x66, 0x79, 0x52, 0x65, 0x73, 0x65, 0x74,
+    0x42, 0x74, 0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x6e, 0x74, 0x66, 0x79, 0x52, 0x65,
+    0x73, 0x65, 0x74, 0x42, 0x74, 0x6e, 0x29, 0x7b, 0x0a, 0x6e, 0x74, 0x66, 0x79, 0x52, 0x65, 0x73,
+    0x65, 0x74, 0x42, 0x74, 0x6e, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69,
+    0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x72,
+    0x65, 0x73, 0x65, 0x74, 0x4e, 0x74, 0x66, 0x79, 0x42, 0x74, 0x6e, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+    0x76, 0x61, 0x72, 0x20, 0x77, 0x69, 0x66, 0x69, 0x52, 0x65, 0x73, 0x65, 0x74, 0x42, 0x74, 0x6e,
+    0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69, 0x52, 0x65,
+    0x73, 0x65, 0x74, 0x42, 0x74, 0x6e, 0x27, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x28, 0x77, 0x69, 0x66,
+    0x69, 0x52, 0x65, 0x73, 0x65, 0x74, 0x42, 0x74, 0x6e, 0x29, 0x7b, 0x0a, 0x77, 0x69, 0x66, 0x69,
+    0x52, 0x65, 0x73, 0x65, 0x74, 0x42, 0x74, 0x6e, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e,
+    0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b,
+    0x27, 0x2c, 0x72, 0x65, 0x73, 0x65, 0x74, 0x57, 0x69, 0x66, 0x69, 0x42, 0x74, 0x6e, 0x29, 0x3b,
+    0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x6c,
+    0x79, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x64, 0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72, 0x20,
+    0x71, 0x75, 0x6f, 0x74, 0x65, 0x3d, 0x43, 0x41, 0x5f, 0x43, 0x46, 0x47, 0x2e, 0x71, 0x75, 0x6f,
+    0x74, 0x65, 0x3b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d,
+    0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x27, 0x63, 0x75, 0x72, 0x50, 0x72, 0x69, 0x63, 0x65, 0x27, 0x29, 0x3b, 0x69,
+    0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74,
+    0x65, 0x6e, 0x74, 0x3d, 0x28, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66, 0x20, 0x64, 0x2e, 0x70, 0x72,
+    0x69, 0x63, 0x65, 0x54, 0x65, 0x78, 0x74, 0x3d, 0x3d, 0x3d, 0x27, 0x73, 0x74, 0x72, 0x69, 0x6e,
+    0x67, 0x27, 0x26, 0x26, 0x64, 0x2e, 0x70, 0x72, 0x69, 0x63, 0x65, 0x54, 0x65, 0x78, 0x74, 0x2e,
+    0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x26, 0x26, 0x64, 0x2e, 0x70, 0x72, 0x69, 0x63, 0x65, 0x54,
+    0x65, 0x78, 0x74, 0x21, 0x3d, 0x3d, 0x27, 0x2d, 0x27, 0x29, 0x3f, 0x64, 0x2e, 0x70, 0x72, 0x69,
+    0x63, 0x65, 0x54, 0x65, 0x78, 0x74, 0x2b, 0x27, 0x20, 0x27, 0x2b, 0x71, 0x75, 0x6f, 0x74, 0x65,
+    0x3a, 0x28, 0x28, 0x64, 0x2e, 0x70, 0x72, 0x69, 0x63, 0x65, 0x3e, 0x30, 0x29, 0x3f, 0x64, 0x2e,
+    0x70, 0x72, 0x69, 0x63, 0x65, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x38, 0x29,
+    0x2b, 0x27, 0x20, 0x27, 0x2b, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x3a, 0x27, 0x2d, 0x2d, 0x27, 0x29,
+    0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65,
+    0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x74, 0x72,
+    0x65, 0x6e, 0x64, 0x32, 0x68, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c,
+    0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x74,
+    0x72, 0x65, 0x6e, 0x64, 0x7c, 0x7c, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x31, 0x64, 0x27,
+    0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x4d, 0x65,
+    0x64, 0x69, 0x75, 0x6d, 0x7c, 0x7c, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x37, 0x64, 0x27,
+    0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x74, 0x72, 0x65, 0x6e, 0x64, 0x4c, 0x6f,
+    0x6e, 0x67, 0x7c, 0x7c, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63,
+    0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+    0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x69, 0x74, 0x79,
+    0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74,
+    0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69,
+    0x6c, 0x69, 0x74, 0x79, 0x7c, 0x7c, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x65, 0x67, 0x69, 0x6d, 0x65, 0x53, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e,
+    0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x28, 0x64, 0x2e, 0x72,
+    0x65, 0x67, 0x69, 0x6d, 0x65, 0x21, 0x3d, 0x3d, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+    0x64, 0x26, 0x26, 0x64, 0x2e, 0x72, 0x65, 0x67, 0x69, 0x6d, 0x65, 0x21, 0x3d, 0x3d, 0x6e, 0x75,
+    0x6c, 0x6c, 0x29, 0x3f, 0x64, 0x2e, 0x72, 0x65, 0x67, 0x69, 0x6d, 0x65, 0x3a, 0x27, 0x2d, 0x2d,
+    0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x76,
+    0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c,
+    0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x76,
+    0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x7c, 0x7c, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+    0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x65, 0x74, 0x31, 0x6d, 0x27, 0x29,
+    0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f,
+    0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x31, 0x6d, 0x21, 0x3d, 0x30,
+    0x3f, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x31, 0x6d, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64,
+    0x28, 0x32, 0x29, 0x2b, 0x27, 0x25, 0x27, 0x3a, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c,
+    0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65,
+    0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x65, 0x74, 0x35, 0x6d, 0x27,
+    0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43,
+    0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x35, 0x6d, 0x21, 0x3d,
+    0x30, 0x3f, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x35, 0x6d, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65,
+    0x64, 0x28, 0x32, 0x29, 0x2b, 0x27, 0x25, 0x27, 0x3a, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65,
+    0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x65, 0x74, 0x33, 0x30,
+    0x6d, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78,
+    0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x33, 0x30,
+    0x6d, 0x21, 0x3d, 0x30, 0x3f, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x33, 0x30, 0x6d, 0x2e, 0x74, 0x6f,
+    0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x32, 0x29, 0x2b, 0x27, 0x25, 0x27, 0x3a, 0x27, 0x2d, 0x2d,
+    0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+    0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72,
+    0x65, 0x74, 0x32, 0x68, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e,
+    0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x72, 0x65,
+    0x74, 0x32, 0x68, 0x21, 0x3d, 0x30, 0x3f, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x32, 0x68, 0x2e, 0x74,
+    0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x32, 0x29, 0x2b, 0x27, 0x25, 0x27, 0x3a, 0x27, 0x2d,
+    0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+    0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+    0x72, 0x65, 0x74, 0x31, 0x64, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c,
+    0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x72,
+    0x65, 0x74, 0x31, 0x64, 0x21, 0x3d, 0x30, 0x3f, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x31, 0x64, 0x2e,
+    0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x32, 0x29, 0x2b, 0x27, 0x25, 0x27, 0x3a, 0x27,
+    0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+    0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+    0x27, 0x72, 0x65, 0x74, 0x37, 0x64, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65,
+    0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x64, 0x2e,
+    0x72, 0x65, 0x74, 0x37, 0x64, 0x21, 0x3d, 0x30, 0x3f, 0x64, 0x2e, 0x72, 0x65, 0x74, 0x37, 0x64,
+    0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x32, 0x29, 0x2b, 0x27, 0x25, 0x27, 0x3a,
+    0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+    0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x27, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c,
+    0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d,
+    0x28, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66, 0x20, 0x64, 0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72,
+    0x54, 0x65, 0x78, 0x74, 0x3d, 0x3d, 0x3d, 0x27, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x27, 0x26,
+    0x26, 0x64, 0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x54, 0x65, 0x78, 0x74, 0x2e, 0x6c, 0x65,
+    0x6e, 0x67, 0x74, 0x68, 0x26, 0x26, 0x64, 0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x54, 0x65,
+    0x78, 0x74, 0x21, 0x3d, 0x3d, 0x27, 0x2d, 0x27, 0x29, 0x3f, 0x64, 0x2e, 0x61, 0x6e, 0x63, 0x68,
+    0x6f, 0x72, 0x54, 0x65, 0x78, 0x74, 0x2b, 0x27, 0x20, 0x27, 0x2b, 0x71, 0x75, 0x6f, 0x74, 0x65,
+    0x3a, 0x28, 0x28, 0x64, 0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x3e, 0x30, 0x29, 0x3f, 0x64,
+    0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28,
+    0x38, 0x29, 0x2b, 0x27, 0x20, 0x27, 0x2b, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x3a, 0x27, 0x2d, 0x2d,
+    0x27, 0x29, 0x3b, 0x0a, 0x65, 0x6c, 0x3d, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e,
+    0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+    0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x44, 0x65, 0x6c, 0x74, 0x61, 0x27, 0x29, 0x3b, 0x69, 0x66,
+    0x28, 0x65, 0x6c, 0x29, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65,
+    0x6e, 0x74, 0x3d, 0x64, 0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x44, 0x65, 0x6c, 0x74, 0x61,
+    0x50, 0x63, 0x74, 0x21, 0x3d, 0x30, 0x3f, 0x64, 0x2e, 0x61, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x44,
+    0x65, 0x6c, 0x74, 0x61, 0x50, 0x63, 0x74, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28,
+    0x32, 0x29, 0x2b, 0x27, 0x25, 0x27, 0x3a, 0x27, 0x2d, 0x2d, 0x27, 0x3b, 0x0a, 0x65, 0x6c, 0x3d,
+    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+    0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x70, 0x69, 0x53, 0x74, 0x61, 0x74,
+    0x65, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29,
+    0x7b, 0x0a, 0x69, 0x66, 0x28, 0x64, 0x2e, 0x61, 0x70, 0x69, 0x46, 0x72, 0x65, 0x73, 0x68, 0x29,
+    0x7b, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d,
+    0x27, 0x27, 0x3b, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x61, 0x67,
+    0x65, 0x3d, 0x28, 0x64, 0x2e, 0x61, 0x70, 0x69, 0x41, 0x67, 0x65, 0x4d, 0x73, 0x3f, 0x4d, 0x61,
+    0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x64, 0x2e, 0x61, 0x70, 0x69, 0x41, 0x67,
+    0x65, 0x4d, 0x73, 0x2f, 0x31, 0x30, 0x30, 0x30, 0x29, 0x3a, 0x30, 0x29, 0x3b, 0x0a, 0x65, 0x6c,
+    0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x27, 0x53, 0x54,
+    0x41, 0x4c, 0x45, 0x20, 0x27, 0x2b, 0x61, 0x67, 0x65, 0x2b, 0x27, 0x73, 0x27, 0x3b, 0x0a, 0x7d,
+    0x7d, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x65, 0x74,
+    0x4c, 0x6f, 0x73, 0x74, 0x28, 0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x65, 0x6c, 0x3d, 0x64,
+    0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65,
+    0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x70, 0x69, 0x53, 0x74, 0x61, 0x74, 0x65,
+    0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x27, 0x29, 0x3b, 0x69, 0x66, 0x28, 0x65, 0x6c, 0x29, 0x65,
+    0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x27, 0x4e,
+    0x45, 0x54, 0x3f, 0x27, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29,
+    0x7b, 0x0a, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x27, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x28, 0x72, 0x29, 0x7b, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x2e, 0x6a, 0x73, 0x6f,
+    0x6e, 0x28, 0x29, 0x3b, 0x7d, 0x29, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x61, 0x70, 0x70, 0x6c,
+    0x79, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x6e,
+    0x65, 0x74, 0x4c, 0x6f, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x70,
+    0x6f, 0x6c, 0x6c, 0x54, 0x69, 0x6d, 0x65, 0x72, 0x3d, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x50, 0x6f, 0x6c,
+    0x6c, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28, 0x70, 0x6f, 0x6c, 0x6c, 0x54,
+    0x69, 0x6d, 0x65, 0x72, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x72, 0x65, 0x66,
+    0x72, 0x65, 0x73, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28, 0x29, 0x3b, 0x0a, 0x70, 0x6f,
+    0x6c, 0x6c, 0x54, 0x69, 0x6d, 0x65, 0x72, 0x3d, 0x73, 0x65, 0x74, 0x49, 0x6e, 0x74, 0x65, 0x72,
+    0x76, 0x61, 0x6c, 0x28, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x53, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x2c, 0x32, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x28, 0x77, 0x69,
+    0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65,
+    0x29, 0x7b, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x65, 0x73, 0x3d, 0x6e, 0x65, 0x77, 0x20, 0x45, 0x76,
+    0x65, 0x6e, 0x74, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x28, 0x27, 0x2f, 0x65, 0x76, 0x65, 0x6e,
+    0x74, 0x73, 0x27, 0x29, 0x3b, 0x0a, 0x65, 0x73, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e,
+    0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x27, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x27, 0x2c, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x65, 0x29, 0x7b, 0x0a,
+    0x74, 0x72, 0x79, 0x7b, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x28,
+    0x4a, 0x53, 0x4f, 0x4e, 0x2e, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 0x65, 0x2e, 0x64, 0x61, 0x74,
+    0x61, 0x29, 0x29, 0x3b, 0x7d, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x78, 0x29, 0x7b, 0x7d, 0x0a,
+    0x7d, 0x29, 0x3b, 0x0a, 0x65, 0x73, 0x2e, 0x6f, 0x6e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x0a, 0x69, 0x66, 0x28, 0x65, 0x73,
+    0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3d, 0x3d, 0x3d, 0x32, 0x29,
+    0x7b, 0x73, 0x74, 0x61, 0x72, 0x74, 0x50, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x3b,
+    0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x6e, 0x65, 0x74, 0x4c, 0x6f, 0x73, 0x74, 0x28, 0x29, 0x3b,
+    0x7d, 0x0a, 0x7d, 0x3b, 0x0a, 0x7d, 0x65, 0x6c, 0x73, 0x65, 0x7b, 0x0a, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x50, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x29,
+    0x3b, 0x0a, 0x7d, 0x29, 0x28, 0x29, 0x3b, 0x0a,
+};
+
+static const WebAsset kWebAssets[] = {
+    {"/assets/app.css", "text/css", kWebAssetAppCssGz, sizeof(kWebAssetAppCssGz), kWebAssetAppCssRaw, sizeof(kWebAssetAppCssRaw), "\"9288e641\"", "\"9288e641-gz\"", "9288e641"},
+    {"/assets/app.js", "application/javascript", kWebAssetAppJsGz, sizeof(kWebAssetAppJsGz), kWebAssetAppJsRaw, sizeof(kWebAssetAppJsRaw), "\"bcf421fc\"", "\"bcf421fc-gz\"", "bcf421fc"},
+};
+static const size_t kWebAssetCount = sizeof(kWebAssets) / sizeof(kWebAssets[0]);
+
+#endif // WEB_ASSETS_H
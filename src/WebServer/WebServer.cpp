@@ -4,6 +4,7 @@
 #include <WiFiManager.h>
 #include <PubSubClient.h>
 #include <ESP.h>  // Voor ESP.restart()
+#include <esp_heap_caps.h>
 #if OTA_ENABLED
 #include <Update.h>
 #endif
@@ -17,6 +18,12 @@
 #include "../RegimeEngine/RegimeEngine.h"
 #include "../PriceFormat/QuotePriceFormat.h"
 #include "../Net/HttpFetch.h"  // netMutexLock / netMutexUnlock (zelfde gate als API/WS, .ino)
+#include "../MqttQueue/MqttQueue.h"
+#include "../Trace/Trace.h"
+#include "../LivePush/LivePush.h"
+#include "../AnalyticsSnapshot/AnalyticsSnapshot.h"
+#include "../TaskTopology/TaskTopology.h"
+#include "../PriceData/PriceSampler.h"
 
 static const char* regimeStatusJsonString(bool enabled, RegimeKind k) {
     if (!enabled) {
@@ -54,6 +61,7 @@ extern char bitvavoSymbol[];  // Bitvavo market (bijv. "BTC-EUR")
 extern uint8_t language;
 extern uint8_t displayRotation;
 extern char chartColorMode[8];
+extern uint8_t chartHorizon;
 extern char chartColorManual[16];
 extern char mqttHost[];
 extern char mqttUser[];
@@ -104,6 +112,7 @@ extern uint8_t autoVolatilityWindowMinutes;
 extern float autoVolatilityBaseline1mStdPct;
 extern float autoVolatilityMinMultiplier;
 extern float autoVolatilityMaxMultiplier;
+extern float currentVolFactor;  // Laatste auto-volatility factor (VolatilityTracker)
 // Regime-engine (globals gesynchroniseerd via saveSettings in .ino)
 extern bool regimeEngineEnabled;
 extern uint32_t regimeMinDwellSec;
@@ -177,9 +186,6 @@ extern void requestMqttReconnect();
 static inline bool isClientConnected(WebServer* srv) {
     return (srv != nullptr) && srv->client().connected();
 }
-extern float calculateReturn1MinuteReadOnly();
-extern float calculateReturn5Minutes();
-extern float calculateReturn30MinutesReadOnly();
 extern bool sendNotification(const char* title, const char* message, const char* colorTag);
 extern uint8_t getNotificationLogCount(void);
 extern bool getNotificationLogEntry(uint8_t index,
@@ -200,18 +206,8 @@ uint32_t WebServerModule::getLastWebActivityMs() {
     return s_lastWebActivityMs;
 }
 
-// WEB-PERF-3: Externe variabelen voor /status endpoint
-extern float ret_2h;  // 2-hour return (globaal in ESP32-Crypto-Alert.ino)
-extern float ret_30m;  // 30-minute return (globaal in ESP32-Crypto-Alert.ino)
-extern float ret_1d;  // 24-hour return (hourly buffer)
-extern float ret_7d;  // 7-day return (hourly buffer of warm-start)
-extern float averagePrices[];  // Array met gemiddelde prijzen (index 3 = avg2h)
-extern bool hasRet2h;  // Flag: ret_2h beschikbaar
-extern bool hasRet30m;  // Flag: ret_30m beschikbaar
-
 // TwoHMetrics struct is gedefinieerd in AlertEngine.h, maar we declareren het hier voor gebruik
 #include "../AlertEngine/AlertEngine.h"  // Voor TwoHMetrics struct
-extern TwoHMetrics computeTwoHMetrics();
 
 // Macro's voor backward compatibility (verwijzen naar structs)
 // Deze moeten NA de extern declaraties komen
@@ -265,52 +261,27 @@ static void webHtmlEscapeText(const char* src, char* dest, size_t destCap) {
     dest[w] = '\0';
 }
 
+// Statische WebUI-assets (CSS/JS) als gzip-blobs in flash; bron + generator in src/WebServer/assets/
+#include "WebAssets.h"
+
+static const WebAsset* findWebAsset(const char* path) {
+    for (size_t i = 0; i < kWebAssetCount; i++) {
+        if (strcmp(kWebAssets[i].path, path) == 0) {
+            return &kWebAssets[i];
+        }
+    }
+    return nullptr;
+}
+
+// Stylesheet als <link> (browser cachet app.css; ?v= wijzigt bij nieuwe CSS in firmware)
 static void sendWebUiStylesheet(WebServer* srv) {
     if (srv == nullptr) {
         return;
     }
-    static const char kWebUiCssBlock[] PROGMEM =
-        "<style>"
-        "*{box-sizing:border-box;}"
-        "body{font-family:Arial;margin:0;padding:10px;background:#1a1a1a;color:#fff;}"
-        ".container{max-width:600px;margin:0 auto;padding:0 10px;}"
-        "h1{color:#00BCD4;margin:15px 0;font-size:24px;}"
-        "form{max-width:100%;}"
-        "label{display:block;margin:15px 0 5px;color:#ccc;}"
-        "input[type=number],input[type=text],select{width:100%;padding:8px;border:1px solid #444;background:#2a2a2a;color:#fff;border-radius:4px;box-sizing:border-box;}"
-        "button{background:#00BCD4;color:#fff;padding:12px 24px;border:none;border-radius:4px;cursor:pointer;font-size:16px;margin-top:20px;width:100%;}"
-        "button:hover{background:#00acc1;}"
-        ".info{color:#888;font-size:12px;margin-top:5px;}"
-        ".status-box{background:#2a2a2a;border:1px solid #444;border-radius:4px;padding:15px;margin:20px 0;max-width:100%;}"
-        ".status-row{display:flex;justify-content:space-between;margin:8px 0;padding:8px 0;border-bottom:1px solid #333;flex-wrap:wrap;}"
-        ".status-label{color:#888;flex:1;min-width:120px;}"
-        ".status-value{color:#fff;font-weight:bold;text-align:right;flex:1;min-width:100px;}"
-        ".section-header{background:#2a2a2a;border:1px solid #444;border-radius:4px;padding:12px;margin:15px 0 0;cursor:pointer;display:flex;justify-content:space-between;align-items:center;}"
-        ".section-header:hover{background:#333;}"
-        ".section-header h3{margin:0;color:#00BCD4;font-size:16px;}"
-        ".section-content{display:none;padding:15px;background:#1a1a1a;border:1px solid #444;border-top:none;border-radius:0 0 4px 4px;}"
-        ".section-content.active{display:block;}"
-        ".section-desc{color:#888;font-size:12px;margin-top:5px;margin-bottom:15px;}"
-        ".toggle-icon{color:#00BCD4;font-size:18px;flex-shrink:0;margin-left:10px;}"
-        ".runtime-context{background:#1a2a2a;border:2px solid #00BCD4;border-radius:4px;padding:12px;margin:15px 0;}"
-        ".runtime-context h2{margin:0 0 10px;color:#00BCD4;font-size:16px;}"
-        "@media (max-width:600px){"
-        "body{padding:5px;}"
-        ".container{padding:0 5px;}"
-        "h1{font-size:20px;margin:10px 0;}"
-        ".status-box{padding:10px;margin:15px 0;}"
-        ".status-row{flex-direction:column;padding:6px 0;}"
-        ".status-label{min-width:auto;margin-bottom:3px;}"
-        ".status-value{text-align:left;min-width:auto;}"
-        ".section-header{padding:10px;}"
-        ".section-header h3{font-size:14px;}"
-        ".section-content{padding:10px;}"
-        "button{padding:10px 20px;font-size:14px;}"
-        "label{font-size:14px;}"
-        "input[type=number],input[type=text],select{font-size:14px;padding:6px;}"
-        "}"
-        "</style>";
-    srv->sendContent_P(kWebUiCssBlock);
+    const WebAsset* css = findWebAsset("/assets/app.css");
+    char link[96];
+    snprintf(link, sizeof(link), "<link rel='stylesheet' href='%s?v=%s'>", css->path, css->version);
+    srv->sendContent(link);
 }
 
 static void sendRoEscaped(WebServer* srv, const char* label, const char* raw) {
@@ -326,12 +297,143 @@ static void sendRoEscaped(WebServer* srv, const char* label, const char* raw) {
     srv->sendContent(line);
 }
 
+// WEB-PERF-4: paginaschrijver voor de settings-pagina.
+// DIRECT  = elke write meteen naar de client (oud gedrag, overige pagina's via dezelfde helpers)
+// CHUNKED = writes verzamelen in een vaste buffer, per WEB_PAGE_CHUNK_SIZE één HTTP-chunk
+// CAPTURE = render naar de PSRAM-cache (geen netwerk); live waarden worden slot-markers
+enum WebPageSinkMode : uint8_t {
+    PAGE_SINK_DIRECT = 0,
+    PAGE_SINK_CHUNKED,
+    PAGE_SINK_CAPTURE
+};
+
+// Template-slots: waarden die zonder settings-wijziging veranderen en dus niet in de cache mogen.
+// In de cache staat per slot PAGE_SLOT_MARKER + ('0' + slot); bij versturen wordt de live waarde ingevuld.
+enum WebPageSlot : uint8_t {
+    PAGE_SLOT_ANCHOR_PREFILL = 0,   // Anchor-invoerveld: huidige prijs (of actieve anchor)
+    PAGE_SLOT_AUTO_ANCHOR_LAST,     // Laatste auto-anchor waarde
+    PAGE_SLOT_COUNT
+};
+static const char PAGE_SLOT_MARKER = '\x01';
+
+static WebPageSinkMode s_pageSinkMode = PAGE_SINK_DIRECT;
+static bool s_pageSinkAborted = false;
+static char s_pageChunk[WEB_PAGE_CHUNK_SIZE];
+static size_t s_pageChunkLen = 0;
+static char s_pageSlots[PAGE_SLOT_COUNT][32];
+
+static char* s_pageCacheBuf = nullptr;
+static size_t s_pageCacheLen = 0;
+static bool s_pageCacheOverflow = false;
+static bool s_pageCacheDisabled = false;
+static uint32_t s_pageCacheVersion = 0;
+
+static bool pageSinkCanWrite(WebServer* srv) {
+    if (s_pageSinkMode == PAGE_SINK_CAPTURE) {
+        return true;
+    }
+    return !s_pageSinkAborted && isClientConnected(srv);
+}
+
+static void pageSinkFlush(WebServer* srv) {
+    if (s_pageChunkLen == 0) {
+        return;
+    }
+    if (!s_pageSinkAborted) {
+        if (isClientConnected(srv)) {
+            srv->sendContent(s_pageChunk, s_pageChunkLen);
+        } else {
+            // Client weg: rest van de render kost alleen nog CPU, geen socket-writes meer
+            s_pageSinkAborted = true;
+        }
+    }
+    s_pageChunkLen = 0;
+}
+
+static void pageSinkWrite(WebServer* srv, const char* data, size_t len) {
+    if (data == nullptr || len == 0) {
+        return;
+    }
+    switch (s_pageSinkMode) {
+        case PAGE_SINK_CAPTURE:
+            if (s_pageCacheOverflow || s_pageCacheLen + len > WEB_PAGE_CACHE_BYTES) {
+                s_pageCacheOverflow = true;
+                return;
+            }
+            memcpy(s_pageCacheBuf + s_pageCacheLen, data, len);
+            s_pageCacheLen += len;
+            return;
+        case PAGE_SINK_CHUNKED:
+            if (s_pageSinkAborted) {
+                return;
+            }
+            if (len >= sizeof(s_pageChunk)) {
+                // Grote run (gecachte pagina): niet kopiëren, direct als eigen chunk
+                pageSinkFlush(srv);
+                if (!s_pageSinkAborted && isClientConnected(srv)) {
+                    srv->sendContent(data, len);
+                }
+                return;
+            }
+            if (s_pageChunkLen + len > sizeof(s_pageChunk)) {
+                pageSinkFlush(srv);
+            }
+            memcpy(s_pageChunk + s_pageChunkLen, data, len);
+            s_pageChunkLen += len;
+            return;
+        case PAGE_SINK_DIRECT:
+        default:
+            srv->sendContent(data, len);
+            return;
+    }
+}
+
+static void pageSinkBegin(WebPageSinkMode mode) {
+    s_pageSinkMode = mode;
+    s_pageSinkAborted = false;
+    s_pageChunkLen = 0;
+}
+
+static void pageSinkEnd(WebServer* srv) {
+    if (s_pageSinkMode == PAGE_SINK_CHUNKED) {
+        pageSinkFlush(srv);
+    }
+    s_pageSinkMode = PAGE_SINK_DIRECT;
+}
+
+// Live slotwaarden ophalen (korte mutex lock; alleen wat niet in de cache mag)
+static void fillSettingsPageSlots() {
+    float currentPrice = 0.0f;
+    float currentAnchorPrice = 0.0f;
+    bool currentAnchorActive = false;
+    if (safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "settingsPage slots")) {
+        if (isValidPrice(prices[0])) {
+            currentPrice = prices[0];
+        }
+        currentAnchorActive = anchorActive;
+        if (anchorActive && isValidPrice(anchorPrice)) {
+            currentAnchorPrice = anchorPrice;
+        }
+        safeMutexGive(dataMutex, "settingsPage slots");
+    }
+    // Anchor prefill: EUR via dynamische formatter, niet %.2f
+    const float anchorPrefill = (currentPrice > 0.0f) ? currentPrice
+        : ((currentAnchorActive && currentAnchorPrice > 0.0f) ? currentAnchorPrice : 0.0f);
+    if (isValidPrice(anchorPrefill)) {
+        formatQuotePriceEur(s_pageSlots[PAGE_SLOT_ANCHOR_PREFILL], sizeof(s_pageSlots[0]), anchorPrefill);
+    } else {
+        safeStrncpy(s_pageSlots[PAGE_SLOT_ANCHOR_PREFILL], "0", sizeof(s_pageSlots[0]));
+    }
+    snprintf(s_pageSlots[PAGE_SLOT_AUTO_ANCHOR_LAST], sizeof(s_pageSlots[0]), "%.2f",
+             alert2HThresholds.autoAnchorLastValue);
+}
+
 // WebServerModule implementation
 // Fase 9: Web Interface Module refactoring
 
 // WEB-PERF-3: Static cache variabelen
 bool WebServerModule::sPageCacheValid = false;
-String WebServerModule::sPageCache = "";
+uint32_t WebServerModule::sSettingsVersion = 1;
 
 WebServerModule::WebServerModule() {
     // Initialiseer server pointer naar nullptr (wordt later ingesteld)
@@ -392,6 +494,13 @@ void WebServerModule::setupWebServer() {
         this->handleStatus();
     });  // WEB-PERF-3: Status endpoint
     Serial.println(F("[WebServer] Route '/status' geregistreerd"));
+#if CRYPTO_ALERT_LIVE_PUSH_ENABLED
+    server->on("/events", HTTP_GET, [this]() {
+        notifyWebActivity();
+        this->handleEvents();
+    });  // Live push (SSE); dashboards vallen terug op /status bij 404/503
+    Serial.println(F("[WebServer] Route '/events' geregistreerd (SSE)"));
+#endif
     // Read-only plain-text settings export (voor copy/paste)
     server->on("/settings.txt", HTTP_GET, [this]() {
         notifyWebActivity();
@@ -409,6 +518,20 @@ void WebServerModule::setupWebServer() {
         this->handleConfigView();
     });
     Serial.println(F("[WebServer] Route '/config' geregistreerd (read-only)"));
+    // Prometheus-tekst: tracepoints + heap + MQTT-queue; geen notifyWebActivity (periodieke scrape)
+    server->on("/metrics", HTTP_GET, [this]() {
+        this->handleMetrics();
+    });
+    Serial.println(F("[WebServer] Route '/metrics' geregistreerd"));
+    // Statische assets (gzip + ETag); If-None-Match/Accept-Encoding expliciet laten bewaren door WebServer
+    for (size_t i = 0; i < kWebAssetCount; i++) {
+        server->on(kWebAssets[i].path, HTTP_GET, [this]() {
+            this->handleStaticAsset();
+        });
+    }
+    static const char* kCollectHeaders[] = {"If-None-Match", "Accept-Encoding"};
+    server->collectHeaders(kCollectHeaders, 2);
+    Serial.println(F("[WebServer] Routes /assets/* geregistreerd (gzip, ETag)"));
 #if OTA_ENABLED
     // Web-based OTA firmware update (chunked upload) — routes in OtaWebUpdater; geen notifyWebActivity in deze stap
     otaWebUpdater.begin(server);
@@ -578,50 +701,15 @@ void WebServerModule::handleClient() {
 // Performance optimalisatie: debug logging voor ESP32-S3
 void WebServerModule::renderSettingsHTML() {
     if (server == nullptr) return;
-    if (!isClientConnected(server)) {
+    if (!pageSinkCanWrite(server)) {
         Serial_println(F("[WEB] WARN: client disconnected, skip render"));
         return;
     }
     
     #if !DEBUG_BUTTON_ONLY
     unsigned long renderStart = millis();
-    Serial.println(F("[WEB] render start"));
     #endif
     
-    // Haal huidige status op (thread-safe)
-    float currentPrice = 0.0f;
-    float currentRet1m = 0.0f;
-    float currentRet5m = 0.0f;
-    float currentRet30m = 0.0f;
-    TrendState currentTrend = TREND_SIDEWAYS;
-    VolatilityState currentVol = VOLATILITY_MEDIUM;
-    bool currentAnchorActive = false;
-    float currentAnchorPrice = 0.0f;
-    float currentAnchorPct = 0.0f;
-    
-    // Haal alle status data op binnen één mutex lock
-    if (safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "getSettingsHTML status")) {
-        if (isValidPrice(prices[0])) {
-            currentPrice = prices[0];
-        }
-        // Fase 5.3.14: Gebruik TrendDetector module getter i.p.v. globale variabele
-        currentTrend = trendDetector.getTrendState();
-        // Fase 5.3.13: Gebruik VolatilityTracker module getter i.p.v. globale variabele
-        currentVol = volatilityTracker.getVolatilityState();
-        currentAnchorActive = anchorActive;
-        if (anchorActive && isValidPrice(anchorPrice)) {
-            currentAnchorPrice = anchorPrice;
-            if (isValidPrice(prices[0]) && anchorPrice > 0.0f) {
-                currentAnchorPct = ((prices[0] - anchorPrice) / anchorPrice) * 100.0f;
-            }
-        }
-        // Bereken returns binnen dezelfde mutex lock
-        currentRet1m = calculateReturn1MinuteReadOnly();
-        currentRet5m = calculateReturn5Minutes();
-        currentRet30m = calculateReturn30MinutesReadOnly();
-        safeMutexGive(dataMutex, "getSettingsHTML status");
-    }
-    
     // Bepaal platform naam
     const char* platformName = "";
     #if defined(PLATFORM_ESP32S3_SUPERMINI)
@@ -651,80 +739,70 @@ void WebServerModule::renderSettingsHTML() {
     }
     
     // Form start (voor anchor instellen)
-    server->sendContent(F("<form method='POST' action='/save'>"));
+    pageOut(F("<form method='POST' action='/save'>"));
     
-    // Anchor instellen - helemaal bovenaan (EUR: dynamische formatter, niet %.2f)
-    {
-        const float anchorPrefill = (currentPrice > 0.0f) ? currentPrice
-            : ((currentAnchorActive && currentAnchorPrice > 0.0f) ? currentAnchorPrice : 0.0f);
-        if (isValidPrice(anchorPrefill)) {
-            formatQuotePriceEur(valueBuf, sizeof(valueBuf), anchorPrefill);
-        } else {
-            safeStrncpy(valueBuf, "0", sizeof(valueBuf));
-        }
-    }
-    
-    server->sendContent(F("<div style='background:#2a2a2a;border:1px solid #444;border-radius:4px;padding:15px;margin:15px 0;'>"));
+    // Anchor instellen - helemaal bovenaan (prefill = live prijs → template-slot, niet gecached)
+    pageOut(F("<div style='background:#2a2a2a;border:1px solid #444;border-radius:4px;padding:15px;margin:15px 0;'>"));
     snprintf(tmpBuf, sizeof(tmpBuf), "<label style='display:block;margin-top:0;margin-bottom:8px;color:#fff;font-weight:bold;'>%s (EUR):</label>", 
              getText("Referentieprijs (Anchor)", "Reference price (Anchor)"));
-    server->sendContent(tmpBuf);
-    snprintf(tmpBuf, sizeof(tmpBuf), "<input type='number' step='0.01' id='anchorValue' value='%s' min='0.01' lang='en' style='width:100%%;padding:8px;margin-bottom:10px;border:1px solid #444;background:#1a1a1a;color:#fff;border-radius:4px;box-sizing:border-box;'>",
-             valueBuf);
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
+    pageOut(F("<input type='number' step='0.01' id='anchorValue' value='"));
+    pageOutSlot(PAGE_SLOT_ANCHOR_PREFILL);
+    pageOut(F("' min='0.01' lang='en' style='width:100%;padding:8px;margin-bottom:10px;border:1px solid #444;background:#1a1a1a;color:#fff;border-radius:4px;box-sizing:border-box;'>"));
     snprintf(tmpBuf, sizeof(tmpBuf), "<button type='button' id='anchorBtn' style='width:100%%;background:#4CAF50;color:#fff;padding:12px 24px;border:none;border-radius:4px;cursor:pointer;font-size:16px;font-weight:bold;'>%s</button>",
              getText("Stel Anchor in", "Set Anchor"));
-    server->sendContent(tmpBuf);
-    server->sendContent(F("</div>"));
+    pageOut(tmpBuf);
+    pageOut(F("</div>"));
     
     // Status box - WEB-PERF-3: gebruik placeholders voor live updates via JavaScript
-    server->sendContent(F("<div class='status-box'>"));
+    pageOut(F("<div class='status-box'>"));
     // Placeholders met IDs voor client-side updates
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='curPrice'>--</span></div>",
              getText("Huidige Prijs", "Current Price"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='trend2h'>--</span></div>",
              getText("Trend 2h", "Trend 2h"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='trend1d'>--</span></div>",
              getText("Trend 1d", "Trend 1d"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='trend7d'>--</span></div>",
              getText("Trend 7d", "Trend 7d"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='volatility'>--</span></div>",
              getText("Volatiliteit", "Volatility"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='regimeStatus'>--</span></div>",
              getText("Regime", "Regime"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='volume'>--</span></div>",
              getText("Volume", "Volume"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='ret1m'>--</span></div>",
              getText("1m Return", "1m Return"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='ret5m'>--</span></div>",
              getText("5m Return", "5m Return"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='ret30m'>--</span></div>",
              getText("30m Return", "30m Return"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='ret2h'>--</span></div>",
              getText("2h Return", "2h Return"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='ret1d'>--</span></div>",
              getText("1d Return", "1d Return"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='ret7d'>--</span></div>",
              getText("7d Return", "7d Return"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='anchor'>--</span></div>",
              getText("Anchor", "Anchor"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value' id='anchorDelta'>--</span></div>",
              getText("Anchor Delta", "Anchor Delta"));
-    server->sendContent(tmpBuf);
-    server->sendContent(F("</div>"));
+    pageOut(tmpBuf);
+    pageOut(F("</div>"));
     
     // Basis & Connectiviteit sectie
     sendSectionHeader(getText("Basis & Connectiviteit", "Basic & Connectivity"), "basic", false);
@@ -733,16 +811,16 @@ void WebServerModule::renderSettingsHTML() {
     // NTFY Topic met reset knop (onder input veld, net als anchor)
     snprintf(tmpBuf, sizeof(tmpBuf), "<label>%s:", 
              getText("NTFY Topic", "NTFY Topic"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<input type='text' name='ntfytopic' value='%s' maxlength='63' style='width:100%%;padding:8px;margin-bottom:10px;border:1px solid #444;background:#1a1a1a;color:#fff;border-radius:4px;box-sizing:border-box;'>", ntfyTopic);
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<button type='button' id='ntfyResetBtn' style='width:100%%;background:#2196F3;color:#fff;padding:12px 24px;border:none;border-radius:4px;cursor:pointer;font-size:16px;font-weight:bold;'>%s</button>", 
              getText("Standaard uniek NTFY-topic", "Default unique NTFY topic"));
-    server->sendContent(tmpBuf);
-    server->sendContent(F("</label>"));
+    pageOut(tmpBuf);
+    pageOut(F("</label>"));
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='info'>%s</div>", 
              getText("NTFY.sh topic voor notificaties", "NTFY.sh topic for notifications"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     sendInputRow(getText("Bitvavo Market", "Bitvavo Market"), "bitvavosymbol", "text", bitvavoSymbol, 
                  getText("Bijv. BTC-EUR, ETH-EUR", "E.g. BTC-EUR, ETH-EUR"));
     sendInputRow(getText("Taal", "Language"), "language", "number", (language == 0) ? "0" : "1", 
@@ -750,6 +828,15 @@ void WebServerModule::renderSettingsHTML() {
     sendInputRow(getText("Display Rotatie", "Display Rotation"), "displayRotation", "number", 
                  (displayRotation == 2) ? "2" : "0", 
                  getText("0 = normaal, 2 = 180 graden gedraaid", "0 = normal, 2 = rotated 180 degrees"), 0, 2, 2);
+    {
+        const char* horizonOptions[] = {
+            getText("Live", "Live"),
+            getText("1 uur (minuten)", "1 hour (minutes)"),
+            getText("24 uur (uren)", "24 hours (hours)"),
+            getText("7 dagen (uren)", "7 days (hours)")
+        };
+        sendDropdownRow(getText("Grafiek periode", "Chart period"), "chartHorizon", chartHorizon, horizonOptions, 4);
+    }
     
     sendSectionFooter();
 
@@ -1007,9 +1094,12 @@ void WebServerModule::renderSettingsHTML() {
                  valueBuf, getText("Extra gewicht voor 4h EMA bij sterke trend", "Extra weight for 4h EMA in strong trend"), 
                  0.0f, 1.0f, 0.01f);
     
-    // Read-only display voor laatste waarde
-    snprintf(valueBuf, sizeof(valueBuf), "%.2f", alert2HThresholds.autoAnchorLastValue);
-    sendStatusRow(getText("Laatste Auto Anchor", "Last Auto Anchor"), valueBuf);
+    // Read-only display voor laatste waarde (wijzigt runtime → template-slot)
+    snprintf(tmpBuf, sizeof(tmpBuf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value'>",
+             getText("Laatste Auto Anchor", "Last Auto Anchor"));
+    pageOut(tmpBuf);
+    pageOutSlot(PAGE_SLOT_AUTO_ANCHOR_LAST);
+    pageOut(F("</span></div>"));
     
     // Checkbox voor notificaties
     sendCheckboxRow(getText("Notificatie bij update", "Notify on update"), 
@@ -1347,16 +1437,16 @@ void WebServerModule::renderSettingsHTML() {
     static char mqttPrefix[64];
     getMqttTopicPrefix(mqttPrefix, sizeof(mqttPrefix));
     snprintf(tmpBuf, sizeof(tmpBuf), "<div style='margin:15px 0;padding:10px;background:#2a2a2a;border:1px solid #444;border-radius:4px;'>");
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<label style='display:block;margin-bottom:5px;color:#ccc;font-weight:bold;'>%s:</label>", 
              getText("MQTT Topic Prefix", "MQTT Topic Prefix"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div style='padding:8px;background:#1a1a1a;border:1px solid #555;border-radius:4px;color:#fff;font-family:monospace;font-size:14px;word-break:break-all;'>%s</div>", mqttPrefix);
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='info' style='margin-top:5px;font-size:12px;color:#888;'>%s</div>", 
              getText("Unieke prefix gebaseerd op NTFY topic (alleen ter referentie)", "Unique prefix based on NTFY topic (reference only)"));
-    server->sendContent(tmpBuf);
-    server->sendContent(F("</div>"));
+    pageOut(tmpBuf);
+    pageOut(F("</div>"));
     
     sendSectionFooter();
     
@@ -1365,23 +1455,28 @@ void WebServerModule::renderSettingsHTML() {
     snprintf(tmpBuf, sizeof(tmpBuf), "<span style='color:#e74c3c;'>%s</span>", wifiResetTitle);
     sendSectionHeader(tmpBuf, "wifiReset", false);
     sendSectionDesc(getText("Wist WiFi-instellingen en herstart het device", "Clears WiFi settings and reboots the device"));
-    server->sendContent(F("<button type='button' id='wifiResetBtn' style='width:100%;background:#e74c3c;color:#fff;padding:12px 24px;border:none;border-radius:4px;cursor:pointer;font-size:16px;font-weight:bold;'>"));
-    server->sendContent(getText("WiFi reset (wis credentials)", "WiFi reset (clear credentials)"));
-    server->sendContent(F("</button>"));
+    pageOut(F("<button type='button' id='wifiResetBtn' style='width:100%;background:#e74c3c;color:#fff;padding:12px 24px;border:none;border-radius:4px;cursor:pointer;font-size:16px;font-weight:bold;'>"));
+    pageOut(getText("WiFi reset (wis credentials)", "WiFi reset (clear credentials)"));
+    pageOut(F("</button>"));
     snprintf(tmpBuf, sizeof(tmpBuf), "<div class='info'>%s</div>",
              getText("Na reset verschijnt het configuratieportal weer", "After reset, the configuration portal will appear"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     sendSectionFooter();
     
     // Submit button
     snprintf(tmpBuf, sizeof(tmpBuf), "<button type='submit'>%s</button>", 
              getText("Opslaan", "Save"));
-    server->sendContent(tmpBuf);
+    pageOut(tmpBuf);
     
-    server->sendContent(F("</form>"));
+    pageOut(F("</form>"));
     
     // Footer
     sendHtmlFooter();
+    
+    #if !DEBUG_BUTTON_ONLY
+    Serial_printf(F("[WEB] render %s: %lu ms\n"),
+                  (s_pageSinkMode == PAGE_SINK_CAPTURE) ? "capture" : "live", millis() - renderStart);
+    #endif
 }
 
 void WebServerModule::handleConfigView() {
@@ -1414,25 +1509,23 @@ void WebServerModule::renderConfigReadOnlyHTML() {
     uint8_t lkSrc = 0;
     TwoHMetrics roMetrics;
 
+    {
+        AnalyticsSnapshot snap;
+        analyticsSnapshotRead(snap);
+        currentPrice = snap.price;
+        currentTrend = snap.trend;
+        trendMediumSnap = snap.trendMedium;
+        trendLongSnap = snap.trendLong;
+        currentVol = snap.volatility;
+        currentAnchorActive = snap.anchorActive;
+        currentAnchorPrice = snap.anchorPrice;
+        currentAnchorPct = snap.anchorDeltaPct;
+        roMetrics = snap.twoH;
+    }
     if (safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "renderConfigReadOnly")) {
-        if (isValidPrice(prices[0])) {
-            currentPrice = prices[0];
-        }
-        currentTrend = trendDetector.getTrendState();
-        trendMediumSnap = trendDetector.getMediumTrendState();
-        trendLongSnap = trendDetector.getLongTermTrendState();
-        currentVol = volatilityTracker.getVolatilityState();
-        currentAnchorActive = anchorActive;
-        if (anchorActive && isValidPrice(anchorPrice)) {
-            currentAnchorPrice = anchorPrice;
-            if (isValidPrice(prices[0]) && anchorPrice > 0.0f) {
-                currentAnchorPct = ((prices[0] - anchorPrice) / anchorPrice) * 100.0f;
-            }
-        }
         lkPrice = latestKnownPrice;
         lkMs = latestKnownPriceMs;
         lkSrc = latestKnownPriceSource;
-        roMetrics = computeTwoHMetrics();
         safeMutexGive(dataMutex, "renderConfigReadOnly");
     }
 
@@ -1495,7 +1588,7 @@ void WebServerModule::renderConfigReadOnlyHTML() {
 
     server->sendContent(F("<script type='text/javascript'>"));
     server->sendContent(F("(function(){function toggleSection(id){var c=document.getElementById('content-'+id);var ic=document.getElementById('icon-'+id);if(!c||!ic)return false;if(c.classList.contains('active')){c.classList.remove('active');ic.innerHTML='&#9654;';}else{c.classList.add('active');ic.innerHTML='&#9660;';}return false;}"));
-    server->sendContent(F("function refreshStatus(){fetch('/status').then(function(r){return r.json();}).then(function(d){"));
+    server->sendContent(F("function applyStatus(d){"));
     snprintf(tmpBuf, sizeof(tmpBuf), "var quote='%s';", quoteCurrency);
     server->sendContent(tmpBuf);
     server->sendContent(F("var el=document.getElementById('curPrice');if(el)el.textContent=(typeof d.priceText==='string'&&d.priceText.length&&d.priceText!=='-')?d.priceText+' '+quote:((d.price>0)?d.price.toFixed(8)+' '+quote:'--');"));
@@ -1514,8 +1607,12 @@ void WebServerModule::renderConfigReadOnlyHTML() {
     server->sendContent(F("el=document.getElementById('anchor');if(el)el.textContent=(typeof d.anchorText==='string'&&d.anchorText.length&&d.anchorText!=='-')?d.anchorText+' '+quote:((d.anchor>0)?d.anchor.toFixed(8)+' '+quote:'--');"));
     server->sendContent(F("el=document.getElementById('anchorDelta');if(el)el.textContent=d.anchorDeltaPct!=0?d.anchorDeltaPct.toFixed(2)+'%':'--';"));
     server->sendContent(F("el=document.getElementById('apiStateHeader');if(el){if(d.apiFresh){el.textContent='';}else{var age=(d.apiAgeMs?Math.round(d.apiAgeMs/1000):0);el.textContent='STALE '+age+'s';}}"));
-    server->sendContent(F("}).catch(function(e){var el=document.getElementById('apiStateHeader');if(el)el.textContent='NET?';});}"));
-    server->sendContent(F("window.addEventListener('DOMContentLoaded',function(){var headers=document.querySelectorAll('.section-header');for(var i=0;i<headers.length;i++){headers[i].addEventListener('click',function(e){var id=this.getAttribute('data-section');toggleSection(id);e.preventDefault();return false;});}refreshStatus();setInterval(refreshStatus,2000);});})();</script>"));
+    server->sendContent(F("}function netLost(){var el=document.getElementById('apiStateHeader');if(el)el.textContent='NET?';}"));
+    server->sendContent(F("function refreshStatus(){fetch('/status').then(function(r){return r.json();}).then(applyStatus).catch(netLost);}"));
+    // Live push (SSE) met terugval op /status-polling (zelfde logica als assets/app.js)
+    server->sendContent(F("var pollTimer=null;function startPolling(){if(pollTimer)return;refreshStatus();pollTimer=setInterval(refreshStatus,2000);}"));
+    server->sendContent(F("function startLive(){if(!window.EventSource){startPolling();return;}var es=new EventSource('/events');es.addEventListener('status',function(e){try{applyStatus(JSON.parse(e.data));}catch(x){}});es.onerror=function(){if(es.readyState===2){startPolling();}else{netLost();}};}"));
+    server->sendContent(F("window.addEventListener('DOMContentLoaded',function(){var headers=document.querySelectorAll('.section-header');for(var i=0;i<headers.length;i++){headers[i].addEventListener('click',function(e){var id=this.getAttribute('data-section');toggleSection(id);e.preventDefault();return false;});}startLive();});})();</script>"));
 
     server->sendContent(F("</head><body><div class='container'>"));
     server->sendContent(F("<div style='margin-bottom:10px;font-size:13px;'>"));
@@ -2132,6 +2229,38 @@ void WebServerModule::renderConfigReadOnlyHTML() {
     server->sendContent(F("</div></body></html>"));
 }
 
+// Statisch asset: 304 bij matchende ETag (geen body), anders gzip-blob uit flash.
+// Gzip- en identity-body hebben elk een eigen sterke ETag; If-None-Match wordt alleen tegen de
+// variant vergeleken die deze client zou krijgen (Vary: Accept-Encoding).
+// Geen notifyWebActivity(): assets komen direct na "/" en zouden de burst-polling alleen verlengen.
+void WebServerModule::handleStaticAsset() {
+    if (server == nullptr) {
+        return;
+    }
+    const WebAsset* asset = findWebAsset(server->uri().c_str());
+    if (asset == nullptr) {
+        handleNotFound();
+        return;
+    }
+    // ?v= in de URL verandert bij nieuwe firmware-assets, dus de browser mag lang cachen
+    const bool gzipOk = server->header("Accept-Encoding").indexOf("gzip") >= 0;
+    const char* etag = gzipOk ? asset->etagGz : asset->etag;
+    server->sendHeader(F("Cache-Control"), F("public, max-age=604800"));
+    server->sendHeader(F("ETag"), etag);
+    server->sendHeader(F("Vary"), F("Accept-Encoding"));
+    // indexOf: If-None-Match mag een lijst zijn; de afsluitende quote voorkomt dat "x" op "x-gz" matcht
+    if (server->hasHeader("If-None-Match") && server->header("If-None-Match").indexOf(etag) >= 0) {
+        server->send(304);
+        return;
+    }
+    if (gzipOk) {
+        server->sendHeader(F("Content-Encoding"), F("gzip"));
+        server->send_P(200, asset->contentType, reinterpret_cast<PGM_P>(asset->gz), asset->gzLen);
+    } else {
+        server->send_P(200, asset->contentType, reinterpret_cast<PGM_P>(asset->raw), asset->rawLen);
+    }
+}
+
 // Fase 9.1.4: Web handlers verplaatst vanuit .ino
 void WebServerModule::handleRoot() {
     if (server == nullptr) {
@@ -2141,7 +2270,21 @@ void WebServerModule::handleRoot() {
     // M1: Rate-limited heap telemetry in web server (alleen bij "/")
     logHeap("WEB_ROOT");
     
+    if (!isClientConnected(server)) {
+        return;
+    }
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "text/html; charset=utf-8", "");
+    
+    fillSettingsPageSlots();
+    if (getOrBuildSettingsPage()) {
+        sendCachedSettingsPage();
+        return;
+    }
+    // Geen cache (geen PSRAM / te groot): live renderen, wel in vaste chunks
+    pageSinkBegin(PAGE_SINK_CHUNKED);
     renderSettingsHTML();
+    pageSinkEnd(server);
 }
 
 void WebServerModule::handleSave() {
@@ -2171,6 +2314,13 @@ void WebServerModule::handleSave() {
         }
     }
 
+    {
+        int horizonVal;
+        if (parseIntArg("chartHorizon", horizonVal, 0, 3)) {
+            chartHorizon = static_cast<uint8_t>(horizonVal);
+        }
+    }
+
 #if !BOOT_DIAG_DISABLE_WEBUI_COLOR_FEATURE
     if (server->hasArg("chartColorMode")) {
         String m = server->arg("chartColorMode");
@@ -2742,6 +2892,109 @@ void WebServerModule::handleNotFound() {
     Serial_printf(F("[WebServer] 404: %s\n"), server->uri().c_str());
 }
 
+static void metricsSendChunk(const char* chunk, void* ctx) {
+    static_cast<WebServer*>(ctx)->sendContent(chunk);
+}
+
+// Route: GET /metrics - tracepoints, heap en queue-/pool-tellers als Prometheus-tekst (chunked)
+void WebServerModule::handleMetrics() {
+    if (server == nullptr) {
+        return;
+    }
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "text/plain; version=0.0.4; charset=utf-8", "");
+
+    traceWriteMetrics(metricsSendChunk, server);
+
+    static char line[192];
+    for (uint8_t c = 0; c < MQTT_CLASS_COUNT; c++) {
+        MqttQueueClassStats st;
+        mqttQueueGetStats(static_cast<MqttTopicClass>(c), st);
+        const char* cls = mqttQueueClassName(static_cast<MqttTopicClass>(c));
+        snprintf(line, sizeof(line),
+                 "crypto_mqtt_queue_depth{class=\"%s\"} %u\n"
+                 "crypto_mqtt_queue_dropped_total{class=\"%s\"} %lu\n"
+                 "crypto_mqtt_queue_published_total{class=\"%s\"} %lu\n",
+                 cls, (unsigned)st.depth,
+                 cls, (unsigned long)st.dropped,
+                 cls, (unsigned long)st.published);
+        server->sendContent(line);
+    }
+
+    snprintf(line, sizeof(line),
+             "crypto_analytics_snapshot_seq %lu\n"
+             "crypto_analytics_snapshot_read_failures_total %lu\n",
+             (unsigned long)analyticsSnapshotSeq(), (unsigned long)analyticsSnapshotReadFailures());
+    server->sendContent(line);
+
+    // Streaming volatiliteit (apiTask schrijft; losse float-reads, geen mutex nodig voor metrics)
+    for (uint8_t i = 0; i < VOLATILITY_EWMA_COUNT; i++) {
+        snprintf(line, sizeof(line), "crypto_volatility_ewma_pct{half_life=\"%u\"} %.5f\n",
+                 (unsigned)VolatilityTracker::getEwmaHalfLife(i), volatilityTracker.getEwmaVolatility(i));
+        server->sendContent(line);
+    }
+    snprintf(line, sizeof(line),
+             "crypto_volatility_window_samples %u\n"
+             "crypto_volatility_factor %.3f\n",
+             (unsigned)volatilityTracker.getWindowCount(), currentVolFactor);
+    server->sendContent(line);
+
+    static const char* const kVolHorizonNames[VOL_HORIZON_COUNT] = {"1s", "1m", "5m", "1h"};
+    const VolSurfaceSnapshot surf = volatilityTracker.getVolSurface();
+    for (uint8_t i = 0; i < VOL_HORIZON_COUNT; i++) {
+        const VolHorizonStats& h = surf.h[i];
+        snprintf(line, sizeof(line),
+                 "crypto_volsurface_per_min_pct{horizon=\"%s\"} %.5f\n"
+                 "crypto_volsurface_bars{horizon=\"%s\"} %u\n"
+                 "crypto_volsurface_ready{horizon=\"%s\"} %u\n",
+                 kVolHorizonNames[i], h.volPerMinPct,
+                 kVolHorizonNames[i], (unsigned)h.bars,
+                 kVolHorizonNames[i], h.ready ? 1u : 0u);
+        server->sendContent(line);
+    }
+
+    // Regime-engine: tick-kosten en verblijf per regime (dwell-buckets: 1m/5m/15m/1h/4h/+Inf)
+    static const char* const kRegimeNames[REGIME_COUNT] = {"slap", "geladen", "energiek"};
+    static const char* const kDwellLe[REGIME_DWELL_BUCKETS] = {"60", "300", "900", "3600", "14400", "+Inf"};
+    const RegimeSnapshot rs = regimeEngineGetSnapshot();
+    snprintf(line, sizeof(line),
+             "crypto_regime_tick_cost_us %lu\n"
+             "crypto_regime_tick_cost_max_us %lu\n"
+             "crypto_regime_config_generation %lu\n",
+             (unsigned long)rs.tickCostUs, (unsigned long)rs.tickCostMaxUs, (unsigned long)rs.configGen);
+    server->sendContent(line);
+    for (uint8_t r = 0; r < REGIME_COUNT; r++) {
+        snprintf(line, sizeof(line), "crypto_regime_time_seconds_total{regime=\"%s\"} %lu\n",
+                 kRegimeNames[r], (unsigned long)rs.timeInRegimeSec[r]);
+        server->sendContent(line);
+        uint32_t cumulative = 0;
+        for (uint8_t b = 0; b < REGIME_DWELL_BUCKETS; b++) {
+            cumulative += rs.dwellHist[r][b];
+            snprintf(line, sizeof(line), "crypto_regime_dwell_seconds_bucket{regime=\"%s\",le=\"%s\"} %lu\n",
+                     kRegimeNames[r], kDwellLe[b], (unsigned long)cumulative);
+            server->sendContent(line);
+        }
+    }
+
+#if CRYPTO_ALERT_LIVE_PUSH_ENABLED
+    LivePushStats lp;
+    livePushGetStats(lp);
+    snprintf(line, sizeof(line),
+             "crypto_livepush_clients %u\n"
+             "crypto_livepush_frames_total %lu\n"
+             "crypto_livepush_unchanged_total %lu\n"
+             "crypto_livepush_client_writes_total %lu\n",
+             (unsigned)lp.clients, (unsigned long)lp.framesPublished, (unsigned long)lp.framesUnchanged,
+             (unsigned long)lp.clientWrites);
+    server->sendContent(line);
+    snprintf(line, sizeof(line),
+             "crypto_livepush_dropped_total %lu\n"
+             "crypto_livepush_stalled_total %lu\n",
+             (unsigned long)lp.clientsDropped, (unsigned long)lp.clientsStalled);
+    server->sendContent(line);
+#endif
+}
+
 // WEB: Read-only settings export in plain text (easy copy/paste)
 // Route: GET /settings.txt
 // Canonieke sectievolgorde = renderSettingsHTML() (edit-pagina). Eerst runtime-snapshot, daarna opgeslagen instellingen.
@@ -2770,26 +3023,24 @@ void WebServerModule::handleSettingsExport() {
     float anchDeltaPct = 0.0f;
     TwoHMetrics m2h{};
 
+    {
+        AnalyticsSnapshot snap;
+        analyticsSnapshotRead(snap);
+        snapPrice0 = snap.price;
+        tr2h = snap.trend;
+        tr1d = snap.trendMedium;
+        tr7d = snap.trendLong;
+        volSnap = snap.volatility;
+        volRangeSnap = snap.volume;
+        anchAct = snap.anchorActive;
+        anchP = snap.anchorPrice;
+        anchDeltaPct = snap.anchorDeltaPct;
+        m2h = snap.twoH;
+    }
     if (safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "settingsTxt")) {
-        if (isValidPrice(prices[0])) {
-            snapPrice0 = prices[0];
-        }
         lkPrice = latestKnownPrice;
         lkMs = latestKnownPriceMs;
         lkSrc = latestKnownPriceSource;
-        tr2h = trendDetector.getTrendState();
-        tr1d = trendDetector.getMediumTrendState();
-        tr7d = trendDetector.getLongTermTrendState();
-        volSnap = volatilityTracker.getVolatilityState();
-        volRangeSnap = lastVolumeRange1m;
-        anchAct = anchorActive;
-        if (anchorActive && isValidPrice(anchorPrice)) {
-            anchP = anchorPrice;
-            if (isValidPrice(prices[0]) && anchorPrice > 0.0f) {
-                anchDeltaPct = ((prices[0] - anchorPrice) / anchorPrice) * 100.0f;
-            }
-        }
-        m2h = computeTwoHMetrics();
         safeMutexGive(dataMutex, "settingsTxt");
     }
 
@@ -2896,6 +3147,20 @@ void WebServerModule::handleSettingsExport() {
     server->sendContent(line);
     snprintf(line, sizeof(line), "mqtt_connected: %s\n", mqttConnected ? "yes" : "no");
     server->sendContent(line);
+    for (uint8_t c = 0; c < MQTT_CLASS_COUNT; c++) {
+        MqttQueueClassStats qs;
+        mqttQueueGetStats(static_cast<MqttTopicClass>(c), qs);
+        snprintf(line, sizeof(line),
+                 "mqtt_queue_%s: depth=%u/%u hwm=%u pub=%lu drop=%lu coal=%lu lat_avg_ms=%lu lat_max_ms=%lu\n",
+                 mqttQueueClassName(static_cast<MqttTopicClass>(c)),
+                 static_cast<unsigned>(qs.depth), static_cast<unsigned>(qs.capacity),
+                 static_cast<unsigned>(qs.highWater),
+                 static_cast<unsigned long>(qs.published), static_cast<unsigned long>(qs.dropped),
+                 static_cast<unsigned long>(qs.coalesced),
+                 static_cast<unsigned long>(qs.published ? (qs.latencySumMs / qs.published) : 0),
+                 static_cast<unsigned long>(qs.latencyMaxMs));
+        server->sendContent(line);
+    }
     snprintf(line, sizeof(line), "heap_free_bytes: %u\n", static_cast<unsigned>(ESP.getFreeHeap()));
     server->sendContent(line);
     snprintf(line, sizeof(line), "heap_largest_free_block: %u\n", ESP.getMaxAllocHeap());
@@ -2916,6 +3181,8 @@ void WebServerModule::handleSettingsExport() {
     server->sendContent(line);
     snprintf(line, sizeof(line), "displayRotation: %u\n", static_cast<unsigned>(displayRotation));
     server->sendContent(line);
+    snprintf(line, sizeof(line), "chartHorizon: %u\n", static_cast<unsigned>(chartHorizon));
+    server->sendContent(line);
 #if !BOOT_DIAG_DISABLE_WEBUI_COLOR_FEATURE
     snprintf(line, sizeof(line), "chartColorMode: %s\n", chartColorMode);
     server->sendContent(line);
@@ -3461,80 +3728,37 @@ void WebServerModule::handleUpdateChunkUpload() { (void)0; }
 void WebServerModule::handleUpdateEnd() { (void)0; }
 #endif
 
-// WEB-PERF-3: Status endpoint - JSON met live waarden (geen heap-allocaties)
-void WebServerModule::handleStatus() {
-    if (server == nullptr) return;
-
-    #if !DEBUG_BUTTON_ONLY
-    unsigned long statusStart = millis();
-    #endif
-    static unsigned long lastStatusLogMs = 0;
-    static uint32_t statusLogCount = 0;
-    static IPAddress lastStatusIp;
-    statusLogCount++;
-    lastStatusIp = server->client().remoteIP();
-    
-    // Lokale variabelen voor thread-safe data kopiëren
-    float price = 0.0f;
-    float ret1m = 0.0f;
-    float ret5m = 0.0f;
-    float ret30m = 0.0f;
-    float ret2h = 0.0f;
-    float ret1d = 0.0f;
-    float ret7d = 0.0f;
-    TrendState trend = TREND_SIDEWAYS;
-    TrendState trendMedium = TREND_SIDEWAYS;
-    TrendState trendLong = TREND_SIDEWAYS;
-    VolatilityState volatility = VOLATILITY_MEDIUM;
-    VolumeRangeStatus volumeStatus;
-    bool anchorActive = false;
-    float anchorPrice = 0.0f;
-    float anchorDeltaPct = 0.0f;
-    float avg2h = 0.0f;
-    float high2h = 0.0f;
-    float low2h = 0.0f;
-    float range2hPct = 0.0f;
+// WEB-PERF-3 / live push: één serialisatie van de dashboardstatus voor GET /status en SSE-frames.
+// live=true laat uptime/heap weg en rondt apiAgeMs af op seconden (0 zolang vers), zodat het frame
+// alleen verandert als de analytics-staat verandert en de hash-vergelijking in LivePush iets betekent.
+size_t WebServerModule::buildStatusJson(char* buf, size_t bufSize, bool live) {
+    // Alle afgeleide waarden uit de snapshot van de laatste tick (lock-free, geen herberekening)
+    AnalyticsSnapshot snap;
+    analyticsSnapshotRead(snap);
+    const float price = snap.price;
+    const float ret1m = snap.ret1m;
+    const float ret5m = snap.ret5m;
+    const float ret30m = snap.ret30m;
+    const float ret2h = snap.ret2h;
+    const float ret1d = snap.ret1d;
+    const float ret7d = snap.ret7d;
+    const TrendState trend = snap.trend;
+    const TrendState trendMedium = snap.trendMedium;
+    const TrendState trendLong = snap.trendLong;
+    const VolatilityState volatility = snap.volatility;
+    const VolumeRangeStatus& volumeStatus = snap.volume;
+    const float anchorPrice = snap.anchorPrice;
+    const float anchorDeltaPct = snap.anchorDeltaPct;
+    const float avg2h = snap.twoH.avg2h;
+    const float high2h = snap.twoH.high2h;
+    const float low2h = snap.twoH.low2h;
+    const float range2hPct = snap.twoH.rangePct;
     bool apiFresh = false;
     uint32_t apiAgeMs = 0;
     const unsigned long nowMs = millis();
-    
-    // Neem kort de dataMutex om globale waarden te kopiëren
-    if (safeMutexTake(dataMutex, pdMS_TO_TICKS(100), "handleStatus")) {
-        if (isValidPrice(prices[0])) {
-            price = prices[0];
-        }
-        ret1m = calculateReturn1MinuteReadOnly();
-        ret5m = calculateReturn5Minutes();
-        ret30m = calculateReturn30MinutesReadOnly();
-        ret2h = ::ret_2h;  // Gebruik globale ret_2h
-        ret1d = ::ret_1d;
-        ret7d = ::ret_7d;
-        trend = trendDetector.getTrendState();
-        trendMedium = trendDetector.getMediumTrendState();
-        trendLong = trendDetector.getLongTermTrendState();
-        volatility = volatilityTracker.getVolatilityState();
-        volumeStatus = ::lastVolumeRange1m;  // Kopieer volume status
-        anchorActive = ::anchorActive;
-        if (anchorActive && isValidPrice(::anchorPrice)) {
-            anchorPrice = ::anchorPrice;
-            if (isValidPrice(price) && anchorPrice > 0.0f) {
-                anchorDeltaPct = ((price - anchorPrice) / anchorPrice) * 100.0f;
-            }
-        }
-        
-        // Bereken 2h metrics (binnen mutex voor thread-safety)
-        TwoHMetrics metrics = computeTwoHMetrics();
-        avg2h = metrics.avg2h;
-        high2h = metrics.high2h;
-        low2h = metrics.low2h;
-        range2hPct = metrics.rangePct;
-        
-        if (lastApiMs > 0) {
-            apiAgeMs = (nowMs >= lastApiMs) ? (nowMs - lastApiMs) : (ULONG_MAX - lastApiMs + nowMs);
-            apiFresh = (apiAgeMs < 3000);
-        }
-        
-        safeMutexGive(dataMutex, "handleStatus");
+    if (snap.tickMs > 0) {
+        apiAgeMs = (nowMs >= snap.tickMs) ? (nowMs - snap.tickMs) : (ULONG_MAX - snap.tickMs + nowMs);
+        apiFresh = (apiAgeMs < 3000);
     }
     
     char trend2hText[8];
@@ -3545,8 +3769,7 @@ void WebServerModule::handleStatus() {
     formatTrendLabel(trend7dText, sizeof(trend7dText), "7d", trendLong);
 
     const bool regimeEnabledForJson = regimeEngineEnabled;
-    const RegimeSnapshot regimeSnap = regimeEngineGetSnapshot();
-    const char* regimeStrJson = regimeStatusJsonString(regimeEnabledForJson, regimeSnap.committedRegime);
+    const char* regimeStrJson = regimeStatusJsonString(regimeEnabledForJson, snap.regime.committedRegime);
 
     char priceText[32];
     char anchorText[32];
@@ -3559,12 +3782,12 @@ void WebServerModule::handleStatus() {
     formatQuotePriceEur(high2hText, sizeof(high2hText), high2h);
     formatQuotePriceEur(low2hText, sizeof(low2hText), low2h);
 
-    // JSON buffer (inclusief regime-velden + geformatteerde EUR-strings)
-    static char jsonBuf[2048];
-    size_t written = 0;
-    
+    if (live) {
+        apiAgeMs = apiFresh ? 0 : (apiAgeMs / 1000UL) * 1000UL;
+    }
+
     // Bouw JSON zonder String-concatenaties (numeriek: hogere precisie; display: priceText, etc.)
-    written = snprintf(jsonBuf, sizeof(jsonBuf),
+    int written = snprintf(buf, bufSize,
         "{"
         "\"symbol\":\"%s\","
         "\"price\":%.8f,"
@@ -3591,13 +3814,7 @@ void WebServerModule::handleStatus() {
         "\"low2hText\":\"%s\","
         "\"range2hPct\":%.2f,"
         "\"apiFresh\":%s,"
-        "\"apiAgeMs\":%lu,"
-        "\"uptimeSec\":%lu,"
-        "\"heapFree\":%u,"
-        "\"heapLargest\":%u,"
-        "\"regimeEnabled\":%s,"
-        "\"regime\":\"%s\""
-        "}",
+        "\"apiAgeMs\":%lu,",
         bitvavoSymbol,
         price,
         priceText,
@@ -3623,16 +3840,71 @@ void WebServerModule::handleStatus() {
         low2hText,
         range2hPct,
         apiFresh ? "true" : "false",
-        static_cast<unsigned long>(apiAgeMs),
-        nowMs / 1000,
-        ESP.getFreeHeap(),
-        ESP.getMaxAllocHeap(),
-        regimeEnabledForJson ? "true" : "false",
-        regimeStrJson
+        static_cast<unsigned long>(apiAgeMs)
     );
+    if (written <= 0 || (size_t)written >= bufSize) {
+        return 0;
+    }
+    size_t len = (size_t)written;
+    if (!live) {
+        written = snprintf(buf + len, bufSize - len,
+            "\"uptimeSec\":%lu,"
+            "\"heapFree\":%u,"
+            "\"heapLargest\":%u,",
+            nowMs / 1000,
+            ESP.getFreeHeap(),
+            ESP.getMaxAllocHeap());
+        if (written <= 0 || (size_t)written >= bufSize - len) {
+            return 0;
+        }
+        len += (size_t)written;
+        // Task-CPU, sampler-deadlines en backfill/jitter (alleen polling; verandert elk venster en zou SSE-frames laten wijzigen)
+        const size_t taskLen = taskTopologyFormatJson(buf + len, bufSize - len);
+        if (taskLen == 0 || taskLen + 1 >= bufSize - len) {
+            return 0;
+        }
+        len += taskLen;
+        buf[len++] = ',';
+        buf[len] = '\0';
+        const size_t samplerLen = priceSamplerFormatJson(buf + len, bufSize - len);
+        if (samplerLen == 0 || samplerLen + 1 >= bufSize - len) {
+            return 0;
+        }
+        len += samplerLen;
+        buf[len++] = ',';
+        buf[len] = '\0';
+    }
+    written = snprintf(buf + len, bufSize - len,
+        "\"regimeEnabled\":%s,"
+        "\"regime\":\"%s\""
+        "}",
+        regimeEnabledForJson ? "true" : "false",
+        regimeStrJson);
+    if (written <= 0 || (size_t)written >= bufSize - len) {
+        return 0;
+    }
+    return len + (size_t)written;
+}
+
+// WEB-PERF-3: Status endpoint - JSON met live waarden (geen heap-allocaties)
+void WebServerModule::handleStatus() {
+    if (server == nullptr) return;
+
+    #if !DEBUG_BUTTON_ONLY
+    unsigned long statusStart = millis();
+    #endif
+    static unsigned long lastStatusLogMs = 0;
+    static uint32_t statusLogCount = 0;
+    static IPAddress lastStatusIp;
+    statusLogCount++;
+    lastStatusIp = server->client().remoteIP();
+
+    // JSON buffer (inclusief regime-velden + geformatteerde EUR-strings)
+    static char jsonBuf[2048];
+    const size_t written = buildStatusJson(jsonBuf, sizeof(jsonBuf), false);
     
     // Verstuur JSON response
-    if (written > 0 && written < sizeof(jsonBuf)) {
+    if (written > 0) {
         server->send(200, "application/json", jsonBuf);
     } else {
         // Fallback bij buffer overflow (zou niet moeten gebeuren)
@@ -3652,6 +3924,54 @@ void WebServerModule::handleStatus() {
     #endif
 }
 
+#if CRYPTO_ALERT_LIVE_PUSH_ENABLED
+// GET /events: Server-Sent Events — socket wordt overgenomen door LivePush, frames via pollLivePush()
+void WebServerModule::handleEvents() {
+    if (server == nullptr) return;
+    WiFiClient client = server->client();
+    if (!livePushAttach(client)) {
+        server->send(503, "text/plain", "live push: max clients");
+        return;
+    }
+    char ipBuf[16];
+    formatIPAddress(client.remoteIP(), ipBuf, sizeof(ipBuf));
+    Serial_printf(F("[LivePush] client %s verbonden (%u actief)\n"), ipBuf, (unsigned)livePushClientCount());
+}
+
+// Vanuit de web-slice (Web_Task of inline in PriceRepeat): één build per wijziging, ongeacht het aantal
+// open dashboards. Rebuild alleen na een nieuwe analytics-snapshot (analyticsSnapshotSeq) of na
+// LIVE_PUSH_REFRESH_MS (anchor, STALE-teller); LivePush stuurt het frame alleen uit als de hash afwijkt
+// van het vorige, en schrijft niet-blokkerend zodat een hangende client de sampler niet ophoudt.
+void WebServerModule::pollLivePush() {
+    const uint32_t nowMs = millis();
+    livePushService(nowMs);
+    if (livePushClientCount() == 0) {
+        return;
+    }
+    static uint32_t s_lastBuildMs = 0;
+    static uint32_t s_lastSeenSeq = 0;
+    const uint32_t seq = analyticsSnapshotSeq();
+    const uint32_t sinceBuild = nowMs - s_lastBuildMs;
+    if (sinceBuild < LIVE_PUSH_MIN_INTERVAL_MS) {
+        return;
+    }
+    if (seq == s_lastSeenSeq && sinceBuild < LIVE_PUSH_REFRESH_MS) {
+        return;
+    }
+    s_lastBuildMs = nowMs;
+    s_lastSeenSeq = seq;
+
+    static char frame[LIVE_PUSH_FRAME_BYTES];
+    const size_t len = buildStatusJson(frame, sizeof(frame), true);
+    if (len > 0) {
+        livePushPublish("status", frame, len);
+    }
+}
+#else
+void WebServerModule::handleEvents() { (void)0; }
+void WebServerModule::pollLivePush() { (void)0; }
+#endif
+
 // Handler voor anchor set (aparte route om crashes te voorkomen)
 // Gebruikt een queue om asynchroon te verwerken vanuit main loop
 // Thread-safe: schrijft naar volatile variabelen die worden gelezen vanuit uiTask
@@ -3767,53 +4087,119 @@ void WebServerModule::handleWifiReset() {
 }
 
 // WEB-PERF-3: Cache invalidation helper
+// Bumpt de settings-versie; de cache wordt bij het volgende GET / opnieuw opgebouwd.
+// Mag vanuit elke task (saveSettings via MQTT/knoppen): de buffer zelf wordt alleen in webTask beschreven.
 void WebServerModule::invalidatePageCache() {
+    sSettingsVersion++;
     sPageCacheValid = false;
-    sPageCache = "";  // Free memory
 }
 
 // WEB-PERF-3: Get or build settings page (with caching)
-String WebServerModule::getOrBuildSettingsPage() {
-    // Return cached page if valid
-    if (sPageCacheValid && sPageCache.length() > 0) {
+// Rendert de pagina (zonder netwerk) naar de PSRAM-cache als die niet bij de huidige settings-versie hoort.
+// @return true als de cache geldig is en via sendCachedSettingsPage() verstuurd kan worden
+bool WebServerModule::getOrBuildSettingsPage() {
+    const uint32_t version = sSettingsVersion;
+    if (sPageCacheValid && s_pageCacheVersion == version) {
         #if !DEBUG_BUTTON_ONLY
         Serial.println(F("[WEB] handleRoot served cached page"));
         #endif
-        return sPageCache;
+        return true;
+    }
+    if (s_pageCacheDisabled || WEB_PAGE_CACHE_BYTES == 0) {
+        return false;
+    }
+    if (s_pageCacheBuf == nullptr) {
+        s_pageCacheBuf = (char*)heap_caps_malloc(WEB_PAGE_CACHE_BYTES, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (s_pageCacheBuf == nullptr) {
+            // Geen PSRAM: DRAM is te schaars voor een vaste paginabuffer, dus altijd live renderen
+            s_pageCacheDisabled = true;
+            Serial_println(F("[WEB] page cache: geen PSRAM, live chunked render"));
+            return false;
+        }
     }
     
     #if !DEBUG_BUTTON_ONLY
     unsigned long buildStart = millis();
     #endif
     
-    // Reserve memory voor grote HTML pagina (ESP32-S3 en vergelijkbare boards)
-    sPageCache.reserve(16000);
-    sPageCache = "";
-    
-    // Build HTML page (we moeten renderSettingsHTML() aanpassen om naar String te schrijven)
-    // Voor nu: gebruik renderSettingsHTML() direct en cache de response niet
-    // TODO: Refactor renderSettingsHTML() om naar String te kunnen schrijven
-    
-    // Voor nu: return empty string en gebruik renderSettingsHTML() direct
-    // Dit is een placeholder - volledige implementatie vereist refactoring van renderSettingsHTML()
-    sPageCacheValid = false;  // Cache nog niet geïmplementeerd
+    s_pageCacheLen = 0;
+    s_pageCacheOverflow = false;
+    pageSinkBegin(PAGE_SINK_CAPTURE);
+    renderSettingsHTML();
+    pageSinkEnd(server);
+    
+    if (s_pageCacheOverflow) {
+        // Pagina past niet: buffer vrijgeven en voortaan live renderen (verhoog WEB_PAGE_CACHE_BYTES)
+        heap_caps_free(s_pageCacheBuf);
+        s_pageCacheBuf = nullptr;
+        s_pageCacheLen = 0;
+        s_pageCacheDisabled = true;
+        sPageCacheValid = false;
+        Serial_printf(F("[WEB] page cache: pagina > %u bytes, cache uit\n"), (unsigned)WEB_PAGE_CACHE_BYTES);
+        return false;
+    }
+    s_pageCacheVersion = version;
+    sPageCacheValid = true;
     
     #if !DEBUG_BUTTON_ONLY
-    unsigned long buildEnd = millis();
-    Serial_printf(F("[WEB] buildSettingsPage: %lu ms, len=%u (not implemented yet)\n"), 
-                  buildEnd - buildStart, sPageCache.length());
+    Serial_printf(F("[WEB] buildSettingsPage: %lu ms, len=%u, version=%lu\n"),
+                  millis() - buildStart, (unsigned)s_pageCacheLen, (unsigned long)version);
     #endif
-    
-    return sPageCache;  // Empty for now
+    return true;
+}
+
+// Verstuur de gecachte pagina in chunks; slot-markers worden vervangen door s_pageSlots (fillSettingsPageSlots)
+void WebServerModule::sendCachedSettingsPage() {
+    if (server == nullptr || s_pageCacheBuf == nullptr) return;
+    pageSinkBegin(PAGE_SINK_CHUNKED);
+    const char* p = s_pageCacheBuf;
+    const char* const end = s_pageCacheBuf + s_pageCacheLen;
+    while (p < end && !s_pageSinkAborted) {
+        const char* marker = (const char*)memchr(p, PAGE_SLOT_MARKER, (size_t)(end - p));
+        if (marker == nullptr) {
+            pageSinkWrite(server, p, (size_t)(end - p));
+            break;
+        }
+        pageSinkWrite(server, p, (size_t)(marker - p));
+        const uint8_t slot = (marker + 1 < end) ? (uint8_t)(marker[1] - '0') : PAGE_SLOT_COUNT;
+        if (slot < PAGE_SLOT_COUNT) {
+            pageSinkWrite(server, s_pageSlots[slot], strlen(s_pageSlots[slot]));
+            p = marker + 2;
+        } else {
+            pageSinkWrite(server, marker, 1);
+            p = marker + 1;
+        }
+    }
+    pageSinkEnd(server);
+}
+
+// Paginaschrijver: alle settings-pagina output loopt hierlangs (zie WebPageSinkMode)
+void WebServerModule::pageOut(const char* text) {
+    if (server == nullptr || text == nullptr) return;
+    pageSinkWrite(server, text, strlen(text));
+}
+
+void WebServerModule::pageOut(const __FlashStringHelper* text) {
+    if (server == nullptr || text == nullptr) return;
+    PGM_P p = reinterpret_cast<PGM_P>(text);
+    pageSinkWrite(server, p, strlen_P(p));
+}
+
+void WebServerModule::pageOutSlot(uint8_t slot) {
+    if (server == nullptr || slot >= PAGE_SLOT_COUNT) return;
+    if (s_pageSinkMode == PAGE_SINK_CAPTURE) {
+        const char marker[2] = {PAGE_SLOT_MARKER, (char)('0' + slot)};
+        pageSinkWrite(server, marker, sizeof(marker));
+    } else {
+        pageSinkWrite(server, s_pageSlots[slot], strlen(s_pageSlots[slot]));
+    }
 }
 
 // Fase 9.1.3: HTML helper functies verplaatst vanuit .ino
+// Response-start (200 + chunked) doet handleRoot(); hier alleen de <head> en navigatie.
 void WebServerModule::sendHtmlHeader(const char* platformName, const char* ntfyTopic) {
     if (server == nullptr) return;
-    if (!isClientConnected(server)) return;
-    
-    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
-    server->send(200, "text/html; charset=utf-8", "");
+    if (!pageSinkCanWrite(server)) return;
     
     char tmpBuf[256];
     char quoteCurrency[8] = "EUR";
@@ -3823,212 +4209,63 @@ void WebServerModule::sendHtmlHeader(const char* platformName, const char* ntfyT
     }
     
     // HTML doctype en head (lang='en' om punt als decimaal scheidingsteken te forceren)
-    server->sendContent(F("<!DOCTYPE html><html lang='en'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1'>"));
+    pageOut(F("<!DOCTYPE html><html lang='en'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1'>"));
     
     // Title - gebruik bitvavoSymbol in plaats van platformName, voeg versie toe
     char titleBuf[128];
     snprintf(titleBuf, sizeof(titleBuf), "<title>%s %s %s v%s</title>", 
              getText("Instellingen", "Settings"), bitvavoSymbol, ntfyTopic, VERSION_STRING);
-    server->sendContent(titleBuf);
-    
-    sendWebUiStylesheet(server);
-    
-    // JavaScript
-    server->sendContent(F("<script type='text/javascript'>"));
-    server->sendContent(F("(function(){"));
-    server->sendContent(F("function toggleSection(id){"));
-    server->sendContent(F("var content=document.getElementById('content-'+id);"));
-    server->sendContent(F("var icon=document.getElementById('icon-'+id);"));
-    server->sendContent(F("if(!content||!icon)return false;"));
-    server->sendContent(F("if(content.classList.contains('active')){"));
-    server->sendContent(F("content.classList.remove('active');"));
-    server->sendContent(F("icon.innerHTML='&#9654;';"));
-    server->sendContent(F("}else{"));
-    server->sendContent(F("content.classList.add('active');"));
-    server->sendContent(F("icon.innerHTML='&#9660;';"));
-    server->sendContent(F("}"));
-    server->sendContent(F("return false;"));
-    server->sendContent(F("}"));
-    server->sendContent(F("function setAnchorBtn(e){"));
-    server->sendContent(F("if(e){e.preventDefault();e.stopPropagation();}"));
-    server->sendContent(F("var input=document.getElementById('anchorValue');"));
-    server->sendContent(F("if(!input){alert('Input not found');return false;}"));
-    server->sendContent(F("var val=input.value||'';"));
-    server->sendContent(F("var xhr=new XMLHttpRequest();"));
-    server->sendContent(F("xhr.open('POST','/anchor/set',true);"));
-    server->sendContent(F("xhr.setRequestHeader('Content-Type','application/x-www-form-urlencoded');"));
-    server->sendContent(F("xhr.onreadystatechange=function(){"));
-    server->sendContent(F("if(xhr.readyState==4){"));
-    server->sendContent(F("if(xhr.status==200){"));
-    
-    char alertBuf[128];
-    snprintf(alertBuf, sizeof(alertBuf), "alert('%s');", getText("Anchor ingesteld!", "Anchor set!"));
-    server->sendContent(alertBuf);
-    
-    // WEB-PERF-3: Refresh status direct na anchor set (geen full reload)
-    server->sendContent(F("refreshStatus();"));
-    server->sendContent(F("}else{"));
-    
-    snprintf(alertBuf, sizeof(alertBuf), "alert('%s');", getText("Fout bij instellen anchor", "Error setting anchor"));
-    server->sendContent(alertBuf);
-    
-    server->sendContent(F("}"));
-    server->sendContent(F("}"));
-    server->sendContent(F("};"));
-    server->sendContent(F("xhr.send('value='+encodeURIComponent(val));"));
-    server->sendContent(F("return false;"));
-    server->sendContent(F("}"));
-    server->sendContent(F("function resetNtfyBtn(e){"));
-    server->sendContent(F("if(e){e.preventDefault();e.stopPropagation();}"));
-    server->sendContent(F("var xhr=new XMLHttpRequest();"));
-    server->sendContent(F("xhr.open('POST','/ntfy/reset',true);"));
-    server->sendContent(F("xhr.onreadystatechange=function(){"));
-    server->sendContent(F("if(xhr.readyState==4){"));
-    server->sendContent(F("if(xhr.status==200){"));
-    server->sendContent(F("setTimeout(function(){location.reload();},500);"));
-    server->sendContent(F("}else{"));
-    
-    snprintf(alertBuf, sizeof(alertBuf), "alert('%s');", getText("Fout bij resetten NTFY topic", "Error resetting NTFY topic"));
-    server->sendContent(alertBuf);
-    
-    server->sendContent(F("}"));
-    server->sendContent(F("}"));
-    server->sendContent(F("};"));
-    server->sendContent(F("xhr.send();"));
-    server->sendContent(F("return false;"));
-    server->sendContent(F("}"));
-    server->sendContent(F("function resetWifiBtn(e){"));
-    server->sendContent(F("if(e){e.preventDefault();e.stopPropagation();}"));
-    server->sendContent(F("if(!confirm('WiFi reset? Dit wist credentials en herstart het device.')){return false;}"));
-    server->sendContent(F("var xhr=new XMLHttpRequest();"));
-    server->sendContent(F("xhr.open('POST','/wifi/reset',true);"));
-    server->sendContent(F("xhr.onreadystatechange=function(){"));
-    server->sendContent(F("if(xhr.readyState==4){"));
-    server->sendContent(F("if(xhr.status==200){alert('WiFi reset uitgevoerd. Device herstart.');}"));
-    server->sendContent(F("else{alert('Fout bij WiFi reset');}"));
-    server->sendContent(F("}};"));
-    server->sendContent(F("xhr.send();"));
-    server->sendContent(F("return false;"));
-    server->sendContent(F("}"));
-    server->sendContent(F("window.addEventListener('DOMContentLoaded',function(){"));
-    // Fix: converteer komma's naar punten in number inputs (locale fix)
-    server->sendContent(F("var numberInputs=document.querySelectorAll('input[type=\"number\"]');"));
-    server->sendContent(F("for(var i=0;i<numberInputs.length;i++){"));
-    server->sendContent(F("numberInputs[i].addEventListener('input',function(e){"));
-    server->sendContent(F("var val=this.value.replace(',','.');"));
-    server->sendContent(F("if(val!==this.value){this.value=val;}});"));
-    server->sendContent(F("numberInputs[i].addEventListener('blur',function(e){"));
-    server->sendContent(F("var val=this.value.replace(',','.');"));
-    server->sendContent(F("if(val!==this.value){this.value=val;}});"));
-    server->sendContent(F("}"));
-    // 2h/2h Strategie dropdown JavaScript
-    server->sendContent(F("var strategySelect=document.querySelector('select[name=\"anchorStrategy\"]');"));
-    server->sendContent(F("if(strategySelect){"));
-    server->sendContent(F("strategySelect.addEventListener('change',function(){"));
-    server->sendContent(F("var val=parseInt(this.value);"));
-    server->sendContent(F("var tpInput=document.querySelector('input[name=\"anchorTP\"]');"));
-    server->sendContent(F("var mlInput=document.querySelector('input[name=\"anchorML\"]');"));
-    server->sendContent(F("if(val==1){"));
-    server->sendContent(F("if(tpInput)tpInput.value='1.8';"));
-    server->sendContent(F("if(mlInput)mlInput.value='-1.2';"));
-    server->sendContent(F("}else if(val==2){"));
-    server->sendContent(F("if(tpInput)tpInput.value='1.2';"));
-    server->sendContent(F("if(mlInput)mlInput.value='-0.9';"));
-    server->sendContent(F("}"));
-    server->sendContent(F("});"));
-    server->sendContent(F("}"));
-    server->sendContent(F("var headers=document.querySelectorAll('.section-header');"));
-    server->sendContent(F("for(var i=0;i<headers.length;i++){"));
-    server->sendContent(F("headers[i].addEventListener('click',function(e){"));
-    server->sendContent(F("var id=this.getAttribute('data-section');"));
-    server->sendContent(F("toggleSection(id);"));
-    server->sendContent(F("e.preventDefault();"));
-    server->sendContent(F("return false;"));
-    server->sendContent(F("});"));
-    server->sendContent(F("}"));
-    server->sendContent(F("var basic=document.getElementById('icon-basic');"));
-    server->sendContent(F("var anchor=document.getElementById('icon-anchor');"));
-    server->sendContent(F("var anchorBtn=document.getElementById('anchorBtn');"));
-    server->sendContent(F("if(anchorBtn){"));
-    server->sendContent(F("anchorBtn.addEventListener('click',setAnchorBtn);"));
-    server->sendContent(F("}"));
-    server->sendContent(F("var ntfyResetBtn=document.getElementById('ntfyResetBtn');"));
-    server->sendContent(F("if(ntfyResetBtn){"));
-    server->sendContent(F("ntfyResetBtn.addEventListener('click',resetNtfyBtn);"));
-    server->sendContent(F("}"));
-    server->sendContent(F("var wifiResetBtn=document.getElementById('wifiResetBtn');"));
-    server->sendContent(F("if(wifiResetBtn){"));
-    server->sendContent(F("wifiResetBtn.addEventListener('click',resetWifiBtn);"));
-    server->sendContent(F("}"));
-    
-    // WEB-PERF-3: Live status updates via /status endpoint
-    server->sendContent(F("function refreshStatus(){"));
-    server->sendContent(F("fetch('/status').then(function(r){return r.json();}).then(function(d){"));
-    snprintf(tmpBuf, sizeof(tmpBuf), "var quote='%s';", quoteCurrency);
-    server->sendContent(tmpBuf);
-    server->sendContent(F("var el=document.getElementById('curPrice');if(el)el.textContent=(typeof d.priceText==='string'&&d.priceText.length&&d.priceText!=='-')?d.priceText+' '+quote:((d.price>0)?d.price.toFixed(8)+' '+quote:'--');"));
-    server->sendContent(F("el=document.getElementById('trend2h');if(el)el.textContent=d.trend||'--';"));
-    server->sendContent(F("el=document.getElementById('trend1d');if(el)el.textContent=d.trendMedium||'--';"));
-    server->sendContent(F("el=document.getElementById('trend7d');if(el)el.textContent=d.trendLong||'--';"));
-    server->sendContent(F("el=document.getElementById('volatility');if(el)el.textContent=d.volatility||'--';"));
-    server->sendContent(F("el=document.getElementById('regimeStatus');if(el)el.textContent=(d.regime!==undefined&&d.regime!==null)?d.regime:'--';"));
-    server->sendContent(F("el=document.getElementById('volume');if(el)el.textContent=d.volume||'--';"));
-    server->sendContent(F("el=document.getElementById('ret1m');if(el)el.textContent=d.ret1m!=0?d.ret1m.toFixed(2)+'%':'--';"));
-    server->sendContent(F("el=document.getElementById('ret5m');if(el)el.textContent=d.ret5m!=0?d.ret5m.toFixed(2)+'%':'--';"));
-    server->sendContent(F("el=document.getElementById('ret30m');if(el)el.textContent=d.ret30m!=0?d.ret30m.toFixed(2)+'%':'--';"));
-    server->sendContent(F("el=document.getElementById('ret2h');if(el)el.textContent=d.ret2h!=0?d.ret2h.toFixed(2)+'%':'--';"));
-    server->sendContent(F("el=document.getElementById('ret1d');if(el)el.textContent=d.ret1d!=0?d.ret1d.toFixed(2)+'%':'--';"));
-    server->sendContent(F("el=document.getElementById('ret7d');if(el)el.textContent=d.ret7d!=0?d.ret7d.toFixed(2)+'%':'--';"));
-    server->sendContent(F("el=document.getElementById('anchor');if(el)el.textContent=(typeof d.anchorText==='string'&&d.anchorText.length&&d.anchorText!=='-')?d.anchorText+' '+quote:((d.anchor>0)?d.anchor.toFixed(8)+' '+quote:'--');"));
-    server->sendContent(F("el=document.getElementById('anchorDelta');if(el)el.textContent=d.anchorDeltaPct!=0?d.anchorDeltaPct.toFixed(2)+'%':'--';"));
-    server->sendContent(F("el=document.getElementById('apiStateHeader');if(el){"));
-    server->sendContent(F("if(d.apiFresh){el.textContent='';}else{"));
-    server->sendContent(F("var age=(d.apiAgeMs?Math.round(d.apiAgeMs/1000):0);"));
-    server->sendContent(F("el.textContent='STALE '+age+'s';"));
-    server->sendContent(F("}}"));
-    server->sendContent(F("}).catch(function(e){"));
-    server->sendContent(F("var el=document.getElementById('apiStateHeader');if(el)el.textContent='NET?';"));
-    server->sendContent(F("});"));
-    server->sendContent(F("}"));
-    server->sendContent(F("refreshStatus();"));
-    server->sendContent(F("setInterval(refreshStatus,2000);"));
-    
-    server->sendContent(F("});"));
-    server->sendContent(F("})();"));
-    server->sendContent(F("</script>"));
-    server->sendContent(F("</head><body>"));
-    server->sendContent(F("<div class='container'>"));
+    pageOut(titleBuf);
+    
+    const WebAsset* css = findWebAsset("/assets/app.css");
+    const WebAsset* js = findWebAsset("/assets/app.js");
+    snprintf(tmpBuf, sizeof(tmpBuf), "<link rel='stylesheet' href='%s?v=%s'>", css->path, css->version);
+    pageOut(tmpBuf);
+    
+    // JavaScript: statisch in /assets/app.js; alleen taal-/quote-afhankelijke teksten inline
+    char cfgBuf[320];
+    snprintf(cfgBuf, sizeof(cfgBuf),
+             "<script>var CA_CFG={quote:'%s',anchorOk:'%s',anchorErr:'%s',ntfyErr:'%s'};</script>",
+             quoteCurrency,
+             getText("Anchor ingesteld!", "Anchor set!"),
+             getText("Fout bij instellen anchor", "Error setting anchor"),
+             getText("Fout bij resetten NTFY topic", "Error resetting NTFY topic"));
+    pageOut(cfgBuf);
+    snprintf(tmpBuf, sizeof(tmpBuf), "<script src='%s?v=%s' defer></script>", js->path, js->version);
+    pageOut(tmpBuf);
+    pageOut(F("</head><body>"));
+    pageOut(F("<div class='container'>"));
     // Eenvoudige navigatie
-    server->sendContent(F("<div style='margin-bottom:10px;font-size:13px;'>"));
-    server->sendContent(F("<a href=\"/notifications\" style='color:#00BCD4;text-decoration:none;'>"));
-    server->sendContent(getText("Notificaties", "Notifications"));
-    server->sendContent(F("</a>"));
-    server->sendContent(F(" &middot; <a href=\"/config\" style='color:#00BCD4;text-decoration:none;'>"));
-    server->sendContent(getText("Overzicht (alleen lezen)", "Overview (read-only)"));
-    server->sendContent(F("</a>"));
-    server->sendContent(F(" &middot; <a href=\"/settings.txt\" style='color:#00BCD4;text-decoration:none;'>"));
-    server->sendContent(getText("Instellingen (kopiëren)", "Settings (copy)"));
-    server->sendContent(F("</a>"));
+    pageOut(F("<div style='margin-bottom:10px;font-size:13px;'>"));
+    pageOut(F("<a href=\"/notifications\" style='color:#00BCD4;text-decoration:none;'>"));
+    pageOut(getText("Notificaties", "Notifications"));
+    pageOut(F("</a>"));
+    pageOut(F(" &middot; <a href=\"/config\" style='color:#00BCD4;text-decoration:none;'>"));
+    pageOut(getText("Overzicht (alleen lezen)", "Overview (read-only)"));
+    pageOut(F("</a>"));
+    pageOut(F(" &middot; <a href=\"/settings.txt\" style='color:#00BCD4;text-decoration:none;'>"));
+    pageOut(getText("Instellingen (kopiëren)", "Settings (copy)"));
+    pageOut(F("</a>"));
 #if OTA_ENABLED
-    server->sendContent(F(" &middot; <a href=\"/update\" style='color:red;text-decoration:none;'>"));
-    server->sendContent(getText("Firmware Update (OTA)", "Firmware Update (OTA)"));
-    server->sendContent(F("</a>"));
+    pageOut(F(" &middot; <a href=\"/update\" style='color:red;text-decoration:none;'>"));
+    pageOut(getText("Firmware Update (OTA)", "Firmware Update (OTA)"));
+    pageOut(F("</a>"));
 #endif
-    server->sendContent(F("<span id='apiStateHeader' style='margin-left:10px;font-size:11px;color:#666;'></span>"));
-    server->sendContent(F("</div>"));
+    pageOut(F("<span id='apiStateHeader' style='margin-left:10px;font-size:11px;color:#666;'></span>"));
+    pageOut(F("</div>"));
     
     // Title - gebruik bitvavoSymbol in plaats van platformName, voeg versie toe
     char h1Buf[128];
     snprintf(h1Buf, sizeof(h1Buf), "<h1>%s %s %s v%s</h1>", 
              getText("Instellingen", "Settings"), bitvavoSymbol, ntfyTopic, VERSION_STRING);
-    server->sendContent(h1Buf);
+    pageOut(h1Buf);
 }
 
 void WebServerModule::sendHtmlFooter() {
     if (server == nullptr) return;
-    if (!isClientConnected(server)) return;
-    server->sendContent(F("</div>"));
-    server->sendContent(F("</body></html>"));
+    if (!pageSinkCanWrite(server)) return;
+    pageOut(F("</div>"));
+    pageOut(F("</body></html>"));
 }
 
 void WebServerModule::sendInputRow(const char* label, const char* name, const char* type, const char* value, 
@@ -4082,10 +4319,10 @@ void WebServerModule::sendInputRow(const char* label, const char* name, const ch
         snprintf(buf, sizeof(buf), "<label>%s:<input type='%s' name='%s' value='%s'></label>",
                  label, type, name, value);
     }
-    server->sendContent(buf);
+    pageOut(buf);
     if (info && strlen(info) > 0) {
         snprintf(buf, sizeof(buf), "<div class='info'>%s</div>", info);
-        server->sendContent(buf);
+        pageOut(buf);
     }
 }
 
@@ -4094,42 +4331,42 @@ void WebServerModule::sendCheckboxRow(const char* label, const char* name, bool
     char buf[256];
     snprintf(buf, sizeof(buf), "<label><input type='checkbox' name='%s' value='1'%s> %s</label>",
              name, checked ? " checked" : "", label);
-    server->sendContent(buf);
+    pageOut(buf);
 }
 
 void WebServerModule::sendDropdownRow(const char* label, const char* name, int value, const char* options[], int optionCount) {
     if (server == nullptr) return;
-    server->sendContent("<tr><td>");
-    server->sendContent(label);
-    server->sendContent(":</td><td><select name=\"");
-    server->sendContent(name);
-    server->sendContent("\">");
+    pageOut("<tr><td>");
+    pageOut(label);
+    pageOut(":</td><td><select name=\"");
+    pageOut(name);
+    pageOut("\">");
     for (int i = 0; i < optionCount; i++) {
         char buf[128];
         snprintf(buf, sizeof(buf), "<option value=\"%d\"%s>%s</option>",
                  i, (i == value) ? " selected" : "", options[i]);
-        server->sendContent(buf);
+        pageOut(buf);
     }
-    server->sendContent("</select></td></tr>");
+    pageOut("</select></td></tr>");
 }
 
 void WebServerModule::sendStringSelectRow(const char* label, const char* name, const char* currentValue,
                                           const char* const optionValues[], const char* const optionLabels[], int optionCount) {
     if (server == nullptr) return;
-    server->sendContent("<tr><td>");
-    server->sendContent(label);
-    server->sendContent(":</td><td><select name=\"");
-    server->sendContent(name);
-    server->sendContent("\">");
+    pageOut("<tr><td>");
+    pageOut(label);
+    pageOut(":</td><td><select name=\"");
+    pageOut(name);
+    pageOut("\">");
     for (int i = 0; i < optionCount; i++) {
         char buf[192];
         snprintf(buf, sizeof(buf), "<option value=\"%s\"%s>%s</option>",
                  optionValues[i],
                  (currentValue != nullptr && strcmp(currentValue, optionValues[i]) == 0) ? " selected" : "",
                  optionLabels[i]);
-        server->sendContent(buf);
+        pageOut(buf);
     }
-    server->sendContent("</select></td></tr>");
+    pageOut("</select></td></tr>");
 }
 
 void WebServerModule::sendStatusRow(const char* label, const char* value) {
@@ -4137,7 +4374,7 @@ void WebServerModule::sendStatusRow(const char* label, const char* value) {
     char buf[256];
     snprintf(buf, sizeof(buf), "<div class='status-row'><span class='status-label'>%s:</span><span class='status-value'>%s</span></div>",
              label, value);
-    server->sendContent(buf);
+    pageOut(buf);
 }
 
 void WebServerModule::sendSectionHeader(const char* title, const char* sectionId, bool expanded) {
@@ -4145,22 +4382,22 @@ void WebServerModule::sendSectionHeader(const char* title, const char* sectionId
     char buf[256];
     snprintf(buf, sizeof(buf), "<div class='section-header' data-section='%s'><h3>%s</h3><span class='toggle-icon' id='icon-%s'>%s</span></div>",
              sectionId, title, sectionId, expanded ? "&#9660;" : "&#9654;");
-    server->sendContent(buf);
+    pageOut(buf);
     snprintf(buf, sizeof(buf), "<div class='section-content%s' id='content-%s'>",
              expanded ? " active" : "", sectionId);
-    server->sendContent(buf);
+    pageOut(buf);
 }
 
 void WebServerModule::sendSectionFooter() {
     if (server == nullptr) return;
-    server->sendContent(F("</div>"));
+    pageOut(F("</div>"));
 }
 
 void WebServerModule::sendSectionDesc(const char* desc) {
     if (server == nullptr) return;
     char buf[256];
     snprintf(buf, sizeof(buf), "<div class='section-desc'>%s</div>", desc);
-    server->sendContent(buf);
+    pageOut(buf);
 }
 
 // Helper: Get trend text (geoptimaliseerd: elimineert switch duplicatie)
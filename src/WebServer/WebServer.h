@@ -38,6 +38,9 @@ public:
     void handleStatus();  // WEB-PERF-3: JSON status endpoint
     void handleSettingsExport();  // Plain-text settings export (read-only)
     void handleNotifications();   // Read-only notification log page
+    void handleStaticAsset();     // GET /assets/* (gzip + ETag, zie WebAssets.h)
+    void handleMetrics();         // GET /metrics: tracepoints + heap + MQTT-queue (Prometheus-tekst)
+    void handleEvents();          // GET /events: SSE live push (zie LivePush.h)
 
     // Legacy handlers (web OTA upload) - kept for backwards compatibility.
     // Routes are now registered via src/OtaWebUpdater/.
@@ -54,11 +57,19 @@ public:
     /// Forensiek: voer uitgestelde server->begin() één keer uit (WEBTRACE_DELAY_SERVER_BEGIN_MS).
     void pollDeferredServerBegin();
 
+    // Live push: bouw het statusframe bij een wijziging en stuur het naar alle SSE-clients
+    void pollLivePush();
+
     // Productie webTask: markeer recente HTTP-activiteit (idle → burst polling in webTask).
     static void notifyWebActivity();
     static uint32_t getLastWebActivityMs();
 
 private:
+    // WEB-PERF-4: paginaschrijver (buffer in vaste chunks, of capture naar de cache)
+    void pageOut(const char* text);
+    void pageOut(const __FlashStringHelper* text);
+    void pageOutSlot(uint8_t slot);
+
     // Fase 9.1.3: HTML helper functies
     void sendHtmlHeader(const char* platformName, const char* ntfyTopic);
     void sendHtmlFooter();
@@ -81,12 +92,18 @@ private:
     bool parseFloatArg(const char* argName, float& result, float minVal, float maxVal);
     bool parseIntArg(const char* argName, int& result, int minVal, int maxVal);
     bool parseStringArg(const char* argName, char* dest, size_t destSize);
+
+    // Status-JSON voor /status (live=false) en SSE-frames (live=true: zonder uptime/heap); 0 bij overflow
+    size_t buildStatusJson(char* buf, size_t bufSize, bool live);
     
     // WEB-PERF-3: HTML caching voor performance
+    // Settings-pagina wordt (met PSRAM) één keer per settings-versie gerenderd naar een cache;
+    // live waarden (anchor prefill, laatste auto-anchor) zijn template-slots die per request ingevuld worden.
     static bool sPageCacheValid;
-    static String sPageCache;
+    static uint32_t sSettingsVersion;  // Opgehoogd door invalidatePageCache() (saveSettings, handleSave, ...)
     void invalidatePageCache();
-    String getOrBuildSettingsPage();
+    bool getOrBuildSettingsPage();
+    void sendCachedSettingsPage();
     
     // WebServer instance (wordt extern gedeclareerd in .ino)
     // Note: WebServer is een externe library class, we gebruiken een referentie
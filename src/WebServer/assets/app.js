@@ -0,0 +1,160 @@
+(function(){
+function toggleSection(id){
+var content=document.getElementById('content-'+id);
+var icon=document.getElementById('icon-'+id);
+if(!content||!icon)return false;
+if(content.classList.contains('active')){
+content.classList.remove('active');
+icon.innerHTML='&#9654;';
+}else{
+content.classList.add('active');
+icon.innerHTML='&#9660;';
+}
+return false;
+}
+function setAnchorBtn(e){
+if(e){e.preventDefault();e.stopPropagation();}
+var input=document.getElementById('anchorValue');
+if(!input){alert('Input not found');return false;}
+var val=input.value||'';
+var xhr=new XMLHttpRequest();
+xhr.open('POST','/anchor/set',true);
+xhr.setRequestHeader('Content-Type','application/x-www-form-urlencoded');
+xhr.onreadystatechange=function(){
+if(xhr.readyState==4){
+if(xhr.status==200){
+alert(CA_CFG.anchorOk);
+refreshStatus();
+}else{
+alert(CA_CFG.anchorErr);
+}
+}
+};
+xhr.send('value='+encodeURIComponent(val));
+return false;
+}
+function resetNtfyBtn(e){
+if(e){e.preventDefault();e.stopPropagation();}
+var xhr=new XMLHttpRequest();
+xhr.open('POST','/ntfy/reset',true);
+xhr.onreadystatechange=function(){
+if(xhr.readyState==4){
+if(xhr.status==200){
+setTimeout(function(){location.reload();},500);
+}else{
+alert(CA_CFG.ntfyErr);
+}
+}
+};
+xhr.send();
+return false;
+}
+function resetWifiBtn(e){
+if(e){e.preventDefault();e.stopPropagation();}
+if(!confirm('WiFi reset? Dit wist credentials en herstart het device.')){return false;}
+var xhr=new XMLHttpRequest();
+xhr.open('POST','/wifi/reset',true);
+xhr.onreadystatechange=function(){
+if(xhr.readyState==4){
+if(xhr.status==200){alert('WiFi reset uitgevoerd. Device herstart.');}
+else{alert('Fout bij WiFi reset');}
+}};
+xhr.send();
+return false;
+}
+window.addEventListener('DOMContentLoaded',function(){
+var numberInputs=document.querySelectorAll('input[type="number"]');
+for(var i=0;i<numberInputs.length;i++){
+numberInputs[i].addEventListener('input',function(e){
+var val=this.value.replace(',','.');
+if(val!==this.value){this.value=val;}});
+numberInputs[i].addEventListener('blur',function(e){
+var val=this.value.replace(',','.');
+if(val!==this.value){this.value=val;}});
+}
+var strategySelect=document.querySelector('select[name="anchorStrategy"]');
+if(strategySelect){
+strategySelect.addEventListener('change',function(){
+var val=parseInt(this.value);
+var tpInput=document.querySelector('input[name="anchorTP"]');
+var mlInput=document.querySelector('input[name="anchorML"]');
+if(val==1){
+if(tpInput)tpInput.value='1.8';
+if(mlInput)mlInput.value='-1.2';
+}else if(val==2){
+if(tpInput)tpInput.value='1.2';
+if(mlInput)mlInput.value='-0.9';
+}
+});
+}
+var headers=document.querySelectorAll('.section-header');
+for(var i=0;i<headers.length;i++){
+headers[i].addEventListener('click',function(e){
+var id=this.getAttribute('data-section');
+toggleSection(id);
+e.preventDefault();
+return false;
+});
+}
+var basic=document.getElementById('icon-basic');
+var anchor=document.getElementById('icon-anchor');
+var anchorBtn=document.getElementById('anchorBtn');
+if(anchorBtn){
+anchorBtn.addEventListener('click',setAnchorBtn);
+}
+var ntfyResetBtn=document.getElementById('ntfyResetBtn');
+if(ntfyResetBtn){
+ntfyResetBtn.addEventListener('click',resetNtfyBtn);
+}
+var wifiResetBtn=document.getElementById('wifiResetBtn');
+if(wifiResetBtn){
+wifiResetBtn.addEventListener('click',resetWifiBtn);
+}
+function applyStatus(d){
+var quote=CA_CFG.quote;
+var el=document.getElementById('curPrice');if(el)el.textContent=(typeof d.priceText==='string'&&d.priceText.length&&d.priceText!=='-')?d.priceText+' '+quote:((d.price>0)?d.price.toFixed(8)+' '+quote:'--');
+el=document.getElementById('trend2h');if(el)el.textContent=d.trend||'--';
+el=document.getElementById('trend1d');if(el)el.textContent=d.trendMedium||'--';
+el=document.getElementById('trend7d');if(el)el.textContent=d.trendLong||'--';
+el=document.getElementById('volatility');if(el)el.textContent=d.volatility||'--';
+el=document.getElementById('regimeStatus');if(el)el.textContent=(d.regime!==undefined&&d.regime!==null)?d.regime:'--';
+el=document.getElementById('volume');if(el)el.textContent=d.volume||'--';
+el=document.getElementById('ret1m');if(el)el.textContent=d.ret1m!=0?d.ret1m.toFixed(2)+'%':'--';
+el=document.getElementById('ret5m');if(el)el.textContent=d.ret5m!=0?d.ret5m.toFixed(2)+'%':'--';
+el=document.getElementById('ret30m');if(el)el.textContent=d.ret30m!=0?d.ret30m.toFixed(2)+'%':'--';
+el=document.getElementById('ret2h');if(el)el.textContent=d.ret2h!=0?d.ret2h.toFixed(2)+'%':'--';
+el=document.getElementById('ret1d');if(el)el.textContent=d.ret1d!=0?d.ret1d.toFixed(2)+'%':'--';
+el=document.getElementById('ret7d');if(el)el.textContent=d.ret7d!=0?d.ret7d.toFixed(2)+'%':'--';
+el=document.getElementById('anchor');if(el)el.textContent=(typeof d.anchorText==='string'&&d.anchorText.length&&d.anchorText!=='-')?d.anchorText+' '+quote:((d.anchor>0)?d.anchor.toFixed(8)+' '+quote:'--');
+el=document.getElementById('anchorDelta');if(el)el.textContent=d.anchorDeltaPct!=0?d.anchorDeltaPct.toFixed(2)+'%':'--';
+el=document.getElementById('apiStateHeader');if(el){
+if(d.apiFresh){el.textContent='';}else{
+var age=(d.apiAgeMs?Math.round(d.apiAgeMs/1000):0);
+el.textContent='STALE '+age+'s';
+}}
+}
+function netLost(){
+var el=document.getElementById('apiStateHeader');if(el)el.textContent='NET?';
+}
+function refreshStatus(){
+fetch('/status').then(function(r){return r.json();}).then(applyStatus).catch(netLost);
+}
+var pollTimer=null;
+function startPolling(){
+if(pollTimer)return;
+refreshStatus();
+pollTimer=setInterval(refreshStatus,2000);
+}
+if(window.EventSource){
+var es=new EventSource('/events');
+es.addEventListener('status',function(e){
+try{applyStatus(JSON.parse(e.data));}catch(x){}
+});
+es.onerror=function(){
+if(es.readyState===2){startPolling();}else{netLost();}
+};
+}else{
+startPolling();
+}
+});
+})();
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Genereer src/WebServer/WebAssets.h uit de statische WebUI-bestanden in deze map.
+
+Elk asset wordt gzip-gecomprimeerd (mtime=0, dus reproduceerbaar) en als PROGMEM-array
+weggeschreven, samen met de ongecomprimeerde variant (fallback voor clients zonder gzip)
+en een sterke ETag per representatie (CRC32 van de bron; gzip-variant met suffix -gz). Na wijziging van app.css/app.js opnieuw draaien:
+
+    python3 src/WebServer/assets/build_web_assets.py
+"""
+
+import gzip
+import os
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OUT = os.path.join(HERE, "..", "WebAssets.h")
+
+# (bestand, URL-pad, content-type, C-identifier)
+ASSETS = [
+    ("app.css", "/assets/app.css", "text/css", "AppCss"),
+    ("app.js", "/assets/app.js", "application/javascript", "AppJs"),
+]
+
+
+def c_bytes(data, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        chunk = data[i:i + per_line]
+        lines.append(indent + ", ".join("0x%02x" % b for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = []
+    out.append("// GEGENEREERD door src/WebServer/assets/build_web_assets.py - niet handmatig wijzigen.")
+    out.append("// Bron: src/WebServer/assets/*.css|*.js")
+    out.append("#ifndef WEB_ASSETS_H")
+    out.append("#define WEB_ASSETS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("struct WebAsset {")
+    out.append("    const char* path;")
+    out.append("    const char* contentType;")
+    out.append("    const uint8_t* gz;")
+    out.append("    size_t gzLen;")
+    out.append("    const uint8_t* raw;")
+    out.append("    size_t rawLen;")
+    out.append("    const char* etag;       // Sterke ETag incl. quotes (identity-body)")
+    out.append("    const char* etagGz;     // Sterke ETag van de gzip-body: andere bytes, dus andere validator")
+    out.append("    const char* version;    // Voor ?v= in URL's (cache-busting na firmware-update)")
+    out.append("};")
+    out.append("")
+    table = []
+    for fname, path, ctype, ident in ASSETS:
+        with open(os.path.join(HERE, fname), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        crc = zlib.crc32(raw) & 0xFFFFFFFF
+        version = "%08x" % crc
+        out.append("// %s: %u -> %u bytes gzip" % (path, len(raw), len(gz)))
+        out.append("static const uint8_t kWebAsset%sGz[] PROGMEM = {" % ident)
+        out.append(c_bytes(gz))
+        out.append("};")
+        out.append("static const uint8_t kWebAsset%sRaw[] PROGMEM = {" % ident)
+        out.append(c_bytes(raw))
+        out.append("};")
+        out.append("")
+        table.append('    {"%s", "%s", kWebAsset%sGz, sizeof(kWebAsset%sGz), kWebAsset%sRaw, sizeof(kWebAsset%sRaw), "\\"%s\\"", "\\"%s-gz\\"", "%s"},'
+                     % (path, ctype, ident, ident, ident, ident, version, version, version))
+    out.append("static const WebAsset kWebAssets[] = {")
+    out.extend(table)
+    out.append("};")
+    out.append("static const size_t kWebAssetCount = sizeof(kWebAssets) / sizeof(kWebAssets[0]);")
+    out.append("")
+    out.append("#endif // WEB_ASSETS_H")
+    with open(OUT, "w", newline="\n") as f:
+        f.write("\n".join(out) + "\n")
+    print("wrote %s" % os.path.normpath(OUT))
+
+
+if __name__ == "__main__":
+    main()
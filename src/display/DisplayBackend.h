@@ -3,6 +3,10 @@
 #include <stdint.h>
 #include <lvgl.h>
 
+// Voltooiing van een asynchrone flush. fromIsr = aangeroepen vanuit de transfer-ISR
+// (alleen ISR-veilige calls, zoals lv_display_flush_ready en xSemaphoreGiveFromISR).
+typedef void (*DisplayFlushDoneCb)(void *ctx, bool fromIsr);
+
 class DisplayBackend {
 public:
     virtual ~DisplayBackend() = default;
@@ -23,6 +27,19 @@ public:
     // LVGL flush callback hook.
     // px_map points to a contiguous array of lv_color_t (RGB565 by config).
     virtual void flush(const lv_area_t *area, const uint8_t *px_map) = 0;
+
+    // Asynchrone flush: start de transfer en return direct; `done` volgt zodra px_map weer
+    // vrij is voor LVGL (transfer klaar, of gekopieerd naar eigen DMA-buffers). Zo rendert LVGL
+    // het volgende gebied in de andere draw buffer terwijl dit gebied nog over de bus gaat.
+    // px_map mag door de backend in-place bewerkt worden (bv. byte-swap).
+    // Default: synchroon via flush() en daarna meteen done.
+    virtual bool supportsAsyncFlush() const { return false; }
+    virtual void flushAsync(const lv_area_t *area, uint8_t *px_map, DisplayFlushDoneCb done, void *ctx) {
+        flush(area, px_map);
+        if (done) {
+            done(ctx, false);
+        }
+    }
 };
 
 // Global backend instance (set during setupDisplay()).
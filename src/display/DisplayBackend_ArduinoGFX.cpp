@@ -1,4 +1,10 @@
+// Platform config voor CRYPTO_ALERT_DISPLAY_ASYNC_FLUSH (zonder PINS includes)
+#define MODULE_INCLUDE
+#include "../../platform_config.h"
+#undef MODULE_INCLUDE
+
 #include "DisplayBackend_ArduinoGFX.h"
+#include "../TaskTopology/TaskTopology.h"
 
 #include <Arduino.h>
 #include <Arduino_GFX_Library.h>
@@ -13,6 +19,19 @@ extern Arduino_GFX *gfx; // from the active PINS_*.h
 #define CRYPTO_ALERT_LVGL_HAS_ESP_CACHE 0
 #endif
 
+// Core 0, weg van API_Task en PriceRepeat (core 1): een bus-write van een volledig frame houdt de
+// 1 Hz sampler anders tientallen ms op. Prio 2 boven UI_Task/Web_Task, zodat een klaargezette flush
+// meteen start en niet in de round-robin met de LVGL-render wacht.
+#ifndef CRYPTO_ALERT_DISPLAY_FLUSH_TASK_CORE
+#define CRYPTO_ALERT_DISPLAY_FLUSH_TASK_CORE 0
+#endif
+#ifndef CRYPTO_ALERT_DISPLAY_FLUSH_TASK_PRIO
+#define CRYPTO_ALERT_DISPLAY_FLUSH_TASK_PRIO 2
+#endif
+#ifndef CRYPTO_ALERT_DISPLAY_FLUSH_TASK_STACK
+#define CRYPTO_ALERT_DISPLAY_FLUSH_TASK_STACK 3072
+#endif
+
 Arduino_GFX *DisplayBackend_ArduinoGFX::gfx_() const {
     return gfx;
 }
@@ -31,9 +50,66 @@ bool DisplayBackend_ArduinoGFX::begin(uint32_t speed) {
     } else {
         ok = g->begin();
     }
+#if CRYPTO_ALERT_DISPLAY_ASYNC_FLUSH
+    if (ok && !startFlushWorker()) {
+        Serial.println("[DisplayBackend] WARN: flush-task niet gestart, synchrone flush");
+    }
+#endif
     return ok;
 }
 
+bool DisplayBackend_ArduinoGFX::startFlushWorker() {
+    if (worker_ != nullptr) {
+        return true;
+    }
+    busMutex_ = xSemaphoreCreateMutex();
+    // Eén job: LVGL heeft hooguit één gebied in flight (wacht op done vóór de volgende flush)
+    jobs_ = xQueueCreate(1, sizeof(FlushJob));
+    if (busMutex_ == nullptr || jobs_ == nullptr) {
+        return false;
+    }
+    if (xTaskCreatePinnedToCore(flushWorkerTask, "Disp_Flush", CRYPTO_ALERT_DISPLAY_FLUSH_TASK_STACK, this,
+                                CRYPTO_ALERT_DISPLAY_FLUSH_TASK_PRIO, &worker_,
+                                CRYPTO_ALERT_DISPLAY_FLUSH_TASK_CORE) != pdPASS) {
+        worker_ = nullptr;
+        return false;
+    }
+    Serial.printf("[DisplayBackend] Async flush-task op core %d\n", (int)CRYPTO_ALERT_DISPLAY_FLUSH_TASK_CORE);
+    // Eigen arg (this), dus niet via taskTopologyStart(); wel in CPU/stack-accounting en diag/tasks
+    const TaskSpec spec = {"Disp_Flush", flushWorkerTask, CRYPTO_ALERT_DISPLAY_FLUSH_TASK_STACK,
+                           CRYPTO_ALERT_DISPLAY_FLUSH_TASK_PRIO, CRYPTO_ALERT_DISPLAY_FLUSH_TASK_CORE, 0, nullptr};
+    taskTopologyRegister(spec, worker_);
+    return true;
+}
+
+void DisplayBackend_ArduinoGFX::flushWorkerTask(void *arg) {
+    DisplayBackend_ArduinoGFX *self = static_cast<DisplayBackend_ArduinoGFX *>(arg);
+    FlushJob job;
+    for (;;) {
+        if (xQueueReceive(self->jobs_, &job, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        self->lockBus();
+        self->drawArea(&job.area, job.px_map);
+        self->unlockBus();
+        if (job.done) {
+            job.done(job.ctx, false);
+        }
+    }
+}
+
+void DisplayBackend_ArduinoGFX::lockBus() {
+    if (busMutex_ != nullptr) {
+        xSemaphoreTake(busMutex_, portMAX_DELAY);
+    }
+}
+
+void DisplayBackend_ArduinoGFX::unlockBus() {
+    if (busMutex_ != nullptr) {
+        xSemaphoreGive(busMutex_);
+    }
+}
+
 uint32_t DisplayBackend_ArduinoGFX::width() const {
     return gfx ? gfx->width() : 0;
 }
@@ -44,24 +120,57 @@ uint32_t DisplayBackend_ArduinoGFX::height() const {
 
 void DisplayBackend_ArduinoGFX::setRotation(uint8_t rotation_deg_compatible) {
     if (!gfx) return;
+    lockBus();
     gfx->setRotation(rotation_deg_compatible);
+    unlockBus();
 }
 
 void DisplayBackend_ArduinoGFX::invertDisplay(bool invert) {
     if (!gfx) return;
+    lockBus();
     gfx->invertDisplay(invert);
+    unlockBus();
 }
 
 void DisplayBackend_ArduinoGFX::fillScreen(uint16_t rgb565_color) {
     if (!gfx) return;
+    lockBus();
     gfx->fillScreen(rgb565_color);
+    unlockBus();
 }
 
 void DisplayBackend_ArduinoGFX::flush(const lv_area_t *area, const uint8_t *px_map) {
     if (!gfx || !area || !px_map) {
         return;
     }
+    lockBus();
+    drawArea(area, px_map);
+    unlockBus();
+}
+
+void DisplayBackend_ArduinoGFX::flushAsync(const lv_area_t *area, uint8_t *px_map, DisplayFlushDoneCb done, void *ctx) {
+    if (!gfx || !area || !px_map || jobs_ == nullptr) {
+        DisplayBackend::flushAsync(area, px_map, done, ctx);
+        return;
+    }
+    FlushJob job;
+    job.area = *area;
+    job.px_map = px_map;
+    job.done = done;
+    job.ctx = ctx;
+    // LVGL wacht op done vóór de volgende flush, dus de queue is hier altijd leeg. Vol = de worker heeft
+    // een job niet afgemeld: niet synchroon ertussendoor tekenen (zou vóór het nog wachtende oudere
+    // gebied landen), maar dit gebied overslaan en async uitzetten.
+    if (xQueueSend(jobs_, &job, 0) != pdTRUE) {
+        Serial.println("[DisplayBackend] ERROR: flush-queue vol (job niet afgemeld), async flush uit");
+        asyncFailed_ = true;
+        if (done) {
+            done(ctx, false);
+        }
+    }
+}
 
+void DisplayBackend_ArduinoGFX::drawArea(const lv_area_t *area, const uint8_t *px_map) {
     const uint32_t w = lv_area_get_width(area);
     const uint32_t h = lv_area_get_height(area);
     const size_t lenBytes = (size_t)w * (size_t)h * sizeof(uint16_t);
@@ -82,7 +191,7 @@ void DisplayBackend_ArduinoGFX::flush(const lv_area_t *area, const uint8_t *px_m
     }
 #endif
 #endif
+    (void)lenBytes;
 
     gfx->draw16bitRGBBitmap(area->x1, area->y1, (const uint16_t *)px_map, w, h);
 }
-
@@ -2,6 +2,11 @@
 
 #include "DisplayBackend.h"
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
 // Forward declaration to keep this header independent from Arduino_GFX includes.
 class Arduino_GFX;
 
@@ -21,7 +26,30 @@ public:
 
     void flush(const lv_area_t *area, const uint8_t *px_map) override;
 
+    // Arduino_GFX-bussen zijn blokkerend: de transfer loopt in een eigen flush-task op de
+    // andere core, zodat de UI-task intussen het volgende gebied rendert.
+    bool supportsAsyncFlush() const override { return worker_ != nullptr && !asyncFailed_; }
+    void flushAsync(const lv_area_t *area, uint8_t *px_map, DisplayFlushDoneCb done, void *ctx) override;
+
 private:
+    struct FlushJob {
+        lv_area_t area;
+        const uint8_t *px_map;
+        DisplayFlushDoneCb done;
+        void *ctx;
+    };
+
+    static void flushWorkerTask(void *arg);
+    bool startFlushWorker();
+    void drawArea(const lv_area_t *area, const uint8_t *px_map);
+    void lockBus();
+    void unlockBus();
+
+    QueueHandle_t jobs_ = nullptr;
+    SemaphoreHandle_t busMutex_ = nullptr;  // gfx-calls uit worker en andere tasks serialiseren
+    TaskHandle_t worker_ = nullptr;
+    volatile bool asyncFailed_ = false;     // Job bleef hangen: verder alleen synchrone flush()
+
     // Provided by PINS_*.h (platform_config.h includes the relevant PINS file).
     // We keep the dependency here so the rest of the app doesn't reference gfx directly.
     Arduino_GFX *gfx_() const;
@@ -8,6 +8,7 @@
 #endif
 
 #include "DisplayBackend_Axs15231bEspLcd.h"
+#include "Rgb565Copy.h"
 
 #include <Arduino.h>
 #include <stddef.h>
@@ -23,11 +24,10 @@
 #include "freertos/semphr.h"
 #include "driver/gpio.h"
 #include "esp_attr.h"
-#if __has_include(<esp_cache.h>)
-#include <esp_cache.h>
-#define CRYPTO_ALERT_AXS15231B_HAS_ESP_CACHE 1
+#if __has_include("esp_memory_utils.h")
+#include "esp_memory_utils.h"
 #else
-#define CRYPTO_ALERT_AXS15231B_HAS_ESP_CACHE 0
+#include "soc/soc_memory_types.h"
 #endif
 
 #if defined(PLATFORM_ESP32S3_JC3248W535)
@@ -143,7 +143,18 @@ static void IRAM_ATTR axs15231b_te_gpio_isr(void *arg) {
 
 bool DisplayBackend_Axs15231bEspLcd::onColorTransDone(esp_lcd_panel_io_handle_t, esp_lcd_panel_io_event_data_t *, void *user_ctx) {
     DisplayBackend_Axs15231bEspLcd *self = static_cast<DisplayBackend_Axs15231bEspLcd *>(user_ctx);
-    if (!self || !self->trans_done_sem_) {
+    if (!self) {
+        return false;
+    }
+    // Directe async transfer: LVGL-buffer is vrij zodra de laatste chunk de bus af is
+    const DisplayFlushDoneCb cb = self->async_done_cb_;
+    if (cb != nullptr) {
+        void *ctx = self->async_done_ctx_;
+        self->async_done_cb_ = nullptr;
+        cb(ctx, true);
+        return false;
+    }
+    if (!self->trans_done_sem_) {
         return false;
     }
     BaseType_t high_task_wakeup = pdFALSE;
@@ -292,7 +303,7 @@ bool DisplayBackend_Axs15231bEspLcd::begin(uint32_t /*speed*/) {
 
     // DMA transport buffers for striped panel transfers.
     // Keep LVGL framebuffer in SPIRAM, but copy stripes into DMA-capable internal RAM.
-    trans_done_sem_ = xSemaphoreCreateBinary();
+    trans_done_sem_ = xSemaphoreCreateCounting(2, 0);
     if (!trans_done_sem_) {
         Serial.println("[AXS15231B] ERROR: failed to create trans_done semaphore");
         return false;
@@ -399,10 +410,17 @@ void DisplayBackend_Axs15231bEspLcd::fillScreen(uint16_t rgb565_color) {
         fill_buf_[i] = rgb565_color;
     }
 
+    (void)waitDirectIdle();
+    (void)drainTransfers();
 #if defined(PLATFORM_ESP32S3_JC3248W535) && CRYPTO_ALERT_AXS15231B_USE_TE_SYNC
     teSyncWaitBeforeDraw("fillScreen");
 #endif
-    (void)esp_lcd_panel_draw_bitmap(panel_, 0, 0, (int)AXS15231B_LCD_W, (int)AXS15231B_LCD_H, fill_buf_);
+    if (esp_lcd_panel_draw_bitmap(panel_, 0, 0, (int)AXS15231B_LCD_W, (int)AXS15231B_LCD_H, fill_buf_) == ESP_OK &&
+        trans_done_sem_ != nullptr) {
+        // Completion ophalen zodat er geen losse give achterblijft voor de stripe-pipeline
+        trans_inflight_++;
+        (void)drainTransfers();
+    }
 }
 
 void DisplayBackend_Axs15231bEspLcd::flush(const lv_area_t *area, const uint8_t *px_map) {
@@ -421,7 +439,86 @@ void DisplayBackend_Axs15231bEspLcd::flush(const lv_area_t *area, const uint8_t
         Serial.println("[AXS15231B] ERROR: transport buffers not ready; flush aborted");
         return;
     }
+    (void)waitDirectIdle();
+    (void)flushStriped(area, px_map, true);
+#endif
+}
+
+void DisplayBackend_Axs15231bEspLcd::flushAsync(const lv_area_t *area, uint8_t *px_map, DisplayFlushDoneCb done, void *ctx) {
+#if CRYPTO_ALERT_AXS15231B_SELFTEST
+    flush(area, px_map);
+    if (done) {
+        done(ctx, false);
+    }
+#else
+    if (!panel_ || !area || !px_map || !transport_ready_ || !trans_done_sem_) {
+        DisplayBackend::flushAsync(area, px_map, done, ctx);
+        return;
+    }
+    (void)waitDirectIdle();
+
+    if (!esp_ptr_dma_capable(px_map) || done == nullptr) {
+        // PSRAM-buffer: stripes kopiëren; LVGL mag verder zodra alles in de transportbuffers staat
+        (void)flushStriped(area, px_map, false);
+        if (done) {
+            done(ctx, false);
+        }
+        return;
+    }
+
+    // Direct uit de (interne, DMA-capabele) LVGL-buffer: geen kopie, CPU vrij tijdens de transfer
+    if (!drainTransfers()) {
+        DisplayBackend::flushAsync(area, px_map, done, ctx);
+        return;
+    }
+    const int x_end = area->x2 + 1;
+    const int y_end = area->y2 + 1;
+#if CRYPTO_ALERT_AXS15231B_SWAP_RGB565_BYTES
+    // Buffer wordt door LVGL toch opnieuw gerenderd: swap in-place i.p.v. via transportbuffer
+    rgb565CopySwap((uint16_t *)px_map, (const uint16_t *)px_map, (size_t)lv_area_get_width(area) * (size_t)lv_area_get_height(area));
+#endif
+#if defined(PLATFORM_ESP32S3_JC3248W535) && CRYPTO_ALERT_AXS15231B_USE_TE_SYNC
+    teSyncWaitBeforeDraw("flush");
+#endif
+    async_done_ctx_ = ctx;
+    async_done_cb_ = done;
+    const esp_err_t err = esp_lcd_panel_draw_bitmap(panel_, area->x1, area->y1, x_end, y_end, px_map);
+    if (err != ESP_OK) {
+        async_done_cb_ = nullptr;
+        Serial.printf("[AXS15231B] ERROR: async draw_bitmap failed, err=%d\n", (int)err);
+        done(ctx, false);
+    }
+#endif
+}
 
+// Wacht tot een directe async transfer klaar is (ISR wist async_done_cb_)
+bool DisplayBackend_Axs15231bEspLcd::waitDirectIdle() {
+    const uint32_t t0 = millis();
+    while (async_done_cb_ != nullptr) {
+        if ((millis() - t0) > 500u) {
+            Serial.println("[AXS15231B] ERROR: timeout waiting async transfer completion");
+            async_done_cb_ = nullptr;
+            return false;
+        }
+        vTaskDelay(1);
+    }
+    return true;
+}
+
+// Haal completions op van stripes die nog op de bus staan
+bool DisplayBackend_Axs15231bEspLcd::drainTransfers() {
+    while (trans_inflight_ > 0) {
+        if (xSemaphoreTake(trans_done_sem_, pdMS_TO_TICKS(500)) != pdTRUE) {
+            Serial.printf("[AXS15231B] ERROR: timeout draining %u transfer(s)\n", (unsigned)trans_inflight_);
+            trans_inflight_ = 0;
+            return false;
+        }
+        trans_inflight_--;
+    }
+    return true;
+}
+
+bool DisplayBackend_Axs15231bEspLcd::flushStriped(const lv_area_t *area, const uint8_t *px_map, bool drain) {
     static bool s_loggedFirstBackendFlush = false;
     if (!s_loggedFirstBackendFlush) {
         Serial.printf("[AXS15231B] First backend flush: area=(%d,%d)-(%d,%d)\n",
@@ -435,22 +532,12 @@ void DisplayBackend_Axs15231bEspLcd::flush(const lv_area_t *area, const uint8_t
     const int y_end = area->y2 + 1;
     const uint32_t w = (uint32_t)(x_end - x1);
     const uint32_t h = (uint32_t)(y_end - y1);
-    const size_t lenBytes = (size_t)w * (size_t)h * sizeof(uint16_t);
-
-#if CRYPTO_ALERT_AXS15231B_HAS_ESP_CACHE
-#if defined(CONFIG_IDF_TARGET_ESP32S3) || defined(ARDUINO_ESP32S3_DEV)
-    if (lenBytes > 0 && esp_ptr_external_ram(px_map)) {
-        int msync_flags = ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_TYPE_DATA;
-#if defined(ESP_CACHE_MSYNC_FLAG_UNALIGNED)
-        msync_flags |= ESP_CACHE_MSYNC_FLAG_UNALIGNED;
-#endif
-        (void)esp_cache_msync((void *)px_map, lenBytes, msync_flags);
-    }
-#endif
-#endif
+    // Geen esp_cache_msync nodig: de CPU kopieert de stripes (via cache) naar interne DMA-buffers;
+    // DMA leest nooit direct uit de PSRAM-framebuffer.
 
     const uint32_t stripeLines = trans_buf_lines_ > 0 ? (uint32_t)trans_buf_lines_ : 1u;
     const uint32_t stripeCount = (h + stripeLines - 1u) / stripeLines;
+    const uint8_t bufCount = use_double_trans_buf_ ? 2 : 1;
     if (!s_loggedFirstBackendFlush) {
         const uint32_t firstStripeY1 = (uint32_t)y1;
         const uint32_t firstStripeY2 = firstStripeY1 + ((h > stripeLines) ? stripeLines : h) - 1u;
@@ -463,6 +550,8 @@ void DisplayBackend_Axs15231bEspLcd::flush(const lv_area_t *area, const uint8_t
     teSyncWaitBeforeDraw("flush");
 #endif
 
+    // Pipeline: stripe N+1 wordt gekopieerd terwijl stripe N op de bus staat; alleen wachten
+    // als de volgende transportbuffer nog in gebruik is.
     const uint8_t *src = px_map;
     for (uint32_t stripeIdx = 0; stripeIdx < stripeCount; stripeIdx++) {
         const uint32_t stripeYOff = stripeIdx * stripeLines;
@@ -470,20 +559,26 @@ void DisplayBackend_Axs15231bEspLcd::flush(const lv_area_t *area, const uint8_t
         const size_t stripeBytes = (size_t)w * (size_t)curLines * sizeof(uint16_t);
         const uint8_t *stripeSrc = src + ((size_t)stripeYOff * (size_t)w * sizeof(uint16_t));
 
+        if (trans_inflight_ >= bufCount) {
+            if (xSemaphoreTake(trans_done_sem_, pdMS_TO_TICKS(500)) != pdTRUE) {
+                Serial.printf("[AXS15231B] ERROR: timeout waiting transfer completion on stripe %u/%u\n",
+                              (unsigned)(stripeIdx + 1u), (unsigned)stripeCount);
+                trans_inflight_ = 0;
+                return false;
+            }
+            trans_inflight_--;
+        }
+
         uint16_t *dst = trans_buf_1_;
         if (use_double_trans_buf_) {
             dst = (trans_buf_toggle_ == 0) ? trans_buf_1_ : trans_buf_2_;
             trans_buf_toggle_ ^= 1;
         }
-        memcpy(dst, stripeSrc, stripeBytes);
-
 #if CRYPTO_ALERT_AXS15231B_SWAP_RGB565_BYTES
-        uint16_t *pix = dst;
-        const size_t pixCount = stripeBytes / sizeof(uint16_t);
-        for (size_t i = 0; i < pixCount; ++i) {
-            const uint16_t v = pix[i];
-            pix[i] = (uint16_t)((v << 8) | (v >> 8));
-        }
+        // Kopie en swap in één pass (bron wordt één keer gelezen)
+        rgb565CopySwap(dst, (const uint16_t *)stripeSrc, stripeBytes / sizeof(uint16_t));
+#else
+        memcpy(dst, stripeSrc, stripeBytes);
 #endif
 
         const int stripeY1 = y1 + (int)stripeYOff;
@@ -492,21 +587,18 @@ void DisplayBackend_Axs15231bEspLcd::flush(const lv_area_t *area, const uint8_t
         if (err != ESP_OK) {
             Serial.printf("[AXS15231B] ERROR: draw_bitmap failed on stripe %u/%u, err=%d\n",
                           (unsigned)(stripeIdx + 1u), (unsigned)stripeCount, (int)err);
-            return;
-        }
-
-        if (xSemaphoreTake(trans_done_sem_, pdMS_TO_TICKS(500)) != pdTRUE) {
-            Serial.printf("[AXS15231B] ERROR: timeout waiting transfer completion on stripe %u/%u\n",
-                          (unsigned)(stripeIdx + 1u), (unsigned)stripeCount);
-            return;
+            (void)drainTransfers();
+            return false;
         }
+        trans_inflight_++;
     }
 
+    const bool ok = drain ? drainTransfers() : true;
     if (!s_loggedFirstBackendFlush) {
         Serial.println("[AXS15231B] First backend flush: draw_bitmap done");
         s_loggedFirstBackendFlush = true;
     }
-#endif
+    return ok;
 }
 
 #if defined(PLATFORM_ESP32S3_JC3248W535) && CRYPTO_ALERT_AXS15231B_USE_TE_SYNC
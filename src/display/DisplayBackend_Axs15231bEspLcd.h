@@ -26,6 +26,11 @@ public:
 
     void flush(const lv_area_t *area, const uint8_t *px_map) override;
 
+    // DMA-capabele draw buffer: direct naar het panel, done vanuit de transfer-ISR.
+    // Anders (PSRAM): stripes via de transportbuffers, done zodra de laatste stripe gekopieerd is.
+    bool supportsAsyncFlush() const override { return transport_ready_; }
+    void flushAsync(const lv_area_t *area, uint8_t *px_map, DisplayFlushDoneCb done, void *ctx) override;
+
 private:
     static bool onColorTransDone(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx);
 
@@ -44,9 +49,18 @@ private:
     uint16_t trans_buf_lines_ = 0;
     bool use_double_trans_buf_ = false;
     uint8_t trans_buf_toggle_ = 0;
-    SemaphoreHandle_t trans_done_sem_ = nullptr;
+    SemaphoreHandle_t trans_done_sem_ = nullptr;  // Counting: één give per voltooide stripe
+    uint8_t trans_inflight_ = 0;                    // Stripes op de bus zonder opgehaalde completion
     bool transport_ready_ = false;
 
+    // Directe (async) transfer in flight: ISR roept deze callback i.p.v. trans_done_sem_
+    volatile DisplayFlushDoneCb async_done_cb_ = nullptr;
+    void *volatile async_done_ctx_ = nullptr;
+
+    bool flushStriped(const lv_area_t *area, const uint8_t *px_map, bool drain);
+    bool drainTransfers();
+    bool waitDirectIdle();
+
 #if defined(PLATFORM_ESP32S3_JC3248W535) && CRYPTO_ALERT_AXS15231B_USE_TE_SYNC
     // TE (tearing effect) sync: GPIO-ISR geeft semaphore op TE-flank; vóór draw wachten op volgende edge
     // (vergelijkbaar met vendor draw_wait_cb / bsp_display_sync_cb, zonder volledige BSP).
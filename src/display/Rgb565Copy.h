@@ -0,0 +1,66 @@
+#ifndef RGB565_COPY_H
+#define RGB565_COPY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// RGB565 kopie + byte-swap (little-endian LVGL -> big-endian panel) in één pass.
+// dst == src (in-place) is toegestaan; andere overlap niet.
+
+// Referentie: één pixel per iteratie (ook fallback bij ongelijke uitlijning)
+static inline void rgb565CopySwapRef(uint16_t *dst, const uint16_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const uint16_t v = src[i];
+        dst[i] = (uint16_t)((v << 8) | (v >> 8));
+    }
+}
+
+// Twee pixels tegelijk in een 32-bit woord
+static inline uint32_t rgb565Swap2(uint32_t v) {
+    return ((v & 0x00FF00FFu) << 8) | ((v >> 8) & 0x00FF00FFu);
+}
+
+// Snel pad: 32-bit loads/stores, 8 pixels per iteratie. Bit-exact gelijk aan rgb565CopySwapRef.
+static inline void rgb565CopySwap(uint16_t *dst, const uint16_t *src, size_t count) {
+    if ((((uintptr_t)dst ^ (uintptr_t)src) & 3u) != 0) {
+        rgb565CopySwapRef(dst, src, count);
+        return;
+    }
+    if ((((uintptr_t)src) & 3u) != 0 && count > 0) {
+        rgb565CopySwapRef(dst, src, 1);
+        ++dst;
+        ++src;
+        --count;
+    }
+
+    uint8_t *d = (uint8_t *)dst;
+    const uint8_t *s = (const uint8_t *)src;
+    size_t words = count / 2;
+    while (words >= 4) {
+        uint32_t w[4];
+        memcpy(w, s, sizeof(w));
+        w[0] = rgb565Swap2(w[0]);
+        w[1] = rgb565Swap2(w[1]);
+        w[2] = rgb565Swap2(w[2]);
+        w[3] = rgb565Swap2(w[3]);
+        memcpy(d, w, sizeof(w));
+        s += sizeof(w);
+        d += sizeof(w);
+        words -= 4;
+    }
+    while (words > 0) {
+        uint32_t w;
+        memcpy(&w, s, sizeof(w));
+        w = rgb565Swap2(w);
+        memcpy(d, &w, sizeof(w));
+        s += sizeof(w);
+        d += sizeof(w);
+        --words;
+    }
+    if ((count & 1u) != 0) {
+        rgb565CopySwapRef((uint16_t *)d, (const uint16_t *)s, 1);
+    }
+}
+
+#endif